@@ -53,6 +53,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_blob_pool ie_blob_pool_t;
 
 /**
  * @struct ie_version
@@ -1021,4 +1022,59 @@ INFERENCE_ENGINE_C_API(void) ie_blob_free(ie_blob_t **blob);
 
 /** @} */ // end of Blob
 
+// BlobPool
+
+/**
+ * @defgroup BlobPool BlobPool
+ * Set of functions dedicated to recycling of blob memory between inferences.
+ * A pool keeps released buffers on per-(byte size, precision) free-lists with
+ * lock-free pop, which removes per-call allocation overhead from high-rate
+ * integrations that create short-lived blobs on every request.
+ * @{
+ */
+
+/**
+ * @brief Creates a blob pool. Use the ie_blob_pool_free() method to free memory.
+ * @ingroup BlobPool
+ * @param capacity Maximum number of released buffers kept per (byte size, precision) free-list.
+ * Buffers released when the free-list is full are deallocated instead of being retained.
+ * @param pool A pointer to the newly created pool.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_pool_create(size_t capacity, ie_blob_pool_t **pool);
+
+/**
+ * @brief Creates a blob with the specified dimensions, layout and precision reusing a recycled
+ * buffer from the pool when one of a matching byte size and precision is available, otherwise
+ * allocating a new aligned buffer. The call is safe to use from several threads at once.
+ * Return the blob with the ie_blob_pool_release() method instead of ie_blob_deallocate().
+ * @ingroup BlobPool
+ * @param pool A pointer to the pool to take the buffer from.
+ * @param tensorDesc Tensor descriptor for Blob creation.
+ * @param blob A pointer to the newly created blob.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_pool_make_memory(ie_blob_pool_t *pool, const tensor_desc_t *tensorDesc, ie_blob_t **blob);
+
+/**
+ * @brief Releases a blob created by ie_blob_pool_make_memory() and returns its buffer to the
+ * pool's free-list so that a subsequent ie_blob_pool_make_memory() call can reuse it. The blob
+ * handle becomes invalid. Do not pass blobs created outside of the pool.
+ * @ingroup BlobPool
+ * @param pool A pointer to the pool the blob was taken from.
+ * @param blob A pointer to the blob to release.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_pool_release(ie_blob_pool_t *pool, ie_blob_t **blob);
+
+/**
+ * @brief Releases memory occupied by the pool and all the buffers it has retained.
+ * Blobs taken from the pool must be released before the pool is freed.
+ * @ingroup BlobPool
+ * @param pool A pointer to the pool to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_blob_pool_free(ie_blob_pool_t **pool);
+
+/** @} */ // end of BlobPool
+
 #endif  // IE_C_API_H
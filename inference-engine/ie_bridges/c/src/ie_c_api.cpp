@@ -14,6 +14,12 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstdlib>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "details/ie_exception.hpp"
@@ -62,6 +68,53 @@ struct ie_network {
     IE::CNNNetwork object;
 };
 
+/**
+ * @struct ie_blob_pool
+ * @brief This struct recycles aligned blob buffers on per-(byte size, precision) free-lists.
+ * Each free-list is a fixed array of atomic slots: taking a buffer is a lock-free exchange,
+ * returning one is a lock-free compare-and-swap, and the mutex only guards creation of a
+ * free-list the first time a new (byte size, precision) combination is requested.
+ */
+struct ie_blob_pool {
+    typedef std::vector<std::atomic<void *>> free_list;
+
+    size_t capacity;
+    std::mutex buckets_mutex;
+    std::map<std::pair<size_t, IE::Precision>, std::unique_ptr<free_list>> buckets;
+};
+
+static void *blob_pool_aligned_alloc(size_t byte_size) {
+#ifdef _WIN32
+    return _aligned_malloc(byte_size, 64);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, 64, byte_size) != 0) {
+        ptr = nullptr;
+    }
+    return ptr;
+#endif
+}
+
+static void blob_pool_aligned_free(void *ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static ie_blob_pool::free_list *blob_pool_get_free_list(ie_blob_pool_t *pool, size_t byte_size, IE::Precision prec) {
+    std::lock_guard<std::mutex> lock(pool->buckets_mutex);
+    std::unique_ptr<ie_blob_pool::free_list> &bucket = pool->buckets[std::make_pair(byte_size, prec)];
+    if (!bucket) {
+        bucket.reset(new ie_blob_pool::free_list(pool->capacity));
+        for (auto &slot : *bucket) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    return bucket.get();
+}
+
 std::map<IE::StatusCode, IEStatusCode> status_map = {{IE::StatusCode::GENERAL_ERROR, IEStatusCode::GENERAL_ERROR},
                                                         {IE::StatusCode::INFER_NOT_STARTED, IEStatusCode::INFER_NOT_STARTED},
                                                         {IE::StatusCode::NETWORK_NOT_LOADED,  IEStatusCode::NETWORK_NOT_LOADED},
@@ -1692,3 +1745,156 @@ void ie_blob_free(ie_blob_t **blob) {
         *blob = NULL;
     }
 }
+
+IEStatusCode ie_blob_pool_create(size_t capacity, ie_blob_pool_t **pool) {
+    if (capacity == 0 || pool == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_blob_pool_t> _pool(new ie_blob_pool_t);
+        _pool->capacity = capacity;
+        *pool = _pool.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_blob_pool_make_memory(ie_blob_pool_t *pool, const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
+    if (pool == nullptr || tensorDesc == nullptr || blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IE::Precision prec;
+    for (auto it : precision_map) {
+        if (it.second == tensorDesc->precision) {
+            prec = it.first;
+            break;
+        }
+    }
+
+    IE::Layout l = IE::Layout::NCHW;
+    for (auto it : layout_map) {
+        if (it.second == tensorDesc->layout) {
+            l = it.first;
+            break;
+        }
+    }
+
+    IE::SizeVector dims_vector;
+    size_t size = 1;
+    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
+        dims_vector.push_back(tensorDesc->dims.dims[i]);
+        size *= tensorDesc->dims.dims[i];
+    }
+    void *ptr = nullptr;
+    try {
+        // Precision::size() throws for precisions without a defined bit width
+        // (UNSPECIFIED, MIXED), so it must stay inside the try block
+        size_t byte_size = size * prec.size();
+
+        // lock-free pop: the first non-empty slot of the matching free-list is taken over
+        // with an atomic exchange, so concurrent callers never take the same buffer
+        ie_blob_pool::free_list *free_list = blob_pool_get_free_list(pool, byte_size, prec);
+        for (auto &slot : *free_list) {
+            ptr = slot.exchange(nullptr, std::memory_order_acquire);
+            if (ptr) {
+                break;
+            }
+        }
+        if (ptr == nullptr) {
+            ptr = blob_pool_aligned_alloc(byte_size);
+        }
+        if (ptr == nullptr) {
+            return IEStatusCode::NOT_ALLOCATED;
+        }
+
+        IE::TensorDesc tensor(prec, dims_vector, l);
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        if (prec == IE::Precision::U8) {
+            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::U16) {
+            uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
+            int8_t *p = reinterpret_cast<int8_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+            int16_t *p = reinterpret_cast<int16_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I32) {
+            int32_t *p = reinterpret_cast<int32_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::I64) {
+            int64_t *p = reinterpret_cast<int64_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::U64) {
+            uint64_t *p = reinterpret_cast<uint64_t *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else if (prec == IE::Precision::FP32) {
+            float *p = reinterpret_cast<float *>(ptr);
+            _blob->object = IE::make_shared_blob(tensor, p, size);
+        } else {
+            blob_pool_aligned_free(ptr);
+            return IEStatusCode::PARAMETER_MISMATCH;
+        }
+        *blob = _blob.release();
+    } catch (const IE::details::InferenceEngineException& e) {
+        blob_pool_aligned_free(ptr);
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        blob_pool_aligned_free(ptr);
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_blob_pool_release(ie_blob_pool_t *pool, ie_blob_t **blob) {
+    if (pool == nullptr || blob == nullptr || *blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        IE::Precision prec = (*blob)->object->getTensorDesc().getPrecision();
+        size_t byte_size = (*blob)->object->byteSize();
+        void *ptr = (*blob)->object->buffer();
+        delete *blob;
+        *blob = NULL;
+
+        // lock-free push: the buffer goes into the first empty slot of the matching
+        // free-list; if every slot is occupied, the buffer is given back to the system
+        ie_blob_pool::free_list *free_list = blob_pool_get_free_list(pool, byte_size, prec);
+        for (auto &slot : *free_list) {
+            void *expected = nullptr;
+            if (slot.compare_exchange_strong(expected, ptr, std::memory_order_release)) {
+                return IEStatusCode::OK;
+            }
+        }
+        blob_pool_aligned_free(ptr);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_blob_pool_free(ie_blob_pool_t **pool) {
+    if (pool && *pool) {
+        for (auto &bucket : (*pool)->buckets) {
+            for (auto &slot : *bucket.second) {
+                void *ptr = slot.exchange(nullptr, std::memory_order_acquire);
+                if (ptr) {
+                    blob_pool_aligned_free(ptr);
+                }
+            }
+        }
+        delete *pool;
+        *pool = NULL;
+    }
+}
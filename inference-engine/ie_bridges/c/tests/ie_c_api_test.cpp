@@ -1448,6 +1448,68 @@ TEST(ie_blob_get_cbuffer, getBuffer) {
     ie_blob_deallocate(&blob);
 }
 
+TEST(ie_blob_pool_make_memory, makeMemory) {
+
+    dimensions_t dim_t;
+    dim_t.ranks = 4 ;
+    dim_t.dims[0] = 1, dim_t.dims[1] = 3, dim_t.dims[2] = 4, dim_t.dims[3] = 4;
+    tensor_desc tensor;
+    tensor.dims = dim_t ;
+    tensor.precision = precision_e::U8;
+    tensor.layout = layout_e::NCHW;
+
+    ie_blob_pool_t *pool = nullptr;
+    IE_EXPECT_OK(ie_blob_pool_create(4, &pool));
+    EXPECT_NE(nullptr, pool);
+
+    ie_blob_t *blob = nullptr;
+    IE_EXPECT_OK(ie_blob_pool_make_memory(pool, &tensor, &blob));
+    EXPECT_NE(nullptr, blob);
+
+    ie_blob_buffer_t blob_buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &blob_buffer));
+    EXPECT_NE(nullptr, blob_buffer.buffer);
+
+    IE_EXPECT_OK(ie_blob_pool_release(pool, &blob));
+    EXPECT_EQ(nullptr, blob);
+
+    ie_blob_pool_free(&pool);
+    EXPECT_EQ(nullptr, pool);
+}
+
+TEST(ie_blob_pool_make_memory, recyclesReleasedBuffer) {
+
+    dimensions_t dim_t;
+    dim_t.ranks = 4 ;
+    dim_t.dims[0] = 1, dim_t.dims[1] = 3, dim_t.dims[2] = 4, dim_t.dims[3] = 4;
+    tensor_desc tensor;
+    tensor.dims = dim_t ;
+    tensor.precision = precision_e::FP32;
+    tensor.layout = layout_e::NCHW;
+
+    ie_blob_pool_t *pool = nullptr;
+    IE_EXPECT_OK(ie_blob_pool_create(4, &pool));
+    EXPECT_NE(nullptr, pool);
+
+    ie_blob_t *blob = nullptr;
+    IE_EXPECT_OK(ie_blob_pool_make_memory(pool, &tensor, &blob));
+    EXPECT_NE(nullptr, blob);
+
+    ie_blob_buffer_t first_buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &first_buffer));
+    IE_EXPECT_OK(ie_blob_pool_release(pool, &blob));
+
+    IE_EXPECT_OK(ie_blob_pool_make_memory(pool, &tensor, &blob));
+    EXPECT_NE(nullptr, blob);
+
+    ie_blob_buffer_t second_buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &second_buffer));
+    EXPECT_EQ(first_buffer.buffer, second_buffer.buffer);
+
+    IE_EXPECT_OK(ie_blob_pool_release(pool, &blob));
+    ie_blob_pool_free(&pool);
+}
+
 TEST(ie_infer_set_completion_callback, setCallback) {
     ie_core_t *core = nullptr;
     IE_ASSERT_OK(ie_core_create("", &core));
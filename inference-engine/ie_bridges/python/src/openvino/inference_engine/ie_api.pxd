@@ -22,7 +22,7 @@ cdef class BlobBuffer:
     cdef char*_get_blob_format(self, const CTensorDesc & desc)
 
     cdef public:
-        total_stride, item_size
+        total_stride, item_size, lifetime_anchor
 
 cdef class InferRequest:
     cdef C.InferRequestWrap *impl
@@ -1050,6 +1050,26 @@ cdef class InferRequest:
             output_blobs[output] = deepcopy(blob)
         return output_blobs
 
+    ## Dictionary that maps output layer names to zero-copy numpy views over the output Blob memory
+    #
+    #  Unlike `output_blobs`, no data is copied: the arrays are buffer-protocol views into the
+    #  memory the request writes its results to, and they keep the request alive for as long as
+    #  they exist. The content changes in place with the next inference of this request, so a
+    #  view must be consumed (or explicitly copied) before the request is started again.
+    #
+    #  Usage example:\n
+    #  ```python
+    #  request = exec_net.requests[0]
+    #  request.infer({'data': image})
+    #  res = request.output_views['prob']
+    #  ```
+    @property
+    def output_views(self):
+        views = {}
+        for output in self._outputs_list:
+            views[output] = self._get_blob_buffer(output.encode()).to_numpy_view(self)
+        return views
+
     ## Sets user defined Blob for the infer request
     #  @param blob_name: A name of input blob
     #  @param blob: Blob object to set for the infer request
@@ -1874,3 +1894,12 @@ cdef class BlobBuffer:
 
     def to_numpy(self):
         return np.asarray(self)
+
+    ## Zero-copy numpy view over the blob memory. The returned array is a buffer-protocol view:
+    #  it holds a reference to this buffer and, through the shared blob pointer, keeps the blob
+    #  memory alive for as long as the view exists. An optional anchor object (e.g. the infer
+    #  request the blob belongs to) is pinned alongside, so the memory owner can not be released
+    #  while the view is in use.
+    def to_numpy_view(self, anchor = None):
+        self.lifetime_anchor = anchor
+        return np.asarray(self)
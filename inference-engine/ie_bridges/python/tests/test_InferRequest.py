@@ -49,6 +49,23 @@ def test_output_blobs(device):
     assert executable_network.requests[0].output_blobs['fc_out'].tensor_desc == td
 
 
+def test_output_views(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img})
+    view = request.output_views['fc_out']
+    assert view.shape == (1, 10)
+    assert np.argmax(view) == 2
+    # the view aliases the request memory instead of copying it
+    assert np.array_equal(view, request.output_blobs['fc_out'].buffer)
+    del exec_net
+    del ie_core
+    del net
+
+
 def test_inputs_deprecated(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
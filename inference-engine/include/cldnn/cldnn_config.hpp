@@ -70,6 +70,13 @@ DECLARE_CLDNN_CONFIG_KEY(INT8_ENABLED);
 */
 DECLARE_CLDNN_CONFIG_KEY(NV12_TWO_INPUTS);
 
+/**
+* @brief This key defines the directory name to which compiled OpenCL program binaries are cached.
+* When set, a warm start reuses the binaries instead of recompiling kernel sources.
+* Empty by default (means no caching).
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_CACHE_DIR);
+
 
 }  // namespace CLDNNConfigParams
 }  // namespace InferenceEngine
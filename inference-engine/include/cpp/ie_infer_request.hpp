@@ -110,6 +110,18 @@ public:
         CALL_STATUS_FNC(SetBlob, name.c_str(), data);
     }
 
+    /**
+     * @brief Sets several input/output blobs in one call
+     *
+     * All blobs are validated before any of them is set, so a failure leaves the request unchanged.
+     * @note Memory allocation does not happen
+     * @param blobs Map of input or output blobs accessed by blob names. The type of each blob must
+     * correspond to the network input or output precision and size.
+     */
+    void SetBlobs(const BlobMap& blobs) {
+        CALL_STATUS_FNC(SetBlobs, blobs);
+    }
+
     /**
      * @copybrief IInferRequest::GetBlob
      *
@@ -206,6 +218,15 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief Sets scheduling priority used by all the following StartAsync calls for this request.
+     *
+     * @param priority new scheduling priority for this request
+     */
+    void SetPriority(IInferRequest::Priority priority) {
+        CALL_STATUS_FNC(SetPriority, priority);
+    }
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      *
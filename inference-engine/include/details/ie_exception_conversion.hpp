@@ -58,6 +58,8 @@ inline void extract_exception(StatusCode status, char* msg) {
         throw InferNotStarted(msg);
     case NETWORK_NOT_READ:
         throw NetworkNotRead(msg);
+    case INFER_CANCELLED:
+        throw InferCancelled(msg);
     default:
         THROW_IE_EXCEPTION << msg << InferenceEngine::details::as_status << status;
     }
@@ -68,6 +68,12 @@ DECLARE_GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE);
 */
 DECLARE_GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE_GENERATION);
 
+/**
+* @brief if set to a directory, compiled models are cached there and LoadNetwork imports
+* a matching cached model instead of compiling the network again. Empty value (default) disables the cache
+*/
+DECLARE_GNA_CONFIG_KEY(COMPILE_CACHE_DIR);
+
 /**
 * @brief GNA proc_type setting that should be one of GNA_AUTO, GNA_HW, GNA_SW, GNA_SW_EXACT
 */
@@ -109,5 +115,16 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
+
+/**
+* @brief The option to enable/disable packing of concurrent single-frame infer requests
+* into one device submission sweep.
+* If value is YES, synchronous Infer calls arriving in parallel are collected for a short
+* window and enqueued to the accelerator back to back before their results are awaited,
+* which amortizes the per-request submission cost for streams of small requests.
+* The number of requests packed per sweep is bounded by the value of KEY_GNA_LIB_N_THREADS.
+* Default value is NO
+*/
+DECLARE_GNA_CONFIG_KEY(FRAME_BATCHING);
 }  // namespace GNAConfigParams
 }  // namespace InferenceEngine
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include "gpu_context_api_ocl.hpp"
 
 #include <va/va.h>
@@ -110,6 +111,22 @@ static inline Blob::Ptr make_shared_blob_nv12(size_t height, size_t width, Remot
     return InferenceEngine::make_shared_blob<NV12Blob>(y_blob, uv_blob);
 }
 
+/**
+* @brief This function is used to obtain NV12 compound blob objects for a fixed ring of NV12 VA decoder surfaces.
+* All surfaces of the ring are imported into the OpenCL context once, up front, so that at steady state
+* the application only rotates over the returned blobs in SetBlob() calls and the decode-to-inference
+* chain stays fully zero-copy.
+*/
+static inline std::vector<Blob::Ptr> make_shared_blob_nv12_pool(size_t height, size_t width, RemoteContext::Ptr ctx,
+    const std::vector<VASurfaceID>& nv12_surfs) {
+    std::vector<Blob::Ptr> pool;
+    pool.reserve(nv12_surfs.size());
+    for (const auto& nv12_surf : nv12_surfs) {
+        pool.push_back(make_shared_blob_nv12(height, width, ctx, nv12_surf));
+    }
+    return pool;
+}
+
 /**
 * @brief This function is used to obtain remote context object from VA display handle
 */
@@ -38,5 +38,21 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the automatic cost-model-driven affinity assignment.
+ * Layers are spread over the devices of the "TARGET_FALLBACK" list minimizing the estimated
+ * execution cost plus transfer penalties on the device boundaries instead of taking the
+ * plain priority order.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_MODEL);
+
+/**
+ * @brief The key for a path to a file with measured layer and transfer costs.
+ * The file refines the built-in estimates of the cost model and may be filled from
+ * performance counters of previous runs, so the measured costs are reused between them.
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_MODEL_CACHE);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
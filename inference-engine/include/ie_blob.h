@@ -864,4 +864,17 @@ struct ROI {
  */
 INFERENCE_ENGINE_API_CPP(Blob::Ptr) make_shared_blob(const Blob::Ptr& inputBlob, const ROI& roi);
 
+/**
+ * @brief Creates a batched blob describing the given ROI objects over one backing blob.
+ *
+ * Each ROI becomes one batch item; no image data is copied. The resulting blob can be set as a
+ * network input to run batched-ROI inference: input pre-processing resizes every ROI into its
+ * batch position of the input tensor.
+ *
+ * @param inputBlob original blob with pre-allocated memory.
+ * @param rois A vector of ROI objects inside of the original blob, one per batch item.
+ * @return A shared pointer to the newly created blob.
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) make_shared_blob(const Blob::Ptr& inputBlob, const std::vector<ROI>& rois);
+
 }  // namespace InferenceEngine
@@ -237,7 +237,8 @@ enum StatusCode : int {
     RESULT_NOT_READY = -9,
     NOT_ALLOCATED = -10,
     INFER_NOT_STARTED = -11,
-    NETWORK_NOT_READ = -12
+    NETWORK_NOT_READ = -12,
+    INFER_CANCELLED = -13
 };
 
 /**
@@ -305,6 +306,11 @@ class NotAllocated : public std::logic_error {
 class InferNotStarted : public std::logic_error {
     using std::logic_error::logic_error;
 };
+
+/** @brief This class represents StatusCode::INFER_CANCELLED exception */
+class InferCancelled : public std::logic_error {
+    using std::logic_error::logic_error;
+};
 }  // namespace InferenceEngine
 
 /** @brief This class represents StatusCode::NETWORK_NOT_READ exception */
@@ -343,4 +343,71 @@ public:
      */
     const Blob::Ptr& v() const noexcept;
 };
+
+/**
+ * @brief Represents a blob that contains a set of image blobs, one per batch item
+ *
+ * The underlying blobs must agree in precision, layout and number of dimensions, each describing a
+ * single image (batch dimension equal to 1); their spatial sizes may differ. A typical use case is
+ * batched-ROI inference: every underlying blob is an ROI blob created over the same backing frame
+ * with make_shared_blob(const Blob::Ptr&, const ROI&), so no image data is copied when the batch
+ * is constructed. When such a blob is set as a network input, input pre-processing gathers the
+ * items into consecutive batch positions of the input tensor.
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedBlob>;
+
+    /**
+     * @brief A deleted default constructor
+     */
+    BatchedBlob() = delete;
+
+    /**
+     * @brief Constructs a batched blob from a vector of blobs
+     *
+     * @param blobs A vector of blobs, one per batch item, that is copied to this object
+     */
+    explicit BatchedBlob(const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Constructs a batched blob from a vector of blobs
+     *
+     * @param blobs A vector of blobs, one per batch item, that is moved to this object
+     */
+    explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
+
+    /**
+     * @brief A virtual destructor
+     */
+    virtual ~BatchedBlob() = default;
+
+    /**
+     * @brief A copy constructor
+     */
+    BatchedBlob(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A copy assignment operator
+     */
+    BatchedBlob& operator=(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A move constructor
+     */
+    BatchedBlob(BatchedBlob&& blob) = default;
+
+    /**
+     * @brief A move assignment operator
+     */
+    BatchedBlob& operator=(BatchedBlob&& blob) = default;
+};
 }  // namespace InferenceEngine
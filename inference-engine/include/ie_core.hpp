@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -59,7 +60,7 @@ public:
      * See RegisterPlugins for more details.
      *
      * @param xmlConfigFile A path to .xml file with plugins to load from. If XML configuration file is not specified,
-     * then default Inference Engine plugins are loaded from the default plugin.xml file.
+     * the default Inference Engine plugin set compiled into the library is registered, without reading any file.
      */
     explicit Core(const std::string& xmlConfigFile = {});
 
@@ -71,6 +72,19 @@ public:
      */
     std::map<std::string, Version> GetVersions(const std::string& deviceName) const;
 
+    /**
+     * @brief Eagerly loads reader libraries and plugins for the listed devices
+     *
+     * By default reader and device plugin shared libraries are loaded lazily inside the first
+     * ReadNetwork / LoadNetwork call, which serializes library loading on the application hot path.
+     * Calling this method right after construction loads the libraries on background threads
+     * instead, overlapping them with each other and with the rest of application start-up.
+     *
+     * @param deviceNames Names of devices to load plugins for. If the list is empty, only the model
+     * reader libraries are preloaded.
+     */
+    void Preload(const std::vector<std::string>& deviceNames = {});
+
     /**
      * @deprecated IErrorListener is not used anymore. An exception is thrown in case of any unexpected situations.
      * The function will be removed in 2021.1 release.
@@ -106,6 +120,21 @@ public:
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath = {}) const;
+
+    /**
+     * @brief Reads IR xml and bin files on a background thread
+     *
+     * A sequential readahead of both files is hinted to the OS before parsing starts,
+     * so when several models are loaded in a pipeline the disk read of the next model
+     * overlaps parsing and compilation of the previous one.
+     *
+     * @param modelPath path to IR file
+     * @param binPath path to bin file, if path is empty, will try to read bin file with the same name as xml and
+     * if bin file with the same name was not found, will load IR without weights.
+     * @return Future which provides the CNNNetwork or rethrows the reading error
+     */
+    std::future<CNNNetwork> ReadNetworkAsync(const std::string& modelPath, const std::string& binPath = {}) const;
+
     /**
      * @brief Reads IR xml and bin (with the same name) files
      * @param model string with IR
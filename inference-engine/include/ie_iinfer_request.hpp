@@ -38,6 +38,16 @@ public:
         /** IInferRequest doesn't block or interrupt current thread and immediately returns inference status */
         STATUS_ONLY = 0,
     };
+    /**
+     * @enum Priority
+     * @brief Enumeration to hold scheduling priority of IInferRequest
+     */
+    enum Priority : int {
+        /** Default priority, requests are executed in submission order */
+        PRIORITY_NORMAL = 0,
+        /** The request is scheduled ahead of already queued normal priority requests */
+        PRIORITY_HIGH = 1,
+    };
     /**
      * @brief A shared pointer to the IInferRequest object
      */
@@ -59,6 +69,20 @@ public:
      */
     virtual StatusCode SetBlob(const char* name, const Blob::Ptr& data, ResponseDesc* resp) noexcept = 0;
 
+    /**
+     * @brief Sets several input/output blobs in one call
+     *
+     * All blobs are validated before any of them is set, so a failure leaves the request unchanged.
+     * Compared to a sequence of SetBlob calls this crosses the API boundary once, which reduces the
+     * fixed per-call overhead for networks with many inputs.
+     * @note Memory allocation does not happen
+     * @param blobs Map of input or output blobs accessed by blob names. The type of each blob must match the
+     * corresponding network input or output precision and size.
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success
+     */
+    virtual StatusCode SetBlobs(const BlobMap& blobs, ResponseDesc* resp) noexcept = 0;
+
     /**
      * @brief Gets input/output data for inference
      *
@@ -178,6 +202,19 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Sets scheduling priority used by all the following StartAsync calls for this request.
+     *
+     * High priority requests are scheduled ahead of normal priority requests already queued to the
+     * executable network that created this request.
+     *
+     * @param priority new scheduling priority for this request
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual InferenceEngine::StatusCode SetPriority(Priority priority, ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
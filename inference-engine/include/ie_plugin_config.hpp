@@ -12,6 +12,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -153,11 +155,75 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric to get the byte counts of memory allocated through the Inference Engine
+ * allocators, split by pipeline phase.
+ *
+ * Returns a std::map<std::string, uint64_t> with <PHASE>_CURRENT and <PHASE>_PEAK entries
+ * for the READ, TRANSFORM, COMPILE, INFER and OTHER phases plus TOTAL_CURRENT / TOTAL_PEAK.
+ * The accounting is process-wide, so the metric value does not depend on the device name
+ * passed to Core::GetMetric.
+ */
+DECLARE_METRIC_KEY(MEMORY_ACCOUNTING, std::map<std::string, uint64_t>);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a std::vector<std::string> of input names for which a user blob
+ * set via InferRequest::SetBlob is bound to the compiled graph without a copy.
+ *
+ * Inputs not listed here are always copied on push (e.g. they feed in-place consumers
+ * or need precision conversion), so callers may pre-allocate accordingly.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(ZERO_COPY_INPUTS, std::vector<std::string>);
+
+/**
+ * @brief Metric to get the accumulated inference latency histogram of an executable network.
+ *
+ * Returns a std::vector<unsigned long long> holding (upper latency bound in microseconds,
+ * request count) pairs flattened into one sequence and ordered by bound; only non-empty
+ * buckets are reported. The buckets are logarithmic with 12.5% worst case resolution,
+ * so percentiles like p50/p99/p999 can be derived by walking the cumulative counts.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LATENCY_HISTOGRAM, std::vector<unsigned long long>);
+
+/**
+ * @brief Metric to get the predicted memory footprint of an executable network, in bytes.
+ *
+ * Returns a std::map<std::string, uint64_t> with WEIGHTS_BYTES (constant data of the
+ * compiled network), WORKSPACE_BYTES_PER_STREAM (the intermediate-tensor workspace the
+ * MemorySolver planned for one stream), STREAMS and TOTAL_BYTES (weights plus one
+ * workspace per stream). Together with KEY_CPU_DRY_RUN the numbers are available without
+ * allocating the memory or creating the primitives, so a placement service can size
+ * hosts before committing to a full LoadNetwork.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_ESTIMATION, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the layers whose tensors form the peak of the planned workspace.
+ *
+ * Returns a std::map<std::string, uint64_t> from producing layer name to tensor bytes for
+ * the largest intermediate tensors (at most ten) alive at the execution step where the sum
+ * of live tensor sizes is maximal. Like MEMORY_ESTIMATION the data comes from the memory
+ * reuse plan, so it is also available after a KEY_CPU_DRY_RUN load and points memory
+ * optimization work at the layers that actually drive the footprint. The full allocation
+ * timeline can be dumped with KEY_DUMP_MEMORY_TIMELINE_AS_CSV.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_PEAK_CONTRIBUTORS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the spatial halo size of an executable network, in input pixels.
+ *
+ * Returns the one-sided margin by which a spatial tile of the input must overlap its
+ * neighbour so that the outputs at the tile border match a whole-image inference. It is
+ * derived from the receptive field accumulated over convolution and pooling layers, so
+ * applications tiling large images can size the overlap exactly instead of guessing.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(TILE_HALO_SIZE, unsigned int);
+
 }  // namespace Metrics
 
 /**
@@ -205,6 +271,298 @@ DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 DECLARE_CONFIG_VALUE(NUMA);
 
+/**
+ * @brief The key to enable replication of constant weights to every NUMA node the network executes on.
+ *
+ * Without replication constants are shared between streams and stay on the NUMA node which loaded
+ * the model, so streams pinned to another socket read them through the interconnect.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_REPLICATE_WEIGHTS);
+
+/**
+ * @brief The key to cap the number of independent graph branches the CPU plugin executes
+ * concurrently within one stream.
+ *
+ * On wide multi-branch topologies sequential per-stream execution leaves cores idle in
+ * latency (single stream) mode; with this option nodes which have no data dependency
+ * on each other are scheduled in parallel on the stream's threads.
+ * The value should be a positive integer; 0 (default) or 1 keeps the strictly
+ * sequential execution
+ */
+DECLARE_CONFIG_KEY(CPU_BRANCH_PARALLELISM);
+
+/**
+ * @brief The key to place reordered constant weights into a named host-level shared memory store.
+ *
+ * Processes serving the same model pass the same store name and reference one physical copy
+ * of the weights instead of duplicating them per process. The store outlives the processes
+ * which created it and has to be removed by the host administrator when the model is retired.
+ * The value should be a store name unique to the model; an empty string (default) disables
+ * the store
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS_STORE);
+
+/**
+ * @brief The key to tap outputs of the listed layers while the CPU plugin executes the network.
+ *
+ * The outputs are copied into preallocated lock-free ring buffers during inference and written
+ * to disk by a background thread, so a running service can be diagnosed for accuracy drift
+ * without being taken offline. Samples are dropped (and counted) instead of blocking when the
+ * writer falls behind.
+ * The value should be a comma-separated list of layer names; an empty string (default)
+ * disables the taps
+ */
+DECLARE_CONFIG_KEY(CPU_TENSOR_TAP);
+
+/**
+ * @brief The key to set the directory the tapped tensors are written to.
+ *
+ * Effective together with KEY_CPU_TENSOR_TAP; the directory has to exist
+ */
+DECLARE_CONFIG_KEY(CPU_TENSOR_TAP_DIR);
+
+/**
+ * @brief The key to calibrate the number of CPU streams with a short self-benchmark at load time.
+ *
+ * With this option enabled LoadNetwork sweeps several stream counts derived from the host
+ * topology (plus the explicitly requested KEY_CPU_THROUGHPUT_STREAMS value, if any), measures
+ * the throughput of the network being loaded for each of them and keeps the fastest one. The
+ * winner is persisted in the calibration cache keyed by model and host, so the sweep runs once
+ * per model/host pair and later loads reuse the stored stream count.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_CALIBRATION);
+
+/**
+ * @brief The key to set the file the calibrated stream counts are persisted in.
+ *
+ * Effective together with KEY_CPU_STREAMS_CALIBRATION
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_CALIBRATION_CACHE);
+
+/**
+ * @brief The key to keep quantized networks in the NHWC layout across the whole graph.
+ *
+ * Int8 convolutions execute natively in NHWC, but the layout-agnostic layers around them
+ * default to planar or blocked formats, which surrounds them with reorders. With this option
+ * enabled every layer of a quantized network that advertises an NHWC implementation prefers
+ * it, so chains of such layers exchange tensors without boundary reorders. Has no effect on
+ * networks without quantized layers.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_NHWC_EXEC_PROFILE);
+
+/**
+ * @brief The key to accumulate live per-edge traffic counters for the execution graph.
+ *
+ * With this option enabled every node execution adds the byte sizes of its input and output
+ * edges to per-node counters, and the network returned by GetExecGraphInfo() carries the bytes
+ * read and written since the previous query next to the usual timing annotations. Querying the
+ * execution graph resets the counters, so consecutive queries see per-interval traffic. The
+ * counters make it possible to tell which edges are bandwidth-bound in production at the cost
+ * of a few additions per node execution.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_EDGE_BANDWIDTH_COUNTERS);
+
+/**
+ * @brief The key to serve the first inference requests with quickly-compiled conservative kernels.
+ *
+ * Creating the optimal CPU primitives is dominated by jit kernel generation and may take seconds
+ * for large networks. With this option enabled LoadNetwork first compiles the graphs with
+ * implementations which are cheap to create (gemm and reference kernels), so the first requests
+ * are served almost immediately, and rebuilds the optimally compiled graphs on a background
+ * thread. Every stream switches to its optimal graph between two inferences as soon as a rebuilt
+ * graph is available, reaching the usual steady-state throughput without the cold-start delay.
+ * Has no effect on networks with memory states, whose state tensors must stay in place.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_FAST_FIRST_INFERENCE);
+
+/**
+ * @brief The key to compress the weights section of a blob exported by the CPU plugin.
+ *
+ * The weights dominate the size of an exported blob and compress well, so this option shrinks
+ * the artifacts shipped to edge devices by a factor of two to three depending on the model.
+ * The weights are compressed in fixed-size chunks which are decompressed in parallel on import,
+ * so the load-time cost is a small fraction of the disk and distribution savings. Import detects
+ * the compression automatically; blobs exported without this option keep the uncompressed format.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_EXPORT_COMPRESSION);
+
+/**
+ * @brief The key to back large allocations with 2MB huge pages.
+ *
+ * On models with gigabytes of weights the TLB misses of 4KB pages cost a measurable share of
+ * inference time. With this option enabled allocations of two megabytes and above - constant
+ * weights and the intermediate-tensor workspace - are placed on 2MB pages: on pre-reserved
+ * huge pages (vm.nr_hugepages) when available, otherwise through transparent huge pages, and
+ * with a transparent fallback to regular pages on platforms without huge-page support.
+ * The setting is process wide and takes effect for allocations made after the first network
+ * is loaded with it; smaller allocations are never affected.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_LARGE_PAGES);
+
+/**
+ * @brief The key to load a network as a dry run for memory estimation.
+ *
+ * The load goes through the usual transformations, graph optimizations and MemorySolver
+ * planning but stops before any workspace is allocated or primitives are created, which
+ * keeps it well under a second even for large networks. The resulting executable network
+ * only serves the MEMORY_ESTIMATION metric - predicted weight, per-stream workspace and
+ * total byte counts - and throws on an attempt to create an infer request.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_DRY_RUN);
+
+/**
+ * @brief The key to keep reordered weights cached across LoadNetwork calls.
+ *
+ * By default the weights cache only deduplicates tensors between the networks currently
+ * loaded; once they are unloaded the reordered copies are freed. With this option the
+ * copies are pinned for the lifetime of the plugin and keyed by data hash and target
+ * descriptor instead of the layer name, so loading the next variant of a model that
+ * shares most weight tensors reorders only the differing ones. The pinned copies are
+ * released when the plugin is unloaded, so this trades process memory for load time and
+ * is meant for fleets of shared-weight model variants. The setting is process wide and
+ * enable-only, like KEY_CPU_LARGE_PAGES.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_PERSISTENT_WEIGHTS_CACHE);
+
+/**
+ * @brief The key to flush denormal floating point values to zero on the stream threads.
+ *
+ * Networks whose activations decay into the denormal range (long audio filters, RNN
+ * state) can spend most of a layer in the hardware assist that handles denormals. With
+ * this option every worker thread of the executable network sets the FTZ and DAZ bits of
+ * its floating point control register when the stream is constructed, so denormal inputs
+ * and results are treated as zero. The setting is per network and slightly changes
+ * numerics around zero, which is why it is off by default.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_DENORMALS_OPTIMIZATION);
+
+/**
+ * @brief The key to store the reordered weights inside a blob exported by the CPU plugin.
+ *
+ * Reordering the weights into the blocked layouts the primitives execute with is the dominant
+ * cost of loading a pre-compiled CPU network. With this option an exported blob additionally
+ * carries every weight tensor already reordered into the layout the plugin chose, so importing
+ * the blob skips the reorders entirely. The prepared copies are keyed by the layer and checked
+ * against the descriptors chosen on the importing machine; a mismatching entry (for example
+ * after importing on a machine with a different instruction set) falls back to the usual
+ * reorder, so the blob stays portable at the price of its larger size.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_EXPORT_PREPARED_WEIGHTS);
+
+/**
+ * @brief The key to drive bfloat16 execution by a per-layer decision map instead of the type allow-list.
+ *
+ * The value is the path of a plain text decision map, one layer per line. When the file does
+ * not exist the plugin builds it: every weighted bf16-capable layer gets a numerical-sensitivity
+ * estimate - the relative error of truncating its weights to bfloat16 - and layers are kept in
+ * bf16 in ascending sensitivity order while the accumulated sensitivity stays within
+ * KEY_CPU_BF16_ACCURACY_BUDGET; the map is then written for review. An existing file is applied
+ * as is, so a hand-tweaked decision survives subsequent loads. Effective together with
+ * KEY_ENFORCE_BF16.
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_POLICY);
+
+/**
+ * @brief The key to set the accuracy budget of the KEY_CPU_BF16_POLICY decision map.
+ *
+ * A non-negative float, the cap on the accumulated weight-truncation sensitivity of the layers
+ * chosen to execute in bfloat16. 0 pins every weighted layer to FP32, larger values admit more
+ * layers into bf16; the default of 0.01 keeps the layers whose weights are essentially
+ * unaffected by the truncation. Only used when the decision map is rebuilt.
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_ACCURACY_BUDGET);
+
+/**
+ * @brief The key to keep intermediate tensors in bfloat16 across the whole graph.
+ *
+ * By default the CPU plugin falls back to float32 tensors around every layer which has no
+ * native bfloat16 implementation, so chains of such layers round-trip through float32.
+ * With this option enabled all edges between bfloat16-capable layers stay in bfloat16 and
+ * conversions are inserted only on the boundaries with unsupported layers, halving the
+ * bandwidth spent on intermediate tensors. Takes effect together with KEY_ENFORCE_BF16.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_BF16_WHOLE_GRAPH);
+
+/**
+ * @brief The key to move high-sparsity activations in a compressed bitmap+values form.
+ *
+ * Post-ReLU activations are often mostly zeros, but copies made of them move the dense
+ * tensor. With this option enabled the plugin samples the zero fraction of an activation
+ * before copying it and, when packing pays off, stores a bitmap plus the non-zero values
+ * instead, cutting the moved bytes roughly by the zero fraction. Applies where the plugin
+ * itself moves activations (currently the KEY_CPU_TENSOR_TAP capture copies); tensors
+ * flowing between primitives stay dense as the kernels consume dense layouts.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_ACTIVATIONS);
+
+/**
+ * @brief The key to shard large FullyConnected layers across a distributed process group.
+ *
+ * Requires a configured ngraph distributed interface (for example the built-in socket
+ * backend driven by the NGRAPH_SOCKET_PEERS/NGRAPH_SOCKET_RANK environment variables).
+ * Every rank loads the same network; eligible FullyConnected layers are rewritten so each
+ * rank keeps only its column slice of the weights and an AllReduce node sums the partial
+ * products, so a model whose weights exceed one machine can serve from several smaller
+ * ones. All ranks must infer in lockstep with identical inputs.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_TENSOR_PARALLEL);
+
+/**
+ * @brief The key to confine a network to a single NUMA node on multi-socket hosts.
+ *
+ * The value is the decimal id of the target node. All stream threads are bound to that
+ * node, and the weights cache, the workspace and the intermediate tensors are first-touched
+ * from those threads, so every allocation of the network is node-local. Intended for
+ * latency-critical small models where a single remote-memory access erases the gains;
+ * after the load the plugin samples the placement of the graph memory and reports any
+ * region that ended up on another node.
+ * This option should be used with a NUMA node id, or "-1" (default) to keep the usual
+ * round-robin stream placement.
+ */
+DECLARE_CONFIG_KEY(CPU_COMPACT_NUMA_NODE);
+
+/**
+ * @brief The key to keep the recurrent state of TensorIterator layers between infer calls.
+ *
+ * Intended for streaming sequence models: instead of paying a request round-trip per
+ * frame, the client feeds consecutive chunks of the stream to the same network, and
+ * every TensorIterator continues from the state its back edges reached at the end of
+ * the previous call; only the very first call reads the initial state from the network
+ * input. The kept states are exposed through the memory-state API (QueryState) under
+ * "<layer name>/back_edge:<port>", so they can be inspected, seeded or reset like
+ * Memory layer states.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_TENSOR_ITERATOR_STREAMING);
+
+/**
+ * @brief The key to speed up a reload of the same network after CNNNetwork::reshape.
+ *
+ * Intended for periodic resolution switches: when only the spatial dimensions changed,
+ * re-ranking the full implementation candidate set of every layer repeats work whose
+ * outcome is already known. With this key the plugin records the implementation type
+ * each layer settled on and, on the next load of a network with the same name, steers
+ * the layers straight to those types; only the shapes, the memory plan and the
+ * primitive descriptors are re-derived. An explicit per-layer PrimitivesPriority still
+ * takes precedence over the recorded type.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_RESHAPE_RELAUNCH);
+
 /**
  * @brief Optimize CPU execution to maximize throughput.
  *
@@ -329,6 +687,17 @@ DECLARE_CONFIG_VALUE(LOG_TRACE);  // finer-grained informational events than the
  */
 DECLARE_CONFIG_KEY(DEVICE_ID);
 
+/**
+ * @brief the key for setting a directory where compiled network blobs are cached
+ *
+ * When the key is passed to Core::LoadNetwork, the resulting executable network is exported
+ * to the given directory keyed by a hash of the network and the compilation configuration.
+ * Subsequent LoadNetwork calls with the same network, device and configuration import
+ * the cached blob instead of compiling the network again.
+ * The directory must exist and be writable; cache misses fall back to regular compilation.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
 /**
  * @brief the key for enabling exclusive mode for async requests of different executable networks and the same plugin.
  *
@@ -350,6 +719,16 @@ DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
  */
 DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
 
+/**
+ * @brief This key enables dumping of the memory reuse plan of the internal graph.
+ *
+ * Should be passed into LoadNetwork method. Value is a name of the output csv file.
+ * The file lists one intermediate tensor per row with its producing layer, lifetime in
+ * execution steps, size and the offset assigned inside the shared workspace, and marks
+ * the tensors alive at the peak, so the allocation timeline can be plotted directly.
+ */
+DECLARE_CONFIG_KEY(DUMP_MEMORY_TIMELINE_AS_CSV);
+
 
 /**
  * @brief The name for setting to execute in bfloat16 precision whenever it is possible
@@ -35,5 +35,32 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Number of batch-1 infer requests that the plugin coalesces into one batched inference
+ *
+ * The value must be a positive integer. The default value of 1 disables the aggregation, any larger
+ * value makes the plugin additionally load a batched version of the network and run the coalesced
+ * requests on it. The network must be reshape-able over the batch dimension for that to work
+ */
+DECLARE_MULTI_CONFIG_KEY(REQUEST_BATCH_SIZE);
+
+/**
+ * @brief Time window, in milliseconds, that the plugin waits for a batch to fill up
+ *
+ * Counted from the arrival of the first request of the batch. When the window elapses, the batch is
+ * submitted with however many requests have been collected. The default value is 1
+ */
+DECLARE_MULTI_CONFIG_KEY(REQUEST_BATCH_TIMEOUT);
+
+/**
+ * @brief Deadline, in milliseconds, that every infer request is given when it enters the scheduler queue
+ *
+ * Queued requests are dispatched to the devices in earliest-deadline-first order, and a request whose
+ * deadline passes while it is still queued completes immediately with the INFER_NOT_STARTED status
+ * instead of occupying a device, leaving the capacity to the requests that can still be served in
+ * time. The default value of 0 disables the deadlines and keeps the arrival order
+ */
+DECLARE_MULTI_CONFIG_KEY(REQUEST_DEADLINE);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
@@ -5,11 +5,30 @@
 #include "cldnn_async_infer_request.h"
 #include <memory>
 
-CLDNNPlugin::CLDNNAsyncInferRequest::CLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
+CLDNNPlugin::CLDNNAsyncInferRequest::CLDNNAsyncInferRequest(const std::shared_ptr<CLDNNInferRequest> &inferRequest,
+                                                            const InferenceEngine::ITaskExecutor::Ptr &copyExecutor,
                                                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
+                                                            const InferenceEngine::ITaskExecutor::Ptr &waitExecutor,
                                                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor)
         : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor)
-        { }
+        , _inferRequest(inferRequest) {
+    // the pipeline is split in three stages: the copy-engine thread pre-processes and uploads
+    // the inputs into the request's staging buffers, the stream thread only binds them and
+    // enqueues the network and is free to submit the next request while the output events of
+    // this one are waited on and the results are copied back on the wait executor
+    _pipeline = {
+        { copyExecutor, [this] {
+            _inferRequest->checkBlobs();
+            _inferRequest->PrepareInputs();
+        } },
+        { taskExecutor, [this] {
+            _inferRequest->StartPipeline();
+        } },
+        { waitExecutor, [this] {
+            _inferRequest->WaitPipeline();
+        } }
+    };
+}
 
 void CLDNNPlugin::CLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
@@ -13,13 +13,18 @@ namespace CLDNNPlugin {
 
 class CLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
-    CLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
+    CLDNNAsyncInferRequest(const std::shared_ptr<CLDNNInferRequest> &inferRequest,
+                           const InferenceEngine::ITaskExecutor::Ptr &copyExecutor,
                            const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
+                           const InferenceEngine::ITaskExecutor::Ptr &waitExecutor,
                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
 
     void Infer_ThreadUnsafe() override;
 
     ~CLDNNAsyncInferRequest() override;
+
+private:
+    std::shared_ptr<CLDNNInferRequest> _inferRequest;
 };
 
 }  // namespace CLDNNPlugin
@@ -140,6 +140,13 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                     THROW_IE_EXCEPTION << "Couldn't create clDNN source dump directory!";
                 }
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR) == 0) {
+            if (!val.empty()) {
+                kernels_cache_dir = val;
+                // the directory usually exists already (that is the whole point of a warm start),
+                // so a failed mkdir is not an error here
+                mkdir(kernels_cache_dir.c_str(), 0755);
+            }
         } else if (key.compare(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 exclusiveAsyncRequests = true;
@@ -151,6 +158,7 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
         } else if (key.compare(PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS) == 0) {
             if (val.compare(PluginConfigParams::GPU_THROUGHPUT_AUTO) == 0) {
                 throughput_streams = 2;
+                throughput_auto = true;
             } else {
                 int val_i;
                 try {
@@ -160,8 +168,10 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                                        << ". Expected only positive numbers (#streams) or "
                                        << "PluginConfigParams::GPU_THROUGHPUT_AUTO";
                 }
-                if (val_i > 0)
+                if (val_i > 0) {
                     throughput_streams = static_cast<uint16_t>(val_i);
+                    throughput_auto = false;
+                }
             }
         } else if (key.compare(PluginConfigParams::KEY_DEVICE_ID) == 0) {
             // Validate if passed value is postivie number.
@@ -263,6 +273,7 @@ void Config::adjustKeyMapValues() {
 
     key_config_map[CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR] = graph_dumps_dir;
     key_config_map[CLDNNConfigParams::KEY_CLDNN_SOURCES_DUMPS_DIR] = sources_dumps_dir;
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR] = kernels_cache_dir;
 
     key_config_map[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = std::to_string(throughput_streams);
     key_config_map[PluginConfigParams::KEY_DEVICE_ID] = device_id;
@@ -21,6 +21,7 @@ namespace CLDNNPlugin {
 
 struct Config {
     Config() : throughput_streams(1),
+               throughput_auto(false),
                useProfiling(false),
                dumpCustomKernels(false),
                exclusiveAsyncRequests(false),
@@ -35,6 +36,7 @@ struct Config {
                tuningConfig(),
                graph_dumps_dir(""),
                sources_dumps_dir(""),
+               kernels_cache_dir(""),
                device_id("") {
         adjustKeyMapValues();
     }
@@ -43,6 +45,9 @@ struct Config {
     void adjustKeyMapValues();
 
     uint16_t throughput_streams;
+    // GPU_THROUGHPUT_AUTO was requested; the plugin rescales throughput_streams
+    // to the compute capacity of the target device when the network is loaded
+    bool throughput_auto;
     bool useProfiling;
     bool dumpCustomKernels;
     bool exclusiveAsyncRequests;
@@ -57,6 +62,7 @@ struct Config {
     cldnn::tuning_config_options tuningConfig;
     std::string graph_dumps_dir;
     std::string sources_dumps_dir;
+    std::string kernels_cache_dir;
     std::string device_id;
 
     std::map<std::string, std::string> key_config_map;
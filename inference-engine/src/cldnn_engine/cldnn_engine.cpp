@@ -167,6 +167,13 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
     conf.enableInt8 = device_info.supports_imad || device_info.supports_immad;
     conf.UpdateFromMap(config);
 
+    if (conf.throughput_auto) {
+        // scale the stream count with the compute capacity of the device so small
+        // networks keep a big discrete GPU occupied; the per-stream networks are
+        // built from one shared program, so the weights are not replicated
+        conf.throughput_streams = std::max<uint16_t>(2, static_cast<uint16_t>(device_info.cores_count / 128));
+    }
+
     if (conf.enableDynamicBatch) {
         conf.max_dynamic_batch = static_cast<int>(network.getBatchSize());
     }
@@ -221,6 +228,11 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
     conf.enableInt8 = device_info.supports_imad || device_info.supports_immad;
     conf.UpdateFromMap(config);
 
+    if (conf.throughput_auto) {
+        // see the default-context overload above
+        conf.throughput_streams = std::max<uint16_t>(2, static_cast<uint16_t>(device_info.cores_count / 128));
+    }
+
     if (conf.enableDynamicBatch) {
         conf.max_dynamic_batch = static_cast<int>(network.getBatchSize());
     }
@@ -50,7 +50,11 @@ CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, Remote
         }
     }()},
     m_config(config),
-    m_taskExecutor{_taskExecutor} {
+    m_taskExecutor{_taskExecutor},
+    m_copyExecutor{std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"CLDNNPlugin copy executor", 1})},
+    m_waitExecutor{std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"CLDNNPlugin wait executor", 1})} {
     auto casted_context = std::dynamic_pointer_cast<gpu::ClContext>(context);
 
     if (nullptr == casted_context) {
@@ -95,10 +99,11 @@ InferRequestInternal::Ptr CLDNNExecNetwork::CreateInferRequestImpl(InputsDataMap
 }
 
 void CLDNNExecNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
-    auto syncRequestImpl = this->CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    auto syncRequestImpl = std::static_pointer_cast<CLDNNInferRequest>(
+        this->CreateInferRequestImpl(_networkInputs, _networkOutputs));
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
 
-    auto asyncTreadSafeImpl = std::make_shared<CLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncTreadSafeImpl = std::make_shared<CLDNNAsyncInferRequest>(syncRequestImpl, m_copyExecutor, _taskExecutor, m_waitExecutor, _callbackExecutor);
 
     asyncRequest.reset(new InferRequestBase<CLDNNAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
     asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
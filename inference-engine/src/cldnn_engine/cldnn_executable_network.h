@@ -41,6 +41,11 @@ public:
     gpu::ClContext::Ptr m_context;
     Config m_config;
     InferenceEngine::ITaskExecutor::Ptr m_taskExecutor;
+    // uploads inputs of queued requests into their staging buffers, overlapping the transfer
+    // of one request with kernel execution of the previously enqueued one
+    InferenceEngine::ITaskExecutor::Ptr m_copyExecutor;
+    // waits for output events and copies results back while the stream threads enqueue further requests
+    InferenceEngine::ITaskExecutor::Ptr m_waitExecutor;
 };
 
 };  // namespace CLDNNPlugin
@@ -613,7 +613,6 @@ void CLDNNInferRequest::AllocateInputsDyn() {
 
 void CLDNNInferRequest::AllocateOutputs() {
     // allocate outputs
-    bool can_reuse_internal_mem = !m_useStreams;
     for (auto& no : _networkOutputs) {
         std::string outputID = m_graph->MapOutputName(no.first);
         cldnn::memory output_mem = m_graph->GetNetwork()->get_output_memory(outputID);
@@ -625,13 +624,13 @@ void CLDNNInferRequest::AllocateOutputs() {
         DataPtr oi = no.second;
         const TensorDesc& desc = oi->getTensorDesc();
 
-        if (can_reuse_internal_mem) {
-            _outputs[no.first] = createOutputBlob(desc, output_mem_ptr.data());
-        } else {
-            Blob::Ptr outputBlob = createOutputBlob(desc);
-            outputBlob->allocate();
-            _outputs[no.first] = outputBlob;
-        }
+        // every request gets its own staging memory for the output and the network is
+        // redirected there on enqueue; this keeps requests of one stream independent,
+        // so readback of this request may overlap with execution of the next one
+        cldnn::memory staging_mem = cldnn::memory::allocate(*(m_graph->GetEngine()), output_mem.get_layout());
+        cldnn::pointer<uint8_t> staging_mem_ptr = staging_mem.pointer<uint8_t>();
+        outputsMemory.insert({no.first, staging_mem});
+        _outputs[no.first] = createOutputBlob(desc, staging_mem_ptr.data());
         outputsMap[no.first] = outputID;
     }
 }
@@ -749,15 +748,85 @@ CLDNNInferRequest::CLDNNInferRequest(InputsDataMap networkInputs, OutputsDataMap
     streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->m_taskExecutor.get());
 }
 
-void CLDNNInferRequest::execAndParse() {
-    auto networkOutputs = m_graph->GetNetwork()->execute();
+void CLDNNInferRequest::PrepareInputs() {
+    // execute input pre-processing.
+    execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
+
+    // dynamic batch networks attach per-subnetwork views of the user blobs on enqueue
+    if (m_graph->GetMaxDynamicBatchSize() > 1)
+        return;
+
+    for (auto &item : _inputs) {
+        std::string name = item.first;
+        Blob::Ptr inputBlob = item.second;
+
+        auto nv12_ptr = inputBlob->as<NV12Blob>();
+
+        if (nv12_ptr == nullptr) {
+            // regular blob
+            UploadInput(name, *inputBlob);
+        } else {
+            // special case for NV12 input blob
+            UploadInput(name + "_Y", *nv12_ptr->y());
+            UploadInput(name + "_UV", *nv12_ptr->uv());
+        }
+    }
+}
+
+void CLDNNInferRequest::StartPipeline() {
+    int streamID = 0;
+    if (nullptr != streamExecutor) {
+        streamID = streamExecutor->GetStreamId();
+    }
+    m_graph = static_cast<CLDNNExecNetwork*>(_exeNetwork.get())->m_graphs[streamID];
 
-    // Collect outputs as requested by the model
+    if (m_graph->GetMaxDynamicBatchSize() > 1) {
+        for (auto &item : _inputs) {
+            PrepareInputDyn(item.first, *item.second);
+        }
+        // dynamic batch networks are executed and parsed in one go
+        execAndParseDyn();
+        m_internalOutputs.clear();
+    } else {
+        auto _nw_ptr = m_graph->GetNetwork();
+
+        // inputs were pre-uploaded into this request's staging buffers by PrepareInputs(),
+        // so the stream thread only binds them and feeds the queue
+        for (auto &item : _inputs) {
+            auto nv12_ptr = item.second->as<NV12Blob>();
+
+            if (nv12_ptr == nullptr) {
+                BindInput(item.first, *item.second);
+            } else {
+                BindInput(item.first + "_Y", *nv12_ptr->y());
+                BindInput(item.first + "_UV", *nv12_ptr->uv());
+            }
+        }
+
+        // redirect the outputs to this request's staging buffers, so the next request
+        // enqueued on the same network does not overwrite the results being read back
+        for (auto& no : _networkOutputs) {
+            auto mem = outputsMemory.find(no.first);
+            if (mem != outputsMemory.end() && !_outputs[no.first]->is<gpu::ClBlob>()) {
+                _nw_ptr->set_output_memory(outputsMap[no.first], mem->second);
+            }
+        }
+        m_internalOutputs = _nw_ptr->execute();
+    }
+}
+
+void CLDNNInferRequest::WaitPipeline() {
+    // dynamic batch results were collected on enqueue
+    if (m_internalOutputs.empty()) {
+        return;
+    }
+
+    // Collect outputs as requested by the model; only the events of this request are waited on
     for (auto& no : _networkOutputs) {
         Blob::Ptr bptr = _outputs[no.first];
 
         std::string outputID = outputsMap[no.first];
-        auto outputMemory = networkOutputs.at(outputID).get_memory();
+        auto outputMemory = m_internalOutputs.at(outputID).get_memory();
 
         // mapping remote blobs not needed -
         // let the user take care of them explicitly
@@ -772,6 +841,7 @@ void CLDNNInferRequest::execAndParse() {
             }
         }
     }
+    m_internalOutputs.clear();
 
     // finally collect profiling info
     if (m_useProfiling) {
@@ -809,40 +879,9 @@ void CLDNNInferRequest::execAndParseDyn() {
 
 void CLDNNInferRequest::InferImpl() {
     IE_PROFILING_AUTO_SCOPE(CLDNN_INFER)
-    int streamID = 0;
-    if (nullptr != streamExecutor) {
-        streamID = streamExecutor->GetStreamId();
-    }
-    m_graph = static_cast<CLDNNExecNetwork*>(_exeNetwork.get())->m_graphs[streamID];
-    // execute input pre-processing.
-    execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
-
-    for (auto &item : _inputs) {
-        std::string name = item.first;
-        Blob::Ptr inputBlob = item.second;
-
-        if (m_graph->GetMaxDynamicBatchSize() > 1) {
-            PrepareInputDyn(name, *inputBlob);
-        } else {
-            auto nv12_ptr = inputBlob->as<NV12Blob>();
-
-            if (nv12_ptr == nullptr) {
-                // regular blob
-                PrepareInput(name, *inputBlob);
-            } else {
-                // special case for NV12 input blob
-                PrepareInput(name + "_Y", *nv12_ptr->y());
-                PrepareInput(name + "_UV", *nv12_ptr->uv());
-            }
-        }
-    }
-
-    // The actual inference
-    if (m_graph->GetMaxDynamicBatchSize() > 1) {
-        execAndParseDyn();
-    } else {
-        execAndParse();
-    }
+    PrepareInputs();
+    StartPipeline();
+    WaitPipeline();
 }
 
 void CLDNNInferRequest::GetPerformanceCounts(
@@ -876,58 +915,68 @@ void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
 
 }  // namespace
 
-void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+void CLDNNInferRequest::UploadInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
     // Get input layout
     if (m_graph->GetInputLayouts().find(inputName) == m_graph->GetInputLayouts().end()) {
         THROW_IE_EXCEPTION << "Input name mismatch.";
     }
-    auto inputLayout = m_graph->GetInputLayouts().at(inputName);
-    auto is_same_buffer = [](const Blob& blob, const cldnn::memory& memory) -> bool {
-        const std::string str_not_allocated("Input data was not allocated.");
-        cldnn::pointer<const uint8_t> ptr = memory.pointer<const uint8_t>();
-        const uint8_t* blob_ptr = blob.cbuffer().as<const uint8_t*>();
-        const uint8_t* mem_ptr = ptr.data();
-        if (blob_ptr == nullptr || mem_ptr == nullptr) {
-            THROW_IE_EXCEPTION << str_not_allocated;
-        }
-        return (blob_ptr == mem_ptr) && (blob.byteSize() == memory.size());
-    };
 
-    cldnn::primitive_id internalName = "input:" + inputName;
+    if (inputBlob.is<gpu::ClBlob>()) {
+        // remote blobs are device memory already and were attached in SetBlob
+        return;
+    }
+
     const cldnn::memory& memory = inputsMemory.at(inputName);
-    auto _nw_ptr = m_graph->GetNetwork();
     auto prec = inputBlob.getTensorDesc().getPrecision();
 
-    if (inputBlob.is<gpu::ClBlob>()) {
-        // no need to check for reuse
-        _nw_ptr->set_input_data(internalName, memory);
-    } else if (prec == Precision::I16) {
+    if (prec == Precision::I16) {
         // clDNN doesn't support I16 input precision, so we always have to convert input data to fp32 precision
         const cldnn::memory& fp32_mem = inputsMemory.at(inputName+fp32_suffix);
         cldnn::pointer<float> ptr = fp32_mem.pointer<float>();
         copyToFloat<int16_t>(ptr.data(), &inputBlob);
-        _nw_ptr->set_input_data(internalName, fp32_mem);
-    } else if (is_same_buffer(inputBlob, memory)) {
-        // If input memory was allocated by cldnn engine and wasn't overwritten by user set_input_data method won't copy input data.
-        switch (prec) {
-            case Precision::FP32:
-            case Precision::FP16:
-            case Precision::U8:
-            case Precision::BOOL:
-            case Precision::I32:
-            case Precision::I64: {
-                _nw_ptr->set_input_data(internalName, memory);
-                break;
-            }
-            default:
-                THROW_IE_EXCEPTION << "Unsupported input precision " << prec;
+        return;
+    }
+
+    cldnn::pointer<uint8_t> mem_ptr = memory.pointer<uint8_t>();
+    const uint8_t* blob_ptr = inputBlob.cbuffer().as<const uint8_t*>();
+    if (blob_ptr == nullptr || mem_ptr.data() == nullptr) {
+        THROW_IE_EXCEPTION << str_not_allocated;
+    }
+
+    if (blob_ptr == mem_ptr.data() && inputBlob.byteSize() == memory.size()) {
+        // input memory was allocated by cldnn engine and wasn't overwritten by user, the data is in place
+        return;
+    }
+
+    switch (prec) {
+        case Precision::FP32:
+        case Precision::FP16:
+        case Precision::U8:
+        case Precision::BOOL:
+        case Precision::I32:
+        case Precision::I64: {
+            // copy the user blob into the request-owned staging buffer; this is the
+            // transfer the copy-engine thread hides behind the previous request
+            std::copy(blob_ptr, blob_ptr + std::min(inputBlob.byteSize(), static_cast<size_t>(memory.size())), mem_ptr.data());
+            break;
         }
-    } else {
-        // Otherwise, we have to attach to user memory and then copy the data.
-        copyInputData(_nw_ptr, inputName, inputLayout, inputBlob);
+        default:
+            THROW_IE_EXCEPTION << "Unsupported input precision " << prec;
     }
 }
 
+void CLDNNInferRequest::BindInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    cldnn::primitive_id internalName = "input:" + inputName;
+    auto prec = inputBlob.getTensorDesc().getPrecision();
+
+    // I16 inputs were converted into the fp32 staging buffer during the upload
+    const cldnn::memory& memory = (prec == Precision::I16)
+        ? inputsMemory.at(inputName + fp32_suffix)
+        : inputsMemory.at(inputName);
+
+    m_graph->GetNetwork()->set_input_data(internalName, memory);
+}
+
 void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
     // now try to get execution results
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
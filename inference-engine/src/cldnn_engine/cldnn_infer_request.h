@@ -46,9 +46,30 @@ public:
     void EnableProfiling() { m_useProfiling = true; }
     void EnableStreams() { m_useStreams = true; }
 
+    /**
+     * @brief Runs pre-processing and uploads user input blobs into this request's staging buffers.
+     * Intended for the dedicated copy-engine thread, so the upload of one request overlaps kernel
+     * execution of the previously enqueued one.
+     */
+    void PrepareInputs();
+
+    /**
+     * @brief Binds the pre-uploaded staging buffers and enqueues the network execution without
+     * waiting for results. Outputs are redirected to this request's staging buffers, so the device
+     * may start the next enqueued request while results of this one are still being read back.
+     */
+    void StartPipeline();
+
+    /**
+     * @brief Waits for the output events of this request only and copies the results to user blobs.
+     */
+    void WaitPipeline();
+
 protected:
     std::map<std::string, cldnn::memory> inputsMemory;
+    std::map<std::string, cldnn::memory> outputsMemory;
     std::map<std::string, cldnn::primitive_id> outputsMap;
+    std::map<cldnn::primitive_id, cldnn::network_output> m_internalOutputs;
 
     bool m_useProfiling;
     bool m_useStreams;
@@ -72,10 +93,10 @@ protected:
     void AllocateOutputs();
     void AllocateInputsDyn();
     void AllocateOutputsDyn();
-    void execAndParse();
     void execAndParseDyn();
 
-    void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    void UploadInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    void BindInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
     void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
 
 private:
@@ -299,6 +299,11 @@ class typedCLDNNExecutionContext : public TpublicContextAPI,
         }
 
         _impl.release_lock();
+
+        // a decoder typically cycles over a fixed ring of surfaces, so the whole pool
+        // gets imported here once at setup time; later SetBlob calls for the same
+        // surfaces only rotate over already shared memory objects
+        getBlobImpl(ret->as<gpu::ClBlob>())->allocate_if_needed();
         return ret;
     }
 
@@ -16,5 +16,6 @@ struct GNAFlags {
     bool gna_openmp_multithreading = false;
     bool sw_fp32 = false;
     bool performance_counting = false;
+    bool frame_batching = false;
 };
 }  // namespace GNAPluginNS
@@ -4,6 +4,7 @@
 
 #include "gna_device.hpp"
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <cstring>
@@ -24,29 +25,136 @@
 #include "details/ie_exception.hpp"
 #include "gna_plugin_log.hpp"
 
+// pool granularity: blocks are carved at page boundaries and a fresh slab is pinned with
+// a generous minimum so that a rotation over several small models reuses one slab
+static constexpr uint32_t gnaPoolAlignment = 4096;
+static constexpr uint32_t gnaMinSlabSize = 8 * 1024 * 1024;
+
+static uint32_t alignUp(uint32_t value, uint32_t alignment) {
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+uint8_t* GNADeviceHelper::allocFromPool(uint32_t size_requested, uint32_t *size_granted) {
+    const uint32_t sizeAligned = alignUp(size_requested, gnaPoolAlignment);
+    MemorySlab *bestSlab = nullptr;
+    MemoryBlock *bestBlock = nullptr;
+    for (auto & slab : memorySlabs) {
+        for (auto & block : slab.blocks) {
+            if (block.used || block.size < sizeAligned) {
+                continue;
+            }
+            // best fit keeps large free blocks intact for the bigger models of the rotation
+            if (bestBlock == nullptr || block.size < bestBlock->size) {
+                bestSlab = &slab;
+                bestBlock = &block;
+            }
+        }
+    }
+    if (bestBlock == nullptr) {
+        return nullptr;
+    }
+    if (bestBlock->size - sizeAligned >= gnaPoolAlignment) {
+        MemoryBlock remainder{bestBlock->offset + sizeAligned, bestBlock->size - sizeAligned, false};
+        bestBlock->size = sizeAligned;
+        auto blockIdx = bestBlock - bestSlab->blocks.data();
+        bestSlab->blocks.insert(bestSlab->blocks.begin() + blockIdx + 1, remainder);
+        bestBlock = &bestSlab->blocks[blockIdx];
+    }
+    bestBlock->used = true;
+    *size_granted = bestBlock->size;
+    return bestSlab->base + bestBlock->offset;
+}
+
+void GNADeviceHelper::mergeFreeBlocks(MemorySlab& slab) {
+    for (size_t i = 0; i + 1 < slab.blocks.size();) {
+        auto & current = slab.blocks[i];
+        auto & next = slab.blocks[i + 1];
+        if (!current.used && !next.used) {
+            current.size += next.size;
+            slab.blocks.erase(slab.blocks.begin() + i + 1);
+        } else {
+            i++;
+        }
+    }
+}
+
 uint8_t* GNADeviceHelper::alloc(uint32_t size_requested, uint32_t *size_granted) {
+    // serve from already pinned slabs first, so model swaps do not re-pin memory
+    auto pooled = allocFromPool(size_requested, size_granted);
+    if (pooled != nullptr) {
+        dumpXNNROPtr = pooled;
+        dumpXNNROSize = *size_granted;
+        return pooled;
+    }
+
     void * memPtr;
+    uint32_t slabRequested = std::max(alignUp(size_requested, gnaPoolAlignment), gnaMinSlabSize);
+    uint32_t slabGranted = 0;
 #if GNA_LIB_VER == 1
-    memPtr = GNAAlloc(nGNAHandle, size_requested, size_granted);
+    memPtr = GNAAlloc(nGNAHandle, slabRequested, &slabGranted);
 #else
-    const auto status = Gna2MemoryAlloc(size_requested, size_granted, &memPtr);
+    const auto status = Gna2MemoryAlloc(slabRequested, &slabGranted, &memPtr);
     checkGna2Status(status);
 #endif
-    if (memPtr == nullptr) {
-        THROW_GNA_EXCEPTION << "GNAAlloc failed to allocate memory. Requested: " << size_requested << " Granted: " << *(size_granted);
+    if (memPtr == nullptr || slabGranted < size_requested) {
+        THROW_GNA_EXCEPTION << "GNAAlloc failed to allocate memory. Requested: " << size_requested << " Granted: " << slabGranted;
     }
-    dumpXNNROPtr = memPtr;
+    memorySlabs.push_back({static_cast<uint8_t *>(memPtr), slabGranted, {{0, slabGranted, false}}});
+
+    pooled = allocFromPool(size_requested, size_granted);
+    IE_ASSERT(pooled != nullptr);
+    dumpXNNROPtr = pooled;
     dumpXNNROSize = *size_granted;
-    return static_cast<uint8_t *>(memPtr);
+    return pooled;
 }
 
 void GNADeviceHelper::free(void * ptr) {
+    // blocks return to the pool and merge with free neighbours; the slab stays pinned
+    // until the device is closed or defragmentMemoryPool() drops fully free slabs
+    for (auto & slab : memorySlabs) {
+        if (ptr < slab.base || ptr >= slab.base + slab.size) {
+            continue;
+        }
+        const auto offset = static_cast<uint32_t>(static_cast<uint8_t *>(ptr) - slab.base);
+        for (auto & block : slab.blocks) {
+            if (block.offset == offset && block.used) {
+                block.used = false;
+                mergeFreeBlocks(slab);
+                return;
+            }
+        }
+    }
+    THROW_GNA_EXCEPTION << "Attempt to free a pointer which was not allocated by the device memory pool";
+}
+
+void GNADeviceHelper::defragmentMemoryPool() {
+    for (auto slab = memorySlabs.begin(); slab != memorySlabs.end();) {
+        mergeFreeBlocks(*slab);
+#if GNA_LIB_VER != 1
+        // GNA1 frees the whole region with the handle, individual slabs cannot be unpinned
+        if (slab->blocks.size() == 1 && !slab->blocks.front().used) {
+            const auto status = Gna2MemoryFree(slab->base);
+            checkGna2Status(status);
+            slab = memorySlabs.erase(slab);
+            continue;
+        }
+#endif
+        ++slab;
+    }
+}
+
+void GNADeviceHelper::releaseSlabs() {
 #if GNA_LIB_VER == 1
-    GNAFree(nGNAHandle);
+    if (!memorySlabs.empty()) {
+        GNAFree(nGNAHandle);
+    }
 #else
-    const auto status = Gna2MemoryFree(ptr);
-    checkGna2Status(status);
+    for (auto & slab : memorySlabs) {
+        const auto status = Gna2MemoryFree(slab.base);
+        checkGna2Status(status);
+    }
 #endif
+    memorySlabs.clear();
 }
 
 #if GNA_LIB_VER == 1
@@ -365,6 +473,7 @@ void GNADeviceHelper::open(uint8_t n_threads) {
 }
 
 void GNADeviceHelper::close() {
+    releaseSlabs();
 #if GNA_LIB_VER == 1
     GNADeviceClose(nGNAHandle);
     nGNAHandle = 0;
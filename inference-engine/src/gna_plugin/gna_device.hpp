@@ -9,6 +9,7 @@
 #include <string>
 #include <map>
 #include <thread>
+#include <vector>
 
 #include <ie_common.h>
 
@@ -88,6 +89,12 @@ public:
 
     uint8_t *alloc(uint32_t size_requested, uint32_t *size_granted);
 
+    /**
+     * merges neighbouring free blocks in every slab and unpins slabs which became
+     * completely free, compacting the accelerator-visible memory region
+     */
+    void defragmentMemoryPool();
+
 #if GNA_LIB_VER == 1
     void propagateSync(const intel_nnet_type_t *pNeuralNetwork,
                        const uint32_t *pActiveIndices,
@@ -149,6 +156,26 @@ public:
     void getGnaPerfCounters(std::map<std::string,
                         InferenceEngine::InferenceEngineProfileInfo>& retPerfCounters);
  private:
+    /**
+     * accelerator-visible memory is pooled in pinned slabs: free() returns blocks to the
+     * pool instead of unpinning, so rotating between models reuses already pinned memory
+     */
+    struct MemoryBlock {
+        uint32_t offset;
+        uint32_t size;
+        bool used;
+    };
+    struct MemorySlab {
+        uint8_t *base;
+        uint32_t size;
+        std::vector<MemoryBlock> blocks;
+    };
+    std::vector<MemorySlab> memorySlabs;
+
+    uint8_t *allocFromPool(uint32_t size_requested, uint32_t *size_granted);
+    static void mergeFreeBlocks(MemorySlab& slab);
+    void releaseSlabs();
+
     void open(uint8_t const n_threads);
 
     void close();
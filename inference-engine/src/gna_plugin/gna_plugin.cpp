@@ -4,6 +4,7 @@
 
 #define NOMINMAX
 
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <vector>
@@ -17,6 +18,8 @@
 #include <memory>
 #include <utility>
 #include <limits>
+#include <fstream>
+#include <sstream>
 
 #include <low_precision_transformations/blob_transformation.hpp>
 #include <graph_tools.hpp>
@@ -348,6 +351,15 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
         THROW_GNA_EXCEPTION << error.c_str();
     }
 
+    // import a previously compiled model when the compile cache holds one for this network / config pair
+    std::string compileCacheFile;
+    if (!config.compileCacheDir.empty()) {
+        compileCacheFile = GetCompileCacheFileName(network);
+        if (!compileCacheFile.empty() && TryImportCachedNetwork(compileCacheFile, network)) {
+            return;
+        }
+    }
+
     // network optimisation phases
     int passIdx = 0;
     auto run_passes = [&] (const CNNNetPtr& network, bool runBeforeCopy) {
@@ -740,6 +752,16 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
 #if GNA_LIB_VER == 2
     createRequestConfigsForGnaModels();
 #endif
+
+    if (!compileCacheFile.empty()) {
+        // populate the compile cache so subsequent LoadNetwork calls skip graph compilation,
+        // a failure to write the entry must not fail the load itself
+        try {
+            Export(compileCacheFile);
+        } catch (const std::exception &e) {
+            gnawarn() << "Cannot write compile cache entry " << compileCacheFile << ": " << e.what() << std::endl;
+        }
+    }
 }
 
 #if GNA_LIB_VER == 2
@@ -1075,9 +1097,83 @@ void GNAPlugin::Infer(const InferenceEngine::Blob &input, InferenceEngine::Blob
 }
 
 void GNAPlugin::Infer(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result) {
+    if (gnaFlags->frame_batching) {
+        InferFrameBatched(input, result);
+        return;
+    }
     Wait(QueueInference(input, result));
 }
 
+void GNAPlugin::InferFrameBatched(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result) {
+    FrameBatchSlot slot;
+    slot.input = &input;
+    slot.result = &result;
+
+    std::unique_lock<std::mutex> lock(frameBatchMutex);
+    pendingFrames.push_back(&slot);
+    frameBatchCondVar.notify_all();
+
+    // wait until either a leader finished this slot, or this thread is the first pending
+    // frame with no leader running - then it becomes the leader of the next sweep
+    while (!slot.done && (frameBatchLeaderActive || pendingFrames.front() != &slot)) {
+        frameBatchCondVar.wait(lock);
+    }
+    if (slot.done) {
+        if (slot.exception) {
+            std::rethrow_exception(slot.exception);
+        }
+        return;
+    }
+
+    // give the other submitting threads a short window to catch up, so that more
+    // requests go to the device in one sweep; a sweep never exceeds the number of
+    // infer request slots the device queue was sized for
+    frameBatchLeaderActive = true;
+    const size_t maxInFlight = gnaFlags->gna_lib_async_threads_num;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds{1};
+    while (pendingFrames.size() < maxInFlight &&
+           frameBatchCondVar.wait_until(lock, deadline) != std::cv_status::timeout) {
+    }
+
+    std::vector<FrameBatchSlot*> sweep;
+    while (!pendingFrames.empty() && sweep.size() < maxInFlight) {
+        sweep.push_back(pendingFrames.front());
+        pendingFrames.pop_front();
+    }
+    lock.unlock();
+
+    // keep the accelerator queue full: enqueue every request of the sweep first and only
+    // then collect the results, instead of paying a submit-wait round trip per request
+    for (auto queuedSlot : sweep) {
+        try {
+            queuedSlot->requestId = QueueInference(*queuedSlot->input, *queuedSlot->result);
+            queuedSlot->queued = true;
+        } catch (...) {
+            queuedSlot->exception = std::current_exception();
+        }
+    }
+    for (auto syncedSlot : sweep) {
+        if (!syncedSlot->queued) continue;
+        try {
+            Wait(syncedSlot->requestId);
+        } catch (...) {
+            syncedSlot->exception = std::current_exception();
+        }
+    }
+
+    lock.lock();
+    for (auto finishedSlot : sweep) {
+        finishedSlot->done = true;
+    }
+    frameBatchLeaderActive = false;
+    frameBatchCondVar.notify_all();
+    lock.unlock();
+
+    if (slot.exception) {
+        std::rethrow_exception(slot.exception);
+    }
+}
+
 Blob::Ptr GNAPlugin::GetOutputBlob(const std::string& name, InferenceEngine::Precision precision) {
     // need to have intermediate blob for interleave conversion
     InferenceEngine::Blob::Ptr outputBlob;
@@ -1113,6 +1209,94 @@ void GNAPlugin::SetName(const std::string & pluginName) noexcept {
     _pluginName = pluginName;
 }
 
+static uint64_t fnv1aHash(uint64_t hash, const void *data, size_t size) {
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static uint64_t fnv1aHash(uint64_t hash, const std::string &str) {
+    return fnv1aHash(hash, str.data(), str.size());
+}
+
+std::string GNAPlugin::GetCompileCacheFileName(const InferenceEngine::ICNNNetwork& network) const {
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+    // the serialized model format keeps a single input / output descriptor pair only
+    if (inputs.size() != 1 || outputs.size() != 1) {
+        return "";
+    }
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (auto && layer : CNNNetSortTopologically(network)) {
+        hash = fnv1aHash(hash, layer->name);
+        hash = fnv1aHash(hash, layer->type);
+        hash = fnv1aHash(hash, layer->precision.name());
+        for (auto && param : layer->params) {
+            hash = fnv1aHash(hash, param.first);
+            hash = fnv1aHash(hash, param.second);
+        }
+        for (auto && blob : layer->blobs) {
+            hash = fnv1aHash(hash, blob.first);
+            if (blob.second != nullptr && blob.second->cbuffer() != nullptr) {
+                hash = fnv1aHash(hash, blob.second->cbuffer().as<const void *>(), blob.second->byteSize());
+            }
+        }
+    }
+    // the compiled model also depends on the whole plugin configuration
+    for (auto && option : config.key_config_map) {
+        hash = fnv1aHash(hash, option.first);
+        hash = fnv1aHash(hash, option.second);
+    }
+
+    std::ostringstream fileName;
+    fileName << config.compileCacheDir << "/" << network.getName() << "_" << std::hex << hash << ".gnamodel";
+    return fileName.str();
+}
+
+bool GNAPlugin::TryImportCachedNetwork(const std::string& fileName, const InferenceEngine::ICNNNetwork& network) {
+    std::fstream inputStream(fileName, ios_base::in | ios_base::binary);
+    if (inputStream.fail()) {
+        return false;
+    }
+    try {
+        // validate the header before any plugin state is touched - a corrupt or incompatible
+        // cache entry has to fall back to the normal compilation path
+        GNAModelSerial::ReadHeader(inputStream);
+    } catch (const std::exception &e) {
+        gnawarn() << "Compile cache entry " << fileName << " is not usable: " << e.what() << std::endl;
+        return false;
+    }
+    inputStream.close();
+
+    ImportNetwork(fileName);
+
+    // the serialized model does not keep port names, restore them from the original network
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+    auto inputName = inputs.begin()->first;
+    auto outputName = outputs.begin()->first;
+    if (inputName != "input") {
+        inputsDataMap[inputName] = inputsDataMap["input"];
+        inputsDataMap.erase("input");
+        inputsDesc->ptr_inputs_global_id[inputName] = inputsDesc->ptr_inputs_global_id["input"];
+        inputsDesc->ptr_inputs_global_id.erase("input");
+        inputsDesc->orientation_in[inputName] = inputsDesc->orientation_in["input"];
+        inputsDesc->orientation_in.erase("input");
+    }
+    if (outputName != "output") {
+        outputsDataMap[outputName] = outputsDataMap["output"];
+        outputsDataMap.erase("output");
+    }
+    return true;
+}
+
 InferenceEngine::IExecutableNetwork::Ptr GNAPlugin::ImportNetwork(const std::string &modelFileName) {
     // no need to return anything dueto weird design of internal base classes
     std::fstream inputStream(modelFileName, ios_base::in | ios_base::binary);
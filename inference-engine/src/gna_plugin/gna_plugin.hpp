@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <list>
 #include <string>
@@ -84,6 +87,27 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
 
+    /**
+     * @brief a synchronous infer call waiting to be submitted to the device as part of a sweep
+     */
+    struct FrameBatchSlot {
+        const InferenceEngine::BlobMap *input = nullptr;
+        InferenceEngine::BlobMap *result = nullptr;
+        uint32_t requestId = 0;
+        bool queued = false;
+        bool done = false;
+        std::exception_ptr exception;
+    };
+    std::deque<FrameBatchSlot*> pendingFrames;
+    std::mutex frameBatchMutex;
+    std::condition_variable frameBatchCondVar;
+    bool frameBatchLeaderActive = false;
+
+    /**
+     * @brief packs concurrent synchronous infer calls into one device submission sweep
+     */
+    void InferFrameBatched(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result);
+
  public:
     explicit GNAPlugin(const std::map<std::string, std::string>& configMap);
     /**
@@ -177,6 +201,19 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
 
     void DumpXNNToFile() const;
 
+    /**
+     * computes the compile cache file name for a network / config combination,
+     * empty string marks a network the model serializer cannot represent
+     */
+    std::string GetCompileCacheFileName(const InferenceEngine::ICNNNetwork& network) const;
+
+    /**
+     * imports a previously compiled model from the compile cache and renames the
+     * serialized input / output descriptors after the original network ports
+     * @return true when the cached model was imported, false when no usable cache entry exists
+     */
+    bool TryImportCachedNetwork(const std::string& fileName, const InferenceEngine::ICNNNetwork& network);
+
     void ImportFrames(void *ptr_dst,
                      const void *ptr_src,
                      InferenceEngine::Precision input_precision,
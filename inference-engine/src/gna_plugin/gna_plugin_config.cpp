@@ -93,6 +93,8 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
             dumpXNNPath = value;
         } else if (key == GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE_GENERATION)) {
             dumpXNNGeneration = value;
+        } else if (key == GNA_CONFIG_KEY(COMPILE_CACHE_DIR)) {
+            compileCacheDir = value;
         } else if (key == GNA_CONFIG_KEY(DEVICE_MODE)) {
             auto procType = supported_values.find(value);
             if (procType == supported_values.end()) {
@@ -182,6 +184,15 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                                     << ", should be greater than 0 and less than 127";
             }
             gnaFlags.gna_lib_async_threads_num = lib_threads;
+        } else if (key == GNA_CONFIG_KEY(FRAME_BATCHING)) {
+            if (value == PluginConfigParams::YES) {
+                gnaFlags.frame_batching = true;
+            } else if (value == PluginConfigParams::NO) {
+                gnaFlags.frame_batching = false;
+            } else {
+                log << "GNA frame batching should be YES/NO, but not " << value;
+                THROW_GNA_EXCEPTION << "GNA frame batching should be YES/NO, but not " << value;
+            }
         } else if (key == CONFIG_KEY(SINGLE_THREAD)) {
             if (value == PluginConfigParams::YES) {
                 gnaFlags.gna_openmp_multithreading = false;
@@ -221,6 +232,7 @@ void Config::AdjustKeyMapValues() {
     }
     key_config_map[GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE)] = dumpXNNPath;
     key_config_map[GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE_GENERATION)] = dumpXNNGeneration;
+    key_config_map[GNA_CONFIG_KEY(COMPILE_CACHE_DIR)] = compileCacheDir;
 
     std::string device_mode;
     if (gnaFlags.sw_fp32) {
@@ -253,6 +265,8 @@ void Config::AdjustKeyMapValues() {
     key_config_map[CONFIG_KEY(PERF_COUNT)] =
             gnaFlags.performance_counting ? PluginConfigParams::YES: PluginConfigParams::NO;
     key_config_map[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
+    key_config_map[GNA_CONFIG_KEY(FRAME_BATCHING)] =
+            gnaFlags.frame_batching ? PluginConfigParams::YES: PluginConfigParams::NO;
     key_config_map[CONFIG_KEY(SINGLE_THREAD)] =
             gnaFlags.gna_openmp_multithreading ? PluginConfigParams::NO: PluginConfigParams::YES;
 }
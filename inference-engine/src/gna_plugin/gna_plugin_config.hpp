@@ -31,6 +31,7 @@ struct Config {
 
     std::string dumpXNNPath;
     std::string dumpXNNGeneration;
+    std::string compileCacheDir;
 
 #if GNA_LIB_VER == 1
     intel_gna_proc_t gna_proc_type = static_cast<intel_gna_proc_t>(GNA_SOFTWARE & GNA_HARDWARE);
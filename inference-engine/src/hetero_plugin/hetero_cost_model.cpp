@@ -0,0 +1,108 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_cost_model.hpp"
+
+#include <details/ie_cnn_network_tools.h>
+
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace HeteroPlugin;
+
+namespace {
+
+float tensorElements(const DataPtr &data) {
+    float elements = 1.f;
+    if (nullptr != data) {
+        for (auto dim : data->getTensorDesc().getDims()) {
+            elements *= dim;
+        }
+    }
+    return elements;
+}
+
+}  // namespace
+
+HeteroCostModel::HeteroCostModel(const std::string &cacheFile) {
+    if (cacheFile.empty()) {
+        return;
+    }
+    std::ifstream file(cacheFile);
+    std::string line;
+    while (std::getline(file, line)) {
+        auto comment = line.find('#');
+        if (comment != std::string::npos) {
+            line = line.substr(0, comment);
+        }
+        std::istringstream record(line);
+        std::string device, key;
+        float cost = 0.f;
+        if (record >> device >> key >> cost) {
+            _costs[device + " " + key] = cost;
+        }
+    }
+}
+
+float HeteroCostModel::layerCost(const CNNLayerPtr &layer, const std::string &device) const {
+    auto it = _costs.find(device + " layer:" + layer->name);
+    if (it != _costs.end()) {
+        return it->second;
+    }
+    float elements = layer->outData.empty() ? 1.f : tensorElements(layer->outData[0]);
+    it = _costs.find(device + " type:" + layer->type);
+    return (it != _costs.end() ? it->second : 1.f) * elements;
+}
+
+float HeteroCostModel::transferCost(const DataPtr &data, const std::string &device) const {
+    auto it = _costs.find(device + " transfer");
+    return (it != _costs.end() ? it->second : 1.f) * tensorElements(data);
+}
+
+void HeteroCostModel::assignAffinities(const ICNNNetwork &network,
+                                       const std::vector<std::string> &fallbackDevices,
+                                       const std::map<std::string, QueryNetworkResult> &queryResults,
+                                       std::map<std::string, std::string> &layersToDevices) const {
+    auto sortedLayers = details::CNNNetSortTopologically(network);
+    for (auto &layer : sortedLayers) {
+        float bestCost = std::numeric_limits<float>::max();
+        std::string bestDevice;
+        for (auto &device : fallbackDevices) {
+            auto query = queryResults.find(device);
+            if (query == queryResults.end() ||
+                query->second.supportedLayersMap.find(layer->name) == query->second.supportedLayersMap.end()) {
+                continue;
+            }
+            float cost = layerCost(layer, device);
+            // producers already assigned to another device pay for moving their output across the cut
+            for (auto &inData : layer->insData) {
+                auto input = inData.lock();
+                if (nullptr == input) {
+                    continue;
+                }
+                auto producer = input->getCreatorLayer().lock();
+                if (nullptr == producer) {
+                    continue;
+                }
+                auto assigned = layersToDevices.find(producer->name);
+                if (assigned != layersToDevices.end() && assigned->second != device) {
+                    cost += transferCost(input, device);
+                }
+            }
+            // strict comparison keeps the device priority order on equal costs
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestDevice = device;
+            }
+        }
+        if (!bestDevice.empty()) {
+            layersToDevices[layer->name] = bestDevice;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_core.hpp>
+#include <ie_icnn_network.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Relative cost model used for the automatic affinity assignment.
+ *
+ * The cost of a layer defaults to the number of elements it produces; a transfer across
+ * a device boundary costs the number of elements of the tensor crossing it. Both can be
+ * overridden from a cache file with measured values, so the partitioning improves between
+ * runs without re-tuning affinities by hand.
+ *
+ * Cache file format - one record per line, '#' starts a comment:
+ *   <device> layer:<layer name> <cost>   measured cost of the named layer on the device
+ *   <device> type:<layer type>  <factor> per-output-element factor for the layer type
+ *   <device> transfer           <factor> per-element cost of moving a tensor to/from the device
+ */
+class HeteroCostModel {
+public:
+    explicit HeteroCostModel(const std::string &cacheFile);
+
+    float layerCost(const InferenceEngine::CNNLayerPtr &layer, const std::string &device) const;
+
+    float transferCost(const InferenceEngine::DataPtr &data, const std::string &device) const;
+
+    /**
+     * @brief Assigns a device to every supported layer minimizing the summary cost.
+     *
+     * Layers are visited in topological order; for each of them the device with the smallest
+     * own cost plus transfer penalties on the edges to the already assigned producers wins,
+     * ties go to the device listed earlier in the priority list. The greedy scheme does not
+     * enumerate all possible cuts, but with the default costs it degenerates to the
+     * priority-ordered fallback policy and with measured costs it moves the split points
+     * away from the expensive boundaries.
+     */
+    void assignAffinities(const InferenceEngine::ICNNNetwork &network,
+                          const std::vector<std::string> &fallbackDevices,
+                          const std::map<std::string, InferenceEngine::QueryNetworkResult> &queryResults,
+                          std::map<std::string, std::string> &layersToDevices) const;
+
+private:
+    // key: "<device> layer:<name>", "<device> type:<type>" or "<device> transfer"
+    std::map<std::string, float> _costs;
+};
+
+}  // namespace HeteroPlugin
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <string>
 #include <memory>
+#include <sstream>
 #include <unordered_set>
 #include <array>
 #include <cstdint>
@@ -337,6 +338,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     using namespace XMLParseUtils;
 
     pugi::xml_node heteroNode = heteroXmlDoc.document_element();
+    _name = GetStrAttr(heteroNode, "name", "");
 
     std::unordered_set<std::string> networkInputs;
     pugi::xml_node inputsNode = heteroNode.child("inputs");
@@ -432,10 +434,16 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
             }
         }
 
+        // keep the subnetwork metadata verbatim: when no cloned network is retained
+        // it cannot be regenerated for a subsequent export
+        std::stringstream importedMeta;
+        subnetworkNode.print(importedMeta, "", pugi::format_raw);
+
         descs.emplace_back(NetworkDesc{
             deviceName,
             loaded ? CNNNetwork{cloneNet(static_cast<InferenceEngine::ICNNNetwork&>(cnnnetwork))} : CNNNetwork{},
             executableNetwork,
+            importedMeta.str(),
         });
     }
 
@@ -459,6 +467,14 @@ void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
 
     auto subnetworksNode = heteroNode.append_child("subnetworks");
     for (auto&& subnetwork : networks) {
+        if (!subnetwork._importedMeta.empty()) {
+            // this network was imported: replay the metadata captured from the
+            // imported blob, so an imported network can be exported again
+            auto res = subnetworksNode.append_buffer(subnetwork._importedMeta.c_str(),
+                                                     subnetwork._importedMeta.size());
+            IE_ASSERT(pugi::status_ok == res.status);
+            continue;
+        }
         auto subnetworkNode = subnetworksNode.append_child("subnetwork");
         subnetworkNode.append_attribute("device").set_value(subnetwork._device.c_str());
         auto subnetworkInputsNode = subnetworkNode.append_child("inputs");
@@ -662,6 +678,9 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         for (auto&& desc : networks) {
             value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
+        // subnetworks form a pipeline: every segment computes a different in-flight request,
+        // so it takes at least one request per segment to keep all of them busy
+        value = std::max(value, static_cast<unsigned int>(networks.size()));
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
         // find metric key among plugin metrics
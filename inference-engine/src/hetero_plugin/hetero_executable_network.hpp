@@ -68,6 +68,10 @@ private:
         std::string                                 _device;
         InferenceEngine::CNNNetwork                 _clonedNetwork;
         InferenceEngine::ExecutableNetwork          _network;
+        // serialized <subnetwork> metadata captured by the import constructor; a
+        // natively imported subnetwork keeps no cloned network to regenerate the
+        // metadata from, so ExportImpl replays this copy instead
+        std::string                                 _importedMeta;
     };
     std::vector<NetworkDesc> networks;
 
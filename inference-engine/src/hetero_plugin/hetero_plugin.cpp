@@ -15,6 +15,7 @@
 #include "hetero/hetero_plugin_config.hpp"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include "hetero_executable_network.hpp"
+#include "hetero_cost_model.hpp"
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::PluginConfigParams;
@@ -30,7 +31,10 @@ static Version heteroPluginDescription = {
 
 Engine::Engine() {
     _pluginName = "HETERO";
-    _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
+    // subnetworks of in-flight requests execute concurrently on their devices, so boundary
+    // transfers and compute of consecutive requests overlap; the exclusive mode funnels all
+    // subrequests through one executor and may still be requested explicitly
+    _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = NO;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
 }
 
@@ -165,6 +169,83 @@ void Engine::SetAffinity(InferenceEngine::ICNNNetwork &network, const Configs &c
     }
 }
 
+std::string Engine::DeviceCacheKey(const std::string &deviceName, const Configs &config) const {
+    std::string key = deviceName;
+    try {
+        key += "/" + GetCore()->GetMetric(deviceName, METRIC_KEY(FULL_DEVICE_NAME)).as<std::string>();
+    } catch (const details::InferenceEngineException &) {
+        // devices without the metric are identified by the name alone
+    }
+    for (auto&& kvp : config) {
+        key += "/" + kvp.first + "=" + kvp.second;
+    }
+    return key;
+}
+
+QueryNetworkResult Engine::QueryDeviceCached(const ICNNNetwork &network, const std::string &deviceName,
+                                             const Configs &config) const {
+    std::map<std::string, std::vector<std::string>> layersPerType;
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        CNNLayer::Ptr layer = *i;
+        layersPerType[layer->type].push_back(layer->name);
+        i++;
+    }
+
+    auto cacheKey = DeviceCacheKey(deviceName, config);
+    {
+        std::lock_guard<std::mutex> lock{_queryCacheMutex};
+        auto itEntry = _queryCache.find(cacheKey);
+        if (itEntry != _queryCache.end()) {
+            bool decidable = true;
+            for (auto&& typeLayers : layersPerType) {
+                auto itVerdict = itEntry->second.find(typeLayers.first);
+                if (itVerdict == itEntry->second.end() || itVerdict->second == TypeVerdict::Mixed) {
+                    decidable = false;
+                    break;
+                }
+            }
+            if (decidable) {
+                QueryNetworkResult result;
+                for (auto&& typeLayers : layersPerType) {
+                    if (itEntry->second[typeLayers.first] != TypeVerdict::Supported) {
+                        continue;
+                    }
+                    for (auto&& layerName : typeLayers.second) {
+                        result.supportedLayersMap[layerName] = deviceName;
+                    }
+                }
+                result.rc = StatusCode::OK;
+                return result;
+            }
+        }
+    }
+
+    auto result = GetCore()->QueryNetwork(network, deviceName, config);
+
+    // fold the fresh answer into the per-type verdicts; a disagreement with an
+    // earlier query means the device decides by layer parameters, not by type
+    std::lock_guard<std::mutex> lock{_queryCacheMutex};
+    auto &verdicts = _queryCache[cacheKey];
+    for (auto&& typeLayers : layersPerType) {
+        bool all = true;
+        bool any = false;
+        for (auto&& layerName : typeLayers.second) {
+            bool supported = result.supportedLayersMap.find(layerName) != result.supportedLayersMap.end();
+            all = all && supported;
+            any = any || supported;
+        }
+        auto verdict = all ? TypeVerdict::Supported : any ? TypeVerdict::Mixed : TypeVerdict::Unsupported;
+        auto itVerdict = verdicts.find(typeLayers.first);
+        if (itVerdict == verdicts.end()) {
+            verdicts[typeLayers.first] = verdict;
+        } else if (itVerdict->second != verdict) {
+            itVerdict->second = TypeVerdict::Mixed;
+        }
+    }
+    return result;
+}
+
 void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, QueryNetworkResult &qr) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
@@ -180,26 +261,38 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
     DeviceMetaInformationMap metaDevices = GetDevicePlugins(fallbackDevicesStr, tconfig);
 
     std::map<std::string, QueryNetworkResult> queryResults;
-    // go over devices and call query network
+    // go over devices and call query network, reusing cached verdicts where possible
     for (auto&& metaDevice : metaDevices) {
         auto& deviceName = metaDevice.first;
-        queryResults[deviceName] = GetCore()->QueryNetwork(network, deviceName, metaDevice.second);
+        queryResults[deviceName] = QueryDeviceCached(network, deviceName, metaDevice.second);
     }
 
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
-    details::CNNNetworkIterator i(&network);
-    while (i != details::CNNNetworkIterator()) {
-        CNNLayer::Ptr layer = *i;
-        for (auto&& deviceName : fallbackDevices) {
-            auto& deviceQueryResult = queryResults[deviceName];
-            if (deviceQueryResult.supportedLayersMap.find(layer->name) != deviceQueryResult.supportedLayersMap.end()) {
-                qr.supportedLayersMap[layer->name] = deviceName;
-                break;
+    auto itCostModel = tconfig.find(HETERO_CONFIG_KEY(COST_MODEL));
+    if (itCostModel != tconfig.end() && itCostModel->second == YES) {
+        // spread the layers over the devices by estimated costs instead of the plain priority order
+        std::string cacheFile;
+        auto itCache = tconfig.find(HETERO_CONFIG_KEY(COST_MODEL_CACHE));
+        if (itCache != tconfig.end()) {
+            cacheFile = itCache->second;
+        }
+        HeteroCostModel costModel(cacheFile);
+        costModel.assignAffinities(network, fallbackDevices, queryResults, qr.supportedLayersMap);
+    } else {
+        details::CNNNetworkIterator i(&network);
+        while (i != details::CNNNetworkIterator()) {
+            CNNLayer::Ptr layer = *i;
+            for (auto&& deviceName : fallbackDevices) {
+                auto& deviceQueryResult = queryResults[deviceName];
+                if (deviceQueryResult.supportedLayersMap.find(layer->name) != deviceQueryResult.supportedLayersMap.end()) {
+                    qr.supportedLayersMap[layer->name] = deviceName;
+                    break;
+                }
             }
+            i++;
         }
-        i++;
     }
 
     // set OK status
@@ -215,6 +308,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(COST_MODEL),
+            HETERO_CONFIG_KEY(COST_MODEL_CACHE),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(FULL_DEVICE_NAME) == name) {
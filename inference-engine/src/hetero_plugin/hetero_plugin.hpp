@@ -9,6 +9,7 @@
 #include "cpp_interfaces/impl/ie_plugin_internal.hpp"
 #include "cpp/ie_plugin_cpp.hpp"
 #include <memory>
+#include <mutex>
 #include <string>
 #include <map>
 #include <unordered_map>
@@ -49,6 +50,36 @@ public:
 
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string & deviceName) const;
+
+    /**
+     * @brief Per-device QueryNetwork with a layer-type cache in front of the device round-trip.
+     *
+     * A device query may take seconds (GPU driver involvement), yet its answer is almost always
+     * a function of the layer types alone. The verdicts of past queries are therefore aggregated
+     * per type; when every type of the network has a clean verdict for the device, the supported
+     * layer set is reconstructed locally and the device is not queried at all. A type which was
+     * ever accepted for some layers only (the decision depends on the layer parameters) is marked
+     * mixed and keeps forcing real queries for the networks containing it, so the cache can never
+     * produce an affinity the device would have rejected.
+     */
+    InferenceEngine::QueryNetworkResult QueryDeviceCached(const InferenceEngine::ICNNNetwork &network,
+                                                          const std::string &deviceName,
+                                                          const Configs &config) const;
+
+    /**
+     * @brief Identity of a device as the query cache sees it.
+     *
+     * The plain device name does not pin down the answering plugin: the full device name metric
+     * carries the actual device and driver identification, and the device configuration may
+     * enable or disable implementations, so both are part of the key.
+     */
+    std::string DeviceCacheKey(const std::string &deviceName, const Configs &config) const;
+
+    enum class TypeVerdict { Supported, Unsupported, Mixed };
+    // verdicts aggregated per layer type, keyed by DeviceCacheKey(); the cache lives for
+    // the lifetime of the plugin instance, within which a driver cannot change
+    mutable std::mutex _queryCacheMutex;
+    mutable std::map<std::string, std::map<std::string, TypeVerdict>> _queryCache;
 };
 
 struct HeteroLayerColorer {
@@ -4,6 +4,7 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
@@ -52,17 +53,24 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
+        // The kernels walk the batch themselves; process every batch item in its own task instead
         if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride,
+                                        N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
+                                        1, static_cast<int>(H), static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride,
+                                         N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
+                                         1, static_cast<int>(H), static_cast<int>(W));
+            });
             return;
         }
     }
@@ -70,55 +78,62 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride,
+                                        N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
+                                        1, static_cast<int>(H), static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride,
+                                         N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
+                                         1, static_cast<int>(H), static_cast<int>(W));
+            });
             return;
         }
     }
 #endif  // HAVE_SSE
 
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
+        parallel_for2d(N, C, [&](size_t n, size_t c) {
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    src_ptr_l_l += W_src_stride;
+                    dst_ptr_l++;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
+        parallel_for2d(N, C, [&](size_t n, size_t c) {
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    dst_ptr_l += W_dst_stride;
+                    src_ptr_l_l++;
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        const size_t chunk = C * H * W;
+        parallel_for(N, [&](size_t n) {
+            data_t* dst_ptr_l = dst_ptr + n * chunk;
+            data_t* src_ptr_l = src_ptr + n * chunk;
+            for (size_t i = 0; i < chunk; i++) {
+                dst_ptr_l[i] = src_ptr_l[i];
+            }
+        });
     }
 }
 
@@ -182,19 +197,26 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
+        // The kernels walk the batch themselves; process every batch item in its own task instead
         if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                    C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride,
+                                        N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride,
+                                        H_dst_stride, C_dst_stride, 1, static_cast<int>(D), static_cast<int>(H),
+                                        static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride,
+                                         N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride,
+                                         H_dst_stride, C_dst_stride, 1, static_cast<int>(D), static_cast<int>(H),
+                                         static_cast<int>(W));
+            });
             return;
         }
     }
@@ -202,60 +224,63 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                    H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride,
+                                        N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride,
+                                        D_dst_stride, H_dst_stride, 1, static_cast<int>(D), static_cast<int>(H),
+                                        static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for(N, [&](size_t n) {
+                blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride,
+                                         N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride,
+                                         D_dst_stride, H_dst_stride, 1, static_cast<int>(D), static_cast<int>(H),
+                                         static_cast<int>(W));
+            });
             return;
         }
     }
 #endif  // HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
+        parallel_for3d(N, C, D, [&](size_t n, size_t c, size_t d) {
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    src_ptr_l_l += W_src_stride;
+                    dst_ptr_l++;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
+        parallel_for3d(N, C, D, [&](size_t n, size_t c, size_t d) {
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    dst_ptr_l += W_dst_stride;
+                    src_ptr_l_l++;
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        const size_t chunk = C * D * H * W;
+        parallel_for(N, [&](size_t n) {
+            data_t* dst_ptr_l = dst_ptr + n * chunk;
+            data_t* src_ptr_l = src_ptr + n * chunk;
+            for (size_t i = 0; i < chunk; i++) {
+                dst_ptr_l[i] = src_ptr_l[i];
+            }
+        });
     }
 }
 
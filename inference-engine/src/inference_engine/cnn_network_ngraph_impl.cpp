@@ -17,6 +17,8 @@
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pass/get_output_element_elimination.hpp>
 #include <set>
+
+#include <ie_memory_accounting.hpp>
 // #include <shape_infer/ie_reshaper.hpp>
 #include <string>
 
@@ -314,6 +316,80 @@ void CNNNetworkNGraphImpl::addOutput(const string& dataName) {
     _outputData[dataName] = data;
 }
 
+StatusCode CNNNetworkNGraphImpl::pruneOutputs(const std::vector<std::string>& outputNames,
+                                              ResponseDesc* resp) noexcept {
+    IE_PROFILING_AUTO_SCOPE(pruneOutputs)
+    if (cnnNetwork) {
+        return DescriptionBuffer(GENERAL_ERROR, resp)
+               << "Cannot prune outputs! Network was already converted to the legacy representation";
+    }
+
+    try {
+        const std::set<std::string> requested(outputNames.begin(), outputNames.end());
+        for (const auto& name : requested) {
+            if (_outputData.find(name) == _outputData.end())
+                return DescriptionBuffer(NOT_FOUND, resp) << "Cannot prune outputs! Output " << name
+                                                          << " wasn't found!";
+        }
+
+        auto resultName = [](const std::shared_ptr<::ngraph::Node>& result) {
+            const auto& input = result->get_inputs()[0];
+            std::string outName = input.get_output().get_node()->get_friendly_name();
+            if (input.get_output().get_node()->get_output_size() != 1)
+                outName += "." + std::to_string(input.get_output().get_index());
+            return outName;
+        };
+
+        ::ngraph::ResultVector keptResults;
+        for (const auto& result : _ngraph_function->get_results()) {
+            if (requested.find(resultName(result)) != requested.end())
+                keptResults.push_back(result);
+        }
+        if (keptResults.empty())
+            return DescriptionBuffer(GENERAL_ERROR, resp)
+                   << "Cannot prune outputs! At least one output should be kept";
+
+        // Rebuilding the function from the kept results drops everything which does not
+        // contribute to them. Parameters are listed explicitly so unused inputs survive
+        // and the input API of the network does not change.
+        _ngraph_function = std::make_shared<::ngraph::Function>(keptResults, _ngraph_function->get_parameters(),
+                                                                _ngraph_function->get_friendly_name());
+
+        std::unordered_set<std::string> keptData;
+        for (const auto& param : _ngraph_function->get_parameters()) {
+            keptData.insert(param->get_friendly_name());
+        }
+        for (const auto& layer : _ngraph_function->get_ordered_ops()) {
+            if (std::dynamic_pointer_cast<::ngraph::op::Result>(layer)) continue;
+            for (const auto& output : layer->outputs()) {
+                std::string outName = layer->get_friendly_name();
+                if (layer->outputs().size() != 1)
+                    outName += "." + std::to_string(output.get_index());
+                keptData.insert(outName);
+            }
+        }
+        for (auto it = _outputData.begin(); it != _outputData.end();) {
+            if (requested.find(it->first) == requested.end())
+                it = _outputData.erase(it);
+            else
+                ++it;
+        }
+        for (auto it = _data.begin(); it != _data.end();) {
+            if (keptData.find(it->first) == keptData.end()) {
+                if (auto nData = std::dynamic_pointer_cast<NGraphData>(it->second))
+                    nData->reset();
+                it = _data.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    } catch (std::exception& ex) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+    }
+
+    return OK;
+}
+
 size_t CNNNetworkNGraphImpl::getBatchSize() const noexcept {
     // TODO Provide adequate implementation.
     // The original code from CNNNetworkImpl just gets the first input and returns the first dimension.
@@ -520,6 +596,7 @@ StatusCode CNNNetworkNGraphImpl::setBatchSizeReshape(size_t size, ResponseDesc*
 
 void CNNNetworkNGraphImpl::convertToCNNNetworkImpl() {
     IE_PROFILING_AUTO_SCOPE(convertToCNNNetworkImpl)
+    MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Transform);
     if (cnnNetwork)
         return;
     auto graph = cloneFunction();
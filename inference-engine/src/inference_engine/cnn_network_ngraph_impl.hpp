@@ -91,6 +91,18 @@ public:
 
     void addOutput(const std::string& dataName);
 
+    /**
+     * @brief Keeps only the listed outputs and prunes all operations which do not
+     * contribute to them. Intended to be called before plugin compilation when only
+     * a subset of the network heads is going to be requested, so neither compile
+     * time nor inference is spent on the unused branches. Parameters are kept even
+     * if they feed pruned branches only, so the input API of the network stays intact.
+     *
+     * @param outputNames names of the outputs to keep
+     * @param resp response descriptor
+     */
+    StatusCode pruneOutputs(const std::vector<std::string>& outputNames, ResponseDesc* resp) noexcept;
+
     StatusCode getStats(ICNNNetworkStats** stats, ResponseDesc* resp) const noexcept override {
         return StatusCode::NOT_FOUND;
     }
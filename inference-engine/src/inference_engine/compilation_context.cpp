@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+#include <pugixml.hpp>
+
+#include "details/ie_exception.hpp"
+#include "ie_version.hpp"
+#include "network_serializer.h"
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief Stream buffer which does not store passed bytes, but accumulates
+ *        a FNV-1a hash over them. Allows to hash serialized network content
+ *        without materializing it in memory.
+ */
+class HashingStreamBuf : public std::streambuf {
+public:
+    uint64_t value() const {
+        return _hash;
+    }
+
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        for (std::streamsize i = 0; i < n; i++) {
+            _hash = (_hash ^ static_cast<uint8_t>(s[i])) * fnvPrime;
+        }
+        return n;
+    }
+
+    int_type overflow(int_type c) override {
+        if (c != traits_type::eof()) {
+            _hash = (_hash ^ static_cast<uint8_t>(c)) * fnvPrime;
+        }
+        return c;
+    }
+
+private:
+    static constexpr uint64_t fnvOffsetBasis = 0xcbf29ce484222325ull;
+    static constexpr uint64_t fnvPrime = 0x100000001b3ull;
+
+    uint64_t _hash = fnvOffsetBasis;
+};
+
+}  // namespace
+
+namespace NetworkCompilationContext {
+
+std::string computeHash(const CNNNetwork& network, const std::string& deviceName,
+                        const std::map<std::string, std::string>& config) {
+    HashingStreamBuf buf;
+    std::ostream stream(&buf);
+
+    // hash the topology and constant data exactly as they would be serialized to IR
+    const ICNNNetwork& icnnnet = static_cast<const ICNNNetwork&>(network);
+    pugi::xml_document doc;
+    Serialization::FillXmlDoc(icnnnet, doc);
+    doc.save(stream);
+    Serialization::SerializeBlobs(stream, icnnnet);
+
+    // the compiled blob also depends on the target device, the plugin configuration
+    // and the version of the engine which produced it
+    stream << deviceName;
+    for (const auto& kvp : config) {
+        stream << kvp.first << kvp.second;
+    }
+    const Version* version = GetInferenceEngineVersion();
+    if (version != nullptr) {
+        stream << version->buildNumber;
+    }
+    stream.flush();
+
+    std::stringstream hexHash;
+    hexHash << std::hex << buf.value();
+    return hexHash.str();
+}
+
+}  // namespace NetworkCompilationContext
+
+}  // namespace InferenceEngine
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "cpp/ie_cnn_network.h"
+
+namespace InferenceEngine {
+
+namespace NetworkCompilationContext {
+
+/**
+ * @brief Computes a stable hash for a (network, compilation config) pair.
+ *        The hash covers the serialized IR representation of the network,
+ *        its constant data, the target device name and the plugin configuration,
+ *        so it can be used as a file name of a compiled blob cached on disk.
+ * @param network    Network to be compiled
+ * @param deviceName Target device name
+ * @param config     Plugin compilation configuration
+ * @return Hex string with the computed hash value
+ */
+std::string computeHash(const CNNNetwork& network, const std::string& deviceName,
+                        const std::map<std::string, std::string>& config);
+
+}  // namespace NetworkCompilationContext
+
+}  // namespace InferenceEngine
@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_sse42/precision_conversions_sse42.hpp"
+
+#include <nmmintrin.h>  // SSE 4.2
+
+namespace InferenceEngine {
+
+void convert_u8_f32_sse42(const uint8_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i u8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i i32_0 = _mm_cvtepu8_epi32(u8);
+        __m128i i32_1 = _mm_cvtepu8_epi32(_mm_srli_si128(u8, 4));
+        __m128i i32_2 = _mm_cvtepu8_epi32(_mm_srli_si128(u8, 8));
+        __m128i i32_3 = _mm_cvtepu8_epi32(_mm_srli_si128(u8, 12));
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(i32_0));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(i32_1));
+        _mm_storeu_ps(dst + i + 8, _mm_cvtepi32_ps(i32_2));
+        _mm_storeu_ps(dst + i + 12, _mm_cvtepi32_ps(i32_3));
+    }
+    for (; i < count; i++)
+        dst[i] = static_cast<float>(src[i]);
+}
+
+void convert_f32_u8_sse42(const float* src, uint8_t* dst, size_t count) {
+    // The value is clamped into [0, 255] before the cast, so out-of-range input saturates
+    // instead of hitting undefined conversion behavior; in-range values truncate as usual.
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 max_u8 = _mm_set1_ps(255.0f);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128 f0 = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(src + i), max_u8), zero);
+        __m128 f1 = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(src + i + 4), max_u8), zero);
+        __m128 f2 = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(src + i + 8), max_u8), zero);
+        __m128 f3 = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(src + i + 12), max_u8), zero);
+        __m128i i16_0 = _mm_packs_epi32(_mm_cvttps_epi32(f0), _mm_cvttps_epi32(f1));
+        __m128i i16_1 = _mm_packs_epi32(_mm_cvttps_epi32(f2), _mm_cvttps_epi32(f3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(i16_0, i16_1));
+    }
+    for (; i < count; i++) {
+        float clamped = src[i] < 255.0f ? src[i] : 255.0f;
+        clamped = clamped > 0.0f ? clamped : 0.0f;
+        dst[i] = static_cast<uint8_t>(clamped);
+    }
+}
+
+void convert_bf16_f32_sse42(const int16_t* src, float* dst, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, v16)));
+        _mm_storeu_ps(dst + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, v16)));
+    }
+    for (; i < count; i++) {
+        union {
+            float f;
+            uint32_t u;
+        } v;
+        v.u = static_cast<uint32_t>(static_cast<uint16_t>(src[i])) << 16;
+        dst[i] = v.f;
+    }
+}
+
+void convert_f32_bf16_sse42(const float* src, int16_t* dst, size_t count) {
+    // Round to nearest even: add 0x7FFF plus the LSB of the result before truncation.
+    // NaN payloads are kept by a plain truncation with the quiet bit forced.
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i rounding = _mm_set1_epi32(0x7FFF);
+    const __m128i quiet = _mm_set1_epi32(0x0040);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128 f0 = _mm_loadu_ps(src + i);
+        __m128 f1 = _mm_loadu_ps(src + i + 4);
+        __m128i u0 = _mm_castps_si128(f0);
+        __m128i u1 = _mm_castps_si128(f1);
+        __m128i r0 = _mm_srli_epi32(_mm_add_epi32(u0, _mm_add_epi32(rounding, _mm_and_si128(_mm_srli_epi32(u0, 16), one))), 16);
+        __m128i r1 = _mm_srli_epi32(_mm_add_epi32(u1, _mm_add_epi32(rounding, _mm_and_si128(_mm_srli_epi32(u1, 16), one))), 16);
+        __m128i n0 = _mm_or_si128(_mm_srli_epi32(u0, 16), quiet);
+        __m128i n1 = _mm_or_si128(_mm_srli_epi32(u1, 16), quiet);
+        __m128i m0 = _mm_castps_si128(_mm_cmpunord_ps(f0, f0));
+        __m128i m1 = _mm_castps_si128(_mm_cmpunord_ps(f1, f1));
+        r0 = _mm_blendv_epi8(r0, n0, m0);
+        r1 = _mm_blendv_epi8(r1, n1, m1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(r0, r1));
+    }
+    for (; i < count; i++) {
+        union {
+            float f;
+            uint32_t u;
+        } v;
+        v.f = src[i];
+        if (src[i] != src[i]) {
+            dst[i] = static_cast<int16_t>((v.u >> 16) | 0x0040u);
+        } else {
+            dst[i] = static_cast<int16_t>((v.u + 0x7FFFu + ((v.u >> 16) & 1u)) >> 16);
+        }
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Precision-conversion primitives manually vectored for SSE 4.2
+// (w/o OpenMP threads)
+//
+//------------------------------------------------------------------------
+
+void convert_u8_f32_sse42(const uint8_t* src, float* dst, size_t count);
+
+void convert_f32_u8_sse42(const float* src, uint8_t* dst, size_t count);
+
+void convert_bf16_f32_sse42(const int16_t* src, float* dst, size_t count);
+
+void convert_f32_bf16_sse42(const float* src, int16_t* dst, size_t count);
+
+}  // namespace InferenceEngine
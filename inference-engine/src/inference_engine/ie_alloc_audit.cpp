@@ -0,0 +1,203 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_alloc_audit.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+
+namespace InferenceEngine {
+
+namespace {
+
+// Per-thread audit state. The counters are bumped by the replaced operator new below,
+// the scope stack turns the raw counts into per-label deltas. Everything is trivially
+// constructible, so the counting path is safe even before static initialization ran.
+constexpr std::size_t MAX_AUDIT_DEPTH = 32;
+
+struct AuditFrame {
+    const char* label;
+    std::uint64_t allocsAtEntry;
+    std::uint64_t bytesAtEntry;
+};
+
+thread_local std::uint64_t tlsAllocs = 0;
+thread_local std::uint64_t tlsBytes = 0;
+thread_local std::size_t tlsDepth = 0;
+thread_local bool tlsRecording = false;
+thread_local AuditFrame tlsFrames[MAX_AUDIT_DEPTH];
+
+bool readAuditEnv() {
+    const char* env = std::getenv("IE_ALLOC_AUDIT");
+    return env != nullptr && env[0] != '\0' && env[0] != '0';
+}
+
+bool auditEnabled() {
+    static const bool enabled = readAuditEnv();
+    return enabled;
+}
+
+struct LabelStat {
+    std::uint64_t scopes = 0;  // scopes of this label that allocated at all
+    std::uint64_t allocs = 0;
+    std::uint64_t bytes = 0;
+};
+
+// Aggregated violations, printed once at process exit. The map is touched only on the
+// cold path - a scope that did allocate while the audit is on - so the mutex is not a
+// steady-state concern.
+struct AuditReport {
+    std::mutex mutex;
+    std::map<std::string, LabelStat> stats;
+
+    ~AuditReport() {
+        if (stats.empty())
+            return;
+        std::fprintf(stderr, "[IE_ALLOC_AUDIT] heap allocations observed inside audited scopes:\n");
+        std::fprintf(stderr, "[IE_ALLOC_AUDIT] %12s %12s %14s  scope\n", "scopes", "allocs", "bytes");
+        for (const auto& kvp : stats) {
+            std::fprintf(stderr, "[IE_ALLOC_AUDIT] %12llu %12llu %14llu  %s\n",
+                         static_cast<unsigned long long>(kvp.second.scopes),
+                         static_cast<unsigned long long>(kvp.second.allocs),
+                         static_cast<unsigned long long>(kvp.second.bytes),
+                         kvp.first.c_str());
+        }
+    }
+};
+
+AuditReport& auditReport() {
+    static AuditReport report;
+    return report;
+}
+
+void recordDelta(const char* label, std::uint64_t allocs, std::uint64_t bytes) {
+    // the report map allocates; keep its traffic out of the open outer scopes
+    tlsRecording = true;
+    {
+        auto& report = auditReport();
+        std::lock_guard<std::mutex> lock(report.mutex);
+        auto& stat = report.stats[label];
+        stat.scopes += 1;
+        stat.allocs += allocs;
+        stat.bytes += bytes;
+    }
+    tlsRecording = false;
+}
+
+}  // namespace
+
+bool AllocAuditEnabled() noexcept {
+    return auditEnabled();
+}
+
+void AllocAuditBegin(const char* label) noexcept {
+    if (!auditEnabled())
+        return;
+    if (tlsDepth < MAX_AUDIT_DEPTH) {
+        tlsFrames[tlsDepth] = AuditFrame{label, tlsAllocs, tlsBytes};
+    }
+    ++tlsDepth;
+}
+
+void AllocAuditEnd() noexcept {
+    if (!auditEnabled() || tlsDepth == 0)
+        return;
+    --tlsDepth;
+    if (tlsDepth >= MAX_AUDIT_DEPTH)
+        return;
+    const auto& frame = tlsFrames[tlsDepth];
+    const std::uint64_t allocs = tlsAllocs - frame.allocsAtEntry;
+    if (allocs != 0)
+        recordDelta(frame.label, allocs, tlsBytes - frame.bytesAtEntry);
+}
+
+}  // namespace InferenceEngine
+
+#ifndef _WIN32
+
+// Replacement of the global allocation functions, so any allocation made while an audit
+// scope is open on the thread is counted, no matter which module makes it. The core
+// library is an ordinary link-time dependency of the application, hence - unlike the
+// dlopened plugins - its definitions interpose the default ones for the whole process.
+// Outside of audit scopes the only extra cost is one thread local comparison.
+
+namespace {
+
+inline void countAllocation(std::size_t size) {
+    using namespace InferenceEngine;
+    if (tlsDepth != 0 && !tlsRecording) {
+        ++tlsAllocs;
+        tlsBytes += size;
+    }
+}
+
+inline void* auditedAlloc(std::size_t size) {
+    countAllocation(size);
+    // malloc(0) may return nullptr which operator new must not
+    void* ptr = std::malloc(size != 0 ? size : 1);
+    while (ptr == nullptr) {
+        std::new_handler handler = std::set_new_handler(nullptr);
+        std::set_new_handler(handler);
+        if (handler == nullptr)
+            return nullptr;
+        handler();
+        ptr = std::malloc(size != 0 ? size : 1);
+    }
+    return ptr;
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    void* ptr = auditedAlloc(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    void* ptr = auditedAlloc(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return auditedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return auditedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif  // !_WIN32
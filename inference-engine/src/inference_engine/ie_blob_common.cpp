@@ -59,4 +59,14 @@ Blob::Ptr make_shared_blob(const Blob::Ptr& inputBlob, const ROI& roi) {
     return make_blob_with_precision(tDesc, inputBlob->buffer());
 }
 
+Blob::Ptr make_shared_blob(const Blob::Ptr& inputBlob, const std::vector<ROI>& rois) {
+    std::vector<Blob::Ptr> blobs;
+    blobs.reserve(rois.size());
+    for (const auto& roi : rois) {
+        blobs.push_back(make_shared_blob(inputBlob, roi));
+    }
+    // all items are views into the backing blob, no image data is copied here
+    return make_shared_blob<BatchedBlob>(std::move(blobs));
+}
+
 }  // namespace InferenceEngine
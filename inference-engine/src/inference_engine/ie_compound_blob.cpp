@@ -189,6 +189,43 @@ void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr
                            << yDims[3] << "(Y plane) and " << vDims[3] << "(V plane)";
     }
 }
+void verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    // batch must contain at least one blob
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "Batched blob must contain at least one blob";
+    }
+
+    // all blobs must be valid MemoryBlob objects
+    if (std::any_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+            return blob == nullptr || !blob->is<MemoryBlob>();
+        })) {
+        THROW_IE_EXCEPTION << "Batch items must be valid MemoryBlob objects";
+    }
+
+    // check tensor descriptor parameters: all blobs must agree in precision, layout and number
+    // of dimensions, and each must describe a single image. Spatial sizes may differ: ROI crops
+    // of different sizes are resized individually during pre-processing.
+    const auto& refDesc = blobs[0]->getTensorDesc();
+    for (const auto& blob : blobs) {
+        const auto& desc = blob->getTensorDesc();
+        if (desc.getPrecision() != refDesc.getPrecision()) {
+            THROW_IE_EXCEPTION << "Batch items must have the same precision, actual: "
+                               << refDesc.getPrecision() << " and " << desc.getPrecision();
+        }
+        if (desc.getLayout() != refDesc.getLayout()) {
+            THROW_IE_EXCEPTION << "Batch items must have the same layout, actual: " << refDesc.getLayout()
+                               << " and " << desc.getLayout();
+        }
+        if (desc.getDims().size() != refDesc.getDims().size()) {
+            THROW_IE_EXCEPTION << "Batch items must have the same number of dimensions, actual: "
+                               << refDesc.getDims().size() << " and " << desc.getDims().size();
+        }
+        if (!desc.getDims().empty() && desc.getDims()[0] != 1) {
+            THROW_IE_EXCEPTION << "Each batch item must describe a single image, actual batch size: "
+                               << desc.getDims()[0];
+        }
+    }
+}
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(): Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -371,4 +408,20 @@ const Blob::Ptr& I420Blob::v() const noexcept {
     return _blobs[2];
 }
 
+BatchedBlob::BatchedBlob(const std::vector<Blob::Ptr>& blobs) {
+    // verify data is correct
+    verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = blobs;
+    tensorDesc = TensorDesc(blobs[0]->getTensorDesc().getPrecision(), {}, blobs[0]->getTensorDesc().getLayout());
+}
+
+BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs) {
+    // verify data is correct
+    verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = std::move(blobs);
+    tensorDesc = TensorDesc(_blobs[0]->getTensorDesc().getPrecision(), {}, _blobs[0]->getTensorDesc().getLayout());
+}
+
 }  // namespace InferenceEngine
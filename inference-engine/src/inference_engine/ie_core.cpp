@@ -13,15 +13,19 @@
 #include <utility>
 #include <vector>
 #include <istream>
+#include <fstream>
 #include <mutex>
+#include <future>
 
 #include <ngraph/opsets/opset.hpp>
+#include "compilation_context.hpp"
 #include "cpp/ie_cnn_net_reader.h"
 #include "cpp/ie_plugin_cpp.hpp"
 #include "cpp_interfaces/base/ie_plugin_base.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include "details/ie_so_pointer.hpp"
 #include "ie_icore.hpp"
+#include "ie_memory_accounting.hpp"
 #include "ie_plugin.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_profiling.hpp"
@@ -192,6 +196,32 @@ std::vector<std::string> DeviceIDParser::getMultiDevices(std::string devicesList
     return deviceNames;
 }
 
+namespace {
+
+/**
+ * @brief Compiled-in mirror of the build-time generated plugins.xml
+ *
+ * Used when Core is constructed without an explicit configuration file, so default
+ * construction needs neither an XML parse nor any file system access (containers
+ * with a read-only file system often ship without the file at all). An explicitly
+ * passed configuration file still takes the XML path and fully replaces this table.
+ */
+struct CompiledPluginDescriptor {
+    const char* deviceName;
+    const char* pluginName;  //!< base library name, without platform decorations and build postfix
+};
+
+constexpr CompiledPluginDescriptor compiledPluginRegistry[] = {
+    {"CPU", "MKLDNNPlugin"},
+    {"GNA", "GNAPlugin"},
+    {"GPU", "clDNNPlugin"},
+    {"HETERO", "HeteroPlugin"},
+    {"MULTI", "MultiDevicePlugin"},
+    {"MYRIAD", "myriadPlugin"},
+};
+
+}  // namespace
+
 class Core::Impl : public ICore {
     // Fields are ordered by deletion order
     ITaskExecutor::Ptr _taskExecutor = nullptr;
@@ -211,6 +241,10 @@ class Core::Impl : public ICore {
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
+    // serializes the creation of each plugin separately, so loading one plugin
+    // library does not block lookups or creation of the others; guarded by
+    // pluginsMutex (std::map keeps the mutexes pinned in memory)
+    mutable std::map<std::string, std::mutex> pluginCreationMutexes;
 
 public:
     Impl();
@@ -282,6 +316,25 @@ public:
         }
     }
 
+    /**
+     * @brief Registers the compiled-in default plugin set, @see compiledPluginRegistry
+     *
+     * Unlike RegisterPluginsInRegistry there is no XML to parse and no file existence
+     * probing: the library paths are composed from the inference engine library
+     * location, and a missing plugin library surfaces on its lazy creation the same
+     * way a stale plugins.xml entry would.
+     */
+    void RegisterCompiledPlugins() {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+
+        for (const auto& plugin : compiledPluginRegistry) {
+            const FileUtils::FilePath libraryName =
+                FileUtils::toFilePath(std::string(plugin.pluginName) + std::string(IE_BUILD_POSTFIX));
+            PluginDescriptor desc = {FileUtils::makeSharedLibraryName(getInferenceEngineLibraryPath(), libraryName), {}, {}};
+            pluginRegistry[plugin.deviceName] = desc;
+        }
+    }
+
     //
     // ICore public API
     //
@@ -296,20 +349,63 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         IE_PROFILING_AUTO_SCOPE(Core::ReadNetwork)
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Read);
         return details::ReadNetwork(modelPath, binPath, extensions);
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
         IE_PROFILING_AUTO_SCOPE(Core::ReadNetwork)
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Read);
         return details::ReadNetwork(model, weights, extensions);
     }
 
     ExecutableNetwork LoadNetwork(const CNNNetwork& network, const std::string& deviceName,
                                   const std::map<std::string, std::string>& config) override {
         IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork)
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Compile);
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+
+        // the cache directory is consumed by the Core itself, plugins must not see the key
+        std::string cacheDir;
+        auto cacheDirIt = parsed._config.find(KEY_CACHE_DIR);
+        if (cacheDirIt != parsed._config.end()) {
+            cacheDir = cacheDirIt->second;
+            parsed._config.erase(cacheDirIt);
+        }
+
         IE_SUPPRESS_DEPRECATED_START
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto cppPlugin = GetCPPPluginByName(parsed._deviceName);
+
+        if (!cacheDir.empty()) {
+            auto pluginAPIInterface = getInferencePluginAPIInterface(cppPlugin);
+            // devices without the import / export capability are compiled as usual
+            if (pluginAPIInterface != nullptr) {
+                const std::string hash = NetworkCompilationContext::computeHash(network, parsed._deviceName, parsed._config);
+                const std::string blobFileName = FileUtils::makePath(cacheDir, hash + ".blob");
+
+                if (FileUtils::fileExist(blobFileName)) {
+                    try {
+                        std::ifstream blobFile(blobFileName, std::ios::binary);
+                        return pluginAPIInterface->ImportNetwork(blobFile, parsed._config);
+                    } catch (const details::InferenceEngineException&) {
+                        // a stale or corrupted blob is not fatal: recompile and overwrite it below
+                    }
+                }
+
+                auto executableNetwork = cppPlugin.LoadNetwork(network, parsed._config);
+                try {
+                    std::ofstream blobFile(blobFileName, std::ios::binary);
+                    if (blobFile) {
+                        executableNetwork.Export(blobFile);
+                    }
+                } catch (const details::InferenceEngineException&) {
+                    // the plugin does not support Export via stream, next load compiles again
+                }
+                return executableNetwork;
+            }
+        }
+
+        return cppPlugin.LoadNetwork(network, parsed._config);
         IE_SUPPRESS_DEPRECATED_END
     }
 
@@ -317,6 +413,7 @@ public:
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
                                     const std::map<std::string, std::string>& config) override {
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Compile);
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
 
         if (parsed._deviceName.empty()) {
@@ -350,6 +447,11 @@ public:
     }
 
     Parameter GetMetric(const std::string& deviceName, const std::string& name) const override {
+        // the allocation accounting is process-wide and served by the Core itself
+        if (name == METRIC_KEY(MEMORY_ACCOUNTING)) {
+            return MemoryAccounting::get().report();
+        }
+
         // HETERO case
         {
             if (deviceName.find("HETERO:") == 0) {
@@ -391,20 +493,42 @@ public:
      * @return Reference to a CPP plugin wrapper
      */
     InferencePlugin GetCPPPluginByName(const std::string& deviceName) const {
-        std::lock_guard<std::mutex> lock(pluginsMutex);
-
         IE_SUPPRESS_DEPRECATED_START
 
-        auto it = pluginRegistry.find(deviceName);
-        if (it == pluginRegistry.end()) {
-            THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
-        }
+        PluginDescriptor desc;
+        std::vector<IExtensionPtr> registeredExtensions;
+        std::mutex* creationMutex = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
 
-        // Plugin is in registry, but not created, let's create
+            auto it = pluginRegistry.find(deviceName);
+            if (it == pluginRegistry.end()) {
+                THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
 
-        if (plugins.find(deviceName) == plugins.end()) {
-            PluginDescriptor desc = it->second;
+            auto created = plugins.find(deviceName);
+            if (created != plugins.end()) {
+                return created->second;
+            }
 
+            desc = it->second;
+            registeredExtensions = extensions;
+            creationMutex = &pluginCreationMutexes[deviceName];
+        }
+
+        // Plugin is in registry, but not created, let's create. Loading the
+        // library and configuring the plugin happen outside of pluginsMutex so
+        // that concurrent work with other devices is not blocked meanwhile.
+        std::lock_guard<std::mutex> creationLock(*creationMutex);
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto created = plugins.find(deviceName);
+            if (created != plugins.end()) {
+                return created->second;
+            }
+        }
+
+        {
             try {
                 InferenceEnginePluginPtr plugin(desc.libraryLocation);
                 IInferencePlugin* pplugin = static_cast<IInferencePlugin*>(plugin.operator->());
@@ -419,7 +543,7 @@ public:
                 }
 
                 // Add registered extensions to new plugin
-                for (const auto& ext : extensions) {
+                for (const auto& ext : registeredExtensions) {
                     plugin->AddExtension(ext, nullptr);
                 }
 
@@ -436,6 +560,7 @@ public:
                     }
                 }
 
+                std::lock_guard<std::mutex> lock(pluginsMutex);
                 plugins[deviceName] = cppPlugin;
             } catch (const details::InferenceEngineException& ex) {
                 THROW_IE_EXCEPTION << "Failed to create plugin " << FileUtils::fromFilePath(desc.libraryLocation) << " for device " << deviceName
@@ -447,6 +572,7 @@ public:
 
         IE_SUPPRESS_DEPRECATED_END
 
+        std::lock_guard<std::mutex> lock(pluginsMutex);
         return plugins[deviceName];
     }
 
@@ -588,14 +714,34 @@ Core::Impl::~Impl() {}
 Core::Core(const std::string& xmlConfigFile) {
     _impl = std::make_shared<Impl>();
 
-    std::string xmlConfigFile_ = xmlConfigFile;
-    if (xmlConfigFile_.empty()) {
-        // register plugins from default plugins.xml config
-        FileUtils::FilePath xmlConfigFileDefault = FileUtils::makePath(getInferenceEngineLibraryPath(), FileUtils::toFilePath("plugins.xml"));
-        xmlConfigFile_ = FileUtils::fromFilePath(xmlConfigFileDefault);
+    if (xmlConfigFile.empty()) {
+        // no override given: take the compiled-in default registry, keeping the XML
+        // parse and the file system probing off the construction path
+        _impl->RegisterCompiledPlugins();
+    } else {
+        RegisterPlugins(xmlConfigFile);
     }
+}
 
-    RegisterPlugins(xmlConfigFile_);
+void Core::Preload(const std::vector<std::string>& deviceNames) {
+    IE_PROFILING_AUTO_SCOPE(Core::Preload)
+
+    // readers and device plugins live in separate shared libraries, so their loading can overlap
+    std::vector<std::future<void>> loaders;
+    loaders.push_back(std::async(std::launch::async, [] {
+        details::preloadNetworkReaders();
+    }));
+    for (auto&& deviceName : deviceNames) {
+        loaders.push_back(std::async(std::launch::async, [this, deviceName] {
+            auto parsed = parseDeviceNameIntoConfig(deviceName);
+            _impl->GetCPPPluginByName(parsed._deviceName);
+        }));
+    }
+
+    // surface the first loading failure to the caller
+    for (auto&& loader : loaders) {
+        loader.get();
+    }
 }
 
 std::map<std::string, Version> Core::GetVersions(const std::string& deviceName) const {
@@ -648,6 +794,16 @@ CNNNetwork Core::ReadNetwork(const std::string& model, const Blob::CPtr& weights
     return _impl->ReadNetwork(model, weights);
 }
 
+std::future<CNNNetwork> Core::ReadNetworkAsync(const std::string& modelPath, const std::string& binPath) const {
+    auto impl = _impl;
+    return std::async(std::launch::async, [impl, modelPath, binPath] {
+        // hint the kernel before parsing starts so the weights of this model stream
+        // from disk while the caller still compiles the previous one
+        details::startNetworkFilesReadahead(modelPath, binPath);
+        return impl->ReadNetwork(modelPath, binPath);
+    });
+}
+
 ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, const std::string& deviceName,
                                     const std::map<std::string, std::string>& config) {
     return _impl->LoadNetwork(network, deviceName, config);
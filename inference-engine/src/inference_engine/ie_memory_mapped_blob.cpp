@@ -0,0 +1,117 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_memory_mapped_blob.hpp"
+#include "ie_weight_residency.hpp"
+
+#include <memory>
+#include <string>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief U8 blob over a read-only file mapping; unmaps the file on destruction
+ */
+class MemoryMappedBlob : public TBlob<uint8_t> {
+public:
+#ifdef _WIN32
+    MemoryMappedBlob(const std::string& fileName, uint8_t* data, size_t size, HANDLE fileHandle, HANDLE mappingHandle)
+        : TBlob<uint8_t>(TensorDesc(Precision::U8, {size}, Layout::C), data),
+          _data(data), _size(size), _fileHandle(fileHandle), _mappingHandle(mappingHandle) {
+        WeightResidencyManager::getInstance()->registerMapping(fileName, data, size);
+    }
+
+    ~MemoryMappedBlob() override {
+        WeightResidencyManager::getInstance()->unregisterMapping(_data);
+        UnmapViewOfFile(_data);
+        CloseHandle(_mappingHandle);
+        CloseHandle(_fileHandle);
+    }
+#else
+    MemoryMappedBlob(const std::string& fileName, uint8_t* data, size_t size)
+        : TBlob<uint8_t>(TensorDesc(Precision::U8, {size}, Layout::C), data),
+          _data(data), _size(size) {
+        WeightResidencyManager::getInstance()->registerMapping(fileName, data, size);
+    }
+
+    ~MemoryMappedBlob() override {
+        WeightResidencyManager::getInstance()->unregisterMapping(_data);
+        munmap(_data, _size);
+    }
+#endif
+
+private:
+    uint8_t* _data;
+    size_t _size;
+#ifdef _WIN32
+    HANDLE _fileHandle;
+    HANDLE _mappingHandle;
+#endif
+};
+
+}  // namespace
+
+Blob::Ptr makeMemoryMappedBlob(const std::string& fileName) {
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) return nullptr;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    HANDLE mappingHandle = CreateFileMapping(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr) {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr) {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    return std::make_shared<MemoryMappedBlob>(fileName, static_cast<uint8_t*>(data),
+                                              static_cast<size_t>(fileSize.QuadPart), fileHandle, mappingHandle);
+#else
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd == -1) return nullptr;
+
+    struct stat sb = {};
+    if (fstat(fd, &sb) == -1 || sb.st_size == 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping keeps the file referenced, the descriptor is not needed anymore
+    close(fd);
+    if (data == MAP_FAILED) return nullptr;
+
+    return std::make_shared<MemoryMappedBlob>(fileName, static_cast<uint8_t*>(data), static_cast<size_t>(sb.st_size));
+#endif
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,28 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Creates a read-only U8 blob over a memory-mapped file
+ *
+ * The file content is not copied to the heap: pages are mapped lazily by the OS
+ * on first access and are shared between processes which map the same file.
+ * The mapping is released when the last reference to the blob is dropped.
+ *
+ * @param fileName Path to the file with weights
+ * @return A blob over the mapped file, or nullptr if the file cannot be mapped
+ *         (the caller is expected to fall back to regular stream reading)
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) makeMemoryMappedBlob(const std::string& fileName);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,171 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_model_bundle.hpp"
+
+#include "ie_memory_mapped_blob.hpp"
+
+#include <details/ie_exception.hpp>
+#include <file_utils.h>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+const char BUNDLE_MAGIC[4] = {'I', 'E', 'M', 'B'};
+const uint32_t BUNDLE_VERSION = 1;
+const uint64_t BUNDLE_ALIGNMENT = 64;
+
+/**
+ * @brief U8 blob over one member of the mapped bundle; keeps the mapping alive
+ */
+class BundleMemberBlob : public TBlob<uint8_t> {
+public:
+    BundleMemberBlob(uint8_t* data, size_t size, const Blob::Ptr& mapping)
+        : TBlob<uint8_t>(TensorDesc(Precision::U8, {size}, Layout::C), data), _mapping(mapping) {}
+
+private:
+    Blob::Ptr _mapping;
+};
+
+bool isBundleFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(BUNDLE_MAGIC)] = {};
+    file.read(magic, sizeof(magic));
+    return file.good() && 0 == std::memcmp(magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC));
+}
+
+}  // namespace
+
+bool ModelBundle::splitBundlePath(const std::string& path, std::string& bundlePath, std::string& memberName) {
+    auto sep = path.find('#');
+    if (sep == std::string::npos || sep == 0 || sep + 1 == path.size())
+        return false;
+    auto bundle = path.substr(0, sep);
+    if (!FileUtils::fileExist(bundle) || !isBundleFile(bundle))
+        return false;
+    bundlePath = bundle;
+    memberName = path.substr(sep + 1);
+    return true;
+}
+
+ModelBundle::ModelBundle(const std::string& path) {
+    _mapping = makeMemoryMappedBlob(path);
+    if (_mapping == nullptr)
+        THROW_IE_EXCEPTION << "Model bundle " << path << " cannot be opened!";
+
+    const uint8_t* data = _mapping->cbuffer().as<const uint8_t*>();
+    const size_t size = _mapping->byteSize();
+    size_t pos = 0;
+
+    auto read = [&](void* dst, size_t count) {
+        if (pos + count > size)
+            THROW_IE_EXCEPTION << "Model bundle " << path << " is corrupted: truncated index";
+        std::memcpy(dst, data + pos, count);
+        pos += count;
+    };
+
+    char magic[sizeof(BUNDLE_MAGIC)] = {};
+    read(magic, sizeof(magic));
+    if (0 != std::memcmp(magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)))
+        THROW_IE_EXCEPTION << "Model bundle " << path << " is corrupted: wrong magic";
+    uint32_t version = 0;
+    read(&version, sizeof(version));
+    if (version != BUNDLE_VERSION)
+        THROW_IE_EXCEPTION << "Model bundle " << path << " has unsupported version " << version;
+
+    uint64_t count = 0;
+    read(&count, sizeof(count));
+    for (uint64_t i = 0; i < count; i++) {
+        uint32_t nameSize = 0;
+        read(&nameSize, sizeof(nameSize));
+        if (pos + nameSize > size)
+            THROW_IE_EXCEPTION << "Model bundle " << path << " is corrupted: truncated index";
+        std::string name(reinterpret_cast<const char*>(data + pos), nameSize);
+        pos += nameSize;
+        uint64_t offset = 0, memberSize = 0;
+        read(&offset, sizeof(offset));
+        read(&memberSize, sizeof(memberSize));
+        if (offset > size || memberSize > size - offset)
+            THROW_IE_EXCEPTION << "Model bundle " << path << " is corrupted: member " << name
+                               << " is out of the file bounds";
+        _index.emplace_back(name, std::make_pair(offset, memberSize));
+    }
+}
+
+Blob::Ptr ModelBundle::getMember(const std::string& name) const {
+    for (auto&& member : _index) {
+        if (member.first == name) {
+            uint8_t* data = _mapping->cbuffer().as<uint8_t*>() + member.second.first;
+            return std::make_shared<BundleMemberBlob>(data, static_cast<size_t>(member.second.second), _mapping);
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::string> ModelBundle::memberNames() const {
+    std::vector<std::string> names;
+    for (auto&& member : _index) {
+        names.push_back(member.first);
+    }
+    return names;
+}
+
+void ModelBundle::write(const std::string& path, const std::vector<std::pair<std::string, std::string>>& members) {
+    uint64_t headerSize = sizeof(BUNDLE_MAGIC) + sizeof(uint32_t) + sizeof(uint64_t);
+    for (auto&& member : members) {
+        headerSize += sizeof(uint32_t) + member.first.size() + 2 * sizeof(uint64_t);
+    }
+
+    std::ofstream bundle(path, std::ios::binary);
+    if (!bundle.is_open())
+        THROW_IE_EXCEPTION << "Model bundle " << path << " cannot be created!";
+
+    auto alignUp = [](uint64_t value) {
+        return (value + BUNDLE_ALIGNMENT - 1) / BUNDLE_ALIGNMENT * BUNDLE_ALIGNMENT;
+    };
+
+    bundle.write(BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC));
+    bundle.write(reinterpret_cast<const char*>(&BUNDLE_VERSION), sizeof(BUNDLE_VERSION));
+    uint64_t count = members.size();
+    bundle.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+    uint64_t offset = alignUp(headerSize);
+    for (auto&& member : members) {
+        long long sourceSize = FileUtils::fileSize(member.second.c_str());
+        if (sourceSize < 0)
+            THROW_IE_EXCEPTION << "Model bundle member file " << member.second << " cannot be opened!";
+        uint64_t memberSize = static_cast<uint64_t>(sourceSize);
+        uint32_t nameSize = static_cast<uint32_t>(member.first.size());
+        bundle.write(reinterpret_cast<const char*>(&nameSize), sizeof(nameSize));
+        bundle.write(member.first.data(), nameSize);
+        bundle.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        bundle.write(reinterpret_cast<const char*>(&memberSize), sizeof(memberSize));
+        offset = alignUp(offset + memberSize);
+    }
+
+    for (auto&& member : members) {
+        std::ifstream source(member.second, std::ios::binary);
+        if (!source.is_open())
+            THROW_IE_EXCEPTION << "Model bundle member file " << member.second << " cannot be opened!";
+        while (bundle.tellp() % BUNDLE_ALIGNMENT != 0)
+            bundle.put('\0');
+        if (source.peek() != std::ifstream::traits_type::eof())
+            bundle << source.rdbuf();
+    }
+
+    if (!bundle.good())
+        THROW_IE_EXCEPTION << "Failed to write model bundle " << path;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
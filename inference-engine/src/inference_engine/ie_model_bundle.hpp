@@ -0,0 +1,70 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Single-file archive of model files with an index and lazy member access
+ *
+ * Shipping many IR pairs as separate files costs one open per file at startup, which
+ * is expensive on network filesystems. A bundle keeps them in one file which is opened
+ * and memory-mapped once; members are exposed as blobs over the mapping, so their pages
+ * are only read when a member is actually parsed.
+ *
+ * File layout (all integers little-endian):
+ *   "IEMB" magic (4 bytes) | version u32 = 1 | member count u64 |
+ *   per member: name size u32 | name bytes | offset u64 | size u64 |
+ *   member bytes (offsets are from the file start, members are 64-byte aligned)
+ *
+ * Core::ReadNetwork accepts "<bundle path>#<member name>" to read one member.
+ */
+class INFERENCE_ENGINE_API_CLASS(ModelBundle) {
+public:
+    /**
+     * @brief Splits a "<bundle path>#<member name>" path
+     * @return True when the path has this form and the bundle part is an existing
+     *         bundle file; a plain path (or a path with '#' pointing to a regular
+     *         file) is left to the usual file reading
+     */
+    static bool splitBundlePath(const std::string& path, std::string& bundlePath, std::string& memberName);
+
+    /**
+     * @brief Creates a bundle from existing files
+     * @param path Destination bundle file
+     * @param members Pairs of member name and source file path, stored in order
+     */
+    static void write(const std::string& path, const std::vector<std::pair<std::string, std::string>>& members);
+
+    /**
+     * @brief Maps the bundle file and parses its index; throws on a missing or malformed file
+     */
+    explicit ModelBundle(const std::string& path);
+
+    /**
+     * @brief Returns a read-only blob over the member content inside the mapping,
+     *        or nullptr if there is no such member. The blob keeps the mapping alive.
+     */
+    Blob::Ptr getMember(const std::string& name) const;
+
+    /**
+     * @brief Returns the member names in the index order
+     */
+    std::vector<std::string> memberNames() const;
+
+private:
+    Blob::Ptr _mapping;
+    std::vector<std::pair<std::string, std::pair<uint64_t, uint64_t>>> _index;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -8,12 +8,21 @@
 #include <file_utils.h>
 #include <ie_blob_stream.hpp>
 #include <ie_profiling.hpp>
+#include "ie_memory_mapped_blob.hpp"
+#include "ie_model_bundle.hpp"
 #include <ie_reader.hpp>
 
 #include <fstream>
+#include <future>
 #include <istream>
 #include <mutex>
 #include <map>
+#include <set>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace InferenceEngine {
 
@@ -89,6 +98,9 @@ public:
     std::string getName() const {
         return name;
     }
+    void preload() {
+        getReaderPtr();
+    }
 };
 
 namespace {
@@ -129,11 +141,111 @@ void registerReaders() {
 
 }  // namespace
 
+void details::preloadNetworkReaders() {
+    IE_PROFILING_AUTO_SCOPE(details::preloadNetworkReaders)
+    registerReaders();
+
+    // the same reader may be registered for several extensions; load every library once
+    std::set<Reader::Ptr> uniqueReaders;
+    for (auto it = readers.begin(); it != readers.end(); it++) {
+        uniqueReaders.insert(it->second);
+    }
+
+    std::vector<std::future<void>> loaders;
+    for (auto&& reader : uniqueReaders) {
+        loaders.push_back(std::async(std::launch::async, [reader] {
+            reader->preload();
+        }));
+    }
+    for (auto&& loader : loaders) {
+        loader.get();
+    }
+}
+
+void details::startNetworkFilesReadahead(const std::string& modelPath, const std::string& binPath) {
+#ifdef __linux__
+    auto advise = [](const std::string& path) {
+        if (path.empty() || !FileUtils::fileExist(path))
+            return;
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        // POSIX_FADV_WILLNEED starts an asynchronous readahead of the whole file
+        (void)posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        ::close(fd);
+    };
+
+    // for a "<bundle>#<member>" path the archive itself is what gets read
+    std::string bundlePath, memberName;
+    if (details::ModelBundle::splitBundlePath(modelPath, bundlePath, memberName)) {
+        advise(bundlePath);
+        return;
+    }
+
+    advise(modelPath);
+
+    std::string bPath = binPath;
+    if (bPath.empty()) {
+        // the exact data file extension is reader-specific and the readers are not
+        // loaded yet; the conventional .bin neighbour covers the IR formats
+        auto pos = modelPath.rfind('.');
+        if (pos != std::string::npos)
+            bPath = modelPath.substr(0, pos) + ".bin";
+    }
+    advise(bPath);
+#else
+    (void)modelPath;
+    (void)binPath;
+#endif
+}
+
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
     IE_PROFILING_AUTO_SCOPE(details::ReadNetwork)
     // Register readers if it is needed
     registerReaders();
 
+    // A "<bundle>#<member>" path reads one member of a model bundle: the archive is
+    // opened and mapped once, member pages are only read when the parser touches them
+    {
+        std::string bundlePath, memberName;
+        if (details::ModelBundle::splitBundlePath(modelPath, bundlePath, memberName)) {
+            details::ModelBundle bundle(bundlePath);
+            auto model = bundle.getMember(memberName);
+            if (model == nullptr)
+                THROW_IE_EXCEPTION << "Model bundle " << bundlePath << " has no member " << memberName;
+            details::BlobStream modelStream(model);
+
+            auto memberExt = memberName.substr(memberName.find_last_of(".") + 1);
+            for (auto it = readers.lower_bound(memberExt); it != readers.upper_bound(memberExt); it++) {
+                auto reader = it->second;
+                if (!reader->supportModel(modelStream))
+                    continue;
+                // for bundles binPath names the weights member inside the archive
+                Blob::Ptr weights;
+                if (!binPath.empty()) {
+                    weights = bundle.getMember(binPath);
+                    if (weights == nullptr)
+                        THROW_IE_EXCEPTION << "Model bundle " << bundlePath << " has no member " << binPath;
+                } else {
+                    auto memberWoExt = memberName;
+                    auto pos = memberName.rfind('.');
+                    if (pos != std::string::npos) memberWoExt = memberName.substr(0, pos);
+                    for (const auto& ext : reader->getDataFileExtensions()) {
+                        weights = bundle.getMember(memberWoExt + "." + ext);
+                        if (weights != nullptr) break;
+                    }
+                }
+                if (weights != nullptr) {
+                    details::BlobStream binStream(weights);
+                    return reader->read(modelStream, binStream, exts);
+                }
+                return reader->read(modelStream, exts);
+            }
+            THROW_IE_EXCEPTION << "Unknown model format! Cannot find reader for model bundle member: "
+                               << memberName;
+        }
+    }
+
     // Fix unicode name
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     std::wstring model_path = InferenceEngine::details::multiByteCharToWString(modelPath.c_str());
@@ -167,6 +279,14 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
+                // Map the weights file to avoid copying it to the heap:
+                // constant data is paged in lazily and shared between processes
+                Blob::Ptr mappedWeights = details::makeMemoryMappedBlob(bPath);
+                if (mappedWeights != nullptr) {
+                    details::BlobStream binStream(mappedWeights);
+                    return reader->read(modelStream, binStream, exts);
+                }
+
                 // Open weights file
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring weights_path = InferenceEngine::details::multiByteCharToWString(bPath.c_str());
@@ -29,5 +29,24 @@ CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath,
  */
 CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts);
 
+/**
+ * @brief Eagerly loads all available network reader libraries
+ *
+ * Reader libraries are normally loaded lazily inside the first ReadNetwork call;
+ * this entry point allows the Core to preload them during application start-up instead.
+ */
+void preloadNetworkReaders();
+
+/**
+ * @brief Hints the OS to start an asynchronous readahead of the model files
+ *
+ * The hint lets the disk read of one model overlap parsing and compilation of another
+ * when models are loaded in a pipeline. Best effort: unknown paths and platforms
+ * without posix_fadvise are silently ignored.
+ * @param modelPath path to IR file
+ * @param binPath path to bin file, if path is empty, a bin file with the same name as xml is hinted
+ */
+void startNetworkFilesReadahead(const std::string& modelPath, const std::string& binPath);
+
 }  // namespace details
 }  // namespace InferenceEngine
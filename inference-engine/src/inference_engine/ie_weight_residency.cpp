@@ -0,0 +1,178 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_weight_residency.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+std::mutex WeightResidencyManager::_mutex;
+WeightResidencyManager* WeightResidencyManager::_instance = nullptr;
+
+WeightResidencyManager* WeightResidencyManager::getInstance() {
+    // allocated on the heap and never destroyed: mapped blobs unregister themselves
+    // from their destructors, which may run after static destruction has started
+    // (same reasoning as the ExecutorManager singleton)
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (_instance == nullptr) {
+        _instance = new WeightResidencyManager();
+    }
+    return _instance;
+}
+
+void WeightResidencyManager::registerMapping(const std::string& name, const void* data, size_t size) {
+    if (data == nullptr || size == 0) return;
+    std::lock_guard<std::mutex> guard(_managerMutex);
+    Mapping mapping;
+    mapping.name = name;
+    mapping.data = data;
+    mapping.size = size;
+    mapping.lastUse = std::chrono::steady_clock::now();
+    // a re-mapped file inherits the priority its earlier mappings were given
+    for (const auto& it : _mappings) {
+        if (it.name == name) {
+            mapping.priority = it.priority;
+            break;
+        }
+    }
+    _mappings.push_back(std::move(mapping));
+}
+
+void WeightResidencyManager::unregisterMapping(const void* data) {
+    std::lock_guard<std::mutex> guard(_managerMutex);
+    _mappings.erase(std::remove_if(_mappings.begin(), _mappings.end(),
+                                   [&](const Mapping& mapping) {
+                                       return mapping.data == data;
+                                   }),
+                    _mappings.end());
+}
+
+void WeightResidencyManager::setPriority(const std::string& name, int priority) {
+    std::lock_guard<std::mutex> guard(_managerMutex);
+    for (auto& mapping : _mappings) {
+        if (mapping.name == name)
+            mapping.priority = priority;
+    }
+}
+
+void WeightResidencyManager::touch(const std::string& name) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> guard(_managerMutex);
+    for (auto& mapping : _mappings) {
+        if (mapping.name == name)
+            mapping.lastUse = now;
+    }
+}
+
+uint64_t WeightResidencyManager::residentBytes(const Mapping& mapping) const {
+#ifndef _WIN32
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t pages = (mapping.size + pageSize - 1) / pageSize;
+    std::vector<unsigned char> residency(pages);
+#ifdef __linux__
+    using MincoreVec = unsigned char*;
+#else
+    using MincoreVec = char*;
+#endif
+    if (mincore(const_cast<void*>(mapping.data), mapping.size,
+                reinterpret_cast<MincoreVec>(residency.data())) != 0)
+        return 0;
+    uint64_t resident = 0;
+    for (size_t page = 0; page < pages; page++) {
+        if (residency[page] & 1) {
+            resident += (page + 1 == pages) ? mapping.size - page * pageSize : pageSize;
+        }
+    }
+    return resident;
+#else
+    // no per-mapping residency accounting on this OS
+    return 0;
+#endif
+}
+
+bool WeightResidencyManager::evictMapping(const Mapping& mapping) const {
+#ifndef _WIN32
+    // the mappings are read-only and file-backed, so dropping the pages loses no
+    // data: the next access faults them back in from the weights file
+#ifdef MADV_PAGEOUT
+    // actually reclaims the backing page-cache pages; MADV_DONTNEED alone only
+    // drops the page tables and leaves file pages cached
+    if (madvise(const_cast<void*>(mapping.data), mapping.size, MADV_PAGEOUT) == 0)
+        return true;
+#endif
+    return madvise(const_cast<void*>(mapping.data), mapping.size, MADV_DONTNEED) == 0;
+#else
+    return false;
+#endif
+}
+
+std::vector<WeightResidencyInfo> WeightResidencyManager::query() {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> guard(_managerMutex);
+    std::vector<WeightResidencyInfo> result;
+    result.reserve(_mappings.size());
+    for (const auto& mapping : _mappings) {
+        WeightResidencyInfo info;
+        info.name = mapping.name;
+        info.priority = mapping.priority;
+        info.totalBytes = mapping.size;
+        info.residentBytes = residentBytes(mapping);
+        info.idleSeconds = std::chrono::duration_cast<std::chrono::duration<double>>(now - mapping.lastUse).count();
+        result.push_back(std::move(info));
+    }
+    return result;
+}
+
+bool WeightResidencyManager::evict(const std::string& name) {
+    std::lock_guard<std::mutex> guard(_managerMutex);
+    bool evicted = false;
+    for (const auto& mapping : _mappings) {
+        if (mapping.name == name && evictMapping(mapping))
+            evicted = true;
+    }
+    return evicted;
+}
+
+size_t WeightResidencyManager::evictToBudget(size_t residentBudgetBytes) {
+    std::lock_guard<std::mutex> guard(_managerMutex);
+    uint64_t residentTotal = 0;
+    std::vector<std::pair<uint64_t, const Mapping*>> candidates;
+    candidates.reserve(_mappings.size());
+    for (const auto& mapping : _mappings) {
+        const uint64_t resident = residentBytes(mapping);
+        residentTotal += resident;
+        if (resident != 0)
+            candidates.emplace_back(resident, &mapping);
+    }
+    // lowest priority first, least recently used within the same priority
+    std::sort(candidates.begin(), candidates.end(),
+              [](const std::pair<uint64_t, const Mapping*>& lhs, const std::pair<uint64_t, const Mapping*>& rhs) {
+                  if (lhs.second->priority != rhs.second->priority)
+                      return lhs.second->priority < rhs.second->priority;
+                  return lhs.second->lastUse < rhs.second->lastUse;
+              });
+    size_t evicted = 0;
+    for (const auto& candidate : candidates) {
+        if (residentTotal <= residentBudgetBytes)
+            break;
+        if (evictMapping(*candidate.second)) {
+            residentTotal -= candidate.first;
+            evicted++;
+        }
+    }
+    return evicted;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
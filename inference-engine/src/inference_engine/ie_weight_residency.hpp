@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_api.h>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Residency snapshot of one registered weight mapping
+ */
+struct WeightResidencyInfo {
+    std::string name;          //!< Registration name (path of the mapped weights file)
+    int priority = 0;          //!< Eviction priority; lower priorities are evicted first
+    uint64_t totalBytes = 0;   //!< Size of the mapping
+    uint64_t residentBytes = 0;//!< Bytes currently backed by resident pages (0 when the OS cannot tell)
+    double idleSeconds = 0.0;  //!< Time since the mapping was last marked as used
+};
+
+/**
+ * @brief Tracks the memory-mapped weight files of the loaded networks and pages them
+ *        out by policy instead of leaving the choice to the OS.
+ *
+ * Every blob created by makeMemoryMappedBlob() registers itself here under the path of
+ * the mapped file, so networks read from the same weights file share one entry. A host
+ * which over-subscribes its memory assigns a priority per network with setPriority(),
+ * marks networks as used with touch() around inference, and calls evictToBudget()
+ * (or evict() for one network) to drop the resident pages of the coldest, lowest
+ * priority mappings with madvise(). The pages are reloaded from the file on the next
+ * access, so eviction affects latency only, never correctness. query() reports
+ * resident-vs-total bytes per mapping for monitoring.
+ */
+class INFERENCE_ENGINE_API_CLASS(WeightResidencyManager) {
+public:
+    /**
+     * @brief      Returns a global instance of WeightResidencyManager
+     * @return     The instance
+     */
+    static WeightResidencyManager* getInstance();
+
+    /**
+     * @brief A deleted copy constructor
+     */
+    WeightResidencyManager(WeightResidencyManager const&) = delete;
+
+    /**
+     * @brief A deleted assignment operator
+     */
+    void operator=(WeightResidencyManager const&) = delete;
+
+    /**
+     * @brief Registers a weight mapping; called by the mapped blob on construction
+     * @param name Registration name, the path of the mapped file
+     * @param data Base address of the mapping
+     * @param size Size of the mapping in bytes
+     */
+    void registerMapping(const std::string& name, const void* data, size_t size);
+
+    /**
+     * @brief Removes a mapping; called by the mapped blob on destruction
+     * @param data Base address the mapping was registered with
+     */
+    void unregisterMapping(const void* data);
+
+    /**
+     * @brief Sets the eviction priority of every mapping registered under the name
+     * @param name Registration name
+     * @param priority Eviction priority; lower priorities are evicted first
+     */
+    void setPriority(const std::string& name, int priority);
+
+    /**
+     * @brief Marks the mappings registered under the name as just used (LRU bump)
+     * @param name Registration name
+     */
+    void touch(const std::string& name);
+
+    /**
+     * @brief Reports resident-vs-total bytes, priority and idle time per mapping
+     * @return A vector with one entry per registered mapping
+     */
+    std::vector<WeightResidencyInfo> query();
+
+    /**
+     * @brief Drops the resident pages of every mapping registered under the name
+     * @param name Registration name
+     * @return true if at least one mapping was evicted
+     */
+    bool evict(const std::string& name);
+
+    /**
+     * @brief Evicts the coldest, lowest priority mappings until the bytes still
+     *        resident fit the budget
+     * @param residentBudgetBytes Upper bound on the summed resident bytes to keep
+     * @return The number of evicted mappings
+     */
+    size_t evictToBudget(size_t residentBudgetBytes);
+
+private:
+    WeightResidencyManager() = default;
+
+    struct Mapping {
+        std::string name;
+        const void* data = nullptr;
+        size_t size = 0;
+        int priority = 0;
+        std::chrono::steady_clock::time_point lastUse;
+    };
+
+    uint64_t residentBytes(const Mapping& mapping) const;
+    bool evictMapping(const Mapping& mapping) const;
+
+    std::mutex _managerMutex;
+    std::vector<Mapping> _mappings;
+
+    static std::mutex _mutex;
+    static WeightResidencyManager* _instance;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
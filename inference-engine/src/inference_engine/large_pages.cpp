@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_large_pages.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr std::size_t LARGE_PAGE_SIZE = std::size_t(2) << 20;
+
+std::atomic<bool> largePagesEnabled{false};
+std::mutex largePagesMutex;
+
+std::unordered_map<void*, std::size_t>& largePagesAllocations() {
+    static std::unordered_map<void*, std::size_t> allocations;
+    return allocations;
+}
+
+}  // namespace
+
+void SetLargePagesEnabled(bool enabled) noexcept {
+    largePagesEnabled = enabled;
+}
+
+bool LargePagesEnabled() noexcept {
+    return largePagesEnabled;
+}
+
+void* AllocLargePages(std::size_t size) noexcept {
+#ifdef __linux__
+    if (!largePagesEnabled || size < LARGE_PAGE_SIZE)
+        return nullptr;
+    const std::size_t rounded = (size + LARGE_PAGE_SIZE - 1) & ~(LARGE_PAGE_SIZE - 1);
+    void* ptr = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (MAP_FAILED == ptr) {
+        // no pre-reserved huge pages (vm.nr_hugepages): take a regular mapping and
+        // ask for transparent huge pages, which the kernel may still back with 2MB
+        // pages without any reservation
+        ptr = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == ptr)
+            return nullptr;
+#ifdef MADV_HUGEPAGE
+        madvise(ptr, rounded, MADV_HUGEPAGE);
+#endif
+    }
+    try {
+        std::lock_guard<std::mutex> lock(largePagesMutex);
+        largePagesAllocations()[ptr] = rounded;
+    } catch (...) {
+        munmap(ptr, rounded);
+        return nullptr;
+    }
+    return ptr;
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
+bool FreeLargePages(void* handle) noexcept {
+#ifdef __linux__
+    std::size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(largePagesMutex);
+        auto& allocations = largePagesAllocations();
+        const auto it = allocations.find(handle);
+        if (it == allocations.end())
+            return false;
+        size = it->second;
+        allocations.erase(it);
+    }
+    munmap(handle, size);
+    return true;
+#else
+    (void)handle;
+    return false;
+#endif
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,81 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_memory_accounting.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+thread_local MemoryAccounting::Phase g_currentPhase = MemoryAccounting::Phase::Other;
+
+const char* phaseName(std::size_t phaseIndex) {
+    static const char* names[] = {"READ", "TRANSFORM", "COMPILE", "INFER", "OTHER"};
+    return names[phaseIndex];
+}
+
+}  // namespace
+
+MemoryAccounting& MemoryAccounting::get() noexcept {
+    static MemoryAccounting instance;
+    return instance;
+}
+
+void MemoryAccounting::allocated(void* handle, std::size_t size) noexcept {
+    try {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const auto it = _allocations.find(handle);
+        if (it != _allocations.end()) {
+            // the previous owner released the memory bypassing the allocator
+            _perPhase[static_cast<std::size_t>(it->second.phase)].current -= it->second.size;
+            _total.current -= it->second.size;
+            _allocations.erase(it);
+        }
+
+        _perPhase[static_cast<std::size_t>(g_currentPhase)].add(size);
+        _total.add(size);
+        _allocations[handle] = {size, g_currentPhase};
+    } catch (...) {
+    }
+}
+
+void MemoryAccounting::freed(void* handle) noexcept {
+    try {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const auto it = _allocations.find(handle);
+        if (it == _allocations.end()) {
+            return;
+        }
+
+        _perPhase[static_cast<std::size_t>(it->second.phase)].current -= it->second.size;
+        _total.current -= it->second.size;
+        _allocations.erase(it);
+    } catch (...) {
+    }
+}
+
+std::map<std::string, uint64_t> MemoryAccounting::report() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::map<std::string, uint64_t> report;
+    for (std::size_t i = 0; i < _phasesCount; ++i) {
+        report[std::string(phaseName(i)) + "_CURRENT"] = _perPhase[i].current;
+        report[std::string(phaseName(i)) + "_PEAK"] = _perPhase[i].peak;
+    }
+    report["TOTAL_CURRENT"] = _total.current;
+    report["TOTAL_PEAK"] = _total.peak;
+    return report;
+}
+
+MemoryAccounting::ScopedPhase::ScopedPhase(Phase phase) noexcept : _previous(g_currentPhase) {
+    g_currentPhase = phase;
+}
+
+MemoryAccounting::ScopedPhase::~ScopedPhase() {
+    g_currentPhase = _previous;
+}
+
+}  // namespace InferenceEngine
@@ -2,9 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <fstream>
 #include <map>
+#include <set>
+#include <sstream>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <iostream>
 #include <sched.h>
@@ -61,6 +66,89 @@ std::vector<int> getAvailableNUMANodes() {
     return nodes;
 }
 #endif
+static std::vector<int> parseCpuList(const std::string& str) {
+    std::vector<int> cpus;
+    std::stringstream stream(str);
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        if (token.empty()) continue;
+        auto dash = token.find('-');
+        int first = std::stoi(token.substr(0, dash));
+        int last = (dash == std::string::npos) ? first : std::stoi(token.substr(dash + 1));
+        for (int id = first; id <= last; id++) {
+            cpus.push_back(id);
+        }
+    }
+    return cpus;
+}
+
+std::vector<std::vector<int>> getCoreComplexes() {
+    static const std::vector<std::vector<int>> complexes = [] {
+        auto readFirstLine = [](const std::string& path) {
+            std::ifstream file(path);
+            std::string line;
+            std::getline(file, line);
+            return line;
+        };
+        auto readInt = [&readFirstLine](const std::string& path, int fallback) {
+            auto line = readFirstLine(path);
+            try {
+                return line.empty() ? fallback : std::stoi(line);
+            } catch (...) {
+                return fallback;
+            }
+        };
+        // hybrid parts enumerate their core classes under /sys/devices; a machine
+        // without the node is homogeneous and gets a single class
+        std::vector<int> atomCpus = parseCpuList(readFirstLine("/sys/devices/cpu_atom/cpus"));
+
+        struct CpuInfo {
+            int classId = 0;
+            int package = 0;
+            int coreId  = 0;
+            int l2Id    = -1;
+        };
+        std::vector<CpuInfo> infos(cpu._processors);
+        for (int id = 0; id < cpu._processors; id++) {
+            const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(id) + "/";
+            auto& info = infos[id];
+            info.classId = std::find(atomCpus.begin(), atomCpus.end(), id) != atomCpus.end() ? 1 : 0;
+            info.package = readInt(base + "topology/physical_package_id", 0);
+            info.coreId  = readInt(base + "topology/core_id", id);
+            auto shared = parseCpuList(readFirstLine(base + "cache/index2/shared_cpu_list"));
+            info.l2Id = shared.empty() ? -1 : *std::min_element(shared.begin(), shared.end());
+        }
+
+        // an L2 complex only counts as a slicing boundary when it spans several cores
+        // (E-core clusters); a private per-core L2 (P-cores, most server parts) would cut
+        // the class into single-core groups, so those merge into one group per class
+        std::map<std::pair<int, int>, std::map<int, std::set<int>>> l2Cores;
+        for (int id = 0; id < cpu._processors; id++) {
+            const auto& info = infos[id];
+            l2Cores[{info.classId, info.package}][info.l2Id].insert(info.coreId);
+        }
+        std::map<std::tuple<int, int, int>, std::vector<int>> groups;
+        for (int id = 0; id < cpu._processors; id++) {
+            const auto& info = infos[id];
+            bool clustered = false;
+            for (auto&& complex : l2Cores[{info.classId, info.package}]) {
+                if (complex.second.size() > 1) {
+                    clustered = true;
+                    break;
+                }
+            }
+            groups[std::make_tuple(info.classId, info.package, clustered ? info.l2Id : -1)].push_back(id);
+        }
+
+        std::vector<std::vector<int>> result;
+        for (auto&& group : groups) {
+            result.emplace_back(std::move(group.second));
+        }
+        return result;
+    }();
+    return complexes;
+}
+
 int getNumberOfCPUCores() {
     unsigned numberOfProcessors = cpu._processors;
     unsigned totalNumberOfCpuCores = cpu._cores;
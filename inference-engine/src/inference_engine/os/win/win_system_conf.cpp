@@ -34,6 +34,9 @@ int getNumberOfCPUCores() {
 #if !(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 // OMP/SEQ threading on the Windows doesn't support NUMA
 std::vector<int> getAvailableNUMANodes() { return std::vector<int>(1, 0); }
+
+// no topology detection on Windows: streams keep the flat core numbering
+std::vector<std::vector<int>> getCoreComplexes() { return {}; }
 #endif
 
 }  // namespace InferenceEngine
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_precision_conversions.hpp"
+
+#include <exception>
+
+#include "ie_system_conf.h"
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/precision_conversions_sse42.hpp"
+#endif
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+namespace PrecisionConversions {
+
+void convertArrayU8ToF32(const uint8_t* src, float* dst, size_t count) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convert_u8_f32_sse42(src, dst, count);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++)
+        dst[i] = static_cast<float>(src[i]);
+}
+
+void convertArrayF32ToU8(const float* src, uint8_t* dst, size_t count) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convert_f32_u8_sse42(src, dst, count);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++) {
+        float clamped = src[i] < 255.0f ? src[i] : 255.0f;
+        clamped = clamped > 0.0f ? clamped : 0.0f;
+        dst[i] = static_cast<uint8_t>(clamped);
+    }
+}
+
+void convertArrayBF16ToF32(const int16_t* src, float* dst, size_t count) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convert_bf16_f32_sse42(src, dst, count);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++) {
+        union {
+            float f;
+            uint32_t u;
+        } v;
+        v.u = static_cast<uint32_t>(static_cast<uint16_t>(src[i])) << 16;
+        dst[i] = v.f;
+    }
+}
+
+void convertArrayF32ToBF16(const float* src, int16_t* dst, size_t count) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convert_f32_bf16_sse42(src, dst, count);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++) {
+        union {
+            float f;
+            uint32_t u;
+        } v;
+        v.f = src[i];
+        if (src[i] != src[i]) {
+            dst[i] = static_cast<int16_t>((v.u >> 16) | 0x0040u);
+        } else {
+            dst[i] = static_cast<int16_t>((v.u + 0x7FFFu + ((v.u >> 16) & 1u)) >> 16);
+        }
+    }
+}
+
+// There are no FP16 conversion instructions in SSE 4.2, so both directions stay scalar
+// until a wider ISA tier is added here.
+void convertArrayF16ToF32(const short* src, float* dst, size_t count, float scale, float bias) {
+    const ie_fp16* src_fp16 = reinterpret_cast<const ie_fp16*>(src);
+
+    for (size_t i = 0; i < count; i++)
+        dst[i] = PrecisionUtils::f16tof32(src_fp16[i]) * scale + bias;
+}
+
+void convertArrayF32ToF16(const float* src, short* dst, size_t count, float scale, float bias) {
+    for (size_t i = 0; i < count; i++)
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+}
+
+}  // namespace PrecisionConversions
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
+#include <ie_precision_conversions.hpp>
 
 #include <stdint.h>
 
@@ -11,17 +12,11 @@ namespace InferenceEngine {
 namespace PrecisionUtils {
 
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
-
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
-    }
+    PrecisionConversions::convertArrayF16ToF32(src, dst, nelem, scale, bias);
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+    PrecisionConversions::convertArrayF32ToF16(src, dst, nelem, scale, bias);
 }
 
 // Function to convert F32 into F16
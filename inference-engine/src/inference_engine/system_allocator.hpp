@@ -7,6 +7,8 @@
 #include <iostream>
 
 #include "ie_allocator.hpp"
+#include "ie_large_pages.hpp"
+#include "ie_memory_accounting.hpp"
 
 class SystemMemoryAllocator : public InferenceEngine::IAllocator {
 public:
@@ -22,7 +24,12 @@ public:
 
     void* alloc(size_t size) noexcept override {
         try {
-            auto handle = reinterpret_cast<void*>(new char[size]);
+            // large allocations (weights, workspaces) optionally go to 2MB pages;
+            // AllocLargePages returns nullptr whenever that does not apply
+            auto handle = InferenceEngine::AllocLargePages(size);
+            if (handle == nullptr)
+                handle = reinterpret_cast<void*>(new char[size]);
+            InferenceEngine::MemoryAccounting::get().allocated(handle, size);
             return handle;
         } catch (...) {
             return nullptr;
@@ -31,7 +38,9 @@ public:
 
     bool free(void* handle) noexcept override {
         try {
-            delete[] reinterpret_cast<char*>(handle);
+            InferenceEngine::MemoryAccounting::get().freed(handle);
+            if (!InferenceEngine::FreeLargePages(handle))
+                delete[] reinterpret_cast<char*>(handle);
         } catch (...) {
         }
         return true;
@@ -9,7 +9,9 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
 #include <atomic>
+#include <chrono>
 #include <climits>
 #include <cassert>
 #include <utility>
@@ -22,7 +24,23 @@
 #include "ie_util_internal.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+# include <pmmintrin.h>
+# define IE_CAN_FLUSH_DENORMALS 1
+#endif
+
 namespace InferenceEngine {
+namespace {
+// Sets the FTZ and DAZ bits of the calling thread's MXCSR, so denormal operands and
+// results are treated as zero instead of taking the hardware denormal assist. The mode
+// is per thread, hence it is applied on every worker a stream may run tasks on.
+inline void FlushDenormalsToZero() {
+#ifdef IE_CAN_FLUSH_DENORMALS
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+}
+}  // namespace
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -31,27 +49,45 @@ struct CPUStreamsExecutor::Impl {
             int     _ncpus                  = 0;
             int     _threadBindingStep      = 0;
             int     _offset                 = 0;
+            std::vector<int> _coreList;
             Observer(tbb::task_arena&    arena,
                      CpuSet              mask,
                      int                 ncpus,
                      const int           streamId,
                      const int           threadsPerStream,
                      const int           threadBindingStep,
-                     const int           threadBindingOffset) :
+                     const int           threadBindingOffset,
+                     std::vector<int>    coreList) :
                 tbb::task_scheduler_observer(arena),
                 _mask{std::move(mask)},
                 _ncpus(ncpus),
                 _threadBindingStep(threadBindingStep),
-                _offset{streamId * threadsPerStream  + threadBindingOffset} {
+                _offset{streamId * threadsPerStream  + threadBindingOffset},
+                _coreList{std::move(coreList)} {
             }
             void on_scheduler_entry(bool) override {
-                PinThreadToVacantCore(_offset + tbb::task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
+                if (!_coreList.empty()) {
+                    PinThreadToCoreList(_offset + tbb::task_arena::current_thread_index(), _coreList, _ncpus, _mask);
+                } else {
+                    PinThreadToVacantCore(_offset + tbb::task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
+                }
             }
             void on_scheduler_exit(bool) override {
                 PinCurrentThreadByMask(_ncpus, _mask);
             }
             ~Observer() override = default;
         };
+
+        // Applies the denormals-as-zero mode on every thread joining the stream's arena
+        struct DenormalsObserver: public tbb::task_scheduler_observer {
+            explicit DenormalsObserver(tbb::task_arena& arena) :
+                tbb::task_scheduler_observer(arena) {
+            }
+            void on_scheduler_entry(bool) override {
+                FlushDenormalsToZero();
+            }
+            ~DenormalsObserver() override = default;
+        };
 #endif
         explicit Stream(Impl* impl) :
             _impl(impl) {
@@ -84,11 +120,22 @@ struct CPUStreamsExecutor::Impl {
                                                      _streamId,
                                                      _impl->_config._threadsPerStream,
                                                      _impl->_config._threadBindingStep,
-                                                     _impl->_config._threadBindingOffset});
+                                                     _impl->_config._threadBindingOffset,
+                                                     _impl->StreamCoreList(_streamId)});
                         _observer->observe(true);
                     }
                 }
             }
+            if (_impl->_config._denormalsOptimization) {
+                // the mode is per thread, so it has to be set on every arena worker a task
+                // may land on; an arena is forced even when neither pinning nor a thread
+                // limit asked for one, so all the stream's threads pass the observer
+                if (nullptr == _taskArena) {
+                    _taskArena.reset(new tbb::task_arena{concurrency});
+                }
+                _denormalsObserver.reset(new DenormalsObserver{*_taskArena});
+                _denormalsObserver->observe(true);
+            }
 #elif IE_THREAD == IE_THREAD_OMP
             omp_set_num_threads(_impl->_config._threadsPerStream);
             if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
@@ -96,12 +143,22 @@ struct CPUStreamsExecutor::Impl {
                 int    ncpus = 0;
                 std::tie(processMask, ncpus) = GetProcessMask();
                 if (nullptr != processMask) {
+                    const auto coreList = _impl->StreamCoreList(_streamId);
                     parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
                         int thrIdx = _streamId * _impl->_config._threadsPerStream + threadIndex + _impl->_config._threadBindingOffset;
-                        PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
+                        if (!coreList.empty()) {
+                            PinThreadToCoreList(thrIdx, coreList, ncpus, processMask);
+                        } else {
+                            PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
+                        }
                     });
                 }
             }
+            if (_impl->_config._denormalsOptimization) {
+                parallel_nt(_impl->_config._threadsPerStream, [&] (int, int) {
+                    FlushDenormalsToZero();
+                });
+            }
 #elif IE_THREAD == IE_THREAD_SEQ
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
@@ -110,7 +167,12 @@ struct CPUStreamsExecutor::Impl {
                 int    ncpus = 0;
                 std::tie(processMask, ncpus) = GetProcessMask();
                 if (nullptr != processMask) {
-                    PinThreadToVacantCore(_streamId + _impl->_config._threadBindingOffset, _impl->_config._threadBindingStep, ncpus, processMask);
+                    const auto coreList = _impl->StreamCoreList(_streamId);
+                    if (!coreList.empty()) {
+                        PinThreadToCoreList(_streamId + _impl->_config._threadBindingOffset, coreList, ncpus, processMask);
+                    } else {
+                        PinThreadToVacantCore(_streamId + _impl->_config._threadBindingOffset, _impl->_config._threadBindingStep, ncpus, processMask);
+                    }
                 }
             }
 #endif
@@ -124,6 +186,9 @@ struct CPUStreamsExecutor::Impl {
             if (nullptr != _observer) {
                 _observer->observe(false);
             }
+            if (nullptr != _denormalsObserver) {
+                _denormalsObserver->observe(false);
+            }
 #endif
         }
 
@@ -135,50 +200,163 @@ struct CPUStreamsExecutor::Impl {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<tbb::task_arena>    _taskArena;
         std::unique_ptr<Observer>           _observer;
+        std::unique_ptr<DenormalsObserver>  _denormalsObserver;
 #endif
     };
 
+    // Per-stream task deque: owner pops from the front, thieves steal from the back,
+    // so the only contention left is between a stealing stream and the queue owner.
+    // High priority tasks live in their own deque and are always drained first,
+    // which keeps FIFO order within each priority class
+    // the enqueue timestamp travels with the task so the pop side can charge the
+    // time the task spent waiting to the dispatch-latency counter
+    struct TimedTask {
+        Task task;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    struct WorkerQueue {
+        std::mutex      _mutex;
+        std::deque<TimedTask> _highTasks;
+        std::deque<TimedTask> _tasks;
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
+        _taskProfiling{ProfilingTask{_config._name + "_Task"}},
         _streams([this] {
             return std::make_shared<Impl::Stream>(this);
         }) {
-        auto numaNodes = getAvailableNUMANodes();
-        std::copy_n(std::begin(numaNodes),
-                    std::min(std::max(static_cast<std::size_t>(1),
-                                      static_cast<std::size_t>(_config._streams)),
-                             numaNodes.size()),
-                    std::back_inserter(_usedNumaNodes));
+        if (_config._numaNodeId >= 0) {
+            // compact placement: every stream lands on the requested node
+            _usedNumaNodes.push_back(_config._numaNodeId);
+        } else {
+            auto numaNodes = getAvailableNUMANodes();
+            std::copy_n(std::begin(numaNodes),
+                        std::min(std::max(static_cast<std::size_t>(1),
+                                          static_cast<std::size_t>(_config._streams)),
+                                 numaNodes.size()),
+                        std::back_inserter(_usedNumaNodes));
+        }
+        _workerQueues.reset(new WorkerQueue[std::max(1, _config._streams)]);
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 annotateSetThreadName((_config._name + "_" + std::to_string(streamId)).c_str());
+                if (_config._denormalsOptimization) {
+                    FlushDenormalsToZero();
+                }
                 for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
+                    Task task = TryPopTask(streamId);
+                    if (!task) {
+                        if (SpinForPendingTasks())
+                            continue;
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                        _queueCondVar.wait(lock, [&] { return (_pendingTasks > 0) || (stopped = _isStopped); });
+                        continue;
                     }
+                    Execute(task, *(_streams.local()));
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    // Cores the given stream may pin its threads to when an affinity profile was
+    // configured: an explicit core list, optionally cut into groups of
+    // _threadBindingGroupSize consecutive cores (a sub-NUMA cluster, an L2 complex)
+    // with the stream confined to its own group. Empty when no profile is set, which
+    // keeps the default vacant-core placement.
+    std::vector<int> StreamCoreList(int streamId) {
+        auto cores = _config._threadBindingCoreList;
+        if (cores.empty() && (0 < _config._threadBindingGroupSize)) {
+            cores = GetProcessMaskCores();
+        }
+        const int groupSize = _config._threadBindingGroupSize;
+        if ((0 < groupSize) && (static_cast<int>(cores.size()) > groupSize)) {
+            const int numGroups = static_cast<int>(cores.size()) / groupSize;
+            const int group = streamId % numGroups;
+            cores.assign(cores.begin() + group * groupSize, cores.begin() + (group + 1) * groupSize);
+        }
+        if (cores.empty()) {
+            // automatic topology slicing: on machines with several core complexes (P/E
+            // classes of a hybrid part, E-core L2 clusters, packages) the stream is
+            // confined to one complex, so a primitive never mixes core classes and is
+            // not dragged to the speed of the slowest one. Homogeneous machines report
+            // a single complex and keep the default vacant-core placement
+            const auto& complexes = _coreComplexes;
+            if (complexes.size() > 1) {
+                cores = complexes[streamId % complexes.size()];
+            }
+        }
+        return cores;
+    }
+
+    // Spin-then-park wait policy: with a non-zero _spinWaitUs budget an idle worker polls the
+    // pending-task counter for up to that many microseconds, so a task enqueued meanwhile is
+    // dispatched without paying the condition-variable wakeup. The spin is bounded, hence
+    // shutdown still proceeds through the parked wait below it.
+    bool SpinForPendingTasks() {
+        if (_config._spinWaitUs <= 0)
+            return false;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(_config._spinWaitUs);
+        int polls = 0;
+        do {
+            if (_pendingTasks > 0)
+                return true;
+            if (0 == (++polls & 0x3F))
+                std::this_thread::yield();
+        } while (std::chrono::steady_clock::now() < deadline);
+        return false;
+    }
+
+    Task TryPopTask(int streamId) {
+        const int numQueues = std::max(1, _config._streams);
+        // own queue first, then round-robin stealing from the victims' tails
+        for (int i = 0; i < numQueues; ++i) {
+            auto& queue = _workerQueues[(streamId + i) % numQueues];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            auto& tasks = !queue._highTasks.empty() ? queue._highTasks : queue._tasks;
+            if (!tasks.empty()) {
+                TimedTask entry = (0 == i) ? std::move(tasks.front()) : std::move(tasks.back());
+                if (0 == i) {
+                    tasks.pop_front();
+                } else {
+                    tasks.pop_back();
+                }
+                --_pendingTasks;
+                const auto waited = std::chrono::steady_clock::now() - entry.enqueued;
+                _statDispatchNs.fetch_add(
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()),
+                    std::memory_order_relaxed);
+                return std::move(entry.task);
+            }
+        }
+        return {};
+    }
+
+    void Enqueue(Task task, TaskPriority priority = TaskPriority::NORMAL) {
+        const int numQueues = std::max(1, _config._streams);
+        auto& queue = _workerQueues[_enqueueIndex++ % numQueues];
         {
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            auto& tasks = (TaskPriority::HIGH == priority) ? queue._highTasks : queue._tasks;
+            tasks.emplace_back(TimedTask{std::move(task), std::chrono::steady_clock::now()});
+        }
+        {
+            // the increment must happen under the mutex the workers wait on: otherwise
+            // a worker can evaluate the wait predicate just before the increment and
+            // block just after the notify, stranding the task (lost wakeup)
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            ++_pendingTasks;
         }
+        _statEnqueued.fetch_add(1, std::memory_order_relaxed);
         _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
+        // one span per dispatched task, named after the executor, so a VTune/ITT
+        // capture shows where every request lands across the stream threads
+        IE_PROFILING_AUTO_SCOPE_TASK(_taskProfiling)
+        const auto started = std::chrono::steady_clock::now();
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
         if (nullptr != arena) {
@@ -189,6 +367,11 @@ struct CPUStreamsExecutor::Impl {
 #else
         task();
 #endif
+        const auto elapsed = std::chrono::steady_clock::now() - started;
+        _statBusyNs.fetch_add(
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            std::memory_order_relaxed);
+        _statCompleted.fetch_add(1, std::memory_order_relaxed);
     }
 
     void Defer(Task task) {
@@ -206,16 +389,49 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    ExecutorDiagnostics GetDiagnostics() const {
+        ExecutorDiagnostics diag;
+        diag.name = _config._name;
+        diag.enqueuedTasks = _statEnqueued.load(std::memory_order_relaxed);
+        diag.completedTasks = _statCompleted.load(std::memory_order_relaxed);
+        diag.queuedTasks = static_cast<uint64_t>(std::max(0, _pendingTasks.load(std::memory_order_relaxed)));
+        // only dispatched tasks have contributed to the latency sum
+        const uint64_t dispatched = (diag.enqueuedTasks > diag.queuedTasks) ? diag.enqueuedTasks - diag.queuedTasks : 0;
+        if (0 != dispatched) {
+            diag.avgDispatchUs = static_cast<double>(_statDispatchNs.load(std::memory_order_relaxed))
+                                 / 1000.0 / static_cast<double>(dispatched);
+        }
+        const auto wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - _statOrigin).count();
+        if (wallNs > 0) {
+            diag.busyRatio = static_cast<double>(_statBusyNs.load(std::memory_order_relaxed))
+                             / (static_cast<double>(wallNs) * std::max(1, _config._streams));
+        }
+        return diag;
+    }
+
     Config                                  _config;
+    ProfilingTask                           _taskProfiling;
     std::mutex                              _streamIdMutex;
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::unique_ptr<WorkerQueue[]>          _workerQueues;
+    std::atomic<int>                        _pendingTasks{0};
+    std::atomic<unsigned>                   _enqueueIndex{0};
+    // scheduling counters behind GetDiagnostics(); relaxed atomics keep the
+    // instrumentation free of synchronization on the enqueue/dispatch paths
+    std::atomic<uint64_t>                   _statEnqueued{0};
+    std::atomic<uint64_t>                   _statCompleted{0};
+    std::atomic<uint64_t>                   _statDispatchNs{0};
+    std::atomic<uint64_t>                   _statBusyNs{0};
+    const std::chrono::steady_clock::time_point _statOrigin = std::chrono::steady_clock::now();
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
+    // core complexes the streams are sliced along; queried once per executor
+    std::vector<std::vector<int>>           _coreComplexes = getCoreComplexes();
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
 
@@ -247,6 +463,10 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
     }
 }
 
+ExecutorDiagnostics CPUStreamsExecutor::GetDiagnostics() const {
+    return _impl->GetDiagnostics();
+}
+
 void CPUStreamsExecutor::Execute(Task task) {
     _impl->Defer(std::move(task));
 }
@@ -259,4 +479,12 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run(Task task, TaskPriority priority) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
+    }
+}
+
 }  // namespace InferenceEngine
@@ -22,6 +22,18 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+namespace {
+bool configsAreEqual(const IStreamsExecutor::Config& lhs, const IStreamsExecutor::Config& rhs) {
+    return lhs._name == rhs._name &&
+           lhs._streams == rhs._streams &&
+           lhs._threadsPerStream == rhs._threadsPerStream &&
+           lhs._threadBindingType == rhs._threadBindingType &&
+           lhs._threadBindingStep == rhs._threadBindingStep &&
+           lhs._threadBindingOffset == rhs._threadBindingOffset &&
+           lhs._numaNodeId == rhs._numaNodeId;
+}
+}  // namespace
+
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
@@ -29,13 +41,7 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name &&
-            executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+        if (configsAreEqual(it.first, config))
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -43,6 +49,20 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    // unlike the idle variant above the executor is handed out even when it is
+    // already leased: all holders multiplex their tasks onto the same stream
+    // threads, so the process keeps one pool per distinct configuration
+    for (const auto& it : cpuStreamsExecutors) {
+        if (configsAreEqual(it.first, config))
+            return it.second;
+    }
+    auto newExec = std::make_shared<CPUStreamsExecutor>(config);
+    cpuStreamsExecutors.emplace_back(std::make_pair(config, newExec));
+    return newExec;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -53,6 +73,27 @@ size_t ExecutorManagerImpl::getIdleCPUStreamsExecutorsNumber() {
     return cpuStreamsExecutors.size();
 }
 
+std::vector<ExecutorDiagnostics> ExecutorManagerImpl::getDiagnostics() {
+    std::vector<ExecutorDiagnostics> result;
+    {
+        std::lock_guard<std::mutex> guard(taskExecutorMutex);
+        for (const auto& it : executors) {
+            auto cpuStreamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(it.second);
+            if (nullptr != cpuStreamsExecutor)
+                result.emplace_back(cpuStreamsExecutor->GetDiagnostics());
+        }
+    }
+    {
+        std::lock_guard<std::mutex> guard(streamExecutorMutex);
+        for (const auto& it : cpuStreamsExecutors) {
+            auto cpuStreamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(it.second);
+            if (nullptr != cpuStreamsExecutor)
+                result.emplace_back(cpuStreamsExecutor->GetDiagnostics());
+        }
+    }
+    return result;
+}
+
 void ExecutorManagerImpl::clear(const std::string& id) {
     std::lock_guard<std::mutex> stream_guard(streamExecutorMutex);
     std::lock_guard<std::mutex> task_guard(taskExecutorMutex);
@@ -123,6 +164,10 @@ size_t ExecutorManager::getIdleCPUStreamsExecutorsNumber() {
     return _impl.getIdleCPUStreamsExecutorsNumber();
 }
 
+std::vector<ExecutorDiagnostics> ExecutorManager::getDiagnostics() {
+    return _impl.getDiagnostics();
+}
+
 void ExecutorManager::clear(const std::string& id) {
     _impl.clear(id);
 }
@@ -131,4 +176,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
 }  // namespace InferenceEngine
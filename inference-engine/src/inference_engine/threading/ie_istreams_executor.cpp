@@ -24,6 +24,10 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_CORE_LIST),
+        CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_GROUP_SIZE),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT_US),
+        CONFIG_KEY(CPU_DENORMALS_OPTIMIZATION),
     };
 }
 
@@ -96,6 +100,62 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only non negative numbers (#threads)";
             }
             _threadsPerStream = val_i;
+        } else if (key == CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_CORE_LIST)) {
+            std::vector<int> coreList;
+            std::string rest = value;
+            while (!rest.empty()) {
+                const auto comma = rest.find(',');
+                const auto token = rest.substr(0, comma);
+                rest = (comma == std::string::npos) ? std::string{} : rest.substr(comma + 1);
+                int val_i;
+                try {
+                    val_i = std::stoi(token);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_CORE_LIST)
+                                       << ". Expected comma-separated list of non negative cpu ids, got " << value;
+                }
+                if (val_i < 0) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_CORE_LIST)
+                                       << ". Expected comma-separated list of non negative cpu ids, got " << value;
+                }
+                coreList.push_back(val_i);
+            }
+            _threadBindingCoreList = coreList;
+        } else if (key == CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_GROUP_SIZE)) {
+            int val_i;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_GROUP_SIZE)
+                                   << ". Expected only non negative numbers (#cores per group)";
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_GROUP_SIZE)
+                                   << ". Expected only non negative numbers (#cores per group)";
+            }
+            _threadBindingGroupSize = val_i;
+        } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT_US)) {
+            int val_i;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT_US)
+                                   << ". Expected only non negative numbers (#microseconds)";
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT_US)
+                                   << ". Expected only non negative numbers (#microseconds)";
+            }
+            _spinWaitUs = val_i;
+        } else if (key == CONFIG_KEY(CPU_DENORMALS_OPTIMIZATION)) {
+            if (value == CONFIG_VALUE(YES)) {
+                _denormalsOptimization = true;
+            } else if (value == CONFIG_VALUE(NO)) {
+                _denormalsOptimization = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_DENORMALS_OPTIMIZATION)
+                                   << ". Expected only YES/NO";
+            }
         } else {
             THROW_IE_EXCEPTION << "Wrong value for property key " << key;
         }
@@ -120,6 +180,18 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_CORE_LIST)) {
+        std::string coreList;
+        for (auto&& core : _threadBindingCoreList) {
+            coreList += (coreList.empty() ? "" : ",") + std::to_string(core);
+        }
+        return {coreList};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_THREAD_BINDING_GROUP_SIZE)) {
+        return {_threadBindingGroupSize};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_WAIT_US)) {
+        return {_spinWaitUs};
+    } else if (key == CONFIG_KEY(CPU_DENORMALS_OPTIMIZATION)) {
+        return {_denormalsOptimization ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else {
         THROW_IE_EXCEPTION << "Wrong value for property key " << key;
     }
@@ -11,6 +11,12 @@
 
 namespace InferenceEngine {
 
+void ITaskExecutor::run(Task task, TaskPriority priority) {
+    // executors which maintain a task queue are expected to override this method
+    (void)priority;
+    run(std::move(task));
+}
+
 void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
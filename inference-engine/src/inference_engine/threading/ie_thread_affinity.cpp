@@ -70,6 +70,37 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     return res;
 }
 
+bool PinThreadToCoreList(int thrIdx, const std::vector<int>& coreList, int ncores, const CpuSet& procMask) {
+    if (coreList.empty() || nullptr == procMask)
+        return false;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    const int mapped_idx = coreList[thrIdx % coreList.size()];
+    // never pin outside of the process mask the user has set up
+    if (mapped_idx >= ncores || !CPU_ISSET_S(mapped_idx, size, procMask.get()))
+        return false;
+
+    CpuSet targetMask{CPU_ALLOC(ncores)};
+    CPU_ZERO_S(size, targetMask.get());
+    CPU_SET_S(mapped_idx, size, targetMask.get());
+    return PinCurrentThreadByMask(ncores, targetMask);
+}
+
+std::vector<int> GetProcessMaskCores() {
+    std::vector<int> cores;
+    CpuSet mask;
+    int    ncpus = 0;
+    std::tie(mask, ncpus) = GetProcessMask();
+    if (nullptr != mask) {
+        const size_t size = CPU_ALLOC_SIZE(ncpus);
+        for (int cpu = 0; cpu < ncpus; ++cpu) {
+            if (CPU_ISSET_S(cpu, size, mask.get())) {
+                cores.push_back(cpu);
+            }
+        }
+    }
+    return cores;
+}
+
 bool PinCurrentThreadToSocket(int socket) {
     const int sockets = InferenceEngine::getAvailableNUMANodes().size();
     const int cores = InferenceEngine::getNumberOfCPUCores();
@@ -105,6 +136,12 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
 bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
     return false;
 }
+bool PinThreadToCoreList(int thrIdx, const std::vector<int>& coreList, int ncores, const CpuSet& procMask) {
+    return false;
+}
+std::vector<int> GetProcessMaskCores() {
+    return {};
+}
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformations/fuse_scaleshift_chain.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <details/caseless.hpp>
+#include "low_precision_transformations/common/ie_lpt_exception.hpp"
+#include "low_precision_transformations/network_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+void FuseScaleShiftChainTransformation::transform(TransformationContext& context, CNNLayer& layer) const {
+    if ((!CaselessEq<std::string>()(layer.type, "Convolution")) &&
+        (!CaselessEq<std::string>()(layer.type, "FullyConnected")) &&
+        (!CaselessEq<std::string>()(layer.type, "GEMM"))) {
+        return;
+    }
+
+    std::vector<CNNLayerPtr> children = CNNNetworkHelper::getChildren(layer);
+    if ((children.size() != 1ul) || (!CaselessEq<std::string>()(children[0]->type, "ScaleShift"))) {
+        return;
+    }
+
+    // The first ScaleShift holds the layer requantization values and is fused into the
+    // layer by the plugin as output scales & shifts. Each following standalone ScaleShift
+    // is an extra memory pass, so the whole chain is folded into the first one:
+    // s2 * (s1 * x + b1) + b2 == (s2 * s1) * x + (s2 * b1 + b2).
+    const CNNLayerPtr requantize = children[0];
+
+    while (true) {
+        const std::vector<CNNLayerPtr> next = CNNNetworkHelper::getChildren(*requantize);
+        if ((next.size() != 1ul) || (!CaselessEq<std::string>()(next[0]->type, "ScaleShift"))) {
+            break;
+        }
+
+        const CNNLayerPtr child = next[0];
+        if (CNNNetworkHelper::getParents(*child).size() != 1ul) {
+            break;
+        }
+
+        // the removed layer can not be a network output: outputs are tracked by name
+        if ((child->outData.size() != 1ul) || child->outData[0]->getInputTo().empty()) {
+            break;
+        }
+
+        Blob::Ptr scalesBlob = CNNNetworkHelper::getBlob(requantize, "weights");
+        auto scalesBufferPtr = CNNNetworkHelper::getFloatData(scalesBlob);
+        Blob::Ptr shiftsBlob = CNNNetworkHelper::getBlob(requantize, "biases");
+        auto shiftsBufferPtr = CNNNetworkHelper::getFloatData(shiftsBlob);
+
+        const Blob::Ptr childScalesBlob = CNNNetworkHelper::getBlob(child, "weights");
+        auto childScalesBufferPtr = CNNNetworkHelper::getFloatData(childScalesBlob);
+        const Blob::Ptr childShiftsBlob = CNNNetworkHelper::getBlob(child, "biases");
+        auto childShiftsBufferPtr = CNNNetworkHelper::getFloatData(childShiftsBlob);
+
+        if ((scalesBlob->size() != shiftsBlob->size()) ||
+            (childScalesBlob->size() != childShiftsBlob->size()) ||
+            (scalesBlob->size() != childScalesBlob->size())) {
+            break;
+        }
+
+        const float* scalesBuffer = scalesBufferPtr.get();
+        const float* shiftsBuffer = shiftsBufferPtr.get();
+        const float* childScalesBuffer = childScalesBufferPtr.get();
+        const float* childShiftsBuffer = childShiftsBufferPtr.get();
+
+        std::vector<float> fusedScales(scalesBlob->size());
+        std::vector<float> fusedShifts(shiftsBlob->size());
+        for (size_t i = 0lu; i < fusedScales.size(); ++i) {
+            fusedScales[i] = childScalesBuffer[i] * scalesBuffer[i];
+            fusedShifts[i] = childScalesBuffer[i] * shiftsBuffer[i] + childShiftsBuffer[i];
+        }
+
+        CNNNetworkHelper::fillBlobByFP32(scalesBlob, fusedScales.data());
+        CNNNetworkHelper::fillBlobByFP32(shiftsBlob, fusedShifts.data());
+
+        if (updatePrecisions) {
+            requantize->outData[0]->setPrecision(child->outData[0]->getPrecision());
+        }
+
+        CNNNetworkHelper::removeLayer(context.network, child);
+        context.removeLayer(*child);
+    }
+}
@@ -31,6 +31,7 @@
 #include "low_precision_transformations/fake_quantize.hpp"
 #include "low_precision_transformations/fully_connected.hpp"
 #include "low_precision_transformations/fuse_fake_quantize_and_scale_shift.hpp"
+#include "low_precision_transformations/fuse_scaleshift_chain.hpp"
 #include "low_precision_transformations/gemm.hpp"
 #include "low_precision_transformations/mvn.hpp"
 #include "low_precision_transformations/permute.hpp"
@@ -212,6 +213,9 @@ LowPrecisionTransformations LowPrecisionTransformer::getAllTransformations(const
         }),
         std::map<std::string, LayerTransformationPtr>({
             { "fakequantize", LayerTransformationPtr(new FuseFakeQuantizeAndScaleShiftTransformation(params)) },
+            { "convolution", LayerTransformationPtr(new FuseScaleShiftChainTransformation(params)) },
+            { "fullyconnected", LayerTransformationPtr(new FuseScaleShiftChainTransformation(params)) },
+            { "gemm", LayerTransformationPtr(new FuseScaleShiftChainTransformation(params)) },
             { "scaleshift", LayerTransformationPtr(new ScaleShiftToConvolutionTransformation(params)) },
         }));
 }
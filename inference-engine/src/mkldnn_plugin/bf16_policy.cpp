@@ -0,0 +1,129 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "bf16_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <details/caseless.hpp>
+#include "details/ie_cnn_network_tools.h"
+#include "ngraph/type/bfloat16.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the policy decides per layer only for the weighted compute layers the
+// transformer marks bf16 initially; the rest follow the per-type allow-list
+const details::caseless_set<std::string> policyCandidates =
+    { "convolution", "fullyconnected", "innerproduct" };
+
+}  // namespace
+
+float BF16Policy::estimateSensitivity(const CNNLayerPtr& layer) {
+    auto weights = layer->blobs.find("weights");
+    if (weights == layer->blobs.end() || weights->second == nullptr
+        || weights->second->getTensorDesc().getPrecision() != Precision::FP32)
+        return 0.0f;
+
+    auto memBlob = as<MemoryBlob>(weights->second);
+    if (memBlob == nullptr)
+        return 0.0f;
+
+    auto mapped = memBlob->rmap();
+    const float* data = mapped.as<const float*>();
+    double error = 0.0, norm = 0.0;
+    for (size_t i = 0; i < memBlob->size(); i++) {
+        error += std::abs(data[i] - static_cast<float>(ngraph::bfloat16(data[i])));
+        norm += std::abs(data[i]);
+    }
+    return norm > 0.0 ? static_cast<float>(error / norm) : 0.0f;
+}
+
+void BF16Policy::build(const CNNNetwork& network, float accuracyBudget) {
+    _decisions.clear();
+
+    std::vector<std::pair<float, std::string>> candidates;
+    for (auto& layer : details::CNNNetSortTopologically(network)) {
+        if (policyCandidates.find(layer->type) == policyCandidates.end())
+            continue;
+        candidates.emplace_back(estimateSensitivity(layer), layer->name);
+    }
+
+    // keep the cheapest-to-convert layers in bf16 first, so the budget buys
+    // the largest number of bf16 layers for the accuracy it allows
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const std::pair<float, std::string>& a, const std::pair<float, std::string>& b) {
+                         return a.first < b.first;
+                     });
+
+    double accumulated = 0.0;
+    for (auto& candidate : candidates) {
+        accumulated += candidate.first;
+        Decision decision;
+        decision.bf16 = accumulated <= accuracyBudget;
+        decision.sensitivity = candidate.first;
+        _decisions[candidate.second] = decision;
+    }
+}
+
+bool BF16Policy::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open())
+        return false;
+
+    _decisions.clear();
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream parser(line);
+        std::string verdict;
+        Decision decision;
+        parser >> verdict >> decision.sensitivity;
+        std::string name;
+        std::getline(parser, name);
+        name.erase(0, name.find_first_not_of(" \t"));
+        if (name.empty())
+            THROW_IE_EXCEPTION << "Malformed bf16 policy line: " << line;
+        if (verdict == "bf16")
+            decision.bf16 = true;
+        else if (verdict == "fp32")
+            decision.bf16 = false;
+        else
+            THROW_IE_EXCEPTION << "Malformed bf16 policy decision '" << verdict << "', expected bf16/fp32";
+        _decisions[name] = decision;
+    }
+    return true;
+}
+
+void BF16Policy::save(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot write bf16 policy file " << path;
+
+    file << "# CPU bf16 per-layer policy (KEY_CPU_BF16_POLICY)" << std::endl;
+    file << "# <bf16|fp32> <estimated sensitivity> <layer name>" << std::endl;
+    file << "# edit the first column and reload to override a decision" << std::endl;
+    for (auto& entry : _decisions) {
+        file << (entry.second.bf16 ? "bf16" : "fp32") << " "
+             << entry.second.sensitivity << " " << entry.first << std::endl;
+    }
+}
+
+std::set<std::string> BF16Policy::fp32Layers() const {
+    std::set<std::string> names;
+    for (auto& entry : _decisions) {
+        if (!entry.second.bf16)
+            names.insert(entry.first);
+    }
+    return names;
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include "inference_engine.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Per-layer bf16 execution policy (KEY_CPU_BF16_POLICY).
+ *
+ * convertToBFloat16 applies a coarse per-type allow-list; the policy refines it
+ * per layer. Each weighted candidate layer gets a numerical-sensitivity estimate
+ * - the relative rounding error its weights take when truncated to bfloat16 -
+ * and the layers are kept in bf16 in ascending sensitivity order while the
+ * accumulated sensitivity stays within the accuracy budget; the remaining
+ * candidates execute in FP32.
+ *
+ * The decision map is persisted as a plain text file, one layer per line, so
+ * the decisions can be reviewed and tweaked by hand: a reviewed file takes
+ * precedence over recomputation on the next LoadNetwork.
+ */
+class BF16Policy {
+public:
+    struct Decision {
+        bool bf16 = true;
+        float sensitivity = 0.0f;
+    };
+
+    /**
+     * Estimates the numerical sensitivity of a layer as the relative L1 error
+     * of truncating its FP32 weights to bfloat16; layers without FP32 weights
+     * get zero
+     */
+    static float estimateSensitivity(const InferenceEngine::CNNLayerPtr& layer);
+
+    /**
+     * Builds the decisions for the weighted bf16-capable layers of @p network:
+     * bf16 in ascending sensitivity order while the accumulated sensitivity
+     * stays within @p accuracyBudget, FP32 for the rest
+     */
+    void build(const InferenceEngine::CNNNetwork& network, float accuracyBudget);
+
+    /** Reads a persisted decision map; returns false when the file does not exist */
+    bool load(const std::string& path);
+
+    /** Writes the decision map in the reviewable one-layer-per-line format */
+    void save(const std::string& path) const;
+
+    /** Names of the layers decided to stay in FP32 */
+    std::set<std::string> fp32Layers() const;
+
+private:
+    std::map<std::string, Decision> _decisions;
+};
+
+}  // namespace MKLDNNPlugin
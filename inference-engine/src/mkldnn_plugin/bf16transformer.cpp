@@ -49,7 +49,7 @@ void BF16Transformer::convertToFloat(InferenceEngine::CNNNetwork &network) {
     }
 }
 
-void BF16Transformer::convertToBFloat16(InferenceEngine::CNNNetwork &network) {
+void BF16Transformer::convertToBFloat16(InferenceEngine::CNNNetwork &network, bool wholeGraphMode) {
     // go over all edges and all edges having FP32 mark as BF16
     std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
     InputsDataMap inputs = network.getInputsInfo();
@@ -68,10 +68,46 @@ void BF16Transformer::convertToBFloat16(InferenceEngine::CNNNetwork &network) {
     }
 
     // convert all edges back to FP32 on demand
-    optimizeToFloat(network);
+    optimizeToFloat(network, wholeGraphMode);
 }
 
-void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
+void BF16Transformer::convertToBFloat16(InferenceEngine::CNNNetwork &network, const std::set<std::string> &fp32Layers,
+                                        bool wholeGraphMode) {
+    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
+    InputsDataMap inputs = network.getInputsInfo();
+    OutputsDataMap outputs = network.getOutputsInfo();
+    // a tensor produced or consumed by a layer pinned to FP32 by the policy is
+    // never marked bf16, so the pinned layer executes in FP32 and the plugin
+    // converts on its edges only
+    auto touchesFP32Layer = [&fp32Layers](const DataPtr &data) {
+        auto creator = data->getCreatorLayer().lock();
+        if (creator != nullptr && fp32Layers.find(creator->name) != fp32Layers.end())
+            return true;
+        for (auto consumer : data->getInputTo()) {
+            if (fp32Layers.find(consumer.second->name) != fp32Layers.end())
+                return true;
+        }
+        return false;
+    };
+    for (auto iter : sortedLayers) {
+        if (_skipmarking.find(iter->type) != _skipmarking.end()) {
+            continue;
+        }
+        for (size_t o = 0; o < iter->outData.size(); o++) {
+            if (inputs.find(iter->outData[o]->getName()) == inputs.end()
+                && outputs.find(iter->outData[o]->getName()) == outputs.end()
+                && iter->outData[o]->getPrecision() == Precision::FP32
+                && !touchesFP32Layer(iter->outData[o])) {
+                iter->outData[o]->setPrecision(Precision::BF16);
+            }
+        }
+    }
+
+    // convert all edges back to FP32 on demand
+    optimizeToFloat(network, wholeGraphMode);
+}
+
+void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network, bool wholeGraphMode) {
     std::set<DataPtr> toAnalyzeTensors;
     std::set<DataPtr> immutable;
     bool hasBF16Tensor = false;
@@ -121,7 +157,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
             // try to mark inputs of the unknown layer
             for (size_t i = 0; i < iter->insData.size(); i++) {
                 if (iter->insData[i].lock()->getPrecision() == Precision::BF16) {
-                    bool marked = tryToMarkFP32(iter->insData[i].lock(), immutable);
+                    bool marked = tryToMarkFP32(iter->insData[i].lock(), immutable, wholeGraphMode);
                     if (marked) {
                         toAnalyzeTensors.insert(iter->insData[i].lock());
                     }
@@ -130,7 +166,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
             // try to mark outputs of the unknown layer
             for (size_t o = 0; o < iter->outData.size(); o++) {
                 if (iter->outData[o]->getPrecision() == Precision::BF16) {
-                    bool marked = tryToMarkFP32(iter->outData[o], immutable);
+                    bool marked = tryToMarkFP32(iter->outData[o], immutable, wholeGraphMode);
                     if (marked) {
                         toAnalyzeTensors.insert(iter->outData[o]);
                     }
@@ -147,7 +183,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
                 // output tensor for FP32 convolutoin/FC layers should be FP32 as well
                 for (size_t o = 0; o < iter->outData.size(); o++) {
                     if (iter->outData[o]->getPrecision() == Precision::BF16) {
-                        bool marked = tryToMarkFP32(iter->outData[o], immutable);
+                        bool marked = tryToMarkFP32(iter->outData[o], immutable, wholeGraphMode);
                         if (marked) {
                             toAnalyzeTensors.insert(iter->outData[o]);
                         }
@@ -167,7 +203,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
         if (_initbf16.find(layer->type) == _initbf16.end()) {
             // for all inputs investigate and modify tensor precision if required
             for (size_t i = 0; i < layer->insData.size(); i++) {
-                bool marked = tryToMarkFP32(layer->insData[i].lock(), immutable);
+                bool marked = tryToMarkFP32(layer->insData[i].lock(), immutable, wholeGraphMode);
                 if (marked) {
                     toAnalyzeTensors.insert(layer->insData[i].lock());
                 }
@@ -183,7 +219,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
         for (auto inputTo : tensor->getInputTo()) {
             for (size_t o = 0; o < inputTo.second->outData.size(); o++) {
                 if (inputTo.second->outData[o]->getTensorDesc().getPrecision() == Precision::BF16) {
-                    bool marked = tryToMarkFP32(inputTo.second->outData[o], immutable);
+                    bool marked = tryToMarkFP32(inputTo.second->outData[o], immutable, wholeGraphMode);
                     if (marked) {
                         toAnalyzeTensors.insert(layer->outData[o]);
                     }
@@ -200,14 +236,31 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
 #endif
 }
 
-bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr>& immutable) {
+bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr>& immutable,
+                                    bool wholeGraphMode) {
     bool marked = false;
     if (immutable.find(data) == immutable.end() && data->getPrecision() == Precision::BF16) {
-        // we treat one consumer and many in different ways
-        // if there is one consumer, we can mark its input as float if it does not belong to the list of initial layers
-        // in other cases we need to mark tensor which is passed to several l ayers as FP32 only if there is at least one conusmer
-        // produces data in FP32. I.e. there should be a way fo getting FP32 from output data to this point
-        if (data->getInputTo().size() == 1) {
+        auto isBF16Capable = [this](const std::string& type) {
+            return _initbf16.find(type) != _initbf16.end() ||
+                   _complementbf16.find(type) != _complementbf16.end() ||
+                   _multiinput.find(type) != _multiinput.end();
+        };
+        if (wholeGraphMode) {
+            // greedy mode: the tensor stays in bf16 while at least one consumer supports it.
+            // Consumers which announce FP32-only configs get a converting reorder on their
+            // edge when MKLDNNGraph figures out the difference in data types
+            marked = true;
+            for (auto o : data->getInputTo()) {
+                if (isBF16Capable(o.second->type)) {
+                    marked = false;
+                    break;
+                }
+            }
+        } else if (data->getInputTo().size() == 1) {
+            // we treat one consumer and many in different ways
+            // if there is one consumer, we can mark its input as float if it does not belong to the list of initial layers
+            // in other cases we need to mark tensor which is passed to several l ayers as FP32 only if there is at least one conusmer
+            // produces data in FP32. I.e. there should be a way fo getting FP32 from output data to this point
             if (_initbf16.find(data->getInputTo().begin()->second->type) == _initbf16.end()) {
                 marked = true;
             }
@@ -215,9 +268,7 @@ bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::se
             // get all consumers
             for (auto o : data->getInputTo()) {
                 // if tensor goes to several layers, we will mark it by FP32 only if one of the layer is unknown
-                if (_initbf16.find(o.second->type) == _initbf16.end() &&
-                    _complementbf16.find(o.second->type) == _complementbf16.end() &&
-                    _multiinput.find(o.second->type) == _multiinput.end()) {
+                if (!isBF16Capable(o.second->type)) {
                     marked = true;
                 }
             }
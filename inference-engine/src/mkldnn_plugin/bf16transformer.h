@@ -29,8 +29,13 @@ class BF16Transformer {
     * 2. goes to the layers which can work with BF16
     *
     * if tensor goes to layer not supporting BF16, this tensor will be marked as FP32
+    *
+    * In whole-graph mode the tensor keeps BF16 whenever at least one of its consumers supports it:
+    * the consumers which do not announce FP32-only configs, so the plugin inserts a converting
+    * reorder on their edges only
     */
-    bool tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr> &immutable);
+    bool tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr> &immutable,
+                       bool wholeGraphMode = false);
 
 public:
     /**
@@ -48,7 +53,7 @@ public:
      * toAnalyzeTensors, analyze parent and children and depending on the type of the layers try to
      * extend FP32 data type
     */
-    void optimizeToFloat(InferenceEngine::CNNNetwork &network);
+    void optimizeToFloat(InferenceEngine::CNNNetwork &network, bool wholeGraphMode = false);
 
     /**
      * Converts all edges from bfloat16 to float data type. Do not touch input and output nodes
@@ -57,8 +62,20 @@ public:
 
     /**
     * converts all fp32 edges excepting inputs and outputs to bf16 and call restoreFloatPrecision
+    *
+    * With wholeGraphMode set the FP32 fallback is greedy: an edge stays in bfloat16 while at
+    * least one of its consumers supports the format, and data is converted to float only on
+    * the boundaries with unsupported layers and on network inputs/outputs
+    */
+    void convertToBFloat16(InferenceEngine::CNNNetwork &network, bool wholeGraphMode = false);
+
+    /**
+    * Same as convertToBFloat16, but the layers named in fp32Layers stay in FP32: tensors
+    * they produce or consume are never marked bf16, and optimizeToFloat propagates the
+    * precision as usual. Used with the per-layer policy of KEY_CPU_BF16_POLICY
     */
-    void convertToBFloat16(InferenceEngine::CNNNetwork &network);
+    void convertToBFloat16(InferenceEngine::CNNNetwork &network, const std::set<std::string> &fp32Layers,
+                           bool wholeGraphMode = false);
 
     InferenceEngine::MemoryBlob::Ptr convertBF16ToFloat(InferenceEngine::MemoryBlob::Ptr);
 };
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "chrome_trace.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::mutex traceMutex;
+
+const char *traceFilePath() {
+    return std::getenv("IE_CPU_CHROME_TRACE");
+}
+
+std::ofstream &traceStream() {
+    // The array bracket is never closed: the chrome://tracing parser accepts
+    // an unterminated event array, so the file stays loadable even if the
+    // process exits abnormally.
+    static struct Stream {
+        std::ofstream out;
+        Stream(): out(traceFilePath(), std::ios::trunc) {
+            out << "[\n";
+        }
+    } holder;
+    return holder.out;
+}
+
+uint64_t threadId() {
+    return static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+}
+
+}  // namespace
+
+bool ChromeTrace::tracingEnabled = traceFilePath() != nullptr;
+
+void ChromeTrace::addSpan(const char *name, const char *category,
+                          std::chrono::high_resolution_clock::time_point start,
+                          std::chrono::high_resolution_clock::time_point finish) {
+    if (!tracingEnabled)
+        return;
+    auto ts = std::chrono::duration_cast<std::chrono::microseconds>(start.time_since_epoch()).count();
+    auto dur = std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+
+    std::lock_guard<std::mutex> lock(traceMutex);
+    traceStream() << "{\"name\":\"" << name << "\",\"cat\":\"" << category
+                  << "\",\"ph\":\"X\",\"ts\":" << ts << ",\"dur\":" << dur
+                  << ",\"pid\":" << getpid() << ",\"tid\":" << threadId() << "},"
+                  << std::endl;
+}
+
+void ChromeTrace::addInstant(const char *name, const char *category) {
+    if (!tracingEnabled)
+        return;
+    auto ts = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(traceMutex);
+    traceStream() << "{\"name\":\"" << name << "\",\"cat\":\"" << category
+                  << "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":" << ts
+                  << ",\"pid\":" << getpid() << ",\"tid\":" << threadId() << "},"
+                  << std::endl;
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Lightweight chrome://tracing event writer for the request lifecycle.
+ *
+ * Tracing is enabled by pointing the IE_CPU_CHROME_TRACE environment variable
+ * at the output file; the resulting JSON can be loaded into chrome://tracing
+ * as is. When the variable is not set the per-span cost is a single boolean
+ * check, so the hooks may stay in release builds.
+ */
+class ChromeTrace {
+public:
+    static bool enabled() { return tracingEnabled; }
+
+    // writes one complete ("ph":"X") duration event; thread safe
+    static void addSpan(const char *name, const char *category,
+                        std::chrono::high_resolution_clock::time_point start,
+                        std::chrono::high_resolution_clock::time_point finish);
+
+    // writes one instant ("ph":"i") event marking a point in time; thread safe
+    static void addInstant(const char *name, const char *category);
+
+    // RAII helper: records a span from construction to destruction
+    class Span {
+    public:
+        Span(const char *name, const char *category): name(name), category(category) {
+            if (ChromeTrace::enabled())
+                start = std::chrono::high_resolution_clock::now();
+        }
+
+        ~Span() {
+            if (ChromeTrace::enabled())
+                ChromeTrace::addSpan(name, category, start, std::chrono::high_resolution_clock::now());
+        }
+
+        Span(const Span &) = delete;
+        Span &operator=(const Span &) = delete;
+
+    private:
+        const char *name;
+        const char *category;
+        std::chrono::high_resolution_clock::time_point start = {};
+    };
+
+private:
+    static bool tracingEnabled;
+};
+
+}  // namespace MKLDNNPlugin
@@ -50,6 +50,124 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_REPLICATE_WEIGHTS) {
+            if (val == PluginConfigParams::YES) replicateWeights = true;
+            else if (val == PluginConfigParams::NO) replicateWeights = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REPLICATE_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_BRANCH_PARALLELISM) {
+            int val_i = std::stoi(val);
+            // zero and one disable intra-stream branch parallelism
+            branchParallelism = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_WEIGHTS_STORE) {
+            // empty string means that the shared weights store is switched off
+            sharedWeightsStore = val;
+        } else if (key == PluginConfigParams::KEY_CPU_TENSOR_TAP) {
+            // empty string means that the tensor taps are switched off
+            tensorTapNodes = val;
+        } else if (key == PluginConfigParams::KEY_CPU_TENSOR_TAP_DIR) {
+            tensorTapDir = val;
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_ACTIVATIONS) {
+            if (val == PluginConfigParams::YES) sparseActivations = true;
+            else if (val == PluginConfigParams::NO) sparseActivations = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_ACTIVATIONS
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_TENSOR_PARALLEL) {
+            if (val == PluginConfigParams::YES) tensorParallel = true;
+            else if (val == PluginConfigParams::NO) tensorParallel = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TENSOR_PARALLEL
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_COMPACT_NUMA_NODE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_COMPACT_NUMA_NODE
+                                   << ". Expected a NUMA node id or -1, got " << val;
+            }
+            if (val_i < -1) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_COMPACT_NUMA_NODE
+                                   << ". Expected a NUMA node id or -1, got " << val;
+            }
+            compactNumaNode = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_TENSOR_ITERATOR_STREAMING) {
+            if (val == PluginConfigParams::YES) tensorIteratorStreaming = true;
+            else if (val == PluginConfigParams::NO) tensorIteratorStreaming = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TENSOR_ITERATOR_STREAMING
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_RESHAPE_RELAUNCH) {
+            if (val == PluginConfigParams::YES) reshapeRelaunch = true;
+            else if (val == PluginConfigParams::NO) reshapeRelaunch = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RESHAPE_RELAUNCH
+                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_STREAMS_CALIBRATION) {
+            if (val == PluginConfigParams::YES) streamsCalibration = true;
+            else if (val == PluginConfigParams::NO) streamsCalibration = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_STREAMS_CALIBRATION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_STREAMS_CALIBRATION_CACHE) {
+            streamsCalibrationCache = val;
+        } else if (key == PluginConfigParams::KEY_CPU_NHWC_EXEC_PROFILE) {
+            if (val == PluginConfigParams::YES) nhwcExecProfile = true;
+            else if (val == PluginConfigParams::NO) nhwcExecProfile = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NHWC_EXEC_PROFILE
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_EDGE_BANDWIDTH_COUNTERS) {
+            if (val == PluginConfigParams::YES) edgeBandwidthCounters = true;
+            else if (val == PluginConfigParams::NO) edgeBandwidthCounters = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_EDGE_BANDWIDTH_COUNTERS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_FAST_FIRST_INFERENCE) {
+            if (val == PluginConfigParams::YES) fastFirstInference = true;
+            else if (val == PluginConfigParams::NO) fastFirstInference = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_FAST_FIRST_INFERENCE
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_EXPORT_COMPRESSION) {
+            if (val == PluginConfigParams::YES) exportCompression = true;
+            else if (val == PluginConfigParams::NO) exportCompression = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_EXPORT_COMPRESSION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_EXPORT_PREPARED_WEIGHTS) {
+            if (val == PluginConfigParams::YES) exportPreparedWeights = true;
+            else if (val == PluginConfigParams::NO) exportPreparedWeights = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_EXPORT_PREPARED_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_LARGE_PAGES) {
+            if (val == PluginConfigParams::YES) largePages = true;
+            else if (val == PluginConfigParams::NO) largePages = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_LARGE_PAGES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DRY_RUN) {
+            if (val == PluginConfigParams::YES) dryRun = true;
+            else if (val == PluginConfigParams::NO) dryRun = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_DRY_RUN
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PERSISTENT_WEIGHTS_CACHE) {
+            if (val == PluginConfigParams::YES) persistentWeightsCache = true;
+            else if (val == PluginConfigParams::NO) persistentWeightsCache = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_PERSISTENT_WEIGHTS_CACHE
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -72,6 +190,9 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
             dumpQuantizedGraphToIr = val;
+        } else if (key.compare(PluginConfigParams::KEY_DUMP_MEMORY_TIMELINE_AS_CSV) == 0) {
+            // empty string means that dumping is switched off
+            dumpMemoryTimeline = val;
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_bfloat16())
@@ -84,6 +205,31 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigParams::KEY_CPU_BF16_WHOLE_GRAPH) {
+            if (val == PluginConfigParams::YES) {
+                bf16WholeGraph = true;
+            } else if (val == PluginConfigParams::NO) {
+                bf16WholeGraph = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BF16_WHOLE_GRAPH
+                    << ". Expected only YES/NO";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_BF16_POLICY) {
+            bf16PolicyFile = val;
+        } else if (key == PluginConfigParams::KEY_CPU_BF16_ACCURACY_BUDGET) {
+            float budget = 0.0f;
+            try {
+                budget = std::stof(val);
+            } catch (...) {
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_BF16_ACCURACY_BUDGET
+                                   << ". Expected a non-negative float, got " << val;
+            }
+            if (budget < 0.0f)
+                THROW_IE_EXCEPTION << "Wrong value for property key "
+                                   << PluginConfigParams::KEY_CPU_BF16_ACCURACY_BUDGET
+                                   << ". Expected a non-negative float, got " << val;
+            bf16AccuracyBudget = budget;
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -119,17 +265,90 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
+        if (replicateWeights == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_REPLICATE_WEIGHTS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_REPLICATE_WEIGHTS, PluginConfigParams::NO });
 
+        _config.insert({ PluginConfigParams::KEY_CPU_BRANCH_PARALLELISM, std::to_string(branchParallelism) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_WEIGHTS_STORE, sharedWeightsStore });
+        _config.insert({ PluginConfigParams::KEY_CPU_TENSOR_TAP, tensorTapNodes });
+        _config.insert({ PluginConfigParams::KEY_CPU_TENSOR_TAP_DIR, tensorTapDir });
+        if (sparseActivations)
+            _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_ACTIVATIONS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_ACTIVATIONS, PluginConfigParams::NO });
+        if (tensorParallel)
+            _config.insert({ PluginConfigParams::KEY_CPU_TENSOR_PARALLEL, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_TENSOR_PARALLEL, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_COMPACT_NUMA_NODE, std::to_string(compactNumaNode) });
+        if (tensorIteratorStreaming)
+            _config.insert({ PluginConfigParams::KEY_CPU_TENSOR_ITERATOR_STREAMING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_TENSOR_ITERATOR_STREAMING, PluginConfigParams::NO });
+        if (reshapeRelaunch)
+            _config.insert({ PluginConfigParams::KEY_CPU_RESHAPE_RELAUNCH, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_RESHAPE_RELAUNCH, PluginConfigParams::NO });
+        if (streamsCalibration)
+            _config.insert({ PluginConfigParams::KEY_CPU_STREAMS_CALIBRATION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_STREAMS_CALIBRATION, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_STREAMS_CALIBRATION_CACHE, streamsCalibrationCache });
+        if (nhwcExecProfile)
+            _config.insert({ PluginConfigParams::KEY_CPU_NHWC_EXEC_PROFILE, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_NHWC_EXEC_PROFILE, PluginConfigParams::NO });
+        if (edgeBandwidthCounters)
+            _config.insert({ PluginConfigParams::KEY_CPU_EDGE_BANDWIDTH_COUNTERS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_EDGE_BANDWIDTH_COUNTERS, PluginConfigParams::NO });
+        if (fastFirstInference)
+            _config.insert({ PluginConfigParams::KEY_CPU_FAST_FIRST_INFERENCE, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_FAST_FIRST_INFERENCE, PluginConfigParams::NO });
+        if (exportCompression)
+            _config.insert({ PluginConfigParams::KEY_CPU_EXPORT_COMPRESSION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_EXPORT_COMPRESSION, PluginConfigParams::NO });
+        if (exportPreparedWeights)
+            _config.insert({ PluginConfigParams::KEY_CPU_EXPORT_PREPARED_WEIGHTS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_EXPORT_PREPARED_WEIGHTS, PluginConfigParams::NO });
+        if (largePages)
+            _config.insert({ PluginConfigParams::KEY_CPU_LARGE_PAGES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_LARGE_PAGES, PluginConfigParams::NO });
+        if (dryRun)
+            _config.insert({ PluginConfigParams::KEY_CPU_DRY_RUN, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DRY_RUN, PluginConfigParams::NO });
+        if (persistentWeightsCache)
+            _config.insert({ PluginConfigParams::KEY_CPU_PERSISTENT_WEIGHTS_CACHE, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PERSISTENT_WEIGHTS_CACHE, PluginConfigParams::NO });
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        if (streamExecutorConfig._denormalsOptimization)
+            _config.insert({ PluginConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION, PluginConfigParams::NO });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_DUMP_MEMORY_TIMELINE_AS_CSV, dumpMemoryTimeline });
         if (!with_cpu_x86_bfloat16())
             enforceBF16 = false;
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (bf16WholeGraph)
+            _config.insert({ PluginConfigParams::KEY_CPU_BF16_WHOLE_GRAPH, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_BF16_WHOLE_GRAPH, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_BF16_POLICY, bf16PolicyFile });
+        _config.insert({ PluginConfigParams::KEY_CPU_BF16_ACCURACY_BUDGET, std::to_string(bf16AccuracyBudget) });
     }
 }
 
@@ -6,8 +6,12 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <threading/ie_istreams_executor.hpp>
 
+#include "mkldnn/iml_type_mapper.h"
+#include "utils/prepared_weights.h"
+
 namespace MKLDNNPlugin {
 
 struct Config {
@@ -28,9 +32,84 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool replicateWeights = false;
+    // use the weights cache even in single stream mode; set for shape-specialized
+    // clones of an executable network so they share constant memory with each other
+    bool forceWeightsSharing = false;
+    // cap on independent graph branches executed concurrently within one stream;
+    // 0 or 1 keeps the sequential per-stream execution
+    int branchParallelism = 0;
+    // name of the host-level shared memory store of reordered constant weights;
+    // empty (default) keeps the weights private to the process
+    std::string sharedWeightsStore = "";
+    // comma-separated names of the layers whose outputs are captured into the
+    // tensor tap ring buffers during Infer(); empty (default) disables the taps
+    std::string tensorTapNodes = "";
+    // directory the tensor tap drain thread writes the captured outputs to
+    std::string tensorTapDir = "mkldnn_tensor_tap";
+    // store high-sparsity activations as bitmap+values wherever the plugin
+    // copies them instead of moving the dense tensor
+    bool sparseActivations = false;
+    // shard large FullyConnected layers across the distributed process group;
+    // requires a configured ngraph distributed interface
+    bool tensorParallel = false;
+    // confine the stream threads of the network (and with them the first touch of
+    // weights, workspace and intermediate tensors) to this NUMA node; -1 (default)
+    // keeps the round-robin stream placement over the available nodes
+    int compactNumaNode = -1;
+    // keep TensorIterator back-edge state across infer calls for streaming inputs
+    bool tensorIteratorStreaming = false;
+    // record the implementation type every layer settles on and reuse it on the
+    // next load of a network with the same name (after a reshape)
+    bool reshapeRelaunch = false;
+    // implementation type per layer recorded by the previous load of this network;
+    // seeded by the plugin on a reshape relaunch (never from a config key)
+    std::shared_ptr<const std::map<std::string, impl_desc_type>> implTypePlan;
+    // pick the stream count for the network by a short throughput self-benchmark
+    // at LoadNetwork time; the winner is persisted in streamsCalibrationCache
+    bool streamsCalibration = false;
+    // file the calibrated stream counts are stored in, keyed by model and host
+    std::string streamsCalibrationCache = "cpu_streams_calibration.cache";
+    // prefer NHWC implementations across the whole graph for quantized networks,
+    // removing the reorders around the natively-NHWC int8 convolutions
+    bool nhwcExecProfile = false;
+    // accumulate bytes read/written per node into live counters reported (and
+    // reset) by GetExecGraphInfo(); default off to keep Infer() free of the cost
+    bool edgeBandwidthCounters = false;
+    // serve the first requests with quickly-created conservative primitives while
+    // the optimally compiled graphs are rebuilt on a background thread
+    bool fastFirstInference = false;
+    // compress the weights section of an exported blob in chunks which import
+    // decompresses in parallel; import always autodetects the format
+    bool exportCompression = false;
+    // additionally store the weights reordered into the layouts the primitives
+    // execute with inside an exported blob, so import skips the weight reorders
+    bool exportPreparedWeights = false;
+    // reordered weights read from an imported blob; handed to the nodes before
+    // primitive creation (set by ImportNetwork, never from a config key)
+    std::shared_ptr<PreparedWeights::Store> preparedWeights;
+    // back allocations of 2MB and above (weights, workspace) with huge pages,
+    // falling back transparently when the system provides none
+    bool largePages = false;
+    // stop the load after memory planning: nothing is allocated, no primitives
+    // are created, the network only serves the MEMORY_ESTIMATION metric
+    bool dryRun = false;
+    // pin reordered weights in the cache across LoadNetwork calls, keyed by data
+    // hash and target descriptor, so shared-weight model variants load faster
+    bool persistentWeightsCache = false;
+    // keep edges between bf16-capable layers in bfloat16 and convert only on the
+    // boundaries with unsupported layers; effective together with enforceBF16
+    bool bf16WholeGraph = false;
+    // path of the per-layer bf16 decision map; empty (default) keeps the
+    // per-type allow-list of the transformer
+    std::string bf16PolicyFile = "";
+    // cap on the accumulated weight-truncation sensitivity of the layers the
+    // rebuilt decision map admits into bf16
+    float bf16AccuracyBudget = 0.01f;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
+    std::string dumpMemoryTimeline = "";
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
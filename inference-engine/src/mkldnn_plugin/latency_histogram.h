@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Always-on, lock-free latency histogram with HDR-style buckets.
+ *
+ * Values are recorded in microseconds into logarithmic buckets: every octave
+ * is split into 8 sub-buckets, giving a worst case relative error of 12.5%
+ * which is enough to derive p50/p99/p999 for production monitoring.
+ * Recording is a couple of shifts plus one relaxed atomic increment, so the
+ * histogram can stay enabled on every inference request.
+ */
+class LatencyHistogram {
+public:
+    void observe(uint64_t microseconds) {
+        counters[bucketIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Returns the non-empty buckets as a flat vector of (upper bound in
+     * microseconds, count) pairs, ordered by bound. Percentiles can be derived
+     * by walking the cumulative counts.
+     */
+    std::vector<unsigned long long> dump() const {
+        std::vector<unsigned long long> result;
+        for (size_t i = 0; i < bucketCount; i++) {
+            uint64_t count = counters[i].load(std::memory_order_relaxed);
+            if (count == 0)
+                continue;
+            result.push_back(bucketBound(i));
+            result.push_back(count);
+        }
+        return result;
+    }
+
+private:
+    // 8 sub-buckets per octave; bounds up to ~2^31 us (~35 minutes), everything
+    // above lands in the last bucket
+    static const size_t subBucketBits = 3;
+    static const size_t maxExponent = 28;
+    static const size_t bucketCount = (maxExponent + 1) << subBucketBits;
+
+    static size_t bucketIndex(uint64_t us) {
+        if (us < (1 << subBucketBits))
+            return static_cast<size_t>(us);
+        size_t msb = subBucketBits;
+        while (msb < 63 && (us >> (msb + 1)) != 0) msb++;
+        size_t exponent = msb - subBucketBits + 1;
+        if (exponent > maxExponent)
+            return bucketCount - 1;
+        size_t subBucket = (us >> (msb - subBucketBits)) & ((1 << subBucketBits) - 1);
+        return (exponent << subBucketBits) | subBucket;
+    }
+
+    static uint64_t bucketBound(size_t index) {
+        if (index < (1 << subBucketBits))
+            return index;
+        uint64_t exponent = index >> subBucketBits;
+        uint64_t subBucket = index & ((1 << subBucketBits) - 1);
+        uint64_t width = 1ull << (exponent - 1);
+        return (((1 << subBucketBits) | subBucket) + 1) * width - 1;
+    }
+
+    std::atomic<uint64_t> counters[bucketCount] = {};
+};
+
+}  // namespace MKLDNNPlugin
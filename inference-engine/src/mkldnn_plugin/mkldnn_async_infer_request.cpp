@@ -3,17 +3,43 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include "chrome_trace.h"
 #include <memory>
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
+                                                               const InferenceEngine::ITaskExecutor::Ptr& preprocessExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {}
+        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
+    if (preprocessExecutor != nullptr) {
+        // run preprocessing as a dedicated stage, so preprocessing of the next
+        // request overlaps with inference of the current one on the stream threads
+        auto request = std::static_pointer_cast<MKLDNNInferRequest>(inferRequest);
+        _pipeline = {
+            { preprocessExecutor, [request] { request->Preprocess(); } },
+            { taskExecutor,       [this]    {
+                _syncRequest->Infer();
+                // the completion callback becomes eligible to run from here
+                ChromeTrace::addInstant("PipelineDone", "cpu_request");
+            } }
+        };
+    }
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    ChromeTrace::addInstant("StartAsync", "cpu_request");
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+}
 
 void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
 }
 
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::Cancel() {
+    ChromeTrace::addInstant("Cancel", "cpu_request");
+    std::static_pointer_cast<MKLDNNInferRequest>(_syncRequest)->Cancel();
+}
+
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
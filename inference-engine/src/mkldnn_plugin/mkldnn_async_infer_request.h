@@ -15,10 +15,21 @@ class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadS
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
+                            const InferenceEngine::ITaskExecutor::Ptr &preprocessExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
 
+    void StartAsync_ThreadUnsafe() override;
+
     void Infer_ThreadUnsafe() override;
 
+    /**
+     * @brief Cancels the inference currently running on this request.
+     * The request completes with the INFER_CANCELLED status within one node's
+     * latency instead of executing the rest of the graph. Safe to call from any
+     * thread; a request with no inference in flight is left untouched.
+     */
+    void Cancel();
+
     ~MKLDNNAsyncInferRequest() override;
 };
 
@@ -10,6 +10,10 @@ mkldnn::primitive_desc_iterator MKLDNNDescriptor::createPrimitiveDescriptorItera
     return desc->createPrimitiveDescriptorIterator(attr, engine);
 }
 
+bool MKLDNNDescriptor::appendSerialized(std::string &blob) const {
+    return desc->appendSerialized(blob);
+}
+
 MKLDNNDescriptor::operator bool() {
     return desc.get() != nullptr;
 }
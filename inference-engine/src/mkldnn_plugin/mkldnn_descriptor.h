@@ -61,14 +61,57 @@ public:
     size_t outputNumbers() const;
     size_t inputNumbers() const;
 
+    /**
+     * @brief appends a byte representation of the wrapped operation descriptor to the blob.
+     * Only descriptor types whose underlying C structure is pointer-free are serialized, so
+     * equal blobs always denote logically equal descriptors.
+     * @return false if the wrapped descriptor type does not support serialization
+     */
+    bool appendSerialized(std::string &blob) const;
+
     operator bool();
 
 private:
+    // serialization support: pointer-free operation descriptor structures are appended
+    // by value, anything else reports itself as non-serializable
+    template <class D>
+    static bool serializeDescData(std::string &blob, const D &data) {
+        return false;
+    }
+    static bool appendDescBytes(std::string &blob, const void *data, size_t size) {
+        blob.append(reinterpret_cast<const char *>(data), size);
+        return true;
+    }
+    static bool serializeDescData(std::string &blob, const mkldnn_convolution_desc_t &data) {
+        return appendDescBytes(blob, &data, sizeof(data));
+    }
+    static bool serializeDescData(std::string &blob, const mkldnn_inner_product_desc_t &data) {
+        return appendDescBytes(blob, &data, sizeof(data));
+    }
+    static bool serializeDescData(std::string &blob, const mkldnn_lrn_desc_t &data) {
+        return appendDescBytes(blob, &data, sizeof(data));
+    }
+    static bool serializeDescData(std::string &blob, const mkldnn_pooling_desc_t &data) {
+        return appendDescBytes(blob, &data, sizeof(data));
+    }
+    static bool serializeDescData(std::string &blob, const mkldnn_softmax_desc_t &data) {
+        return appendDescBytes(blob, &data, sizeof(data));
+    }
+    static bool serializeDescData(std::string &blob, const mkldnn_eltwise_desc_t &data) {
+        return appendDescBytes(blob, &data, sizeof(data));
+    }
+    static bool serializeDescData(std::string &blob, const mkldnn_batch_normalization_desc_t &data) {
+        return appendDescBytes(blob, &data, sizeof(data));
+    }
+
     class IDesc {
     public:
         virtual ~IDesc() {}
         virtual mkldnn::primitive_desc_iterator createPrimitiveDescriptorIterator(const mkldnn::primitive_attr &attr,
                                                                                   const mkldnn::engine &engine) const = 0;
+        virtual bool appendSerialized(std::string &blob) const {
+            return false;
+        }
     };
 
     template <class T>
@@ -82,6 +125,10 @@ private:
             return mkldnn::primitive_desc_iterator(*desc, attr, engine);
         }
 
+        bool appendSerialized(std::string &blob) const override {
+            return serializeDescData(blob, desc->data);
+        }
+
         std::shared_ptr<T>& getPtr() {
             return desc;
         }
@@ -10,9 +10,16 @@
 #include "mkldnn_async_infer_request.h"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
+#include <nodes/mkldnn_tensoriterator_node.h>
 #include "bf16transformer.h"
+#include "bf16_policy.h"
+#include "tensor_parallel.h"
 #include <ie_util_internal.hpp>
 #include <graph_tools.hpp>
+#include <network_serializer.h>
+#include <pugixml.hpp>
+#include "utils/weights_compression.h"
+#include "utils/prepared_weights.h"
 #include <cnn_network_int8_normalizer.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include "low_precision_transformations/convolution.hpp"
@@ -24,9 +31,17 @@
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
+#include <iostream>
+#include <set>
+#include <sstream>
 #include <unordered_set>
 #include <utility>
 
+#if defined(__linux__)
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using InferenceEngine::details::CNNNetworkInt8Normalizer;
@@ -35,17 +50,23 @@ using namespace InferenceEngine::details;
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
+    if (_cfg.dryRun)
+        THROW_IE_EXCEPTION << "Network was loaded with " << PluginConfigParams::KEY_CPU_DRY_RUN
+                           << " and holds no primitives, so it cannot create infer requests";
     return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
 }
 
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const MKLDNNWorkspacePool::Ptr &workspacePool) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _workspacePool{workspacePool},
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _numaNodesWeights{&numaNodesWeights} {
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
     // we are cloning network if we have statistics and we can transform network.
@@ -105,8 +126,20 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                 // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
                 // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
                 // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-                if (cfg.enforceBF16 == true)
-                    bf16Transformer.convertToBFloat16(cnnetwork);
+                if (cfg.enforceBF16 == true) {
+                    if (!cfg.bf16PolicyFile.empty()) {
+                        // KEY_CPU_BF16_POLICY: a reviewed decision map takes precedence;
+                        // otherwise build one within the accuracy budget and persist it
+                        BF16Policy policy;
+                        if (!policy.load(cfg.bf16PolicyFile)) {
+                            policy.build(cnnetwork, cfg.bf16AccuracyBudget);
+                            policy.save(cfg.bf16PolicyFile);
+                        }
+                        bf16Transformer.convertToBFloat16(cnnetwork, policy.fp32Layers(), cfg.bf16WholeGraph);
+                    } else {
+                        bf16Transformer.convertToBFloat16(cnnetwork, cfg.bf16WholeGraph);
+                    }
+                }
             } else {
                 BF16Transformer bf16Transformer;
                 CNNNetwork cnnetwork(_clonedNetwork);
@@ -117,6 +150,13 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
     MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
 
+    if (_cfg.tensorParallel) {
+        // KEY_CPU_TENSOR_PARALLEL: shard large FullyConnected layers across the
+        // distributed process group; each rank multiplies only its column slice
+        // of the weights and an AllReduce node sums the partial products
+        TensorParallel::splitFullyConnected(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    }
+
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(*_clonedNetwork)) {
@@ -132,6 +172,15 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         const auto& numa_nodes = getAvailableNUMANodes();
         const auto numa_nodes_num = numa_nodes.size();
         auto streamExecutorConfig = cfg.streamExecutorConfig;
+        if (_cfg.compactNumaNode >= 0) {
+            if (std::find(numa_nodes.begin(), numa_nodes.end(), _cfg.compactNumaNode) == numa_nodes.end())
+                THROW_IE_EXCEPTION << "NUMA node " << _cfg.compactNumaNode << " requested with "
+                                   << PluginConfigParams::KEY_CPU_COMPACT_NUMA_NODE << " is not available on this host";
+            // compact placement: every stream (and with it the first touch of the
+            // weights, workspace and intermediate tensors) goes to the chosen node
+            streamExecutorConfig._numaNodeId = _cfg.compactNumaNode;
+            streamExecutorConfig._threadBindingType = IStreamsExecutor::ThreadBindingType::NUMA;
+        }
         // use logical cores only for single-socket targets in throughput mode
         const int hw_cores = streamExecutorConfig._streams > 1 && numa_nodes_num == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
         const int threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (env_threads ? env_threads : hw_cores);
@@ -139,15 +188,21 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                                                 ? std::max(1, threads/streamExecutorConfig._streams)
                                                 : threads;
         streamExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
+        // networks with an equal stream configuration lease slots of one shared
+        // pool instead of spawning a thread pool each
+        _taskExecutor = ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamExecutorConfig);
     }
     if (0 != cfg.streamExecutorConfig._streams) {
-        _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        _callbackExecutor = ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(
             IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+        _preprocessExecutor = ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUPreprocessExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
     } else {
         _callbackExecutor = _taskExecutor;
     }
 
+    _buildConservative = _cfg.fastFirstInference;
+
     _graphs = decltype(_graphs){[&] {
         // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
         //       is fixed and does not change content of network passed (CVS-26420)
@@ -155,23 +210,40 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         auto graph = std::make_shared<MKLDNNGraph>();
         {
             std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
+            auto graphCfg = _cfg;
+            // only the initial stream graphs are compiled conservatively; once the
+            // background rebuild has finished, a late stream thread gets the
+            // optimally compiled graph right away
+            graphCfg.fastFirstInference = graphCfg.fastFirstInference && _buildConservative;
+            graph->setConfig(graphCfg);
         }
         int numaNode = 0;
         auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
         if (nullptr != streamExecutor) {
             numaNode = streamExecutor->GetNumaNodeId();
         }
+        if (_workspacePool) {
+            graph->setWorkspacePool(_workspacePool, numaNode);
+        }
         graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
         return graph;
     }};
 
-    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+    if (_cfg.dryRun) {
+        // one planned-but-never-allocated graph is enough for the estimation;
+        // warming a graph per stream would only multiply the planning cost
+        _graphs.local();
+    } else {
+        _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+        if (_cfg.compactNumaNode >= 0) {
+            CheckCompactPlacement(_cfg.compactNumaNode);
+        }
+    }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
+    if (_graphs.size() == 1 && !_cfg.dryRun) {
         for (auto &node : _graphs.begin()->get()->GetNodes()) {
             if (node->getType() == MemoryInput) {
                 auto state_store = node->getChildEdgeAt(0)->getMemoryPtr();
@@ -184,8 +256,214 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
                 memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
             }
+
+#if defined (COMPILED_CPU_MKLDNN_TENSORITERATOR_NODE)
+            // Streaming TensorIterators keep their recurrent state in the graph between
+            // infer calls; publish those storages so clients can seed or reset them
+            // like Memory layer states.
+            if (node->getType() == TensorIterator) {
+                auto *ti = dynamic_cast<MKLDNNTensorIteratorNode *>(node.get());
+                if (ti != nullptr)
+                    for (auto &state : ti->getStreamingStates())
+                        memoryStates.emplace_back(new MKLDNNMemoryState(state.first, state.second));
+            }
+#endif
         }
     }
+
+    bool stateful = false;
+    for (auto &node : _graphs.begin()->get()->GetNodes()) {
+        if (node->getType() == MemoryInput ||
+            (_cfg.tensorIteratorStreaming && node->getType() == TensorIterator)) {
+            stateful = true;
+            break;
+        }
+    }
+
+    {
+        uint64_t weightsBytes = 0;
+        for (auto it = CNNNetworkIterator(_clonedNetwork.get()); it != CNNNetworkIterator(); ++it) {
+            for (const auto& blob : (*it)->blobs) {
+                if (blob.second)
+                    weightsBytes += blob.second->byteSize();
+            }
+        }
+        const auto workspaceBytes = static_cast<uint64_t>(_graphs.begin()->get()->getWorkspaceBytes());
+        const auto streams = static_cast<uint64_t>(std::max(1, _cfg.streamExecutorConfig._streams));
+        _memoryEstimation["WEIGHTS_BYTES"] = weightsBytes;
+        _memoryEstimation["WORKSPACE_BYTES_PER_STREAM"] = workspaceBytes;
+        _memoryEstimation["STREAMS"] = streams;
+        _memoryEstimation["TOTAL_BYTES"] = weightsBytes + streams * workspaceBytes;
+    }
+
+    if (_cfg.fastFirstInference && !_cfg.implTypePlan && !stateful && !_cfg.dryRun) {
+        // second phase of KEY_CPU_FAST_FIRST_INFERENCE: rebuild optimally compiled
+        // graphs in the background, one replacement per conservative stream graph.
+        // Every finished graph is published right away, so the streams upgrade one
+        // by one instead of all waiting for the last rebuild. Stateful networks
+        // keep the conservative build: their state tensors live in the graph
+        // memory and must not be swapped out between inferences. A reshape relaunch
+        // compiled straight to the recorded optimal types, so there is nothing to
+        // rebuild.
+        const auto replicas = _graphs.size();
+        _optimalGraphsBuild = std::async(std::launch::async, [this, replicas] {
+            for (size_t i = 0; i < replicas; i++) {
+                auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+                auto graph = std::make_shared<MKLDNNGraph>();
+                {
+                    std::unique_lock<std::mutex> lock{_cfgMutex};
+                    auto graphCfg = _cfg;
+                    graphCfg.fastFirstInference = false;
+                    graph->setConfig(graphCfg);
+                }
+                // the rebuild thread is not bound to a stream, so the graph memory is
+                // placed on the first NUMA node; the reordered weights still come from
+                // the shared per-node cache
+                if (_workspacePool) {
+                    graph->setWorkspacePool(_workspacePool, 0);
+                }
+                graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, (*_numaNodesWeights)[0]);
+                {
+                    std::lock_guard<std::mutex> lock{_optimalGraphsMutex};
+                    _optimalGraphs.push_back(graph);
+                }
+            }
+            _buildConservative = false;
+        });
+    }
+}
+
+#if defined(__linux__)
+// NUMA node the page holding `data` currently resides on; negative when the page
+// has not been faulted in yet or the kernel cannot resolve it
+static int numaNodeOfPage(const void* data) {
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    void* page = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(data) & ~(pageSize - 1));
+    int status = -1;
+    // move_pages without target nodes only queries the current placement
+    if (syscall(SYS_move_pages, 0, 1, &page, nullptr, &status, 0) != 0)
+        return -1;
+    return status;
+}
+#endif
+
+void MKLDNNExecNetwork::CheckCompactPlacement(int numaNode) {
+#if defined(__linux__)
+    // one sample per distinct region start: edges of one graph reference slices of
+    // the shared workspace, and the stream graphs share the cached weight tensors
+    std::set<const void*> sampled;
+    size_t nonLocalRegions = 0;
+    uint64_t nonLocalBytes = 0;
+    for (auto& graph : _graphs) {
+        for (const auto& edge : graph->GetEdges()) {
+            const auto& memory = edge->getMemoryPtr();
+            if (!memory || memory->GetData() == nullptr)
+                continue;
+            const void* data = memory->GetData();
+            if (!sampled.insert(data).second)
+                continue;
+            const int pageNode = numaNodeOfPage(data);
+            // pages never touched yet have no placement to complain about
+            if (pageNode < 0 || pageNode == numaNode)
+                continue;
+            nonLocalRegions++;
+            nonLocalBytes += memory->GetSize();
+            std::cout << "MKLDNNExecNetwork::CheckCompactPlacement: " << memory->GetSize() << " bytes at the output of "
+                      << edge->getParent()->getName() << " are on NUMA node " << pageNode
+                      << ", expected node " << numaNode << std::endl;
+        }
+    }
+    if (nonLocalRegions != 0) {
+        std::cout << "MKLDNNExecNetwork::CheckCompactPlacement: " << nonLocalRegions << " region(s), "
+                  << nonLocalBytes << " bytes in total, are not local to NUMA node " << numaNode << std::endl;
+    }
+#else
+    // no per-page placement query on this OS
+    (void)numaNode;
+#endif
+}
+
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    // the background rebuild walks the cloned network and the weights cache;
+    // it must not outlive them
+    if (_optimalGraphsBuild.valid())
+        _optimalGraphsBuild.wait();
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::PopOptimalGraph() {
+    std::lock_guard<std::mutex> lock{_optimalGraphsMutex};
+    if (_optimalGraphs.empty())
+        return nullptr;
+    auto graph = _optimalGraphs.back();
+    _optimalGraphs.pop_back();
+    return graph;
+}
+
+std::map<std::string, impl_desc_type> MKLDNNExecNetwork::GetSelectedImplTypes() const {
+    std::map<std::string, impl_desc_type> implTypes;
+    if (_graphs.size() == 0)
+        return implTypes;
+    for (const auto &node : _graphs.begin()->get()->GetNodes()) {
+        auto *selected = node->getSelectedPrimitiveDescriptor();
+        if (selected != nullptr)
+            implTypes[node->getName()] = selected->getImplementationType();
+    }
+    return implTypes;
+}
+
+MKLDNNExecNetwork::Ptr MKLDNNExecNetwork::CreateShapeVariant(const ICNNNetwork::InputShapes &shapes) {
+    auto variantNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+
+    ResponseDesc resp;
+    StatusCode rc = variantNetwork->reshape(shapes, &resp);
+    if (rc != StatusCode::OK) {
+        THROW_IE_EXCEPTION << "MKLDNNExecNetwork::CreateShapeVariant: cannot reshape network: " << resp.msg;
+    }
+
+    Config variantCfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        variantCfg = _cfg;
+    }
+    // the variant must go through the weights cache even in single stream mode,
+    // otherwise its graphs would create private copies of all constants
+    variantCfg.forceWeightsSharing = true;
+
+    return std::make_shared<MKLDNNExecNetwork>(static_cast<ICNNNetwork&>(*variantNetwork), variantCfg,
+                                               extensionManager, *_numaNodesWeights, _workspacePool);
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream& modelStream) {
+    // The blob holds the legacy CNNNetwork as the plugin compiled it: nGraph
+    // conversion, precision conversions and the low precision transformations
+    // are already applied, so importing skips all of them on cold start.
+    // Format (same as the generic part of a HETERO blob): one line of IR xml,
+    // then the weights size and the raw weights. With KEY_CPU_EXPORT_COMPRESSION
+    // the size field is replaced by a marker and the weights are written as
+    // independently compressed chunks which import decompresses in parallel.
+    pugi::xml_document doc;
+    auto dataSize = static_cast<std::uint64_t>(Serialization::FillXmlDoc(*_clonedNetwork, doc));
+    doc.save(modelStream, nullptr, pugi::format_raw);
+    modelStream << std::endl;
+    if (_cfg.exportCompression && 0 != dataSize) {
+        std::stringstream weightsStream;
+        Serialization::SerializeBlobs(weightsStream, *_clonedNetwork);
+        const auto& weights = weightsStream.str();
+        WeightsCompression::serialize(modelStream,
+                                      reinterpret_cast<const std::uint8_t*>(weights.data()),
+                                      static_cast<std::uint64_t>(weights.size()));
+    } else {
+        modelStream.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+        Serialization::SerializeBlobs(modelStream, *_clonedNetwork);
+    }
+    if (_cfg.exportPreparedWeights) {
+        // KEY_CPU_EXPORT_PREPARED_WEIGHTS: append the weights as this network
+        // reordered them, so importing the blob skips the weight reorders;
+        // every stream's graph reorders identically, so one graph is enough
+        PreparedWeights::Store store;
+        _graphs.begin()->get()->CollectPreparedWeights(store);
+        PreparedWeights::serialize(modelStream, store);
+    }
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -199,11 +477,33 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
-    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    auto self = std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this());
+
+    std::shared_ptr<MKLDNNInferRequest> syncRequestImpl;
+    {
+        std::lock_guard<std::mutex> lock{_requestPoolMutex};
+        if (!_requestPool.empty()) {
+            syncRequestImpl = _requestPool.back();
+            _requestPool.pop_back();
+        }
+    }
+    if (syncRequestImpl) {
+        syncRequestImpl->AttachToNetwork(self);
+    } else {
+        syncRequestImpl = std::static_pointer_cast<MKLDNNInferRequest>(
+            CreateInferRequestImpl(_networkInputs, _networkOutputs));
+    }
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _preprocessExecutor, _callbackExecutor);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
-                       [](IInferRequest *p) { p->Release(); });
+                       [self, syncRequestImpl](IInferRequest *p) {
+                           p->Release();
+                           // async pipeline is complete at this point; put the request impl
+                           // with its warm staging blobs back to the pool for the next client
+                           syncRequestImpl->Recycle();
+                           std::lock_guard<std::mutex> lock{self->_requestPoolMutex};
+                           self->_requestPool.push_back(syncRequestImpl);
+                       });
 
     asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
 }
@@ -212,7 +512,13 @@ void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &grap
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
 
-    graphPtr = _graphs.begin()->get()->dump();
+    auto graph = _graphs.begin()->get();
+    graphPtr = graph->dump();
+
+    // the edge traffic counters report the bytes moved since the previous query,
+    // so a query restarts the interval
+    for (auto &node : graph->GetNodes())
+        node->resetEdgeByteCounters();
 }
 
 void MKLDNNExecNetwork::GetConfig(const std::string &name, Parameter &result, ResponseDesc *resp) const {
@@ -241,6 +547,11 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(ZERO_COPY_INPUTS));
+        metrics.push_back(METRIC_KEY(LATENCY_HISTOGRAM));
+        metrics.push_back(METRIC_KEY(MEMORY_ESTIMATION));
+        metrics.push_back(METRIC_KEY(MEMORY_PEAK_CONTRIBUTORS));
+        metrics.push_back(METRIC_KEY(TILE_HALO_SIZE));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -255,6 +566,16 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(ZERO_COPY_INPUTS)) {
+        result = IE_SET_METRIC(ZERO_COPY_INPUTS, _graphs.begin()->get()->getZeroCopyInputs());
+    } else if (name == METRIC_KEY(LATENCY_HISTOGRAM)) {
+        result = IE_SET_METRIC(LATENCY_HISTOGRAM, _latencyHistogram.dump());
+    } else if (name == METRIC_KEY(MEMORY_ESTIMATION)) {
+        result = IE_SET_METRIC(MEMORY_ESTIMATION, _memoryEstimation);
+    } else if (name == METRIC_KEY(MEMORY_PEAK_CONTRIBUTORS)) {
+        result = IE_SET_METRIC(MEMORY_PEAK_CONTRIBUTORS, _graphs.begin()->get()->getPeakContributors());
+    } else if (name == METRIC_KEY(TILE_HALO_SIZE)) {
+        result = IE_SET_METRIC(TILE_HALO_SIZE, static_cast<unsigned int>(_graphs.begin()->get()->getTileHaloSize()));
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
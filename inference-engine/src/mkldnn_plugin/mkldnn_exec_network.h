@@ -8,6 +8,7 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "latency_histogram.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -19,6 +20,8 @@
 
 namespace MKLDNNPlugin {
 
+class MKLDNNInferRequest;
+
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
@@ -30,18 +33,52 @@ public:
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const MKLDNNWorkspacePool::Ptr &workspacePool = nullptr);
 
-    ~MKLDNNExecNetwork() override = default;
+    ~MKLDNNExecNetwork() override;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * Creates an executable network for the same model reshaped to the given input shapes.
+     * Constant memory is shared with this network and its other shape variants through the
+     * per-NUMA-node weights cache, so an extra resolution only costs the intermediate
+     * buffers of its graphs. The weights cache is forced on for the variant; the base
+     * network uses it whenever it runs more than one stream.
+     */
+    MKLDNNExecNetwork::Ptr CreateShapeVariant(const InferenceEngine::ICNNNetwork::InputShapes &shapes);
+
+    void ExportImpl(std::ostream& modelStream) override;
+
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
 
     void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    /**
+     * Hands out one optimally compiled graph prepared by the background rebuild of
+     * KEY_CPU_FAST_FIRST_INFERENCE, or null when none is ready yet. The infer
+     * requests call it to hot-swap their stream's conservative graph between two
+     * inferences.
+     */
+    MKLDNNGraph::Ptr PopOptimalGraph();
+
+    /**
+     * Startup validation of KEY_CPU_COMPACT_NUMA_NODE: samples the placement of the
+     * graph memory of every stream and reports each region that ended up on a NUMA
+     * node other than the requested one. Only informative; no pages are moved.
+     */
+    void CheckCompactPlacement(int numaNode);
+
+    /**
+     * The implementation type every node of the compiled graph settled on, keyed by
+     * node name. KEY_CPU_RESHAPE_RELAUNCH records this plan after a load and seeds it
+     * into the next load of the same network (see Engine::LoadExeNetworkImpl).
+     */
+    std::map<std::string, impl_desc_type> GetSelectedImplTypes() const;
+
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
@@ -49,13 +86,36 @@ public:
 protected:
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // pool the per-stream graph workspaces are carved from, keyed by the stream's NUMA node
+    MKLDNNWorkspacePool::Ptr _workspacePool;
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
-
+    // executor of the standalone preprocessing stage; keeps stream threads
+    // busy with inference while inputs of the next request are preprocessed
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessExecutor;
+    // per-NUMA-node weights caches of the plugin; kept to share constants with shape variants
+    NumaNodesWeights*                           _numaNodesWeights = nullptr;
+    // aggregated inference latency of all requests of this network, see METRIC_KEY(LATENCY_HISTOGRAM)
+    LatencyHistogram                            _latencyHistogram;
+    // predicted weight/workspace byte counts, see METRIC_KEY(MEMORY_ESTIMATION)
+    std::map<std::string, uint64_t>             _memoryEstimation;
+    // released request impls waiting for reuse with their staging blobs kept
+    // allocated; CreateInferRequest hands them out without allocator traffic
+    std::mutex                                  _requestPoolMutex;
+    std::vector<std::shared_ptr<MKLDNNInferRequest>> _requestPool;
+
+    // second phase of KEY_CPU_FAST_FIRST_INFERENCE: the background task compiles
+    // one optimally built replacement per conservative stream graph and publishes
+    // them here for PopOptimalGraph(); the flag keeps stream graphs created after
+    // the rebuild finished from being compiled conservatively for nothing
+    std::future<void>                           _optimalGraphsBuild;
+    std::mutex                                  _optimalGraphsMutex;
+    std::vector<MKLDNNGraph::Ptr>               _optimalGraphs;
+    std::atomic<bool>                           _buildConservative = {false};
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
 };
@@ -3,12 +3,15 @@
 //
 
 #include <algorithm>
+#include <future>
+#include <iostream>
 #include <string>
 #include <map>
 #include <vector>
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <sstream>
 #include <unordered_map>
 #include <memory>
 #include <utility>
@@ -21,10 +24,18 @@
 #include "mkldnn_memory_solver.hpp"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_tensoriterator_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 #include <graph_tools.hpp>
 #include <ie_algorithm.hpp>
+#include <ie_alloc_audit.hpp>
+#include <ie_large_pages.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include <ie_compound_blob.h>
 #include <net_pass.h>
 #include <details/ie_cnn_network_tools.h>
 #include <ie_memcpy.h>
@@ -36,6 +47,11 @@
 #include "low_precision_transformations/transformer.hpp"
 
 #include "utils/blob_dump.h"
+#include "utils/tensor_tap.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 /*****************************************************
  * Debug capability
@@ -91,11 +107,13 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
     if (IsReady())
         ForgetGraphData();
     // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsCache = (config.streamExecutorConfig._streams != 1 || config.forceWeightsSharing) ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
-    status = Ready;
+    // a dry-run graph carries only the solved memory plan and must never execute
+    if (!config.dryRun)
+        status = Ready;
 }
 
 template void MKLDNNGraph::CreateGraph(const TensorIterator::Body&,
@@ -346,6 +364,8 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    optimizer.OptimizeEdgeLayouts(*this);
+
     for (auto &node : graphNodes) {
         node->initOptimalPrimitiveDescriptor();
     }
@@ -355,10 +375,42 @@ void MKLDNNGraph::InitGraph() {
 
     SortTopologically();
 
+    if (config.branchParallelism > 1)
+        BuildExecLevels();
+
     Allocate();
 
+    if (config.dryRun) {
+        // KEY_CPU_DRY_RUN: the MemorySolver has sized the workspace by now, which is
+        // all the estimation needs; allocation and primitive creation never happen
+        return;
+    }
+
+    // offline-reordered weights imported with the blob must be visible to
+    // prepareMemory, which runs during primitive creation
+    if (config.preparedWeights)
+        for (auto &node : graphNodes)
+            node->preparedWeights = config.preparedWeights.get();
+
     CreatePrimitives();
 
+    InitTensorTaps();
+
+    BuildFlattenedExecSequence();
+
+    // nodes take per-request temporaries from the graph's arena instead of the
+    // heap; the arena is a single-thread bump allocator, so it is not offered
+    // when branch parallelism executes nodes of one graph concurrently
+    if (config.branchParallelism <= 1)
+        for (auto &node : graphNodes)
+            node->scratchArena = &scratchArena;
+
+    if (constBlobsPrefetch.valid()) {
+        // the weight warm-up must be done before the source blobs may be
+        // released by cleanup() below
+        constBlobsPrefetch.wait();
+    }
+
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
         auto nodeType = graphNode->getType();
@@ -379,8 +431,13 @@ void MKLDNNGraph::InitGraph() {
             }
         }
     }
-    if (!config.dumpToDot.empty())
+    // needs the layer kernel/stride information which cleanup() drops below
+    ComputeTileHaloSize();
+
+    if (!config.dumpToDot.empty()) {
         dumpToDotFile(config.dumpToDot + "_init.dot");
+        dumpReorderReportToFile(config.dumpToDot + "_reorders.txt");
+    }
 
 #ifndef DUMP_INTERNAL_BLOBS
     for (auto &graphNode : graphNodes) {
@@ -406,6 +463,18 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
+#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+    if (config.replicateWeights && weightsCache) {
+        // give every NUMA node its own copy of the constants before they are
+        // propagated to graph memory below
+        for (auto &graphNode : graphNodes) {
+            auto *inputNode = dynamic_cast<MKLDNNInputNode *>(graphNode.get());
+            if (inputNode != nullptr && inputNode->isConstant())
+                inputNode->replicateConstBlob(weightsCache);
+        }
+    }
+#endif
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
@@ -414,6 +483,58 @@ void MKLDNNGraph::InitGraph() {
     }
 }
 
+void MKLDNNGraph::ComputeTileHaloSize() {
+    // Receptive-field propagation over the topologically sorted nodes: r is the
+    // receptive field of one output pixel in input pixels, j the cumulative
+    // stride of the node output grid. Branches take the maximum over their
+    // parents, so the result is exact for aligned branches (residual blocks)
+    // and a safe upper bound otherwise.
+    std::map<MKLDNNNode *, std::pair<size_t, size_t>> fields;
+    size_t maxField = 1;
+
+    for (auto &node : graphNodes) {
+        size_t r = 1;
+        size_t j = 1;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto it = fields.find(node->getParentEdgeAt(i)->getParent().get());
+            if (it == fields.end())
+                continue;
+            r = std::max(r, it->second.first);
+            j = std::max(j, it->second.second);
+        }
+
+        size_t kernel = 1;
+        size_t stride = 1;
+        auto layer = node->getCnnLayer();
+        auto *convLayer = dynamic_cast<ConvolutionLayer *>(layer.get());
+        auto *poolLayer = dynamic_cast<PoolingLayer *>(layer.get());
+        if (convLayer != nullptr) {
+            for (size_t i = 0; i < convLayer->_kernel.size(); i++) {
+                size_t dilation = i < convLayer->_dilation.size() ? std::max(1u, convLayer->_dilation[i]) : 1;
+                if (convLayer->_kernel[i] > 0)
+                    kernel = std::max<size_t>(kernel, (convLayer->_kernel[i] - 1) * dilation + 1);
+            }
+            for (size_t i = 0; i < convLayer->_stride.size(); i++)
+                stride = std::max<size_t>(stride, convLayer->_stride[i]);
+        } else if (poolLayer != nullptr) {
+            for (size_t i = 0; i < poolLayer->_kernel.size(); i++)
+                kernel = std::max<size_t>(kernel, poolLayer->_kernel[i]);
+            for (size_t i = 0; i < poolLayer->_stride.size(); i++)
+                stride = std::max<size_t>(stride, poolLayer->_stride[i]);
+        }
+
+        if (kernel > 1)
+            r += (kernel - 1) * j;
+        if (stride > 1)
+            j *= stride;
+
+        fields[node.get()] = {r, j};
+        maxField = std::max(maxField, r);
+    }
+
+    tileHaloSize = (maxField - 1) / 2;
+}
+
 void MKLDNNGraph::InitNodes() {
     for (auto &node : graphNodes) {
         node->init();
@@ -428,6 +549,13 @@ void MKLDNNGraph::InitDescriptors() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
+#endif
+#if defined (COMPILED_CPU_MKLDNN_TENSORITERATOR_NODE)
+        if (config.tensorIteratorStreaming && node->getType() == TensorIterator) {
+            auto *tiNode = dynamic_cast<MKLDNNTensorIteratorNode *>(node.get());
+            if (tiNode)
+                tiNode->setStreamingMode(true);
+        }
 #endif
         node->getSupportedDescriptors();
 
@@ -435,11 +563,91 @@ void MKLDNNGraph::InitDescriptors() {
         node->filterSupportedPrimitiveDescriptors();
     }
 
+    if (config.nhwcExecProfile)
+        PreferNhwcDescriptors();
+
+    if (config.implTypePlan) {
+        // reshape relaunch: steer every node straight to the implementation type the
+        // previous load of this network settled on, so selection doesn't re-rank the
+        // whole candidate set; shapes, the memory plan and the primitive descriptors
+        // are still re-derived for the new dimensions. The hints go after the
+        // per-layer PrimitivesPriority, so an explicit user preference still wins.
+        for (auto &node : graphNodes) {
+            auto hint = config.implTypePlan->find(node->getName());
+            if (hint != config.implTypePlan->end())
+                node->implPriorities.push_back(hint->second);
+        }
+    }
+
+    if (config.fastFirstInference && !config.implTypePlan) {
+        // first phase of KEY_CPU_FAST_FIRST_INFERENCE: prefer implementations which
+        // are cheap to create over the ones which are fast to run. gemm and reference
+        // kernels need almost no jit generation, so the graph compiles in a fraction
+        // of the optimal-build time and the optimally compiled replacement is built
+        // in the background (see MKLDNNExecNetwork). The conservative types go after
+        // the per-layer PrimitivesPriority, so an explicit user preference still wins.
+        // A reshape relaunch compiles straight to the known-optimal types, so it
+        // doesn't need the conservative detour.
+        conservativeBuild = true;
+        static const std::vector<impl_desc_type> conservativeImpls = {
+            impl_desc_type::gemm_any,
+            impl_desc_type::gemm_blas,
+            impl_desc_type::ref_any,
+            impl_desc_type::ref,
+        };
+        for (auto &node : graphNodes) {
+            for (const auto& impl : conservativeImpls)
+                node->implPriorities.push_back(impl);
+        }
+    }
+
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
     }
 }
 
+void MKLDNNGraph::PreferNhwcDescriptors() {
+    // the profile targets quantized vision models: mkldnn executes int8 convolutions
+    // natively in nhwc, so keeping the layout-agnostic neighbours in nhwc as well removes
+    // the boundary reorders around them; plain fp32 topologies run faster in the blocked
+    // layouts and are left alone
+    bool quantized = false;
+    for (auto &node : graphNodes) {
+        if (node->getType() == Quantize) {
+            quantized = true;
+            break;
+        }
+    }
+    if (!quantized)
+        return;
+
+    auto isNhwcConfig = [](const InferenceEngine::LayerConfig &config) {
+        bool hasNhwc = false;
+        for (const auto &confs : {config.inConfs, config.outConfs}) {
+            for (const auto &dc : confs) {
+                if (dc.desc.getDims().size() != 4)
+                    continue;
+                if (dc.desc.getLayout() != InferenceEngine::Layout::NHWC)
+                    return false;
+                hasNhwc = true;
+            }
+        }
+        return hasNhwc;
+    };
+
+    for (auto &node : graphNodes) {
+        // selectPreferPrimitiveDescriptor keeps the first descriptor of the winning
+        // implementation type unless the already selected parent formats break the tie,
+        // so moving the nhwc descriptors to the front settles the whole graph on nhwc
+        // wherever a node advertises it
+        std::stable_partition(node->supportedPrimitiveDescriptors.begin(),
+                              node->supportedPrimitiveDescriptors.end(),
+                              [&](const PrimitiveDescInfo &descInfo) {
+                                  return isNhwcConfig(descInfo.getConfig());
+                              });
+    }
+}
+
 void MKLDNNGraph::InitEdges() {
     auto reorderArgs = [](const InferenceEngine::TensorDesc &parentDesc, const InferenceEngine::TensorDesc &childDesc) {
         std::string inArgs, outArgs;
@@ -600,8 +808,12 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // With branch parallelism nodes of one topological level run concurrently,
+            // so tensor lifetimes are expressed in level units: clusters whose level
+            // ranges overlap get disjoint memory, and the levels themselves are
+            // separated by a synchronization point.
+            int e_start = execLevels.empty() ? edge->getParent()->execIndex : edge->getParent()->execLevel;
+            int e_finish = execLevels.empty() ? edge->getChild()->execIndex : edge->getChild()->execLevel;
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -652,12 +864,77 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
+    MemorySolver memSolver(boxes, MemorySolver::Strategy::BestFit);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    workspaceBytes = total_size;
+
+    // Sweep the lifetimes to find the execution step where the sum of live tensor
+    // sizes peaks, and record the largest tensors alive there: those layers are the
+    // ones that drive the footprint when a model does not fit
+    int max_ts = 0;
+    for (const auto& box : boxes) max_ts = std::max(std::max(max_ts, box.start), box.finish);
+    std::vector<int64_t> live_size(max_ts + 1, 0);
+    for (const auto& box : boxes) {
+        const int finish = (box.finish == -1) ? max_ts : box.finish;
+        for (int ts = box.start; ts <= finish; ts++) live_size[ts] += box.size;
+    }
+    const int peak_ts = std::max_element(live_size.begin(), live_size.end()) - live_size.begin();
+    auto alive_at_peak = [&](const MemorySolver::Box& box) {
+        const int finish = (box.finish == -1) ? max_ts : box.finish;
+        return box.start <= peak_ts && peak_ts <= finish;
+    };
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
-    auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    std::vector<int> peak_ids;
+    for (const auto& box : boxes)
+        if (alive_at_peak(box)) peak_ids.push_back(static_cast<int>(box.id));
+    std::sort(peak_ids.begin(), peak_ids.end(), [&](int l, int r) { return boxes[l].size > boxes[r].size; });
+    if (peak_ids.size() > 10) peak_ids.resize(10);  // the top few are enough to steer the work
+    peakContributors.clear();
+    for (int id : peak_ids)
+        peakContributors[edge_clasters[id][0]->getParent()->getName()] += static_cast<uint64_t>(boxes[id].size) * alignment;
+
+    // full allocation timeline, one tensor per row, directly plottable
+    if (!config.dumpMemoryTimeline.empty()) {
+        std::ofstream timeline(config.dumpMemoryTimeline);
+        timeline << "id,layer,start,finish,size_bytes,offset_bytes,at_peak" << std::endl;
+        for (const auto& box : boxes) {
+            const int finish = (box.finish == -1) ? max_ts : box.finish;
+            timeline << box.id << "," << edge_clasters[box.id][0]->getParent()->getName() << ","
+                     << box.start << "," << finish << "," << box.size * alignment << ","
+                     << memSolver.getOffset(box.id) * alignment << "," << (alive_at_peak(box) ? 1 : 0) << std::endl;
+        }
+    }
+
+    if (config.dryRun)
+        return;
+
+#ifndef NDEBUG
+    // achieved footprint vs theoretical lower bound (max live-tensor sum over time)
+    std::cout << "MKLDNNGraph::AllocateWithReuse: workspace " << total_size << " bytes, lower bound "
+              << static_cast<size_t>(memSolver.maxDepth()) * alignment << " bytes" << std::endl;
+#endif
+
+    int8_t* workspace_ptr = nullptr;
+    if (workspacePool) {
+        // allocation and first touch happen on this (stream) thread, so the workspace
+        // pages are local to the NUMA node the stream is pinned to
+        pooledWorkspace = workspacePool->get(total_size, numaNodeId, config.largePages);
+        workspace_ptr = pooledWorkspace.get();
+    } else {
+        if (config.largePages) {
+            if (auto* huge = static_cast<int8_t*>(InferenceEngine::AllocLargePages(total_size))) {
+                pooledWorkspace = std::shared_ptr<int8_t>(huge, [](int8_t* ptr) {
+                    InferenceEngine::FreeLargePages(ptr);
+                });
+                workspace_ptr = huge;
+            }
+        }
+        if (workspace_ptr == nullptr) {
+            memWorkspace = std::make_shared<MKLDNNMemory>(eng);
+            memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+            workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+        }
+    }
 
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
@@ -689,21 +966,209 @@ void MKLDNNGraph::Allocate() {
 
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
+    if (config.dryRun)
+        return;
 
     // Resolve all other edges with status NotAllocated or in-place
     for (auto& node : graphNodes) node->resolveNotAllocatedEdges();
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    // start warming up constant data while primitives are being created
+    PrefetchConstBlobs();
+}
+
+void MKLDNNGraph::PrefetchConstBlobs() {
+    // collect the source blobs of all constant data (weights, biases, const
+    // inputs) which may still be mmap-backed and not resident yet
+    std::vector<InferenceEngine::Blob::Ptr> constBlobs;
+    for (auto &node : graphNodes) {
+        auto layer = node->getCnnLayer();
+        if (!layer)
+            continue;
+        for (auto &blob : layer->blobs) {
+            if (blob.second)
+                constBlobs.push_back(blob.second);
+        }
+    }
+    if (constBlobs.empty())
+        return;
+
+    // warm the pages asynchronously: primitive creation, which runs next and
+    // is dominated by jit kernel generation, consumes this data, so weight
+    // I/O is hidden behind the compilation. Blobs are captured by value to
+    // keep the memory alive until the task is done; InitGraph() waits for
+    // completion right after CreatePrimitives().
+    constBlobsPrefetch = std::async(std::launch::async, [constBlobs] {
+        const uintptr_t pageSize = 4096;
+        for (auto &blob : constBlobs) {
+            auto data = blob->cbuffer().as<const uint8_t *>();
+            size_t size = blob->byteSize();
+            if (data == nullptr || size == 0)
+                continue;
+#ifdef __linux__
+            auto pageStart = reinterpret_cast<uintptr_t>(data) & ~(pageSize - 1);
+            madvise(reinterpret_cast<void *>(pageStart),
+                    size + (reinterpret_cast<uintptr_t>(data) - pageStart), MADV_WILLNEED);
+#endif
+            // touch one byte per page to fault the data in
+            volatile uint8_t sink = 0;
+            for (size_t i = 0; i < size; i += pageSize)
+                sink += data[i];
+            (void)sink;
+        }
+    });
+}
+
+void MKLDNNGraph::BuildExecLevels() {
+    // Group the nodes by topological level (the length of the longest dependency
+    // chain leading to the node). Nodes of one level have no data dependencies
+    // between each other, so Infer() may execute them concurrently as long as
+    // the levels themselves stay ordered.
+    std::unordered_map<MKLDNNNode *, size_t> nodeLevel;
+    execLevels.clear();
+    for (auto& node : graphNodes) {
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            auto it = nodeLevel.find(parent.get());
+            if (it != nodeLevel.end())
+                level = std::max(level, it->second + 1);
+        }
+        nodeLevel[node.get()] = level;
+        node->execLevel = static_cast<int>(level);
+        if (execLevels.size() <= level)
+            execLevels.resize(level + 1);
+        execLevels[level].push_back(node);
+    }
+}
+
+void MKLDNNGraph::InitTensorTaps() {
+    if (config.tensorTapNodes.empty())
+        return;
+
+    std::unordered_set<std::string> tappedNames;
+    std::istringstream stream(config.tensorTapNodes);
+    std::string name;
+    while (std::getline(stream, name, ','))
+        if (!name.empty())
+            tappedNames.insert(name);
+
+    for (auto &node : graphNodes) {
+        if (tappedNames.find(node->getName()) == tappedNames.end())
+            continue;
+        if (!tensorTap)
+            tensorTap = std::make_shared<TensorTap>(config.tensorTapDir, config.sparseActivations);
+        auto childEdge = node->getChildEdgeAt(0);
+        node->tensorTapId = tensorTap->RegisterTap(node->getName(), childEdge->getDesc(),
+                                                   childEdge->getMemory().GetSize());
+    }
+
+    if (tensorTap)
+        tensorTap->Start();
+}
+
+void MKLDNNGraph::BuildFlattenedExecSequence() {
+    // Tiny fixed-shape models spend a time comparable to the math itself in the
+    // per-node bookkeeping of ExecuteNode(): perf sampling, profiling scopes and
+    // constant checks. For small graphs Infer() therefore runs a pre-resolved
+    // list of the non-constant nodes, leaving the execute() call as the only
+    // per-node work. The list is not built when a feature which relies on the
+    // bookkeeping is requested.
+    flattenedExecSequence.clear();
+
+    const size_t smallGraphNodeLimit = 128;
+    if (graphNodes.size() > smallGraphNodeLimit)
+        return;
+    if (config.collectPerfCounters || config.batchLimit > 0 || config.branchParallelism > 1)
+        return;
+    if (config.edgeBandwidthCounters)
+        return;
+    if (tensorTap)
+        return;
+#ifdef BLOB_DUMP_PATH
+    return;
+#endif
+
+    for (auto &node : graphNodes) {
+        if (!node->isConstant())
+            flattenedExecSequence.push_back(node.get());
+    }
 }
 
 void MKLDNNGraph::CreatePrimitives() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::CreatePrimitives)
+    // Primitive creation (dominated by jit kernel generation) only needs the
+    // memory of the node's own edges, which is already allocated, so nodes of
+    // the same topological level can be processed in parallel. Levels are
+    // derived from the data dependencies to keep parents ahead of children
+    // for nodes which inspect parent primitives.
+    std::unordered_map<MKLDNNNode *, size_t> nodeLevel;
+    std::vector<std::vector<MKLDNNNode *>> levels;
     for (auto& node : graphNodes) {
-        node->createPrimitive();
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            auto it = nodeLevel.find(parent.get());
+            if (it != nodeLevel.end())
+                level = std::max(level, it->second + 1);
+        }
+        nodeLevel[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node.get());
+    }
+
+    for (auto& level : levels) {
+        InferenceEngine::parallel_for(level.size(), [&](size_t i) {
+            level[i]->createPrimitive();
+        });
+    }
+}
+
+void MKLDNNGraph::CollectPreparedWeights(PreparedWeights::Store &store) const {
+    for (const auto &node : graphNodes) {
+        for (size_t i = 0; i < node->internalBlobMemory.size(); i++) {
+            const auto &memory = node->internalBlobMemory[i];
+            const auto *data = reinterpret_cast<const uint8_t *>(memory->GetData());
+            store[PreparedWeights::key(node->getName(), i)].assign(data, data + memory->GetSize());
+        }
+    }
+}
+
+bool MKLDNNGraph::InputZeroCopySupported(const MKLDNNNodePtr &inputNode) const {
+    // Input cannot be in-place with other primitives
+    for (size_t i = 0; i < inputNode->getChildEdges().size(); i++) {
+        auto& child = inputNode->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+#endif
+        // Cannot be in-place before split because split is using different ptrs without offsets
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+        if (dynamic_cast<MKLDNNSplitNode *>(child.get()) != nullptr)
+            return false;
+#endif
+        if (child->isInplace())
+            return false;
+    }
+    return true;
+}
+
+std::vector<std::string> MKLDNNGraph::getZeroCopyInputs() const {
+    std::vector<std::string> names;
+    for (auto &input : inputNodes) {
+        if (InputZeroCopySupported(input.second) && _meanImages.find(input.first) == _meanImages.end())
+            names.push_back(input.first);
     }
+    return names;
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::PushInputData)
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -713,7 +1178,9 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
-        if (ext_data_ptr != inter_data_ptr) {
+        if (in->is<BatchedBlob>()) {
+            PushBatchedInputData(input->second, *std::dynamic_pointer_cast<BatchedBlob>(in));
+        } else if (ext_data_ptr != inter_data_ptr) {
             auto l = in->getTensorDesc().getLayout();
             if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
                 l = NCHW;
@@ -736,15 +1203,69 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+void MKLDNNGraph::PushBatchedInputData(const MKLDNNNodePtr& inputNode, const InferenceEngine::BatchedBlob &batch) {
+    auto &memory = inputNode->getChildEdgeAt(0)->getMemory();
+    const MKLDNNDims dims = inputNode->getChildEdgeAt(0)->getDims();
+    if (dims.ndims() < 1 || static_cast<size_t>(dims[0]) != batch.size())
+        THROW_IE_EXCEPTION << "Batched input blob holds " << batch.size()
+                           << " items while the network expects a batch of " << (dims.ndims() < 1 ? 1 : dims[0]);
+
+    // the batch is the outermost dimension of every activation format, so each item
+    // owns one contiguous slice of the input memory; the scattered member buffers are
+    // read in place and no intermediate batch tensor is ever materialized
+    const size_t sliceSize = memory.GetSize() / dims[0];
+    const auto memDesc = memory.GetDescriptor().data;
+    uint8_t *base = static_cast<uint8_t *>(memory.GetData()) +
+            MKLDNNExtensionUtils::sizeOfDataType(memory.GetDataType()) * memDesc.layout_desc.blocking.offset_padding;
+    std::vector<ptrdiff_t> itemDims(memDesc.dims, memDesc.dims + memDesc.ndims);
+    itemDims[0] = 1;
+
+    for (size_t i = 0; i < batch.size(); i++) {
+        auto item = batch.getBlob(i);
+        const auto &itemDesc = item->getTensorDesc();
+        auto l = itemDesc.getLayout();
+        if (l == CHW && dims.ndims() == 4)
+            l = NCHW;
+        void *slicePtr = base + i * sliceSize;
+
+        const bool denseItem = itemDesc.getBlockingDesc() ==
+                TensorDesc(itemDesc.getPrecision(), itemDesc.getDims(), l).getBlockingDesc();
+        if (denseItem) {
+            // the same single touch a non-batched push performs, retargeted at the slice
+            MKLDNNMemory slice(eng);
+            slice.Create(itemDims, memory.GetDataType(), memory.GetFormat(), slicePtr);
+            slice.SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(itemDesc.getPrecision()),
+                          MKLDNNMemory::Convert(l), item->cbuffer(), item->byteSize(), false);
+        } else if (memory.GetFormat() == MKLDNNMemory::Convert(l)) {
+            // a strided view over a larger frame (e.g. an ROI batch item): the shared
+            // blob conversion walks the view by its strides directly into the slice
+            auto sliceBlob = make_blob_with_precision(TensorDesc(itemDesc.getPrecision(), itemDesc.getDims(), l),
+                                                      slicePtr);
+            blob_copy(item, sliceBlob);
+        } else {
+            // strided view into a non-plain input memory: stage the view densely once,
+            // then reorder the stage into the slice
+            auto stage = make_blob_with_precision(TensorDesc(itemDesc.getPrecision(), itemDesc.getDims(), l));
+            stage->allocate();
+            blob_copy(item, stage);
+            MKLDNNMemory slice(eng);
+            slice.Create(itemDims, memory.GetDataType(), memory.GetFormat(), slicePtr);
+            slice.SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(itemDesc.getPrecision()),
+                          MKLDNNMemory::Convert(l), stage->cbuffer(), stage->byteSize(), false);
+        }
+    }
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::PullOutputData)
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
 
     for (MKLDNNNodePtr &node : outputNodes) {
         // remove out_ from node name
         std::string name = node->getName().substr(4);
-        const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
         if (out.find(name) == out.end()) {
+            const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
             // TODO: Create blob from MemoryDesc
             Blob::Ptr outBlob = make_shared_blob<float>({Precision::FP32, node->getParentEdgeAt(0)->getDims().ToSizeVector(),
                                                          TensorDesc::getLayoutByDims(node->getParentEdgeAt(0)->getDims().ToSizeVector())},
@@ -752,55 +1273,196 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             out[name] = outBlob;
         }
 
-        Blob::Ptr &ext_blob = out[name];
+        pullOutput(node, out[name]);
+    }
+}
+
+void MKLDNNGraph::pullOutput(const MKLDNNNodePtr &node, Blob::Ptr &ext_blob) {
+    const MKLDNNMemory& intr_blob = node->getParentEdgeAt(0)->getMemory();
+
+    // TODO: Why we allow allocation of output memory inside Infer call??
+    // Suggestion is to disable this behaviour
+    if (ext_blob->buffer() == nullptr) {
+        ext_blob->allocate();
+    }
+
+    if (ext_blob->byteSize() != intr_blob.GetSize())
+        THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                           << ext_blob->size() << "!=" << intr_blob.GetSize()/sizeof(float) << ").";
+
+    void *ext_blob_ptr = ext_blob->buffer();
+    void *intr_blob_ptr = intr_blob.GetData();
+
+    // That is the same memory. No need to copy
+    if (ext_blob_ptr == intr_blob_ptr) return;
+
+    int MB = intr_blob.GetDims()[0];
+    int MB_to_process = node->batchToProcess();
+    // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
+    if (config.batchLimit)
+        MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
+    size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
+
+    ie_memcpy(ext_blob_ptr, ext_blob->byteSize(), intr_blob_ptr, size_to_copy);
+}
+
+void MKLDNNGraph::DeferOutputData(const void* requestId, const BlobMap &out) {
+    std::lock_guard<std::mutex> lock(deferredOutputsMutex);
+    deferredOutputs = out;
+    deferredOutputsOwner = requestId;
+}
+
+bool MKLDNNGraph::PullDeferredOutput(const void* requestId, const std::string &name) {
+    std::lock_guard<std::mutex> lock(deferredOutputsMutex);
+    if (deferredOutputsOwner != requestId)
+        return false;
+
+    auto blob = deferredOutputs.find(name);
+    if (blob == deferredOutputs.end())
+        return false;
 
-        // TODO: Why we allow allocation of output memory inside Infer call??
-        // Suggestion is to disable this behaviour
-        if (ext_blob->buffer() == nullptr) {
-            ext_blob->allocate();
+    for (MKLDNNNodePtr &node : outputNodes) {
+        if (node->getName() == "out_" + name) {
+            pullOutput(node, blob->second);
+            break;
         }
+    }
+
+    deferredOutputs.erase(blob);
+    if (deferredOutputs.empty())
+        deferredOutputsOwner = nullptr;
+    return true;
+}
 
-        if (ext_blob->byteSize() != intr_blob.GetSize())
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << ext_blob->size() << "!=" << intr_blob.GetSize()/sizeof(float) << ").";
+void MKLDNNGraph::FlushDeferredOutputs(const void* requestId) {
+    std::lock_guard<std::mutex> lock(deferredOutputsMutex);
+    if (deferredOutputsOwner == nullptr)
+        return;
 
-        void *ext_blob_ptr = ext_blob->buffer();
-        void *intr_blob_ptr = intr_blob.GetData();
+    // pending outputs of another request must not be lost when the graph memory
+    // is reused; the caller's own pending outputs are superseded by the infer it
+    // is about to run and may simply be dropped
+    if (deferredOutputsOwner != requestId)
+        PullOutputData(deferredOutputs);
 
-        // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+    deferredOutputs.clear();
+    deferredOutputsOwner = nullptr;
+}
+
+void MKLDNNGraph::DropDeferredOutputs(const void* requestId) {
+    std::lock_guard<std::mutex> lock(deferredOutputsMutex);
+    if (deferredOutputsOwner != requestId)
+        return;
+    deferredOutputs.clear();
+    deferredOutputsOwner = nullptr;
+}
+
+void MKLDNNGraph::ApplyDynamicBatch(int batch) {
+    if (batch <= 0 || batch == appliedDynBatch)
+        return;
+
+    // the limits stick in the nodes and their primitives, so re-applying them on
+    // every request is needed only when the effective batch actually changes
+    for (auto& node : graphNodes)
+        node->setDynamicBatchLim(batch);
+    appliedDynBatch = batch;
+}
+
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream) {
+    PERF(node);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+        InferenceEngine::AllocAuditScope auditScope(node->getName().c_str());
+        node->execute(stream);
+    }
 
-        int MB = intr_blob.GetDims()[0];
-        int MB_to_process = node->batchToProcess();
-        // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
-        if (config.batchLimit)
-            MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
-        size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
+    if (tensorTap && node->tensorTapId >= 0) {
+        auto &memory = node->getChildEdgeAt(0)->getMemory();
+        tensorTap->Capture(node->tensorTapId, memory.GetData(), memory.GetSize());
+    }
 
-        ie_memcpy(ext_blob_ptr, ext_blob->byteSize(), intr_blob_ptr, size_to_copy);
+    if (config.edgeBandwidthCounters && !node->isConstant()) {
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            node->edgeBytesRead += node->getParentEdgeAt(i)->getMemory().GetSize();
+        // several child edges of one output port alias the same memory; count
+        // every written tensor once, the consumers account for their own reads
+        const void* counted = nullptr;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto &memory = node->getChildEdgeAt(i)->getMemory();
+            if (memory.GetData() == counted)
+                continue;
+            counted = memory.GetData();
+            node->edgeBytesWritten += memory.GetSize();
+        }
     }
+
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
 }
 
-void MKLDNNGraph::Infer(int batch) {
+void MKLDNNGraph::Infer(int batch, const std::atomic<bool>* cancelRequested) {
+    IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::Infer)
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    // IE_ALLOC_AUDIT: heap traffic of the whole request, broken down per node
+    // by the scopes in ExecuteNode()
+    InferenceEngine::AllocAuditScope auditScope("MKLDNNGraph::Infer");
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    scratchArena.reset();
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+    // a relaxed load per node is all the checkpoint costs; the partially written
+    // intermediate tensors a canceled run leaves behind are overwritten by the
+    // next infer on this graph, so no cleanup is required beyond the throw
+    auto checkCanceled = [cancelRequested] {
+        if (cancelRequested && cancelRequested->load(std::memory_order_relaxed)) {
+            THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::StatusCode::INFER_CANCELLED
+                               << "Infer request was canceled while executing the graph";
+        }
+    };
+
+    ApplyDynamicBatch(batch);
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+    if (!flattenedExecSequence.empty() && batch <= 0) {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (auto node : flattenedExecSequence) {
+            checkCanceled();
+            node->execute(stream);
         }
+        if (infer_count != -1) infer_count++;
+        return;
+    }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+    if (execLevels.empty()) {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (int i = 0; i < graphNodes.size(); i++) {
+            checkCanceled();
+            ExecuteNode(graphNodes[i], stream);
+        }
+    } else {
+        // Execute independent branches of every topological level concurrently.
+        // Memory reuse stays valid because AllocateWithReuse expressed tensor
+        // lifetimes in level units when the levels were built.
+        for (auto &level : execLevels) {
+            // the checkpoint sits between levels, not inside the parallel section,
+            // so the cancellation exception never crosses a parallel_for boundary
+            checkCanceled();
+            const int nTasks = std::min<int>(config.branchParallelism, level.size());
+            if (nTasks <= 1) {
+                mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+                for (auto &node : level)
+                    ExecuteNode(node, stream);
+            } else {
+                InferenceEngine::parallel_for(nTasks, [&](int t) {
+                    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+                    for (size_t i = t; i < level.size(); i += nTasks)
+                        ExecuteNode(level[i], stream);
+                });
+            }
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -919,7 +1581,10 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         getPerfMapFor(perfMap, graphNodes[i]);
     }
 
-    if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
+    if (!config.dumpToDot.empty()) {
+        dumpToDotFile(config.dumpToDot + "_perf.dot");
+        dumpRooflineReportToFile(config.dumpToDot + "_roofline.txt");
+    }
 }
 
 void MKLDNNGraph::setConfig(const Config &cfg) {
@@ -1111,6 +1776,24 @@ void MKLDNNGraph::dumpToDotFile(std::string file) const {
     dot.close();
 }
 
+void MKLDNNGraph::dumpRooflineReportToFile(std::string file) const {
+    std::ofstream report;
+    report.open(file);
+    if (!report.is_open()) THROW_IE_EXCEPTION << "CPU Plugin cannot create roofline report file " << file << ".";
+
+    dump_roofline_report(*this, report);
+    report.close();
+}
+
+void MKLDNNGraph::dumpReorderReportToFile(std::string file) const {
+    std::ofstream report;
+    report.open(file);
+    if (!report.is_open()) THROW_IE_EXCEPTION << "CPU Plugin cannot create reorder report file " << file << ".";
+
+    dump_reorder_report(*this, report);
+    report.close();
+}
+
 void MKLDNNGraph::do_before(const std::string &dir, const MKLDNNNodePtr &node) {
     auto exec_order = std::to_string(node->execIndex);
     std::string nodeName = node->name;
@@ -8,17 +8,28 @@
 #include "ie_icnn_network.hpp"
 #include "config.h"
 #include "mkldnn_memory.h"
+#include "mkldnn_workspace_pool.hpp"
+#include "mkldnn_scratch_arena.hpp"
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include <atomic>
+#include <future>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <memory>
 
+namespace InferenceEngine {
+class BatchedBlob;
+}  // namespace InferenceEngine
+
 namespace MKLDNNPlugin {
 
+class TensorTap;
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -43,6 +54,21 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
+    // one-sided input-pixel overlap a spatial tile needs for exact border
+    // outputs; computed from the receptive field while the graph is built
+    size_t getTileHaloSize() const {
+        return tileHaloSize;
+    }
+
+    /**
+     * Makes the graph carve its intermediate-tensor workspace out of the given pool,
+     * with the pages pinned to the NUMA node of the stream the graph belongs to
+     */
+    void setWorkspacePool(const MKLDNNWorkspacePool::Ptr &pool, int numaNode) {
+        workspacePool = pool;
+        numaNodeId = numaNode;
+    }
+
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
@@ -56,9 +82,89 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+
+    /**
+     * Gathers a batched input blob into the input node memory: every item lands in its
+     * contiguous batch slice, so the scattered member buffers act as the batch dimension
+     * of the input and request aggregation adds no intermediate batch tensor.
+     */
+    void PushBatchedInputData(const MKLDNNNodePtr& inputNode, const InferenceEngine::BatchedBlob &batch);
+
     void PullOutputData(InferenceEngine::BlobMap &out);
 
-    void Infer(int batch = -1);
+    /**
+     * Registers output blobs for lazy copy-out instead of pulling them right away.
+     * The copy from internal memory happens in PullDeferredOutput() for the heads
+     * the caller actually reads; whatever is still pending is materialized by
+     * FlushDeferredOutputs() before the next infer reuses the graph memory.
+     * @param requestId opaque token identifying the owning infer request
+     */
+    void DeferOutputData(const void* requestId, const InferenceEngine::BlobMap &out);
+
+    /**
+     * Copies out a single deferred output on its first access.
+     * @return false if nothing is pending for this request and name
+     */
+    bool PullDeferredOutput(const void* requestId, const std::string &name);
+
+    /**
+     * Materializes all outputs still pending on this graph. Pending outputs owned
+     * by requestId itself are dropped instead: that request is about to re-infer,
+     * so its unread results are superseded anyway.
+     */
+    void FlushDeferredOutputs(const void* requestId = nullptr);
+
+    /**
+     * Discards pending outputs of a request which goes away without reading them.
+     */
+    void DropDeferredOutputs(const void* requestId);
+
+    /**
+     * Checks whether user memory may be bound to the input node edges without a copy.
+     * Covers only the topology-dependent restrictions; runtime aliasing of edge
+     * pointers is re-checked on every pointer switch.
+     */
+    bool InputZeroCopySupported(const MKLDNNNodePtr &inputNode) const;
+
+    /**
+     * Names of network inputs which accept zero-copy binding of user blobs
+     */
+    std::vector<std::string> getZeroCopyInputs() const;
+
+    /**
+     * Tells whether the graph was compiled with the quickly-created conservative
+     * primitives of the first phase of KEY_CPU_FAST_FIRST_INFERENCE and should be
+     * replaced with an optimally compiled graph once the background rebuild
+     * delivers one
+     */
+    bool IsConservativeBuild() const {
+        return conservativeBuild;
+    }
+
+    /**
+     * Size in bytes of the intermediate-tensor workspace as planned by the
+     * MemorySolver; also recorded by a KEY_CPU_DRY_RUN load, where the workspace
+     * itself is never allocated
+     */
+    size_t getWorkspaceBytes() const {
+        return workspaceBytes;
+    }
+
+    /**
+     * Largest intermediate tensors (keyed by producing layer) alive at the execution
+     * step where the sum of live tensor sizes peaks; filled by AllocateWithReuse, also
+     * during a KEY_CPU_DRY_RUN load. Serves the MEMORY_PEAK_CONTRIBUTORS metric.
+     */
+    const std::map<std::string, uint64_t>& getPeakContributors() const {
+        return peakContributors;
+    }
+
+    /**
+     * Runs the graph. When @p cancelRequested is given, the flag is polled between
+     * node executions and setting it aborts the run with an INFER_CANCELLED exception
+     * within one node's latency, without waiting for the remaining nodes.
+     */
+    void Infer(int batch = -1, const std::atomic<bool>* cancelRequested = nullptr);
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
@@ -78,6 +184,12 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * Collects the reordered weight tensors of the graph's nodes into @p store,
+     * keyed as prepareMemory looks them up (see KEY_CPU_EXPORT_PREPARED_WEIGHTS)
+     */
+    void CollectPreparedWeights(PreparedWeights::Store &store) const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -103,7 +215,13 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        flattenedExecSequence.clear();
+        tensorTap.reset();
         _meanImages.clear();
+
+        std::lock_guard<std::mutex> lock(deferredOutputsMutex);
+        deferredOutputs.clear();
+        deferredOutputsOwner = nullptr;
     }
     Status status;
     Config config;
@@ -112,18 +230,70 @@ protected:
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    // dynamic batch limit the nodes are currently configured for; -1 until the
+    // first limited Infer(), so switching the effective batch between requests
+    // costs a pass over the nodes only when the value actually changes
+    int appliedDynBatch = -1;
+
+    // see getTileHaloSize(); derived in ComputeTileHaloSize() before the layer
+    // information is dropped by cleanup()
+    size_t tileHaloSize = 0;
+
     bool reuse_io_tensors = true;
 
+    // set when the primitives were selected conservatively for a fast first
+    // inference, see IsConservativeBuild()
+    bool conservativeBuild = false;
+
+    // solved workspace size, see getWorkspaceBytes()
+    size_t workspaceBytes = 0;
+
+    // see getPeakContributors()
+    std::map<std::string, uint64_t> peakContributors;
+
     MKLDNNMemoryPtr memWorkspace;
+    // used instead of memWorkspace when a NUMA-pinned pool was set with setWorkspacePool
+    std::shared_ptr<int8_t> pooledWorkspace;
+    MKLDNNWorkspacePool::Ptr workspacePool;
+    int numaNodeId = 0;
+
+    // per-request scratch of the nodes, reset at the start of every Infer
+    MKLDNNScratchArena scratchArena;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // nodes grouped by topological level; non-empty only when intra-stream
+    // branch parallelism is enabled with KEY_CPU_BRANCH_PARALLELISM
+    std::vector<std::vector<MKLDNNNodePtr>> execLevels;
+
+    // pre-resolved execute sequence for small fully static graphs; non-empty only
+    // when Infer() may bypass the per-node bookkeeping in ExecuteNode(), whose
+    // fixed cost dominates sub-millisecond models (see BuildFlattenedExecSequence)
+    std::vector<MKLDNNNode *> flattenedExecSequence;
+
+    // capture of the outputs requested with KEY_CPU_TENSOR_TAP; null when no
+    // configured layer name matched a node of the graph
+    std::shared_ptr<TensorTap> tensorTap;
+
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // copy-out registered by DeferOutputData(); the mutex is needed because the
+    // owning request may read an output on the user thread while the next request
+    // flushes the rest from the stream thread
+    std::mutex deferredOutputsMutex;
+    InferenceEngine::BlobMap deferredOutputs;
+    const void* deferredOutputsOwner = nullptr;
+
+    void pullOutput(const MKLDNNNodePtr &node, InferenceEngine::Blob::Ptr &ext_blob);
+
+    // completes when the asynchronous constant blob warm-up started in
+    // Allocate() has finished touching all pages
+    std::future<void> constBlobsPrefetch;
+
     mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -131,10 +301,18 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void PreferNhwcDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void PrefetchConstBlobs();
+    void BuildExecLevels();
+    void BuildFlattenedExecSequence();
+    void InitTensorTaps();
     void CreatePrimitives();
+    void ApplyDynamicBatch(int batch);
+    void ComputeTileHaloSize();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -142,9 +320,13 @@ protected:
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
+    friend void dump_reorder_report(const MKLDNNGraph &graph, std::ostream &out);
+    friend void dump_roofline_report(const MKLDNNGraph &graph, std::ostream &out);
 
 private:
     void dumpToDotFile(std::string file) const;
+    void dumpReorderReportToFile(std::string file) const;
+    void dumpRooflineReportToFile(std::string file) const;
     struct ParsedLayer {
         MKLDNNNodePtr parent;
         InferenceEngine::CNNLayerPtr cnnLayer;
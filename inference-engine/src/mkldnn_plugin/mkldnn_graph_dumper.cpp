@@ -7,7 +7,11 @@
 #include "ie_util_internal.hpp"
 #include "exec_graph_info.hpp"
 #include "mkldnn_debug.h"
+#include "nodes/mkldnn_reorder_node.h"
+#include "ie_system_conf.h"
 
+#include <fstream>
+#include <iomanip>
 #include <vector>
 #include <string>
 #include <memory>
@@ -84,6 +88,87 @@ std::shared_ptr<ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph) {
     return net;
 }
 
+static double cpuFrequencyGHz() {
+#if defined(__linux__)
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 7, "cpu MHz") == 0) {
+            auto pos = line.find(':');
+            if (pos != std::string::npos)
+                return std::stod(line.substr(pos + 1)) / 1000.0;
+        }
+    }
+#endif
+    return 0.0;
+}
+
+void dump_roofline_report(const MKLDNNGraph &graph, std::ostream &out) {
+    // peak fp32 throughput of the machine assuming two FMA pipes on AVX-512
+    // and AVX2 capable cores; when the frequency cannot be read the report
+    // falls back to absolute GFLOP/s without peak percentages
+    const double flopsPerCycle = with_cpu_x86_avx512f() ? 64.0 : with_cpu_x86_avx2() ? 32.0 : 16.0;
+    const double peakGflops = cpuFrequencyGHz() * getNumberOfCPUCores() * flopsPerCycle;
+
+    out << "Roofline report of graph " << graph._name;
+    if (peakGflops > 0.0)
+        out << " (estimated fp32 peak " << std::fixed << std::setprecision(0) << peakGflops << " GFLOP/s)";
+    out << std::endl;
+
+    for (auto &node : graph.graphNodes) {
+        uint64_t usec = node->PerfCounter().avg();
+        if (usec == 0)
+            continue;
+
+        size_t flops = node->getTheoreticalFlops();
+        size_t bytes = node->getTheoreticalBytes();
+        out << node->getName() << " [" << node->getPrimitiveDescriptorType() << "]: "
+            << usec << " us, " << flops << " flops, " << bytes << " bytes";
+        if (flops != 0) {
+            double gflops = static_cast<double>(flops) / (usec * 1000.0);
+            out << ", " << std::fixed << std::setprecision(1) << gflops << " GFLOP/s";
+            if (peakGflops > 0.0)
+                out << " (" << std::setprecision(1) << 100.0 * gflops / peakGflops << "% of peak)";
+        }
+        if (bytes != 0) {
+            out << ", " << std::fixed << std::setprecision(1)
+                << static_cast<double>(bytes) / (usec * 1000.0) << " GB/s";
+        }
+        out << std::endl;
+    }
+}
+
+void dump_reorder_report(const MKLDNNGraph &graph, std::ostream &out) {
+    size_t totalBytes = 0;
+    size_t totalCount = 0;
+    out << "Surviving reorders of graph " << graph._name << std::endl;
+#if defined (COMPILED_CPU_MKLDNN_REORDER_NODE)
+    for (auto &node : graph.graphNodes) {
+        if (node->getType() != Reorder)
+            continue;
+        auto *reorder = dynamic_cast<MKLDNNReorderNode *>(node.get());
+        if (reorder == nullptr)
+            continue;
+
+        const auto &inDesc = reorder->getInput();
+        const auto &outDesc = reorder->getOutput();
+        size_t bytes = outDesc.getPrecision().size();
+        for (auto dim : outDesc.getDims())
+            bytes *= dim;
+
+        out << node->getName() << ": "
+            << inDesc.getPrecision().name() << "/"
+            << MKLDNNMemory::formatToString(MKLDNNMemoryDesc(inDesc).getFormat()) << " -> "
+            << outDesc.getPrecision().name() << "/"
+            << MKLDNNMemory::formatToString(MKLDNNMemoryDesc(outDesc).getFormat())
+            << ", " << bytes << " bytes" << std::endl;
+        totalCount++;
+        totalBytes += bytes;
+    }
+#endif
+    out << "Total: " << totalCount << " reorders, " << totalBytes << " bytes" << std::endl;
+}
+
 void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out) {
     auto dump_net = dump_graph_as_ie_net(graph);
     if (dump_net == nullptr)
@@ -171,6 +256,13 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
         layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    // Live edge traffic, present only when KEY_CPU_EDGE_BANDWIDTH_COUNTERS is on;
+    // the caller resets the counters after the dump so they report per-interval bytes
+    if (node->getEdgeBytesRead() != 0 || node->getEdgeBytesWritten() != 0) {
+        layer->params[ExecGraphInfoSerialization::EDGE_BYTES_READ] = std::to_string(node->getEdgeBytesRead());
+        layer->params[ExecGraphInfoSerialization::EDGE_BYTES_WRITTEN] = std::to_string(node->getEdgeBytesWritten());
+    }
+
     layer->params[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 }
 
@@ -13,6 +13,15 @@ namespace MKLDNNPlugin {
 
     void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out);
 
+    // lists the reorders that survived graph optimization together with the
+    // number of bytes each one moves, so the remaining conversion cost of a
+    // topology can be quantified from the dump
+    void dump_reorder_report(const MKLDNNGraph &graph, std::ostream &out);
+
+    // relates the measured per-node time to the theoretical flops and bytes of
+    // each node, so layers running far below the machine peak stand out
+    void dump_roofline_report(const MKLDNNGraph &graph, std::ostream &out);
+
     std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
 
 }  // namespace MKLDNNPlugin
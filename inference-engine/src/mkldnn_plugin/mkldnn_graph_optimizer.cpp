@@ -17,6 +17,7 @@
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_resample_node.h"
+#include "nodes/mkldnn_eltwise_chain_node.h"
 
 #include <blob_factory.hpp>
 #include <ie_layers_internal.hpp>
@@ -138,6 +139,11 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
+#if defined(COMPILED_CPU_MKLDNN_ACTIVATION_NODE)
+    FuseMemoryBoundOpChains(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
     graph.RemoveDroppedEdges();
 }
 
@@ -1579,7 +1585,7 @@ void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableMVN = (node->getType() == MVN) && (node->inDims[0].ndims() == 4 || node->inDims[0].ndims() == 5);
+        bool isSutableMVN = (node->getType() == MVN) && (node->inDims[0].ndims() >= 1 && node->inDims[0].ndims() <= 5);
 
         if (isSutableMVN) {
             auto *mvnLayer = dynamic_cast<MVNLayer *>(node->getCnnLayer().get());
@@ -1592,16 +1598,24 @@ void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
         }
     };
 
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
+    auto isSutableChildNode = [](MKLDNNNodePtr parentNode, MKLDNNNodePtr node) {
         if (!node->getCnnLayer())
             return false;
 
+        // 1D-3D cases (LayerNorm in transformer-like topologies) are executed on the planar code path
+        // which supports only ReLU and a single leading ScaleShift post operation (see MKLDNNMVNNode)
+        bool isPlanarRank = parentNode->inDims[0].ndims() < 4;
+
         if (node->getType() == Quantize) {
+            if (isPlanarRank)
+                return false;
             auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
             if (quantizeNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
             return !quantizeNode->isBinarization();
         } else if (node->getType() == Depthwise) {
+            if (isPlanarRank && (parentNode->inDims[0].ndims() < 2 || !parentNode->getFusedWith().empty()))
+                return false;
             auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
             if (depthwiseNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get depthwise layer " << node->getName();
@@ -1625,7 +1639,7 @@ void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
         }
 
         auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
+        if (!isSutableChildNode(parentNode, childNode)) {
             parent++;
             continue;
         }
@@ -1865,7 +1879,8 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
             if (maxChannels < simdWidth)
                 return false;
 
-            return node->getChildEdges().size() == 1 &&
+            // the fused jit kernel processes exactly two inputs
+            return node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1 &&
                    (eltwiseLayer->_operation == EltwiseLayer::Sum || eltwiseLayer->_operation == EltwiseLayer::Prod) &&
                    !node->isFusedWith(Quantize);
         } else {
@@ -1883,17 +1898,25 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
                 THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
             return !quantizeNode->isBinarization();
         } else if (node->getType() == Activation) {
-            // Applicability was narrowed down in order not to affect FP32 topologies
+            // Chains of standalone post-operations are folded into the eltwise jit kernel,
+            // saving a full read+write of the tensor per fused node
             if (node->getChildEdges().size() != 1)
                 return false;
-            if (node->getChildEdgeAt(0)->getChild()->getType() != Quantize)
-                return false;
 
             auto *activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
             if (activationNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
             return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_elu, eltwise_logistic, eltwise_bounded_relu,
                                                             eltwise_clamp, eltwise_swish});
+        } else if (node->getType() == Depthwise) {
+            if (node->getChildEdges().size() != 1)
+                return false;
+
+            auto *depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+            if (depthwiseNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get depthwise layer " << node->getName();
+            return ((depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift && depthwiseNode->isWithBiases()) ||
+                    (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu));
         }
 
         return false;
@@ -1930,6 +1953,122 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseMemoryBoundOpChains(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+    std::vector<MKLDNNNodePtr> newNodes;
+
+    auto isSutableNode = [](const MKLDNNNodePtr& node, MKLDNNEltwiseChainNode::ChainOp& op) {
+        if (node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+        if (!node->getFusedWith().empty())
+            return false;
+
+        const auto& layer = node->getCnnLayer();
+        if (layer == nullptr || layer->insData.empty() || layer->outData.empty())
+            return false;
+        auto inData = layer->insData[0].lock();
+        if (inData == nullptr)
+            return false;
+        if (inData->getPrecision() != Precision::FP32 || layer->outData[0]->getPrecision() != Precision::FP32)
+            return false;
+
+        if (node->getType() == Activation) {
+            auto *activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+            if (activationNode == nullptr)
+                return false;
+            if (!MKLDNNEltwiseChainNode::isSupportedAlgorithm(activationNode->getAlgorithm()))
+                return false;
+            op.alg = activationNode->getAlgorithm();
+            op.alpha = activationNode->getAlpha();
+            op.beta = activationNode->getBeta();
+            return true;
+        } else if (node->getType() == Power) {
+            auto *powerLayer = dynamic_cast<PowerLayer *>(layer.get());
+            if (powerLayer == nullptr || powerLayer->power != 1.0f)
+                return false;
+            op.alg = eltwise_linear;
+            op.alpha = powerLayer->scale;
+            op.beta = powerLayer->offset;
+            return true;
+        }
+
+        return false;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto node = graphNodes[i];
+        MKLDNNEltwiseChainNode::ChainOp op;
+        if (!isSutableNode(node, op))
+            continue;
+
+        //  Start only at the head of a maximal chain: a sutable predecessor
+        //  with a single consumer extends its own chain down to this node
+        auto prev = node->getParentEdgeAt(0)->getParent();
+        MKLDNNEltwiseChainNode::ChainOp prevOp;
+        if (prev->getChildEdges().size() == 1 && isSutableNode(prev, prevOp))
+            continue;
+
+        std::vector<MKLDNNNodePtr> chain{node};
+        std::vector<MKLDNNEltwiseChainNode::ChainOp> chainOps{op};
+        auto last = node;
+        while (last->getChildEdges().size() == 1) {
+            auto next = last->getChildEdgeAt(0)->getChild();
+            MKLDNNEltwiseChainNode::ChainOp nextOp;
+            if (!isSutableNode(next, nextOp))
+                break;
+            chain.push_back(next);
+            chainOps.push_back(nextOp);
+            last = next;
+        }
+
+        if (chain.size() < 2)
+            continue;
+
+        auto parentEdge = chain.front()->getParentEdgeAt(0);
+        auto parent = parentEdge->getParent();
+        int inputNum = parentEdge->getInputNum();
+        auto childEdge = chain.back()->getChildEdgeAt(0);
+        auto child = childEdge->getChild();
+        int outputNum = childEdge->getOutputNum();
+
+        //  1. Create EltwiseChain node holding the operations of the whole chain
+        CNNLayerPtr chainLayer(new CNNLayer(*chain.back()->getCnnLayer().get()));
+        chainLayer->name = chain.front()->getName() + "_chain";
+        chainLayer->type = "EltwiseChain";
+        MKLDNNNodePtr chainNode(new MKLDNNEltwiseChainNode(chainLayer, graph.getEngine(), graph.weightsCache));
+        auto *chainNodePtr = dynamic_cast<MKLDNNEltwiseChainNode *>(chainNode.get());
+        if (chainNodePtr == nullptr)
+            THROW_IE_EXCEPTION << "Cannot cast " << chainNode->getName() << " to EltwiseChain node";
+        for (size_t j = 0; j < chain.size(); j++) {
+            chainNodePtr->appendOp(chainOps[j]);
+            chainNode->addOriginalLayer(chain[j]->getCnnLayer());
+        }
+
+        //  2. Remove all edges of the chain from the graph
+        std::vector<MKLDNNEdgePtr> chainEdges{parentEdge};
+        for (size_t j = 0; j + 1 < chain.size(); j++)
+            chainEdges.push_back(chain[j]->getChildEdgeAt(0));
+        chainEdges.push_back(childEdge);
+        for (auto &edge : chainEdges) {
+            edge->drop();
+            graph.GetEdges().erase(std::remove(graph.GetEdges().begin(), graph.GetEdges().end(), edge), graph.GetEdges().end());
+        }
+
+        //  3. Create edges Parent-EltwiseChain and EltwiseChain-Child, add them to the graph
+        MKLDNNEdgePtr beforeChainEdge(new MKLDNNEdge(parent, chainNode, inputNum, 0));
+        MKLDNNEdgePtr afterChainEdge(new MKLDNNEdge(chainNode, child, 0, outputNum));
+        chainNode->addEdge(beforeChainEdge);
+        chainNode->addEdge(afterChainEdge);
+        graph.GetEdges().push_back(beforeChainEdge);
+        graph.GetEdges().push_back(afterChainEdge);
+        newNodes.push_back(chainNode);
+    }
+
+    for (int i = 0; i < newNodes.size(); i++) {
+        graph.GetNodes().push_back(newNodes[i]);
+    }
+}
+
 void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
     for (MKLDNNNodePtr& node : graph.GetNodes()) {
         bool toDrop = false;
@@ -1956,6 +2095,98 @@ void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::OptimizeEdgeLayouts(MKLDNNGraph &graph) {
+    // Primitive descriptors are selected per node from the implementation's own
+    // priority list, so two neighbours may settle on incompatible layouts and
+    // force a reorder on the edge between them. Sweep the graph and, among the
+    // descriptors that keep the already chosen implementation, reselect the one
+    // with the smallest number of bytes crossing mismatched edges. The sweep is
+    // repeated because resolving one edge can unlock a better choice upstream.
+    auto descBytes = [](const InferenceEngine::TensorDesc &desc) -> size_t {
+        size_t bytes = desc.getPrecision().size();
+        for (auto dim : desc.getDims())
+            bytes *= dim;
+        return bytes;
+    };
+
+    auto configCost = [&](const MKLDNNNodePtr &node, const InferenceEngine::LayerConfig &config) -> size_t {
+        size_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            auto parentSPD = edge->getParent()->getSelectedPrimitiveDescriptor();
+            int inNum = edge->getInputNum();
+            int outNum = edge->getOutputNum();
+            if (parentSPD == nullptr || inNum < 0 || inNum >= parentSPD->getConfig().outConfs.size() ||
+                outNum < 0 || outNum >= config.inConfs.size())
+                continue;
+            const auto &inDesc = config.inConfs[outNum].desc;
+            if (!MKLDNNExtensionUtils::initTensorsAreEqual(parentSPD->getConfig().outConfs[inNum].desc, inDesc))
+                cost += descBytes(inDesc);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto childSPD = edge->getChild()->getSelectedPrimitiveDescriptor();
+            int inNum = edge->getInputNum();
+            int outNum = edge->getOutputNum();
+            if (childSPD == nullptr || outNum < 0 || outNum >= childSPD->getConfig().inConfs.size() ||
+                inNum < 0 || inNum >= config.outConfs.size())
+                continue;
+            const auto &outDesc = config.outConfs[inNum].desc;
+            if (!MKLDNNExtensionUtils::initTensorsAreEqual(outDesc, childSPD->getConfig().inConfs[outNum].desc))
+                cost += descBytes(outDesc);
+        }
+        return cost;
+    };
+
+    // in-place and constness markers drive the memory assignment; a candidate
+    // descriptor has to match them, otherwise reselection could change semantics
+    auto sameInPlaceAndConst = [](const InferenceEngine::LayerConfig &lhs, const InferenceEngine::LayerConfig &rhs) {
+        if (lhs.inConfs.size() != rhs.inConfs.size() || lhs.outConfs.size() != rhs.outConfs.size())
+            return false;
+        for (size_t i = 0; i < lhs.inConfs.size(); i++)
+            if (lhs.inConfs[i].inPlace != rhs.inConfs[i].inPlace || lhs.inConfs[i].constant != rhs.inConfs[i].constant)
+                return false;
+        for (size_t i = 0; i < lhs.outConfs.size(); i++)
+            if (lhs.outConfs[i].inPlace != rhs.outConfs[i].inPlace || lhs.outConfs[i].constant != rhs.outConfs[i].constant)
+                return false;
+        return true;
+    };
+
+    bool changed = true;
+    const int maxSweeps = 3;
+    for (int sweep = 0; changed && sweep < maxSweeps; sweep++) {
+        changed = false;
+        for (auto &node : graph.GetNodes()) {
+            const auto *selected = node->getSelectedPrimitiveDescriptor();
+            if (selected == nullptr)
+                continue;
+            const auto &supported = node->getSupportedPrimitiveDescriptors();
+            if (supported.size() < 2)
+                continue;
+
+            size_t bestCost = configCost(node, selected->getConfig());
+            int bestIndex = -1;
+            for (int i = 0; i < supported.size(); i++) {
+                if (&supported[i] == selected)
+                    continue;
+                if (supported[i].getImplementationType() != selected->getImplementationType())
+                    continue;
+                if (!sameInPlaceAndConst(supported[i].getConfig(), selected->getConfig()))
+                    continue;
+                size_t cost = configCost(node, supported[i].getConfig());
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIndex = i;
+                }
+            }
+            if (bestIndex >= 0) {
+                node->selectPrimitiveDescriptorByIndex(bestIndex);
+                changed = true;
+            }
+        }
+    }
+}
+
 #if defined (COMPILED_CPU_MKLDNN_REORDER_NODE)
 void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
     std::set<MKLDNNNodePtr> processed;
@@ -15,6 +15,9 @@ public:
 
 public:
     void ApplyCommonGraphOptimizations(MKLDNNGraph& graph);
+    // runs after all nodes selected a primitive descriptor and before reorders
+    // are inserted; reduces the number of bytes crossing mismatched edges
+    void OptimizeEdgeLayouts(MKLDNNGraph& graph);
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
 private:
@@ -54,6 +57,7 @@ private:
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
+    void FuseMemoryBoundOpChains(MKLDNNGraph &graph);
     void FuseScaleShiftAndQuantize(MKLDNNGraph &graph);
     void FuseClampAndQuantize(MKLDNNGraph &graph);
 
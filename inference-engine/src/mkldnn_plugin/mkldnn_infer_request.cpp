@@ -13,6 +13,7 @@
 #include <ie_compound_blob.h>
 #include "inference_engine.hpp"
 #include "mkldnn_exec_network.h"
+#include "chrome_trace.h"
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
@@ -24,7 +25,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
-    graph = execNetwork->_graphs.begin()->get();
+    graph = *execNetwork->_graphs.begin();
     for (const auto& it : _networkInputs) {
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
@@ -34,10 +35,41 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
     }
+    // remember the request-allocated staging blobs so Recycle() can restore them
+    _ownInputs = _inputs;
+    _ownOutputs = _outputs;
+    _ownExternalPtr = externalPtr;
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
+    // recycled requests waiting in the pool are detached from the network
+    if (execNetwork) {
+        if (graph)
+            graph->DropDeferredOutputs(this);
+        --(execNetwork->_numRequests);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::Recycle() {
+    if (graph)
+        graph->DropDeferredOutputs(this);
+    _inputs = _ownInputs;
+    _outputs = _ownOutputs;
+    externalPtr = _ownExternalPtr;
+    _outputRings.clear();
+    _preProcData.clear();
+    m_curBatch = -1;
+    _preprocessDone = false;
     --(execNetwork->_numRequests);
+    graph.reset();
+    execNetwork.reset();
+    _exeNetwork.reset();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::AttachToNetwork(const std::shared_ptr<MKLDNNExecNetwork> &network) {
+    execNetwork = network;
+    graph = *execNetwork->_graphs.begin();
+    ++(execNetwork->_numRequests);
 }
 
 template <typename T>
@@ -77,11 +109,44 @@ void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
 
 }  // namespace
 
+void MKLDNNPlugin::MKLDNNInferRequest::Preprocess() {
+    IE_PROFILING_AUTO_SCOPE(Preprocess)
+    ChromeTrace::Span traceSpan("Preprocess", "cpu_request");
+    execDataPreprocessing(_inputs);
+    _preprocessDone = true;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     IE_PROFILING_AUTO_SCOPE_TASK(profilingTask)
-    graph = execNetwork->_graphs.local().get();
+    ChromeTrace::Span traceSpan("Infer", "cpu_request");
+    auto inferStart = std::chrono::high_resolution_clock::now();
+    // a cancellation requested for a previous run must not abort this one
+    _cancelRequested = false;
+    graph = execNetwork->_graphs.local();
+    if (graph->IsConservativeBuild()) {
+        // hot-swap point of KEY_CPU_FAST_FIRST_INFERENCE: between two inferences
+        // nothing runs on this stream's graph, so the conservatively compiled graph
+        // is replaced by the optimal one as soon as the background rebuild delivers
+        // it. Results other requests deferred on the retiring graph are materialized
+        // before it goes out of service.
+        auto optimalGraph = execNetwork->PopOptimalGraph();
+        if (optimalGraph) {
+            graph->FlushDeferredOutputs();
+            graph = optimalGraph;
+            execNetwork->_graphs.local() = optimalGraph;
+        }
+    }
+    // outputs the previous request on this graph deferred must be materialized
+    // (and our own stale ones dropped) before changeDefaultPtr() and input
+    // pushing start rewiring the graph memory
+    graph->FlushDeferredOutputs(this);
+    // output rings advance before changeDefaultPtr() so this inference lands in
+    // the next consumer-visible slot
+    rotateOutputRings();
     {
-        execDataPreprocessing(_inputs);
+        // preprocessing may have already run as a separate pipeline stage
+        if (!_preprocessDone.exchange(false))
+            execDataPreprocessing(_inputs);
 
         changeDefaultPtr();
 
@@ -94,6 +159,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                                     << input.first;
             }
 
+            if (input.second->is<InferenceEngine::BatchedBlob>()) {
+                // an aggregated batch: the graph gathers the scattered item buffers
+                // directly, so no per-request staging copy precedes the push
+                graph->PushInputData(input.first, input.second);
+                continue;
+            }
+
             InferenceEngine::Blob::Ptr iconv;
             InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
@@ -162,9 +234,29 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         }
     }
 
-    graph->Infer(m_curBatch);
+    graph->Infer(m_curBatch, &_cancelRequested);
 
-    graph->PullOutputData(_outputs);
+    // copy-out is deferred to the first GetBlob() per output, so the heads
+    // the caller never reads are skipped entirely
+    graph->DeferOutputData(this, _outputs);
+
+    execNetwork->_latencyHistogram.observe(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - inferStart).count()));
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::rotateOutputRings() {
+    for (auto& it : _outputRings) {
+        auto& ring = it.second;
+        const auto& slot = ring.slots[ring.next];
+        ring.next = (ring.next + 1) % ring.slots.size();
+        _outputs[it.first] = slot;
+        if (slot->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+                !graph->getProperty().batchLimit) {
+            externalPtr[it.first] = slot->buffer();
+        } else if (externalPtr.find(it.first) != externalPtr.end()) {
+            externalPtr.erase(it.first);
+        }
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
@@ -192,7 +284,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            // a batched input was validated item by item in SetBlob; the
+            // network-sized check below does not apply to the compound holder
+            if (!data->is<InferenceEngine::CompoundBlob>())
+                checkBlob(data, name, true);
             return;
         }
 
@@ -220,6 +315,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     graph->getOutputBlobs(blobs);
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
+            // first access after Infer materializes the deferred copy-out for this head
+            graph->PullDeferredOutput(this, name);
             data = _outputs[name];
             checkBlob(data, name, false);
             return;
@@ -240,6 +337,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) {
     IE_PROFILING_AUTO_SCOPE(SetBlob)
+    ChromeTrace::Span traceSpan("SetBlob", "cpu_request");
     if (name == nullptr) {
         THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blob with empty name";
     }
@@ -263,7 +361,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         }
 
         const bool preProcRequired = preProcessingRequired(foundInput, data);
-        if (compoundBlobPassed && !preProcRequired) {
+        const bool batchedBlobPassed = data->is<InferenceEngine::BatchedBlob>();
+        if (compoundBlobPassed && !batchedBlobPassed && !preProcRequired) {
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "cannot set compound blob: supported only for input pre-processing";
         }
@@ -272,10 +371,50 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             if (_preProcData.find(name) == _preProcData.end()) {
                 _preProcData.emplace(name, InferenceEngine::CreatePreprocDataHelper());
             }
+            if (_inputs.find(name) == _inputs.end() || !_inputs[name]) {
+                // pre-processing (color conversion, resize) fills a network-sized blob; allocate
+                // it here and let changeDefaultPtr() adopt its buffer as the input edge memory,
+                // so e.g. an NV12 frame is converted directly into the graph input tensor and
+                // PushInputData has no frame-sized copy left to do
+                InferenceEngine::TensorDesc desc = foundInput->getTensorDesc();
+                _inputs[name] = make_blob_with_precision(desc);
+                _inputs[name]->allocate();
+
+                InferenceEngine::BlobMap blobs;
+                graph->getInputBlobs(blobs);
+                if (blobs.find(name) != blobs.end() &&
+                        desc.getPrecision() == blobs[name]->getTensorDesc().getPrecision() &&
+                        graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+                    externalPtr[name] = _inputs[name]->buffer();
+                }
+            }
             _preProcData[name]->isApplicable(data, _inputs[name]);
             // Stores the given blob as ROI blob. It will be used to fill in network input during
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
+        } else if (batchedBlobPassed) {
+            // an aggregated batch without pre-processing: the items stay in their own
+            // buffers and PushInputData gathers them batch slice by batch slice into
+            // the input memory, so combining requests adds no input copies
+            auto batched = std::dynamic_pointer_cast<InferenceEngine::BatchedBlob>(data);
+            const auto& inDims = foundInput->getTensorDesc().getDims();
+            if (inDims.empty() || batched->size() != inDims[0]) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set batched input Blob. The batch holds "
+                                   << batched->size() << " items while the network expects "
+                                   << (inDims.empty() ? 1 : inDims[0]);
+            }
+            InferenceEngine::SizeVector itemDims = inDims;
+            itemDims[0] = 1;
+            for (size_t i = 0; i < batched->size(); i++) {
+                if (batched->getBlob(i)->getTensorDesc().getDims() != itemDims) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                                       << "Failed to set batched input Blob. Dimensions mismatch for batch item " << i;
+                }
+            }
+            if (externalPtr.find(name) != externalPtr.end()) {
+                externalPtr.erase(name);
+            }
+            _inputs[name] = data;
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
@@ -289,7 +428,22 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+            // every precision which InferImpl pushes to the graph without conversion
+            // may be adopted as the input edge memory without a copy
+            auto isDirectPushPrecision = [] (const InferenceEngine::Precision& precision) {
+                switch (precision) {
+                case InferenceEngine::Precision::FP32:
+                case InferenceEngine::Precision::I32:
+                case InferenceEngine::Precision::I16:
+                case InferenceEngine::Precision::I8:
+                case InferenceEngine::Precision::U8:
+                case InferenceEngine::Precision::BOOL:
+                    return true;
+                default:
+                    return false;
+                }
+            };
+            if (isDirectPushPrecision(data->getTensorDesc().getPrecision()) &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -299,9 +453,45 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         }
     } else {
         if (compoundBlobPassed) {
-            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
-                               << "cannot set compound blob: supported only for input pre-processing";
+            // a compound output blob is a ring of consumer-visible slots: each inference
+            // binds the next slot as its output, so e.g. a shared-memory telemetry ring
+            // receives the results with no post-infer copy for FP32 outputs
+            auto compound = std::dynamic_pointer_cast<InferenceEngine::CompoundBlob>(data);
+            if (compound->size() == 0) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                                   << "Failed to set output ring. Compound blob has no slots. Output name: \'"
+                                   << name << "\'";
+            }
+            OutputRing ring;
+            for (size_t i = 0; i < compound->size(); i++) {
+                const auto& slot = compound->getBlob(i);
+                if (!slot || slot->is<InferenceEngine::CompoundBlob>() || slot->buffer() == nullptr) {
+                    THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set output ring. Slot " << i
+                                       << " is not an allocated memory blob. Output name: \'" << name << "\'";
+                }
+                if (slot->getTensorDesc().getDims() != foundOutput->getTensorDesc().getDims()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                                       << "Failed to set output ring. Dimensions mismatch for slot " << i;
+                }
+                if (slot->getTensorDesc().getPrecision() != foundOutput->getPrecision()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output ring. Slot " << i
+                                       << " precision does not correspond to user output precision";
+                }
+                ring.slots.push_back(slot);
+            }
+            _outputRings[name] = std::move(ring);
+            // bind slot 0 right away; the rotation in InferImpl starts from it as well
+            const auto& first = _outputRings[name].slots[0];
+            if (first->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+                    !graph->getProperty().batchLimit) {
+                externalPtr[name] = first->buffer();
+            } else if (externalPtr.find(name) != externalPtr.end()) {
+                externalPtr.erase(name);
+            }
+            _outputs[name] = first;
+            return;
         }
+        _outputRings.erase(name);
         size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
             ? InferenceEngine::details::product(foundOutput->getDims())
             : 1;
@@ -337,25 +527,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
             // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
+            bool canBeInPlace = graph->InputZeroCopySupported(input->second);
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
                 auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-#endif
-                // Cannot be in-place before split because split is using different ptrs without offsets
-#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-#endif
-
-                if (child->isInplace())
-                    canBeInPlace = false;
                 for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
                     if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
                             input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
@@ -417,3 +591,17 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
 
     m_curBatch = new_batch;
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::Cancel() {
+    _cancelRequested = true;
+}
+
+const MKLDNNMemory& MKLDNNPlugin::MKLDNNInferRequest::GetOutputMemory(const std::string &name) const {
+    if (!graph || !graph->IsReady())
+        THROW_IE_EXCEPTION << "Graph is not ready!";
+    for (auto &node : graph->outputNodes) {
+        if (node->getName() == "out_" + name)
+            return node->getParentEdgeAt(0)->getMemory();
+    }
+    THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find output with name: \"" << name << "\"";
+}
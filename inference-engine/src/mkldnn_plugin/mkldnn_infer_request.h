@@ -5,9 +5,11 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include <atomic>
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -25,12 +27,24 @@ public:
 
     void InferImpl() override;
 
+    /**
+     * @brief Runs input preprocessing as a standalone pipeline stage.
+     * Allows the async request to overlap preprocessing of the next request
+     * with inference of the current one. InferImpl skips preprocessing
+     * if it was already done through this method.
+     */
+    void Preprocess();
+
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
     /**
      * @brief Given optional implementation of setting blob to avoid need for it to be implemented by plugin
      * @param name - a name of input or output blob.
      * @param data - a reference to input or output blob. The type of Blob must correspond to the network input precision and size.
+     * A CompoundBlob of network-sized blobs set for an output is treated as a ring of
+     * output slots: every inference writes its result into the next slot of the ring
+     * (directly for FP32 outputs), so consumers reading the slots from shared memory
+     * see the results without a post-infer copy.
      */
     void SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) override;
 
@@ -43,13 +57,65 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    /**
+     * @brief Requests cooperative cancellation of the inference running on this request.
+     * The running graph execution polls the flag between node executions and aborts
+     * with the INFER_CANCELLED status within one node's latency. Calling it when no
+     * inference is in flight has no effect on the next one: InferImpl clears the flag
+     * on entry.
+     */
+    void Cancel();
+
+    /**
+     * @brief Returns the graph memory holding the raw result of the named output.
+     * Intended for completion hooks (AsyncInferRequestThreadSafeDefault::AddCompletionHook):
+     * copy-out to the user blob is deferred until GetBlob, so when a hook runs the
+     * returned memory still holds this request's result in the plugin's native layout
+     * and post-processing can read it without the blob copy. The reference stays valid
+     * until the next inference is started on the same stream.
+     */
+    const MKLDNNMemory& GetOutputMemory(const std::string &name) const;
+
+    /**
+     * @brief Prepares the request for reuse by another client.
+     * Restores the request-allocated staging blobs and drops user-set blobs,
+     * ROI blobs and pre-processing state. The network references are dropped
+     * as well so pooled requests do not keep the executable network alive.
+     */
+    void Recycle();
+
+    /**
+     * @brief Rebinds a recycled request to the network handing it out.
+     * Counterpart of Recycle().
+     */
+    void AttachToNetwork(const std::shared_ptr<MKLDNNExecNetwork> &network);
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
     void changeDefaultPtr();
+
+    // ring of user-provided output slots set through SetBlob with a CompoundBlob;
+    // rotateOutputRings() points _outputs at the next slot before every inference
+    struct OutputRing {
+        std::vector<InferenceEngine::Blob::Ptr> slots;
+        size_t next = 0;
+    };
+    void rotateOutputRings();
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
-    MKLDNNGraph*                        graph = nullptr;
+    // shared ownership: after a KEY_CPU_FAST_FIRST_INFERENCE hot-swap the retiring
+    // conservative graph must stay alive while a request still reads its results
+    MKLDNNGraph::Ptr                    graph;
     std::map<std::string, void*>        externalPtr;
     InferenceEngine::ProfilingTask      profilingTask;
+    std::atomic<bool>                   _preprocessDone = {false};
+    std::atomic<bool>                   _cancelRequested = {false};
+    // staging blobs allocated by the constructor; restored by Recycle() so a
+    // reused request hands out warm buffers instead of reallocating them
+    InferenceEngine::BlobMap            _ownInputs;
+    InferenceEngine::BlobMap            _ownOutputs;
+    std::map<std::string, void*>        _ownExternalPtr;
+    std::map<std::string, OutputRing>   _outputRings;
 };
 }  // namespace MKLDNNPlugin
@@ -7,12 +7,14 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, Strategy strategy) : _boxes(boxes), _strategy(strategy) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -57,6 +59,65 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
 }
 
 int64_t MemorySolver::solve() {
+    return _strategy == Strategy::BestFit ? solveBestFit() : solvePopUp();
+}
+
+int64_t MemorySolver::solveBestFit() {
+    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+    std::vector<std::vector<const Box*>> time_slots(_time_duration);
+    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
+
+    // Sort be box size. First is biggest.
+    // Among equal sizes the long-lived boxes go first so they sink to the
+    // bottom of the skyline instead of fencing gaps for short-lived ones.
+    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+        if (l.size != r.size) return l.size > r.size;
+        return (l.finish - l.start) > (r.finish - r.start);
+    });
+
+    int64_t _min_required = 0;
+
+    // offset interval [first, first+second) occupied during the box lifetime
+    std::vector<std::pair<int64_t, int64_t>> occupied;
+
+    for (Box& box : _boxes) {
+        const int64_t id = box.id;
+
+        // collect the skyline of already placed boxes which overlap in time
+        occupied.clear();
+        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+            for (auto *box_in_slot : time_slots[i_slot])
+                occupied.emplace_back(box_in_slot->id, box_in_slot->size);
+        std::sort(occupied.begin(), occupied.end());
+
+        // coalesce intervals and pick the tightest gap the box fits into;
+        // when no gap fits the box goes on top of the skyline
+        int64_t best_offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t level = 0;  // top of the coalesced skyline scanned so far
+        for (const auto& interval : occupied) {
+            if (interval.first > level) {
+                const int64_t gap = interval.first - level;
+                if (gap >= box.size && gap < best_gap) {
+                    best_gap = gap;
+                    best_offset = level;
+                }
+            }
+            level = std::max(level, interval.first + interval.second);
+        }
+        box.id = (best_offset != -1) ? best_offset : level;  // id is reused as the offset storage
+
+        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+            time_slots[i_slot].push_back(&box);
+
+        _min_required = std::max(_min_required, box.id + box.size);
+        _offsets[id] = box.id;
+    }
+
+    return _min_required;
+}
+
+int64_t MemorySolver::solvePopUp() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
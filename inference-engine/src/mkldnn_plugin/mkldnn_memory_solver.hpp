@@ -65,7 +65,18 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /** @brief Offset assignment strategy */
+    enum class Strategy {
+        /** Original greedy assignment: each box is pushed up until it fits. */
+        PopUp,
+        /** Best-fit over coalesced free gaps of the lifetime skyline:
+         *  each box takes the tightest gap it fits into, keeping large gaps
+         *  for large boxes. Tighter than PopUp on graphs with heterogeneous
+         *  tensor sizes and lifetimes (e.g. transformers). */
+        BestFit,
+    };
+
+    explicit MemorySolver(const std::vector<Box>& boxes, Strategy strategy = Strategy::PopUp);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -84,10 +95,13 @@ public:
 private:
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
+    Strategy _strategy = Strategy::PopUp;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
+    int64_t solvePopUp();
+    int64_t solveBestFit();
     void calcDepth();
 };
 
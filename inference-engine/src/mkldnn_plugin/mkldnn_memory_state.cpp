@@ -4,6 +4,7 @@
 
 #include "mkldnn_memory_state.h"
 #include "mkldnn_extension_utils.h"
+#include <blob_factory.hpp>
 
 using namespace InferenceEngine;
 
@@ -28,8 +29,10 @@ void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
 }
 
 InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
-    THROW_IE_EXCEPTION << "GetLastState method is not implemented for MemoryState";
-    return nullptr;
+    // a view over the state storage, materialized only on explicit access; the graph keeps the
+    // state in this memory between infer calls, so no copy is made here
+    InferenceEngine::TensorDesc desc = MKLDNNMemoryDesc(storage->GetDescriptor());
+    return make_blob_with_precision(desc, storage->GetData());
 }
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
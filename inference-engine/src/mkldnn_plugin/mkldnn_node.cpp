@@ -10,6 +10,8 @@
 #include <string>
 #include <limits>
 #include <cstdint>
+#include <mutex>
+#include <typeinfo>
 #include <unordered_map>
 
 #include <nodes/mkldnn_batchnorm_node.h>
@@ -89,6 +91,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "Power", Power },
         { "Deconvolution", Deconvolution },
         { "Eltwise", Eltwise },
+        { "EltwiseChain", EltwiseChain },
         { "Crop", Crop },
         { "Reshape", Reshape },
         { "Tile", Tile },
@@ -514,6 +517,33 @@ void MKLDNNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    // Walking the implementations below runs the library dispatcher, which for jit
+    // primitives evaluates the kernel configuration heuristics of every candidate.
+    // The walk is fully determined by the operation descriptors, so its outcome is
+    // memoized process-wide: the per-stream replicas of a network and repeated loads
+    // of the same model skip the redundant dispatch. Descriptors whose type does not
+    // support serialization (see MKLDNNDescriptor::appendSerialized) are not cached.
+    static std::mutex primitiveDescCacheGuard;
+    static std::unordered_map<std::string, std::vector<PrimitiveDescInfo>> primitiveDescCache;
+
+    std::string cacheKey(typeid(*this).name());
+    cacheKey.push_back(canBeInPlace() ? '1' : '0');
+    bool cacheable = !descs.empty();
+    for (auto& desc : descs) {
+        if (!desc.appendSerialized(cacheKey)) {
+            cacheable = false;
+            break;
+        }
+    }
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(primitiveDescCacheGuard);
+        auto cached = primitiveDescCache.find(cacheKey);
+        if (cached != primitiveDescCache.end()) {
+            supportedPrimitiveDescriptors = cached->second;
+            return;
+        }
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(engine);
         while (itpd.is_not_end()) {
@@ -553,6 +583,11 @@ void MKLDNNNode::initSupportedPrimitiveDescriptors() {
             itpd++;
         }
     }
+
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(primitiveDescCacheGuard);
+        primitiveDescCache.emplace(cacheKey, supportedPrimitiveDescriptors);
+    }
 }
 
 void MKLDNNNode::filterSupportedPrimitiveDescriptors() {
@@ -746,6 +781,21 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
         const auto &internalBlob = internalBlobs[i];
 
         auto create = [&] () {
+            // a copy prepared offline (KEY_CPU_EXPORT_PREPARED_WEIGHTS) replaces the
+            // reorder when its byte size matches the descriptor chosen here
+            if (preparedWeights != nullptr) {
+                auto prepared = preparedWeights->find(PreparedWeights::key(name, i));
+                if (prepared != preparedWeights->end()) {
+                    MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
+                    _ptr->Create(intDescs[i]);
+                    if (_ptr->GetSize() == prepared->second.size()) {
+                        ie_memcpy(_ptr->GetData(), _ptr->GetSize(),
+                                  prepared->second.data(), prepared->second.size());
+                        return _ptr;
+                    }
+                }
+            }
+
             auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
             auto newFormat = newDesc.getFormat();
             if (newFormat == mkldnn::memory::ncdhw) {
@@ -770,11 +820,25 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             const uint64_t data_hash = weightCache->GetHashFunc().hash(
                     internalBlob->buffer(), internalBlob->byteSize());
 
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+            std::string string_hash;
+            if (weightCache->persistentMode()) {
+                // persistent entries are keyed by (data hash, target descriptor) and
+                // not by the node name, so networks sharing weight tensors hit the
+                // reordered copies of each other regardless of how layers are named
+                const auto &desc = intDescs[i];
+                string_hash = "PersistentWeights_" + std::to_string(static_cast<int>(desc.getDataType()))
+                              + "_" + std::to_string(static_cast<int>(desc.getFormat()));
+                for (auto dim : desc.getDims().ToSizeVector())
+                    string_hash += "_" + std::to_string(dim);
+                string_hash += "_" + std::to_string(internalBlob->byteSize())
+                               + "_" + std::to_string(data_hash);
+            } else {
+                string_hash = name + "_" + std::to_string(i)
+                              + "_" + std::to_string(internalBlob->byteSize())
+                              + "_" + std::to_string(data_hash);
+            }
 
-            ptr = weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreate(string_hash, create, &engine);
         } else {
             ptr = create();
         }
@@ -847,6 +911,28 @@ void MKLDNNNode::addOriginalLayer(const InferenceEngine::CNNLayerPtr &layer) {
     }
 }
 
+size_t MKLDNNNode::getTheoreticalBytes() const {
+    const auto *selected = getSelectedPrimitiveDescriptor();
+    if (selected == nullptr)
+        return 0;
+
+    auto descBytes = [](const InferenceEngine::TensorDesc &desc) -> size_t {
+        if (desc.getPrecision() == InferenceEngine::Precision::UNSPECIFIED)
+            return 0;
+        size_t bytes = desc.getPrecision().size();
+        for (auto dim : desc.getDims())
+            bytes *= dim;
+        return bytes;
+    };
+
+    size_t bytes = 0;
+    for (const auto &conf : selected->getConfig().inConfs)
+        bytes += descBytes(conf.desc);
+    for (const auto &conf : selected->getConfig().outConfs)
+        bytes += descBytes(conf.desc);
+    return bytes;
+}
+
 void MKLDNNNode::cleanup() {
     internalBlobs.clear();
     cnnLayer.reset();
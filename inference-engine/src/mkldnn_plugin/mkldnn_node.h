@@ -23,10 +23,13 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "utils/prepared_weights.h"
 #include "mkldnn.hpp"
 
 namespace MKLDNNPlugin {
 
+class MKLDNNScratchArena;
+
 using MKLDNNNodePtr = std::shared_ptr<MKLDNNNode>;
 using MKLDNNNodeWeakPtr = std::weak_ptr<MKLDNNNode>;
 
@@ -75,7 +78,8 @@ enum Type {
     Convert,
     MVN,
     Resample,
-    Normalize
+    Normalize,
+    EltwiseChain
 };
 
 Type TypeFromName(const std::string type);
@@ -158,6 +162,8 @@ static std::string NameFromType(Type type) {
             return "Resample";
         case Normalize:
             return "Normalize";
+        case EltwiseChain:
+            return "EltwiseChain";
         default:
             return "Unknown";
     }
@@ -329,6 +335,22 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    // Bytes the node's executions read from parent edges and wrote to child edges
+    // since the counters were last reset (see KEY_CPU_EDGE_BANDWIDTH_COUNTERS)
+    uint64_t getEdgeBytesRead() const { return edgeBytesRead; }
+    uint64_t getEdgeBytesWritten() const { return edgeBytesWritten; }
+    void resetEdgeByteCounters() {
+        edgeBytesRead = 0;
+        edgeBytesWritten = 0;
+    }
+
+    // theoretical work of a single inference of this node, derived from the
+    // shapes of the selected descriptor; flops stays zero for nodes that are
+    // purely memory bound, so achieved throughput can be put in relation to
+    // the machine peak when perf counters are reported
+    virtual size_t getTheoreticalFlops() const { return 0; }
+    virtual size_t getTheoreticalBytes() const;
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveNotAllocatedEdges();
@@ -536,6 +558,23 @@ private:
     const std::string typeStr;
     Type type;
     int execIndex = -1;
+    // topological level of the node when the graph is executed with branch
+    // parallelism; -1 when levels were not built
+    int execLevel = -1;
+    // id of the tensor tap ring the output of the node is captured into after
+    // every execute; -1 when the node is not tapped (see KEY_CPU_TENSOR_TAP)
+    int tensorTapId = -1;
+    // per-request scratch arena of the owning graph, reset before every Infer;
+    // execute() implementations take temporaries from it instead of the heap
+    MKLDNNScratchArena* scratchArena = nullptr;
+    // weights reordered offline and imported with the network; prepareMemory
+    // takes a matching entry verbatim instead of reordering
+    const PreparedWeights::Store* preparedWeights = nullptr;
+    // live traffic counters of the node's edges, accumulated by the graph when
+    // edge bandwidth counters are on; only the thread executing the node updates
+    // them, so the increments need no atomics
+    uint64_t edgeBytesRead = 0;
+    uint64_t edgeBytesWritten = 0;
 
     std::string typeToStr(Type type);
 
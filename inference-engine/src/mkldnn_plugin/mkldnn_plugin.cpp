@@ -7,14 +7,23 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
 #include <threading/ie_executor_manager.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
 #include <memory>
+#include <sstream>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
 #include <generic_ie.hpp>
 #include <nodes/list.hpp>
+#include <ie_large_pages.hpp>
+#include "utils/weights_compression.h"
+#include "utils/prepared_weights.h"
 
 #include "convert_function_to_cnn_network.hpp"
 #include <transformations/common_optimizations/common_optimizations.hpp>
@@ -79,6 +88,26 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    // enable-only: another loaded network may still rely on huge pages, so a
+    // network configured with NO simply does not turn the backing on
+    if (conf.largePages)
+        SetLargePagesEnabled(true);
+
+    if (conf.persistentWeightsCache) {
+        // the cache must be engaged even in single stream mode, otherwise the
+        // reordered weights stay private to the graph and nothing persists
+        conf.forceWeightsSharing = true;
+        weightsSharing.setPersistentMode(true);
+    }
+
+    if (!conf.sharedWeightsStore.empty() && conf.sharedWeightsStore != attachedSharedStore) {
+        auto store = SharedWeightsStore::Open(conf.sharedWeightsStore);
+        if (store == nullptr)
+            THROW_IE_EXCEPTION << "Cannot open shared weights store with name: " << conf.sharedWeightsStore;
+        weightsSharing.setSharedStore(store);
+        attachedSharedStore = conf.sharedWeightsStore;
+    }
+
     std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
 
     if (clonedNetwork->getFunction()) {
@@ -120,7 +149,219 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         transformator.fullTrim();
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    // the calibration runs on the already transformed network, so every candidate
+    // only pays for graph compilation and the benchmark itself
+    if (conf.streamsCalibration && !conf.enableDynamicBatch) {
+        conf.streamExecutorConfig._streams = CalibrateStreams(*clonedNetwork, conf);
+    }
+
+    if (conf.reshapeRelaunch) {
+        // relaunch of a reshaped network: hand the graphs the implementation types the
+        // previous load of this network settled on, so selection is immediate and the
+        // conservative/background double compile of fast-first-inference is skipped
+        auto plan = implTypePlans.find(network.getName());
+        if (plan != implTypePlans.end())
+            conf.implTypePlan = plan->second;
+    }
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing, workspacePool);
+
+    if (conf.reshapeRelaunch)
+        implTypePlans[network.getName()] =
+                std::make_shared<const std::map<std::string, impl_desc_type>>(execNetwork->GetSelectedImplTypes());
+
+    return execNetwork;
+}
+
+namespace {
+
+// model + host identity the calibrated stream count is keyed by; a model loaded with other
+// input shapes or on a host with another topology/ISA gets its own sweep
+std::string StreamsCalibrationSignature(const ICNNNetwork &network) {
+    std::stringstream signature;
+    signature << network.getName();
+    InputsDataMap inputsInfo;
+    network.getInputsInfo(inputsInfo);
+    for (const auto &input : inputsInfo) {
+        signature << "/" << input.first;
+        for (const auto &dim : input.second->getTensorDesc().getDims())
+            signature << "x" << dim;
+    }
+    signature << "@cores" << getNumberOfCPUCores() << "-numa" << getAvailableNUMANodes().size();
+    if (with_cpu_x86_avx512f())
+        signature << "-avx512";
+    else if (with_cpu_x86_avx2())
+        signature << "-avx2";
+    else if (with_cpu_x86_sse42())
+        signature << "-sse42";
+
+    std::string str = signature.str();
+    std::replace(str.begin(), str.end(), ' ', '_');
+    return str;
+}
+
+}  // namespace
+
+int Engine::CalibrateStreams(const ICNNNetwork &network, const Config &conf) {
+    const std::string signature = StreamsCalibrationSignature(network);
+
+    {   // an earlier sweep of this model on this host may have stored the answer already
+        std::ifstream cache(conf.streamsCalibrationCache);
+        std::string key;
+        int streams = 0;
+        while (cache >> key >> streams) {
+            if (key == signature && streams > 0)
+                return streams;
+        }
+    }
+
+    const int cores = getNumberOfCPUCores();
+    const int numaNodes = static_cast<int>(getAvailableNUMANodes().size());
+    std::vector<int> candidates = { 1, 2, numaNodes, cores / 2, cores };
+    if (conf.streamExecutorConfig._streams > 0)
+        candidates.push_back(conf.streamExecutorConfig._streams);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                    [&](int streams) { return streams < 1 || streams > cores; }),
+                     candidates.end());
+
+    int bestStreams = conf.streamExecutorConfig._streams > 0 ? conf.streamExecutorConfig._streams : 1;
+    double bestThroughput = 0.0;
+
+    for (int streams : candidates) {
+        Config candidateConf = conf;
+        candidateConf.streamsCalibration = false;
+        candidateConf.streamExecutorConfig._streams = streams;
+
+        auto candidate = std::make_shared<MKLDNNExecNetwork>(network, candidateConf, extensionManager,
+                                                             weightsSharing, workspacePool);
+
+        ResponseDesc resp;
+        std::vector<IInferRequest::Ptr> requests(streams);
+        for (auto &request : requests) {
+            candidate->CreateInferRequest(request);
+
+            // the request pre-allocates its blobs; zero-fill the inputs so the benchmark
+            // does not run on denormals or other pathological garbage
+            InputsDataMap inputsInfo;
+            network.getInputsInfo(inputsInfo);
+            for (const auto &input : inputsInfo) {
+                Blob::Ptr blob;
+                if (request->GetBlob(input.first.c_str(), blob, &resp) == OK && blob)
+                    memset(blob->buffer(), 0, blob->byteSize());
+            }
+        }
+
+        auto runOnce = [&]() {
+            for (auto &request : requests) {
+                if (request->StartAsync(&resp) != OK)
+                    THROW_IE_EXCEPTION << "Stream calibration inference failed: " << resp.msg;
+            }
+            for (auto &request : requests) {
+                if (request->Wait(IInferRequest::WaitMode::RESULT_READY, &resp) != OK)
+                    THROW_IE_EXCEPTION << "Stream calibration inference failed: " << resp.msg;
+            }
+        };
+
+        // the first run pays for lazy allocations and primitive caches
+        runOnce();
+
+        const auto start = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::duration elapsed {};
+        int iterations = 0;
+        do {
+            runOnce();
+            iterations++;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (iterations < 4 || elapsed < std::chrono::milliseconds(200));
+
+        double seconds = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count();
+        double throughput = iterations * static_cast<double>(streams) / seconds;
+        if (throughput > bestThroughput) {
+            bestThroughput = throughput;
+            bestStreams = streams;
+        }
+    }
+
+    std::ofstream cache(conf.streamsCalibrationCache, std::ios::app);
+    if (cache)
+        cache << signature << " " << bestStreams << std::endl;
+
+    return bestStreams;
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferenceEngine::Core object";
+    }
+
+    // The blob was written by MKLDNNExecNetwork::ExportImpl: one line of legacy
+    // IR xml, then the weights size and the raw weights. A blob exported with
+    // KEY_CPU_EXPORT_COMPRESSION replaces the size field with a marker and
+    // stores the weights as compressed chunks, decompressed here in parallel
+    std::string xmlString;
+    std::getline(networkModel, xmlString);
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    bool compressed = WeightsCompression::COMPRESSED_MARKER == dataSize;
+    if (compressed)
+        networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(
+            TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        if (compressed)
+            WeightsCompression::deserialize(networkModel, dataBlob->buffer(), dataSize);
+        else
+            networkModel.read(dataBlob->buffer(), dataSize);
+    }
+
+    // a blob exported with KEY_CPU_EXPORT_PREPARED_WEIGHTS carries a trailing
+    // section of reordered weight tensors which lets prepareMemory skip the
+    // reorders; blobs without the section simply end after the weights
+    auto preparedWeights = std::make_shared<PreparedWeights::Store>();
+    {
+        std::uint64_t marker = 0;
+        networkModel.read(reinterpret_cast<char*>(&marker), sizeof(marker));
+        if (networkModel.good() && PreparedWeights::SECTION_MARKER == marker)
+            PreparedWeights::deserialize(networkModel, *preparedWeights);
+        else
+            networkModel.clear();
+    }
+
+    CNNNetwork network = GetCore()->ReadNetwork(xmlString, dataBlob);
+
+    Config conf = engConfig;
+    conf.readProperties(config);
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
+    }
+    if (conf.largePages)
+        SetLargePagesEnabled(true);
+    if (conf.persistentWeightsCache) {
+        conf.forceWeightsSharing = true;
+        weightsSharing.setPersistentMode(true);
+    }
+    if (!preparedWeights->empty())
+        conf.preparedWeights = preparedWeights;
+
+    // the exported network is already converted from nGraph and transformed,
+    // so it goes straight to the executable network
+    auto implNetwork = std::make_shared<MKLDNNExecNetwork>(static_cast<const ICNNNetwork&>(network), conf,
+                                                           extensionManager, weightsSharing, workspacePool);
+    implNetwork->setNetworkInputs(network.getInputsInfo());
+    implNetwork->setNetworkOutputs(network.getOutputsInfo());
+    implNetwork->SetPointerToPluginInternal(shared_from_this());
+
+    IExecutableNetwork::Ptr executableNetwork;
+    executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(implNetwork),
+                            [](details::IRelease *p) { p->Release(); });
+    return ExecutableNetwork{executableNetwork};
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
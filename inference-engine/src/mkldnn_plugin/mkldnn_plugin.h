@@ -36,9 +36,25 @@ public:
     void QueryNetwork(const InferenceEngine::ICNNNetwork& network,
                       const std::map<std::string, std::string>& config, InferenceEngine::QueryNetworkResult& res) const override;
 
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                                         const std::map<std::string, std::string>& config) override;
+
 private:
+    /**
+     * Picks the stream count for the network by a short throughput sweep over candidate
+     * stream counts derived from the host topology. The on-disk calibration cache is
+     * consulted first and updated with the winner (see KEY_CPU_STREAMS_CALIBRATION).
+     */
+    int CalibrateStreams(const InferenceEngine::ICNNNetwork &network, const Config &conf);
+
     Config engConfig;
     NumaNodesWeights weightsSharing;
+    // implementation types the last load of each network settled on, keyed by network
+    // name; seeded into the next load of the same network (KEY_CPU_RESHAPE_RELAUNCH)
+    std::map<std::string, std::shared_ptr<const std::map<std::string, impl_desc_type>>> implTypePlans;
+    // name of the host-level weights store the caches are currently attached to
+    std::string attachedSharedStore;
+    MKLDNNWorkspacePool::Ptr workspacePool = std::make_shared<MKLDNNWorkspacePool>();
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
 };
 
@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Bump-pointer arena for per-request scratch memory.
+ *
+ * Each graph - and a graph is per stream - owns one arena which the graph resets at
+ * the start of every Infer, so nodes can take small temporaries (pointer tables,
+ * per-split offsets) from it instead of the heap. Allocations are a pointer bump; the
+ * memory is reclaimed wholesale by the reset, never freed individually. When the arena
+ * runs out the allocation falls back to the heap and the high-water mark is remembered,
+ * so the next reset regrows the buffer and the steady state goes back to zero heap
+ * traffic. Not thread safe: an arena belongs to the single thread executing its graph.
+ */
+class MKLDNNScratchArena {
+public:
+    void* allocate(size_t size) {
+        size = (size + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= buffer.size()) {
+            void* ptr = buffer.data() + offset;
+            offset += size;
+            highWater += size;
+            return ptr;
+        }
+        // overflow: served from the heap this once, sized into the arena by the next reset
+        highWater += size;
+        overflow.emplace_back(new uint8_t[size]);
+        return overflow.back().get();
+    }
+
+    template <typename T>
+    T* allocate(size_t count) {
+        return reinterpret_cast<T*>(allocate(count * sizeof(T)));
+    }
+
+    void reset() {
+        if (highWater > buffer.size()) {
+            buffer.clear();
+            buffer.resize(highWater);
+        }
+        overflow.clear();
+        offset = 0;
+        highWater = 0;
+    }
+
+private:
+    static const size_t alignment = 64;
+
+    std::vector<uint8_t> buffer;
+    std::vector<std::unique_ptr<uint8_t[]>> overflow;
+    size_t offset = 0;
+    // bytes requested since the last reset, including overflow
+    size_t highWater = 0;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,215 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_shared_weights_store.hpp"
+
+#include <cstring>
+
+#if !(defined(__APPLE__) || defined(_WIN32))
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+#if !(defined(__APPLE__) || defined(_WIN32))
+
+namespace {
+
+// written by the creator after the header is fully initialized
+const uint64_t storeMagic = 0x5748545353544f52;  // "WHTSSTOR"
+const size_t maxEntries = 4096;
+// virtual reservation only: tmpfs allocates pages when payloads are written
+const size_t dataRegionSize = 8ull << 30;
+
+size_t alignUp(size_t value, size_t align) {
+    return (value + align - 1) & ~(align - 1);
+}
+
+// a sibling may die while holding the lock; the mutex is robust, and entries
+// are made visible only after their payload is fully written, so the table
+// stays consistent and the lock can be recovered
+bool lockRobust(pthread_mutex_t *mutex) {
+    int rc = pthread_mutex_lock(mutex);
+    if (rc == EOWNERDEAD) {
+        pthread_mutex_consistent(mutex);
+        rc = 0;
+    }
+    return rc == 0;
+}
+
+}  // namespace
+
+struct SharedWeightsStore::Entry {
+    uint64_t key;
+    uint64_t size;
+    uint64_t offset;  // payload offset from the segment start
+    mkldnn_memory_desc_t desc;
+};
+
+struct SharedWeightsStore::Header {
+    pthread_mutex_t mutex;
+    uint64_t count;
+    uint64_t dataCursor;
+    uint64_t magic;
+};
+
+SharedWeightsStore::Ptr SharedWeightsStore::Open(const std::string &name) {
+    const std::string shmName = "/" + name;
+    const size_t size = alignUp(sizeof(Header) + maxEntries * sizeof(Entry), 64) + dataRegionSize;
+
+    bool creator = false;
+    int fd = shm_open(shmName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+        creator = true;
+        if (ftruncate(fd, size) != 0) {
+            close(fd);
+            shm_unlink(shmName.c_str());
+            return nullptr;
+        }
+    } else {
+        fd = shm_open(shmName.c_str(), O_RDWR, 0600);
+        if (fd < 0)
+            return nullptr;
+
+        // the creator may still be sizing the segment; wait until it is complete
+        struct stat st = {};
+        for (int attempt = 0; ; attempt++) {
+            if (fstat(fd, &st) != 0 || attempt > 5000) {
+                close(fd);
+                return nullptr;
+            }
+            if (static_cast<size_t>(st.st_size) == size)
+                break;
+            usleep(1000);
+        }
+    }
+
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        close(fd);
+        if (creator)
+            shm_unlink(shmName.c_str());
+        return nullptr;
+    }
+
+    Header *header = reinterpret_cast<Header *>(mapping);
+    if (creator) {
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+        pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+        pthread_mutex_init(&header->mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+
+        header->count = 0;
+        header->dataCursor = alignUp(sizeof(Header) + maxEntries * sizeof(Entry), 64);
+        __sync_synchronize();
+        header->magic = storeMagic;
+    } else {
+        for (int attempt = 0; header->magic != storeMagic; attempt++) {
+            if (attempt > 5000) {
+                munmap(mapping, size);
+                close(fd);
+                return nullptr;
+            }
+            usleep(1000);
+        }
+    }
+
+    Ptr store(new SharedWeightsStore());
+    store->mapping = mapping;
+    store->mappingSize = size;
+    store->fd = fd;
+    return store;
+}
+
+SharedWeightsStore::~SharedWeightsStore() {
+    if (mapping != nullptr)
+        munmap(mapping, mappingSize);
+    if (fd >= 0)
+        close(fd);
+}
+
+const void* SharedWeightsStore::find(uint64_t key, mkldnn_memory_desc_t *desc) const {
+    Header *header = reinterpret_cast<Header *>(mapping);
+    Entry *entries = reinterpret_cast<Entry *>(reinterpret_cast<char *>(mapping) + sizeof(Header));
+
+    if (!lockRobust(&header->mutex))
+        return nullptr;
+
+    const void *data = nullptr;
+    for (uint64_t i = 0; i < header->count; i++) {
+        if (entries[i].key == key) {
+            *desc = entries[i].desc;
+            data = reinterpret_cast<const char *>(mapping) + entries[i].offset;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&header->mutex);
+    return data;
+}
+
+const void* SharedWeightsStore::insert(uint64_t key, const mkldnn_memory_desc_t &desc, const void *data, size_t size) {
+    Header *header = reinterpret_cast<Header *>(mapping);
+    Entry *entries = reinterpret_cast<Entry *>(reinterpret_cast<char *>(mapping) + sizeof(Header));
+
+    if (!lockRobust(&header->mutex))
+        return nullptr;
+
+    const void *published = nullptr;
+    for (uint64_t i = 0; i < header->count; i++) {
+        if (entries[i].key == key) {
+            published = reinterpret_cast<const char *>(mapping) + entries[i].offset;
+            break;
+        }
+    }
+
+    if (published == nullptr && header->count < maxEntries && header->dataCursor + size <= mappingSize) {
+        char *payload = reinterpret_cast<char *>(mapping) + header->dataCursor;
+        memcpy(payload, data, size);
+
+        Entry &entry = entries[header->count];
+        entry.key = key;
+        entry.size = size;
+        entry.offset = header->dataCursor;
+        entry.desc = desc;
+
+        // the entry becomes visible only after the payload and metadata are complete
+        header->dataCursor += alignUp(size, 64);
+        header->count++;
+        published = payload;
+    }
+
+    pthread_mutex_unlock(&header->mutex);
+    return published;
+}
+
+#else  // no shared weights store on Win/MacOS
+
+struct SharedWeightsStore::Entry {};
+struct SharedWeightsStore::Header {};
+
+SharedWeightsStore::Ptr SharedWeightsStore::Open(const std::string &name) {
+    return nullptr;
+}
+
+SharedWeightsStore::~SharedWeightsStore() {}
+
+const void* SharedWeightsStore::find(uint64_t key, mkldnn_memory_desc_t *desc) const {
+    return nullptr;
+}
+
+const void* SharedWeightsStore::insert(uint64_t key, const mkldnn_memory_desc_t &desc, const void *data, size_t size) {
+    return nullptr;
+}
+
+#endif  // !(defined(__APPLE__) || defined(_WIN32))
+
+}  // namespace MKLDNNPlugin
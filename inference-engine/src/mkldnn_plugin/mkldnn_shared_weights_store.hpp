@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn_types.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Host-level store of reordered constant blobs placed in a named shared memory
+ * segment, so sibling processes serving the same model reference one physical
+ * copy of the weights instead of duplicating them per process.
+ *
+ * The first process to need a blob publishes it together with the mkldnn memory
+ * descriptor it was reordered to; later processes (and later loads in the same
+ * process) look the blob up by the weights cache key and map it directly.
+ * The segment outlives the processes which created it and has to be removed
+ * by the host administrator (or a reboot) when the model is retired.
+ *
+ * Is a process and thread safe
+ */
+class SharedWeightsStore {
+public:
+    typedef std::shared_ptr<SharedWeightsStore> Ptr;
+
+    /**
+     * Creates the named store or attaches to an already existing one.
+     * Returns nullptr when shared memory is not supported on the platform
+     * or the segment cannot be created.
+     */
+    static Ptr Open(const std::string &name);
+
+    ~SharedWeightsStore();
+
+    /**
+     * Returns a pointer to the payload published under the key and fills the
+     * memory descriptor it was published with, or nullptr on a miss
+     */
+    const void* find(uint64_t key, mkldnn_memory_desc_t *desc) const;
+
+    /**
+     * Publishes the payload under the key and returns the mapped pointer.
+     * Returns the already published payload when the key is taken and
+     * nullptr when the store has no room left.
+     */
+    const void* insert(uint64_t key, const mkldnn_memory_desc_t &desc, const void *data, size_t size);
+
+private:
+    SharedWeightsStore() = default;
+
+    struct Header;
+    struct Entry;
+
+    void *mapping = nullptr;
+    size_t mappingSize = 0;
+    int fd = -1;
+};
+
+}  // namespace MKLDNNPlugin
@@ -11,6 +11,39 @@ namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreateShared(const std::string& name_hash,
+                                                         const std::function<MKLDNNMemoryPtr(void)>& create,
+                                                         const mkldnn::engine& engine) {
+    // the cache key already encodes the name, size and CRC of the source data
+    const uint64_t key = simpleCRC.hash(
+            reinterpret_cast<const unsigned char *>(name_hash.data()), name_hash.size());
+
+    mkldnn_memory_desc_t desc;
+    const void *published = store->find(key, &desc);
+    if (published != nullptr) {
+        // a sibling process already reordered this blob: reference its pages
+        MKLDNNMemoryPtr mapped(new MKLDNNMemory(engine));
+        mapped->Create(mkldnn::memory::desc(desc), published, false);
+        return mapped;
+    }
+
+    MKLDNNMemoryPtr ptr = create();
+    const size_t size = ptr->GetSize();
+    if (size == 0)
+        return ptr;
+
+    published = store->insert(key, ptr->GetDescriptor().data, ptr->GetData(), size);
+    if (published != nullptr) {
+        // drop the private copy and reference the shared pages instead
+        MKLDNNMemoryPtr mapped(new MKLDNNMemory(engine));
+        mapped->Create(ptr->GetDescriptor(), published, false);
+        return mapped;
+    }
+
+    // the store is full, keep the private copy
+    return ptr;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -30,4 +63,14 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+void NumaNodesWeights::setSharedStore(const SharedWeightsStore::Ptr& sharedStore) {
+    for (auto& cache : _cache_map)
+        cache.second->setSharedStore(sharedStore);
+}
+
+void NumaNodesWeights::setPersistentMode(bool enabled) {
+    for (auto& cache : _cache_map)
+        cache.second->setPersistentMode(enabled);
+}
+
 }  // namespace MKLDNNPlugin
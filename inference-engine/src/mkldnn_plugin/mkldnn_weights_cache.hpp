@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include "mkldnn_shared_weights_store.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -55,21 +56,50 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
-                             std::function<MKLDNNMemoryPtr(void)> create) {
+                             std::function<MKLDNNMemoryPtr(void)> create,
+                             const mkldnn::engine* engine = nullptr) {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(name_hash);
 
         MKLDNNMemoryPtr ptr;
         if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
-            ptr = create();
+            if (store != nullptr && engine != nullptr)
+                ptr = findOrCreateShared(name_hash, create, *engine);
+            else
+                ptr = create();
             sharedWeights[name_hash] = ptr;
         }
+        // in persistent mode a strong reference pins the tensor past the lifetime
+        // of the networks using it, so the next network sharing the same weights
+        // finds them reordered already instead of redoing the work
+        if (persistent)
+            persistentWeights[name_hash] = ptr;
         return ptr;
     }
+    void setSharedStore(const SharedWeightsStore::Ptr& sharedStore) {
+        std::unique_lock<std::mutex> lock(guard);
+        store = sharedStore;
+    }
+    void setPersistentMode(bool enabled) {
+        std::unique_lock<std::mutex> lock(guard);
+        persistent = enabled;
+        if (!enabled)
+            persistentWeights.clear();
+    }
+    bool persistentMode() const { return persistent; }
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    MKLDNNMemoryPtr findOrCreateShared(const std::string& name_hash,
+                             const std::function<MKLDNNMemoryPtr(void)>& create,
+                             const mkldnn::engine& engine);
+
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    // strong references of the persistent mode; entries live until the plugin is
+    // unloaded or the mode is switched off
+    std::unordered_map<std::string, MKLDNNMemoryPtr> persistentWeights;
+    bool persistent = false;
+    SharedWeightsStore::Ptr store;
     std::mutex guard;
     static const SimpleDataHash simpleCRC;
 };
@@ -86,6 +116,9 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    void setSharedStore(const SharedWeightsStore::Ptr& sharedStore);
+    void setPersistentMode(bool enabled);
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
 };
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_workspace_pool.hpp"
+
+#include <ie_large_pages.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+static const size_t kWorkspaceAlignment = 64;
+
+MKLDNNWorkspacePool::~MKLDNNWorkspacePool() {
+    for (auto& nodeList : _freeWorkspaces)
+        for (auto& workspace : nodeList.second)
+            release(workspace);
+}
+
+void MKLDNNWorkspacePool::release(Workspace& workspace) {
+    if (workspace._base == nullptr)
+        return;
+    if (workspace._huge)
+        InferenceEngine::FreeLargePages(workspace._base);
+    else
+        delete[] workspace._base;
+    workspace._base = nullptr;
+}
+
+std::shared_ptr<int8_t> MKLDNNWorkspacePool::get(size_t size, int numaNode, bool largePages) {
+    Workspace workspace;
+    {
+        std::lock_guard<std::mutex> lock(_guard);
+        auto& freeList = _freeWorkspaces[numaNode];
+        // best fit: the smallest free workspace that is large enough, so that the big
+        // ones stay available for the graphs that actually need them
+        auto best = freeList.end();
+        for (auto it = freeList.begin(); it != freeList.end(); ++it) {
+            if (it->_size >= size && (best == freeList.end() || it->_size < best->_size)) {
+                best = it;
+            }
+        }
+        if (best != freeList.end()) {
+            workspace = std::move(*best);
+            freeList.erase(best);
+        }
+    }
+    if (!workspace._base) {
+        if (largePages) {
+            workspace._base = static_cast<int8_t*>(InferenceEngine::AllocLargePages(size + kWorkspaceAlignment));
+            workspace._huge = workspace._base != nullptr;
+        }
+        if (!workspace._base)
+            workspace._base = new int8_t[size + kWorkspaceAlignment];
+        workspace._size = size;
+        // first touch on the calling thread: the stream is already bound to its NUMA
+        // node here, so this is what makes the pages land on the right node
+        std::memset(workspace._base, 0, size + kWorkspaceAlignment);
+    }
+    auto* base = workspace._base;
+    auto* aligned = reinterpret_cast<int8_t*>(
+        (reinterpret_cast<uintptr_t>(base) + kWorkspaceAlignment - 1) & ~(kWorkspaceAlignment - 1));
+    const size_t workspaceSize = workspace._size;
+    const bool huge = workspace._huge;
+    auto pool = shared_from_this();
+    return std::shared_ptr<int8_t>(aligned, [pool, base, workspaceSize, huge, numaNode](int8_t*) {
+        Workspace released;
+        released._base = base;
+        released._size = workspaceSize;
+        released._huge = huge;
+        std::lock_guard<std::mutex> lock(pool->_guard);
+        pool->_freeWorkspaces[numaNode].push_back(std::move(released));
+    });
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Pool of reusable workspace buffers for the intermediate tensors of a graph
+ *
+ * Buffers are pooled per NUMA node: a stream requests a workspace with its own node id and the
+ * pages of the returned buffer either come from a workspace that was released on the same node
+ * before, or are first-touched by the calling stream thread. Either way the intermediate tensors
+ * end up resident on the node the stream is bound to, avoiding cross-socket traffic.
+ *
+ * Is a thread safe
+ */
+class MKLDNNWorkspacePool : public std::enable_shared_from_this<MKLDNNWorkspacePool> {
+public:
+    typedef std::shared_ptr<MKLDNNWorkspacePool> Ptr;
+
+    ~MKLDNNWorkspacePool();
+
+    /**
+     * Returns a buffer of at least `size` bytes, aligned to 64 bytes, local to `numaNode`.
+     * The buffer goes back to the node's free list when the last shared_ptr copy dies.
+     * With `largePages` a fresh buffer is backed by 2MB pages when the system allows it;
+     * a matching free workspace is reused regardless of how its pages are backed.
+     */
+    std::shared_ptr<int8_t> get(size_t size, int numaNode, bool largePages = false);
+
+private:
+    struct Workspace {
+        int8_t* _base = nullptr;
+        size_t  _size = 0;
+        bool    _huge = false;
+    };
+
+    static void release(Workspace& workspace);
+
+    std::map<int, std::vector<Workspace>> _freeWorkspaces;
+    std::mutex                            _guard;
+};
+
+}  // namespace MKLDNNPlugin
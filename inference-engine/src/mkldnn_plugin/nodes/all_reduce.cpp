@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base.hpp"
+
+#include <ngraph/distributed.hpp>
+
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * Sums its input element-wise across the distributed process group and outputs
+ * the reduced tensor on every rank. Inserted by the tensor-parallel split of
+ * FullyConnected layers to combine the partial products; requires a configured
+ * distributed interface (see ngraph/distributed.hpp).
+ */
+class AllReduceImpl: public ExtLayerBase {
+public:
+    explicit AllReduceImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.size() != 1 || layer->outData.empty())
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            if (layer->insData[0].lock()->getTensorDesc().getPrecision() != Precision::FP32)
+                THROW_IE_EXCEPTION << "AllReduce supports only FP32 tensors!";
+
+            addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const auto *src_data = inputs[0]->cbuffer().as<const float *>();
+        auto *dst_data = outputs[0]->buffer().as<float *>();
+
+        try {
+            ngraph::get_distributed_interface()->all_reduce(const_cast<float *>(src_data), dst_data,
+                                                            ngraph::element::Type_t::f32,
+                                                            ngraph::reduction::Type::SUM,
+                                                            inputs[0]->size());
+        } catch (const std::exception &ex) {
+            if (resp != nullptr) {
+                std::string errorMsg = ex.what();
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+
+        return OK;
+    }
+};
+
+REG_FACTORY_FOR(AllReduceImpl, AllReduce);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -12,6 +12,7 @@
 #include <utility>
 #include <functional>
 #include <ie_parallel.hpp>
+#include "nodes/common/arg_max_row.h"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #include "nodes/common/uni_simd.h"
@@ -119,17 +120,10 @@ template <bool out_max_val>
 void argmax_one_class(const float* src_data, float* dst_data, Shape in_dims) {
     const int dim = count(in_dims, 1);
     int before_num = in_dims[0];
+
     parallel_for(before_num, [&](int i0) {
-        int index_max_val = 0;
-        int s_index = i0 * dim;
-        float max_val = src_data[s_index];
-        for (int i1 = 1; i1 < dim; i1++) {
-            s_index++;
-            if (src_data[s_index] > max_val) {
-                max_val = src_data[s_index];
-                index_max_val = i1;
-            }
-        }
+        float max_val;
+        int index_max_val = row_arg_max(src_data + i0 * dim, dim, max_val);
         if (!out_max_val) {
             dst_data[i0] = static_cast<float>(index_max_val);
         } else {
@@ -320,6 +314,20 @@ void argmax_many_classes(const float* src_data, float* dst_data, Shape in_dims,
     const int dim = count(in_dims, 1);
     auto top_k_ = conf.top_k_;
     int before_num = in_dims[0];
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256 vmask_type;
+#elif defined(HAVE_SSE)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128 vmask_type;
+#endif
+
     parallel_for(before_num, [&](int i0) {
         std::vector<float> max_values(top_k_ + 1);
         std::vector<int> max_indexes(top_k_ + 1);
@@ -337,6 +345,18 @@ void argmax_many_classes(const float* src_data, float* dst_data, Shape in_dims,
             max_indexes[index2] = tmp_index;
         };
 
+        auto insert_func = [&](float value, int index) {
+            max_values[top_k_] = value;
+            max_indexes[top_k_] = index;
+            for (int i3 = top_k_; i3 > 0; i3--) {
+                if (max_values[i3] > max_values[i3 - 1]) {
+                    swap_func(i3, i3 - 1);
+                } else {
+                    break;
+                }
+            }
+        };
+
         for (int i2 = 0; i2 < top_k_; i2++) {
             max_values[i2] = src_data[s_index];
             max_indexes[i2] = i2;
@@ -349,16 +369,26 @@ void argmax_many_classes(const float* src_data, float* dst_data, Shape in_dims,
                 }
             }
         }
-        for (int i2 = top_k_; i2 < dim; i2++) {
-            max_values[top_k_] = src_data[s_index];
-            max_indexes[top_k_] = i2;
-            for (int i3 = top_k_; i3 > 0; i3--) {
-                if (max_values[i3] > max_values[i3 - 1]) {
-                    swap_func(i3, i3 - 1);
-                } else {
-                    break;
+        int i2 = top_k_;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        // skip whole blocks which cannot displace the smallest of the kept top-K candidates
+        for (; i2 + block_size <= dim; i2 += block_size) {
+            vec_type_f vsrc = _mm_uni_loadu_ps(src_data + s_index);
+            vmask_type vmask = _mm_uni_cmpgt_ps(vsrc, _mm_uni_set1_ps(max_values[top_k_ - 1]));
+#if defined(HAVE_AVX512F)
+            if (vmask) {
+#else
+            if (_mm_uni_movemask_ps(vmask)) {
+#endif
+                for (int i3 = 0; i3 < block_size; i3++) {
+                    insert_func(src_data[s_index + i3], i2 + i3);
                 }
             }
+            s_index += block_size;
+        }
+#endif
+        for (; i2 < dim; i2++) {
+            insert_func(src_data[s_index], i2);
             s_index++;
         }
         for (int i2 = 0; i2 < top_k_; i2++) {
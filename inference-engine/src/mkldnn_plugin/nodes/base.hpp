@@ -176,20 +176,14 @@ protected:
 
 IE_SUPPRESS_DEPRECATED_END
 
-template <typename __prim>
-inline void extRegister(MKLDNNExtensions * extInstance, const char * __type) {
-    IE_SUPPRESS_DEPRECATED_START
-    extInstance->AddExt(__type,
-                [](const CNNLayer* layer) -> InferenceEngine::ILayerImplFactory* {
-                    return new __prim(layer);
-                });
-    IE_SUPPRESS_DEPRECATED_END
-}
-
+// Defines a plain factory function for the node: a pointer to it is placed into the
+// compile-time registration table in list.cpp, so no code runs until the first lookup
 #define REG_FACTORY_FOR(__prim, __type) \
-    void __prim ## __type(MKLDNNExtensions * extInstance) { \
-        extRegister<ImplFactory<__prim>>(extInstance, #__type); \
-    }
+    IE_SUPPRESS_DEPRECATED_START \
+    InferenceEngine::ILayerImplFactory* __prim ## __type(const InferenceEngine::CNNLayer* layer) { \
+        return new ImplFactory<__prim>(layer); \
+    } \
+    IE_SUPPRESS_DEPRECATED_END
 
 }  // namespace Cpu
 }  // namespace Extensions
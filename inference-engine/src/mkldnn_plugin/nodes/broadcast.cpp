@@ -99,6 +99,61 @@ public:
         uint8_t* dst_data = outputs[0]->cbuffer().as<uint8_t *>() +
                           outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
+        //  The element width is resolved to a compile time type once here, so inside
+        //  the loop every element moves as a single typed store instead of a guarded
+        //  byte copy per output element
+        switch (data_size) {
+            case 1:
+                broadcast_copy<uint8_t>(dst_data, src_data, dst_dims, src_aligned, srcStrides_aligned, work_amount_dst);
+                break;
+            case 2:
+                broadcast_copy<uint16_t>(dst_data, src_data, dst_dims, src_aligned, srcStrides_aligned, work_amount_dst);
+                break;
+            case 4:
+                broadcast_copy<uint32_t>(dst_data, src_data, dst_dims, src_aligned, srcStrides_aligned, work_amount_dst);
+                break;
+            case 8:
+                broadcast_copy<uint64_t>(dst_data, src_data, dst_dims, src_aligned, srcStrides_aligned, work_amount_dst);
+                break;
+            default:
+                broadcast_copy_generic(dst_data, src_data, data_size, dst_dims, src_aligned, srcStrides_aligned, work_amount_dst);
+        }
+
+        return OK;
+    }
+
+private:
+    template <typename data_t>
+    void broadcast_copy(uint8_t* dst_bytes, const uint8_t* src_bytes, const SizeVector& dst_dims,
+                        const SizeVector& src_aligned, const SizeVector& srcStrides_aligned, size_t work_amount_dst) {
+        const data_t* src_data = reinterpret_cast<const data_t*>(src_bytes);
+        data_t* dst_data = reinterpret_cast<data_t*>(dst_bytes);
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t i, src_idx, start = 0, end = 0;
+            SizeVector counters(dst_dims.size(), 0);
+            splitter(work_amount_dst, nthr, ithr, start, end);
+            for (int j = dst_dims.size() - 1, i = start; j >= 0; j--) {
+                counters[j] = i % dst_dims[j];
+                i /= dst_dims[j];
+            }
+            for (size_t iwork = start; iwork < end; ++iwork) {
+                for (i = 0, src_idx = 0; i < dst_dims.size(); ++i)
+                    src_idx += counters[i] ? ((counters[i] % src_aligned[i]) * srcStrides_aligned[i]) : 0;
+
+                dst_data[iwork] = src_data[src_idx];
+
+                for (int j = dst_dims.size() - 1; j >= 0; j--) {
+                    counters[j] = (counters[j] + 1) % dst_dims[j];
+                    if (counters[j] != 0) break;
+                }
+            }
+        });
+    }
+
+    //  Fallback for element widths without a typed kernel
+    void broadcast_copy_generic(uint8_t* dst_data, const uint8_t* src_data, size_t data_size, const SizeVector& dst_dims,
+                                const SizeVector& src_aligned, const SizeVector& srcStrides_aligned, size_t work_amount_dst) {
         parallel_nt(0, [&](const int ithr, const int nthr) {
             size_t i, src_idx, start = 0, end = 0;
             SizeVector counters(dst_dims.size(), 0);
@@ -119,11 +174,8 @@ public:
                 }
             }
         });
-
-        return OK;
     }
 
-private:
     const size_t BROADCAST_INPUT = 0;
     const size_t BROADCAST_SHAPE = 1;
 };
@@ -195,19 +195,54 @@ private:
             return;
         }
 
-        // boundaries are assumed to be sorted and to have unique elements
-        parallel_for(num_values, [&](size_t ind) {
-            T value = input_data[ind];
+        // boundaries are assumed to be sorted and to have unique elements;
+        // the search runs a branchless probe sequence of fixed length
+        // ceil(log2(num_bin_values)) + 1, so within a block every element takes
+        // the same instruction path and the compiler vectorizes the loop
+        const size_t block_size = 1024;
+        const size_t blocks_num = (num_values + block_size - 1) / block_size;
+        parallel_for(blocks_num, [&](size_t block) {
+            const size_t begin = block * block_size;
+            const size_t end = std::min(begin + block_size, num_values);
             if (with_right) {
-                auto low = std::lower_bound(boundaries_data, boundaries_data + num_bin_values, value);
-                output_data[ind] = static_cast<T_IND>(low - boundaries_data);
+                for (size_t ind = begin; ind < end; ind++) {
+                    output_data[ind] = static_cast<T_IND>(
+                        lower_bound_branchless(boundaries_data, num_bin_values, input_data[ind]));
+                }
             } else {
-                auto up = std::upper_bound(boundaries_data, boundaries_data + num_bin_values, value);
-                output_data[ind] = static_cast<T_IND>(up - boundaries_data);
+                for (size_t ind = begin; ind < end; ind++) {
+                    output_data[ind] = static_cast<T_IND>(
+                        upper_bound_branchless(boundaries_data, num_bin_values, input_data[ind]));
+                }
             }
         });
     }
 
+    // index of the first boundary not less than value (as std::lower_bound),
+    // computed with conditional advances only
+    template <typename T_BOUNDARIES, typename T>
+    static size_t lower_bound_branchless(const T_BOUNDARIES* arr, size_t n, T value) {
+        const T_BOUNDARIES* base = arr;
+        while (n > 1) {
+            const size_t half = n / 2;
+            base += (base[half - 1] < value) ? half : 0;
+            n -= half;
+        }
+        return (base - arr) + ((base[0] < value) ? 1 : 0);
+    }
+
+    // index of the first boundary greater than value (as std::upper_bound)
+    template <typename T_BOUNDARIES, typename T>
+    static size_t upper_bound_branchless(const T_BOUNDARIES* arr, size_t n, T value) {
+        const T_BOUNDARIES* base = arr;
+        while (n > 1) {
+            const size_t half = n / 2;
+            base += (base[half - 1] <= value) ? half : 0;
+            n -= half;
+        }
+        return (base - arr) + ((base[0] <= value) ? 1 : 0);
+    }
+
     const size_t INPUT_TENSOR_PORT = 0;
     const size_t INPUT_BINS_PORT = 1;
     const size_t OUTPUT_TENSOR_PORT = 0;
@@ -0,0 +1,89 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "uni_simd.h"
+#endif
+
+// Shared SIMD argmax over a contiguous row of floats. This header may only be
+// included from cross compiled translation units: the XARCH namespace below is
+// substituted with the concrete arch namespace (see cross_compiled_file), so
+// the _mm_uni_* helpers of the matching arch resolve without qualification.
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Returns the index of the maximum element of row[0..len); on equal values the
+// smaller index wins, matching a plain scalar scan. The maximum itself is
+// stored into max_val.
+static inline int row_arg_max(const float* row, int len, float& max_val) {
+    int index_max_val = 0;
+    max_val = row[0];
+    int first_index = 0;
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __m512i vec_type_i;
+    typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256i vec_type_i;
+    typedef __m256 vmask_type;
+#elif defined(HAVE_SSE)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128i vec_type_i;
+    typedef __m128 vmask_type;
+#endif
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (len >= 2 * block_size) {
+        vec_type_f vmax_val = _mm_uni_loadu_ps(row);
+        vec_type_i vblock_max_val = _mm_uni_setzero_si();
+        for (int ib1 = 1; ib1 < len / block_size; ib1++) {
+            vec_type_f vsrc = _mm_uni_loadu_ps(row + ib1 * block_size);
+            vmask_type vmask = _mm_uni_cmpgt_ps(vsrc, vmax_val);
+            vmax_val = _mm_uni_blendv_ps(vmax_val, vsrc, vmask);
+            vec_type_i vblock_cur_val = _mm_uni_set1_epi32(ib1);
+#if defined(HAVE_AVX512F)
+            vblock_max_val = _mm512_mask_blend_epi32(vmask, vblock_max_val, vblock_cur_val);
+#else
+            vblock_max_val = _mm_uni_blendv_epi8(vblock_max_val, vblock_cur_val, _mm_uni_castps_si(vmask));
+#endif
+        }
+        float lane_values[block_size];
+        int lane_blocks[block_size];
+        _mm_uni_storeu_ps(lane_values, vmax_val);
+        _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(lane_blocks), vblock_max_val);
+        max_val = lane_values[0];
+        index_max_val = lane_blocks[0] * block_size;
+        for (int i1 = 1; i1 < block_size; i1++) {
+            int index = lane_blocks[i1] * block_size + i1;
+            // on equal values prefer the smaller index to keep the first occurrence like the scalar scan
+            if (lane_values[i1] > max_val || (lane_values[i1] == max_val && index < index_max_val)) {
+                max_val = lane_values[i1];
+                index_max_val = index;
+            }
+        }
+        first_index = len / block_size * block_size;
+    }
+#endif
+    for (int i1 = first_index; i1 < len; i1++) {
+        if (row[i1] > max_val) {
+            max_val = row[i1];
+            index_max_val = i1;
+        }
+    }
+    return index_max_val;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "defs.h"
+
+// Fixed-width element copies for the byte-oriented extension nodes (Broadcast,
+// Gather, ScatterUpdate). Those nodes learn the element width only at runtime,
+// so copying rows through simple_copy degenerates to a guarded byte loop inside
+// the hot loop. Here a kernel is instantiated per element width at compile time
+// and the width is resolved once per execute() through element_copy_for_width;
+// inside the loop every element moves as a plain typed load/store.
+//
+// Unlike simple_copy there is no runtime overlap/capacity guard: the callers
+// size both buffers from the same tensor descriptors.
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+template <typename data_t>
+inline void element_copy_kernel(uint8_t* dst, const uint8_t* src, size_t size) {
+    const data_t* src_t = reinterpret_cast<const data_t*>(src);
+    data_t* dst_t = reinterpret_cast<data_t*>(dst);
+    const size_t count = size / sizeof(data_t);
+    DLSDK_EXT_IVDEP()
+    for (size_t i = 0; i < count; i++)
+        dst_t[i] = src_t[i];
+}
+
+typedef void (*element_copy_fn)(uint8_t* dst, const uint8_t* src, size_t size);
+
+// Resolves the element width to its compile time kernel; `size` stays in bytes
+// so the result is a drop-in for simple_copy. Every precision the plugin
+// handles is 1, 2, 4 or 8 bytes wide, any other width falls back to the byte
+// kernel which is correct for arbitrary sizes.
+inline element_copy_fn element_copy_for_width(size_t data_size) {
+    switch (data_size) {
+        case 2: return element_copy_kernel<uint16_t>;
+        case 4: return element_copy_kernel<uint32_t>;
+        case 8: return element_copy_kernel<uint64_t>;
+        default: return element_copy_kernel<uint8_t>;
+    }
+}
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
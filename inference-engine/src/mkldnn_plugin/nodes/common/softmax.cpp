@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <cfloat>
 #include <ie_parallel.hpp>
 #include "jit_generator.hpp"
 #include "jit_uni_eltwise.hpp"
@@ -14,6 +15,7 @@ using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::utils;
 
 #define GET_OFF(field) offsetof(jit_args_softmax, field)
+#define GET_OFF_DENSE(field) offsetof(jit_args_softmax_dense, field)
 
 struct jit_args_softmax {
     const float* src;
@@ -160,6 +162,383 @@ private:
     std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
 };
 
+struct jit_args_softmax_dense {
+    const float* src;
+    float* dst;
+    const float* mask;
+    float* max;
+    float* sum;
+    size_t work_amount;
+};
+
+struct jit_softmax_dense_config_params {
+    bool log_softmax;
+    bool with_mask;
+    bool finalize;
+};
+
+struct jit_uni_softmax_dense_kernel {
+    void (*ker_)(const jit_args_softmax_dense *);
+
+    void operator()(const jit_args_softmax_dense *args) { assert(ker_); ker_(args); }
+
+    jit_uni_softmax_dense_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_softmax_dense_kernel() {}
+};
+
+// Single-pass softmax/log-softmax over a contiguous row: the optional additive mask is applied
+// on load, exp uses the polynomial approximation of the eltwise injector, max/sum are reduced
+// horizontally in-register. The finalize variant computes dst = src [+ mask] - (max + log(sum))
+// for log-softmax once the host has folded log(sum) into *max.
+template <cpu_isa_t isa>
+struct jit_uni_softmax_dense_kernel_f32 : public jit_uni_softmax_dense_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_dense_kernel_f32)
+
+    explicit jit_uni_softmax_dense_kernel_f32(jit_softmax_dense_config_params jcp)
+            : jit_uni_softmax_dense_kernel(), jit_generator(), jcp_(jcp) {
+        if (!jcp_.finalize)
+            exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, alg_kind::eltwise_exp, 0.f, 0.f));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF_DENSE(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF_DENSE(dst)]);
+        if (jcp_.with_mask)
+            mov(reg_mask, ptr[reg_params + GET_OFF_DENSE(mask)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_DENSE(work_amount)]);
+
+        if (jcp_.finalize)
+            generate_finalize();
+        else
+            generate_main();
+
+        this->postamble();
+
+        if (!jcp_.finalize)
+            exp_injector->prepare_table();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse42, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_mask = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 aux_reg_work_amount = r12;
+    Xbyak::Reg64 aux_reg_src = r13;
+    Xbyak::Reg64 aux_reg_dst = r14;
+    Xbyak::Reg64 aux_reg_mask = r15;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_blend_mask = Vmm(0);
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_max = Vmm(2);
+    Vmm vmm_exp_sum = Vmm(3);
+    Vmm vmm_add_mask = Vmm(4);
+    Xbyak::Xmm xmm_aux1 = Xbyak::Xmm(5);
+    Xbyak::Xmm xmm_aux2 = Xbyak::Xmm(6);
+    Xbyak::Xmm xmm_aux3 = Xbyak::Xmm(7);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    jit_softmax_dense_config_params jcp_;
+
+    // loads the next block of src (plus the additive mask when present) into vmm_v
+    inline void load_value(Vmm vmm_v, Xbyak::Reg64 src, Xbyak::Reg64 mask) {
+        uni_vmovups(vmm_v, ptr[src]);
+        if (jcp_.with_mask) {
+            uni_vmovups(vmm_add_mask, ptr[mask]);
+            uni_vaddps(vmm_v, vmm_v, vmm_add_mask);
+        }
+    }
+
+    // reduces the lanes of xmm_v with op into lane 0 of xmm_aux1
+    inline void hreduce_xmm(Xbyak::Xmm xmm_v, bool is_max) {
+        movshdup(xmm_aux3, xmm_v);
+        if (is_max) maxps(xmm_v, xmm_aux3); else addps(xmm_v, xmm_aux3);
+        movhlps(xmm_aux3, xmm_v);
+        if (is_max) maxps(xmm_v, xmm_aux3); else addps(xmm_v, xmm_aux3);
+        if (xmm_v.getIdx() != xmm_aux1.getIdx())
+            movups(xmm_aux1, xmm_v);
+    }
+
+    inline void hreduce(Vmm vmm_v, bool is_max) {
+        if (isa == sse42) {
+            hreduce_xmm(Xbyak::Xmm(vmm_v.getIdx()), is_max);
+        } else if (isa == avx2) {
+            Xbyak::Ymm ymm_v = Xbyak::Ymm(vmm_v.getIdx());
+            vextractf128(xmm_aux1, ymm_v, 0);
+            vextractf128(xmm_aux2, ymm_v, 1);
+            if (is_max) maxps(xmm_aux1, xmm_aux2); else addps(xmm_aux1, xmm_aux2);
+            hreduce_xmm(xmm_aux1, is_max);
+        } else {
+            Xbyak::Zmm zmm_v = Xbyak::Zmm(vmm_v.getIdx());
+            vextractf32x4(xmm_aux1, zmm_v, 0);
+            vextractf32x4(xmm_aux2, zmm_v, 1);
+            if (is_max) maxps(xmm_aux1, xmm_aux2); else addps(xmm_aux1, xmm_aux2);
+            vextractf32x4(xmm_aux2, zmm_v, 2);
+            vextractf32x4(xmm_aux3, zmm_v, 3);
+            if (is_max) maxps(xmm_aux2, xmm_aux3); else addps(xmm_aux2, xmm_aux3);
+            if (is_max) maxps(xmm_aux1, xmm_aux2); else addps(xmm_aux1, xmm_aux2);
+            hreduce_xmm(xmm_aux1, is_max);
+        }
+    }
+
+    // broadcasts lane 0 of xmm_aux1 into all lanes of vmm_v
+    inline void broadcast_scalar(Vmm vmm_v) {
+        if (isa == sse42) {
+            shufps(xmm_aux1, xmm_aux1, 0);
+            movups(Xbyak::Xmm(vmm_v.getIdx()), xmm_aux1);
+        } else {
+            vbroadcastss(vmm_v, xmm_aux1);
+        }
+    }
+
+    void generate_main() {
+        Xbyak::Label max_loop_label;
+        Xbyak::Label max_loop_end_label;
+        Xbyak::Label exp_loop_label;
+        Xbyak::Label exp_loop_end_label;
+        Xbyak::Label div_loop_label;
+        Xbyak::Label div_loop_end_label;
+
+        mov(aux_reg_work_amount, reg_work_amount);
+        mov(aux_reg_src, reg_src);
+        if (jcp_.with_mask)
+            mov(aux_reg_mask, reg_mask);
+        load_value(vmm_max, aux_reg_src, aux_reg_mask);
+        L(max_loop_label); {
+            cmp(aux_reg_work_amount, 0);
+            jle(max_loop_end_label, T_NEAR);
+
+            load_value(vmm_val, aux_reg_src, aux_reg_mask);
+
+            if (isa == sse42) {
+                uni_vmovups(vmm_blend_mask, vmm_val);
+                uni_vcmpgtps(vmm_blend_mask, vmm_blend_mask, vmm_max);
+                uni_vblendvps(vmm_max, vmm_max, vmm_val, vmm_blend_mask);
+            } else if (isa == avx2) {
+                uni_vcmpgtps(vmm_blend_mask, vmm_val, vmm_max);
+                uni_vblendvps(vmm_max, vmm_max, vmm_val, vmm_blend_mask);
+            } else {
+                vcmpps(k_mask, vmm_val, vmm_max, _cmp_nle_us);
+                vblendmps(vmm_max | k_mask, vmm_max, vmm_val);
+            }
+
+            add(aux_reg_src, vlen);
+            if (jcp_.with_mask)
+                add(aux_reg_mask, vlen);
+            sub(aux_reg_work_amount, 1);
+
+            jmp(max_loop_label, T_NEAR);
+        }
+        L(max_loop_end_label);
+
+        hreduce(vmm_max, true);
+        if (jcp_.log_softmax) {
+            mov(aux_reg_dst, ptr[reg_params + GET_OFF_DENSE(max)]);
+            movss(ptr[aux_reg_dst], xmm_aux1);
+        }
+        broadcast_scalar(vmm_max);
+
+        mov(aux_reg_work_amount, reg_work_amount);
+        mov(aux_reg_src, reg_src);
+        mov(aux_reg_dst, reg_dst);
+        if (jcp_.with_mask)
+            mov(aux_reg_mask, reg_mask);
+        uni_vpxor(vmm_exp_sum, vmm_exp_sum, vmm_exp_sum);
+        L(exp_loop_label); {
+            cmp(aux_reg_work_amount, 0);
+            jle(exp_loop_end_label, T_NEAR);
+
+            load_value(vmm_val, aux_reg_src, aux_reg_mask);
+
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+            exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            uni_vaddps(vmm_exp_sum, vmm_exp_sum, vmm_val);
+
+            // log-softmax is finalized from src, no need to materialize the exponents
+            if (!jcp_.log_softmax) {
+                uni_vmovups(ptr[aux_reg_dst], vmm_val);
+                add(aux_reg_dst, vlen);
+            }
+
+            add(aux_reg_src, vlen);
+            if (jcp_.with_mask)
+                add(aux_reg_mask, vlen);
+            sub(aux_reg_work_amount, 1);
+
+            jmp(exp_loop_label, T_NEAR);
+        }
+        L(exp_loop_end_label);
+
+        hreduce(vmm_exp_sum, false);
+        if (jcp_.log_softmax) {
+            mov(aux_reg_dst, ptr[reg_params + GET_OFF_DENSE(sum)]);
+            movss(ptr[aux_reg_dst], xmm_aux1);
+            return;
+        }
+        broadcast_scalar(vmm_exp_sum);
+
+        mov(aux_reg_work_amount, reg_work_amount);
+        mov(aux_reg_dst, reg_dst);
+        L(div_loop_label); {
+            cmp(aux_reg_work_amount, 0);
+            jle(div_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[aux_reg_dst]);
+
+            uni_vdivps(vmm_val, vmm_val, vmm_exp_sum);
+
+            uni_vmovups(ptr[aux_reg_dst], vmm_val);
+
+            add(aux_reg_dst, vlen);
+            sub(aux_reg_work_amount, 1);
+
+            jmp(div_loop_label, T_NEAR);
+        }
+        L(div_loop_end_label);
+    }
+
+    void generate_finalize() {
+        Xbyak::Label sub_loop_label;
+        Xbyak::Label sub_loop_end_label;
+
+        mov(aux_reg_src, ptr[reg_params + GET_OFF_DENSE(max)]);
+        uni_vbroadcastss(vmm_max, ptr[aux_reg_src]);
+
+        mov(aux_reg_work_amount, reg_work_amount);
+        mov(aux_reg_src, reg_src);
+        mov(aux_reg_dst, reg_dst);
+        if (jcp_.with_mask)
+            mov(aux_reg_mask, reg_mask);
+        L(sub_loop_label); {
+            cmp(aux_reg_work_amount, 0);
+            jle(sub_loop_end_label, T_NEAR);
+
+            load_value(vmm_val, aux_reg_src, aux_reg_mask);
+
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+
+            uni_vmovups(ptr[aux_reg_dst], vmm_val);
+
+            add(aux_reg_src, vlen);
+            add(aux_reg_dst, vlen);
+            if (jcp_.with_mask)
+                add(aux_reg_mask, vlen);
+            sub(aux_reg_work_amount, 1);
+
+            jmp(sub_loop_label, T_NEAR);
+        }
+        L(sub_loop_end_label);
+    }
+};
+
+SoftmaxInnerDim::SoftmaxInnerDim(bool log_softmax) : log_softmax(log_softmax) {
+    auto create_kernels = [&](bool with_mask, std::shared_ptr<jit_uni_softmax_dense_kernel>& main,
+                              std::shared_ptr<jit_uni_softmax_dense_kernel>& finalize) {
+        jit_softmax_dense_config_params jcp = { log_softmax, with_mask, false };
+        if (mayiuse(avx512_common)) {
+            main.reset(new jit_uni_softmax_dense_kernel_f32<avx512_common>(jcp));
+        } else if (mayiuse(avx2)) {
+            main.reset(new jit_uni_softmax_dense_kernel_f32<avx2>(jcp));
+        } else if (mayiuse(sse42)) {
+            main.reset(new jit_uni_softmax_dense_kernel_f32<sse42>(jcp));
+        }
+
+        if (main && log_softmax) {
+            jcp.finalize = true;
+            if (mayiuse(avx512_common)) {
+                finalize.reset(new jit_uni_softmax_dense_kernel_f32<avx512_common>(jcp));
+            } else if (mayiuse(avx2)) {
+                finalize.reset(new jit_uni_softmax_dense_kernel_f32<avx2>(jcp));
+            } else {
+                finalize.reset(new jit_uni_softmax_dense_kernel_f32<sse42>(jcp));
+            }
+        }
+    };
+
+    block_size = 1;
+    if (mayiuse(avx512_common)) {
+        block_size = 16;
+    } else if (mayiuse(avx2)) {
+        block_size = 8;
+    } else if (mayiuse(sse42)) {
+        block_size = 4;
+    }
+
+    create_kernels(false, main_kernel, finalize_kernel);
+    create_kernels(true, main_kernel_masked, finalize_kernel_masked);
+}
+
+void SoftmaxInnerDim::execute(const float *src_data, float *dst_data, int outer_size, int axis_size,
+                              const float *mask_data, size_t mask_stride) {
+    const auto &kernel = mask_data ? main_kernel_masked : main_kernel;
+    const auto &finalize = mask_data ? finalize_kernel_masked : finalize_kernel;
+    // attention and classifier rows are multiples of the vector width; rows with a vector tail
+    // fall back to the scalar path to keep max/sum consistent over the whole row
+    bool use_kernel = kernel && (axis_size % block_size == 0);
+
+    parallel_for(outer_size, [&](int i) {
+        const float *psrc = src_data + i * static_cast<size_t>(axis_size);
+        float *pdst = dst_data + i * static_cast<size_t>(axis_size);
+        const float *pmask = mask_data ? mask_data + i * mask_stride : nullptr;
+
+        if (!use_kernel) {
+            execute_scalar_row(psrc, pdst, pmask, axis_size);
+            return;
+        }
+
+        float max = -FLT_MAX;
+        float exp_sum = 0.0f;
+        auto arg = jit_args_softmax_dense();
+        arg.src = psrc;
+        arg.dst = pdst;
+        arg.mask = pmask;
+        arg.max = &max;
+        arg.sum = &exp_sum;
+        arg.work_amount = static_cast<size_t>(axis_size / block_size);
+        (*kernel)(&arg);
+
+        if (log_softmax) {
+            max += logf(exp_sum);
+            (*finalize)(&arg);
+        }
+    });
+}
+
+void SoftmaxInnerDim::execute_scalar_row(const float *psrc, float *pdst, const float *pmask, int axis_size) {
+    float max = pmask ? psrc[0] + pmask[0] : psrc[0];
+    for (int j = 0; j < axis_size; j++) {
+        float val = pmask ? psrc[j] + pmask[j] : psrc[j];
+        if (val > max) max = val;
+    }
+
+    float exp_sum = 0.0f;
+    for (int j = 0; j < axis_size; j++) {
+        float val = pmask ? psrc[j] + pmask[j] : psrc[j];
+        pdst[j] = expf(val - max);
+        exp_sum += pdst[j];
+    }
+
+    if (log_softmax) {
+        float log_sum = max + logf(exp_sum);
+        for (int j = 0; j < axis_size; j++) {
+            pdst[j] = (pmask ? psrc[j] + pmask[j] : psrc[j]) - log_sum;
+        }
+    } else {
+        for (int j = 0; j < axis_size; j++) {
+            pdst[j] = pdst[j] / exp_sum;
+        }
+    }
+}
+
 SoftmaxGeneric::SoftmaxGeneric() {
     block_size = 1;
     if (mayiuse(avx512_common)) {
@@ -175,6 +554,13 @@ SoftmaxGeneric::SoftmaxGeneric() {
 }
 
 void SoftmaxGeneric::execute(const float *src_data, float *dst_data, int B, int C, int H, int W) {
+    if (H * W == 1) {
+        // no spatial dims to vectorize over: the channels are contiguous, so the fused
+        // inner-dim kernel handles each batch row in a single pass
+        dense_softmax.execute(src_data, dst_data, B, C);
+        return;
+    }
+
     for (int b = 0; b < B; b++) {
         int tail_start = 0;
         if (softmax_kernel) {
@@ -10,6 +10,7 @@
 #include "ie_parallel.hpp"
 
 struct jit_uni_softmax_kernel;
+struct jit_uni_softmax_dense_kernel;
 
 static inline
 void softmax_many_batches(const float *src_data, float *dst_data, int B, int C, int H, int W) {
@@ -35,6 +36,29 @@ void softmax_many_batches(const float *src_data, float *dst_data, int B, int C,
     });
 }
 
+// Fused softmax/log-softmax over the innermost (stride-1) axis: max, exp and normalization are
+// computed in a single kernel call per row with an optional additive mask (attention scores),
+// threaded over the outer dimensions.
+class SoftmaxInnerDim {
+public:
+    explicit SoftmaxInnerDim(bool log_softmax = false);
+
+    // mask_stride is the distance between mask rows in elements; 0 broadcasts one mask row
+    // over all outer rows. mask_data may be nullptr.
+    void execute(const float *src_data, float *dst_data, int outer_size, int axis_size,
+                 const float *mask_data = nullptr, size_t mask_stride = 0);
+
+private:
+    void execute_scalar_row(const float *psrc, float *pdst, const float *pmask, int axis_size);
+
+    bool log_softmax;
+    int block_size;
+    std::shared_ptr<jit_uni_softmax_dense_kernel> main_kernel;
+    std::shared_ptr<jit_uni_softmax_dense_kernel> main_kernel_masked;
+    std::shared_ptr<jit_uni_softmax_dense_kernel> finalize_kernel;
+    std::shared_ptr<jit_uni_softmax_dense_kernel> finalize_kernel_masked;
+};
+
 class SoftmaxGeneric {
 public:
     SoftmaxGeneric();
@@ -44,5 +68,6 @@ public:
 private:
     int block_size;
     std::shared_ptr<jit_uni_softmax_kernel> softmax_kernel;
+    SoftmaxInnerDim dense_softmax;
 };
 
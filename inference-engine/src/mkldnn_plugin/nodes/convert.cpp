@@ -9,12 +9,30 @@
 #include <vector>
 #include "ie_parallel.hpp"
 #include "ie_precision.hpp"
+#include "ie_precision_conversions.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
 class ConvertImpl: public ExtLayerBase {
+    template<typename src_d, typename dst_d>
+    void exec_vectorized(const Blob::CPtr& inputs, Blob::Ptr& outputs,
+                         void (*convert)(const src_d*, dst_d*, size_t)) {
+        const src_d *src_data = inputs->cbuffer().as<src_d *>() +
+                                inputs->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        dst_d* dst_data = outputs->buffer().as<dst_d *>() +
+                          outputs->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        if (inputs->size() != outputs->size())
+            THROW_IE_EXCEPTION << "Input and output buffers have different sizes!";
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(inputs->size(), nthr, ithr, start, end);
+            if (start < end)
+                convert(src_data + start, dst_data + start, end - start);
+        });
+    }
+
     template<typename src_d, typename dst_d>
     void exec_cast(const Blob::CPtr& inputs, Blob::Ptr& outputs) {
         const src_d *src_data = inputs->cbuffer().as<src_d *>() +
@@ -47,6 +65,11 @@ public:
             const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
             dataConfigOut.desc = TensorDesc(layer->outData[0]->getTensorDesc().getPrecision(), out_dims,
                     layer->outData[0]->getTensorDesc().getLayout());
+            // same-width casts are element-wise over identical offsets, so the output may
+            // overwrite the input; the graph keeps the aliasing only when the producer has
+            // a single consumer
+            if (dataIn.desc.getPrecision().size() == dataConfigOut.desc.getPrecision().size())
+                dataConfigOut.inPlace = 0;
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
             confs.push_back(config);
@@ -61,10 +84,10 @@ public:
             auto compare = getPrecisionMask(inputs[0]->getTensorDesc().getPrecision(), outputs[0]->getTensorDesc().getPrecision());
             switch (compare) {
                 case getPrecisionMask(Precision::U8, Precision::FP32):
-                    exec_cast<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs[0], outputs[0]);
+                    exec_vectorized<uint8_t, float>(inputs[0], outputs[0], PrecisionConversions::convertArrayU8ToF32);
                     break;
                 case getPrecisionMask(Precision::FP32, Precision::U8):
-                    exec_cast<PrecisionTrait<Precision::FP32>::value_type, PrecisionTrait<Precision::U8>::value_type>(inputs[0], outputs[0]);
+                    exec_vectorized<float, uint8_t>(inputs[0], outputs[0], PrecisionConversions::convertArrayF32ToU8);
                     break;
                 case getPrecisionMask(Precision::I16, Precision::FP32):
                     exec_cast<PrecisionTrait<Precision::I16>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs[0], outputs[0]);
@@ -3,6 +3,7 @@
 //
 
 #include "base.hpp"
+#include "ctc_greedy_imp.hpp"
 
 #include <cmath>
 #include <vector>
@@ -44,43 +45,7 @@ public:
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
-        }
-
-        for (size_t n = 0; n < N_; ++n) {
-            int prev_class_idx = -1;
-            size_t output_index = n*T_;
-
-            for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
-                int max_class_idx = 0;
-
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (size_t c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = static_cast<int>(c);
-                        max_prob = *probs;
-                    }
-                }
-
-                if (max_class_idx < static_cast<int>(C_) - 1 &&
-                        max_class_idx != prev_class_idx) {
-                    output_sequences[output_index] = static_cast<float>(max_class_idx);
-                    output_index++;
-                }
-
-                prev_class_idx = max_class_idx;
-
-                if (t + 1 == static_cast<int>(T_) || sequence_indicators[(t + 1)*N_ + n] == 0) {
-                    break;
-                }
-            }
-        }
+        XARCH::ctc_greedy_decode(probabilities, sequence_indicators, output_sequences, T_, N_, C_);
         return OK;
     }
 };
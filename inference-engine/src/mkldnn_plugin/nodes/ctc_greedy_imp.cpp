@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ctc_greedy_imp.hpp"
+
+#include <ie_parallel.hpp>
+#include "nodes/common/arg_max_row.h"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+void ctc_greedy_decode(const float* probabilities, const float* sequence_indicators,
+                       float* output_sequences, size_t T, size_t N, size_t C) {
+    // every batch element owns the contiguous output range [n*T, (n+1)*T) and
+    // reads its own probability rows only, so the decode is embarrassingly
+    // parallel over the batch
+    parallel_for(N, [&](size_t n) {
+        float* out = output_sequences + n * T;
+        for (size_t t = 0; t < T; t++)
+            out[t] = -1;
+
+        int prev_class_idx = -1;
+        size_t output_index = 0;
+
+        for (size_t t = 0; /* check at end */; ++t) {
+            // get maximum probability and its index
+            float max_prob;
+            const int max_class_idx =
+                row_arg_max(probabilities + t * C * N + n * C, static_cast<int>(C), max_prob);
+
+            if (max_class_idx < static_cast<int>(C) - 1 && max_class_idx != prev_class_idx) {
+                out[output_index] = static_cast<float>(max_class_idx);
+                output_index++;
+            }
+
+            prev_class_idx = max_class_idx;
+
+            if (t + 1 == T || sequence_indicators[(t + 1) * N + n] == 0) {
+                break;
+            }
+        }
+    });
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
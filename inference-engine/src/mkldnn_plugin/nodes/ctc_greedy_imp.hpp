@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+namespace XARCH {
+
+void ctc_greedy_decode(const float* probabilities, const float* sequence_indicators,
+                       float* output_sequences, size_t T, size_t N, size_t C);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
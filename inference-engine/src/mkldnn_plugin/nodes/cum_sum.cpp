@@ -5,7 +5,9 @@
 #include "list.hpp"
 #include "base.hpp"
 
+#include <algorithm>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include "ie_parallel.hpp"
 #include "ie_precision.hpp"
@@ -139,55 +141,126 @@ private:
 
     template <bool reverse, bool exclusive, typename dataType>
     void cumSum(const dataType *input, dataType *output, const size_t &offset) {
-        std::vector<size_t> iterationRange(numOfDims - 1);
-        size_t j = 0;
+        if (offset == 1)
+            cumSumAlongInnermostAxis<reverse, exclusive>(input, output);
+        else
+            cumSumAcrossInnerDims<reverse, exclusive>(input, output, offset);
+    }
+
+    // Scans logical positions [start, end) of one contiguous row and returns the sum of the
+    // inputs it consumed, so a caller splitting the row into blocks can propagate carries.
+    template <bool reverse, bool exclusive, typename dataType>
+    static dataType scanBlock(const dataType *input, dataType *output, size_t start, size_t end, size_t axisDim) {
+        dataType acc = 0;
+        for (size_t i = start; i < end; i++) {
+            const size_t idx = reverse ? (axisDim - 1 - i) : i;
+            if (exclusive) {
+                output[idx] = acc;
+                acc += input[idx];
+            } else {
+                acc += input[idx];
+                output[idx] = acc;
+            }
+        }
+        return acc;
+    }
+
+    // The scan axis is the innermost one, so every row is contiguous. When the independent rows
+    // alone cannot feed all threads the axis is split into blocks: each block is scanned locally,
+    // the per-block sums are turned into carries with a short sequential scan, and the carries are
+    // added back in a second parallel pass.
+    template <bool reverse, bool exclusive, typename dataType>
+    void cumSumAlongInnermostAxis(const dataType *input, dataType *output) {
+        const size_t axisDim = shape5d[axis];
+        size_t rows = 1;
         for (size_t i = 0; i < shape5d.size(); i++) {
-            if (i == axis)
-                continue;
-            iterationRange[j++] = shape5d[i];
+            if (i != axis)
+                rows *= shape5d[i];
         }
-        parallel_for4d(iterationRange[0], iterationRange[1], iterationRange[2], iterationRange[3], [&](size_t ir0, size_t ir1, size_t ir2, size_t ir3) {
-            std::vector<size_t> forStartOffset;
-            forStartOffset.push_back(ir0); forStartOffset.push_back(ir1); forStartOffset.push_back(ir2); forStartOffset.push_back(ir3);
-            forStartOffset.insert(forStartOffset.begin() + axis, 0);
-            size_t startOffset = getStartOffset(forStartOffset);
 
-            const dataType *inputStart = input + startOffset;
-            dataType *outputStart = output + startOffset;
+        // splitting the axis re-associates the additions, which is exact for int32 and within the
+        // usual tolerance for fp32; the remaining types keep the original summation order
+        const bool splittable = std::is_same<dataType, float>::value || std::is_same<dataType, int32_t>::value;
+        const size_t nthr = parallel_get_max_threads();
+        size_t blocks = 1;
+        if (splittable && rows < nthr)
+            blocks = std::min(axisDim, (nthr + rows - 1) / rows);
+        const size_t blockSize = (axisDim + blocks - 1) / blocks;
 
-            if (reverse) {
-                if (exclusive) {
-                    outputStart[offset*(shape5d[axis] - 1)] = 0;
-                    for (int64_t i = shape5d[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[(i+1)*offset] + outputStart[(i+1)*offset];
-                    }
-                } else {
-                    outputStart[offset*(shape5d[axis] - 1)] = inputStart[offset*(shape5d[axis] - 1)];
-                    for (int64_t i = shape5d[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i+1)*offset];
-                    }
-                }
+        if (blocks == 1) {
+            parallel_for(rows, [&](size_t r) {
+                scanBlock<reverse, exclusive>(input + r * axisDim, output + r * axisDim, 0, axisDim, axisDim);
+            });
+            return;
+        }
+
+        std::vector<dataType> blockSums(rows * blocks);
+        parallel_for2d(rows, blocks, [&](size_t r, size_t b) {
+            const size_t start = b * blockSize;
+            const size_t end = std::min(start + blockSize, axisDim);
+            blockSums[r * blocks + b] =
+                    scanBlock<reverse, exclusive>(input + r * axisDim, output + r * axisDim, start, end, axisDim);
+        });
+        parallel_for(rows, [&](size_t r) {
+            dataType carry = 0;
+            for (size_t b = 0; b < blocks; b++) {
+                const dataType next = carry + blockSums[r * blocks + b];
+                blockSums[r * blocks + b] = carry;
+                carry = next;
+            }
+        });
+        parallel_for2d(rows, blocks, [&](size_t r, size_t b) {
+            if (b == 0)
+                return;
+            const dataType carry = blockSums[r * blocks + b];
+            const size_t start = b * blockSize;
+            const size_t end = std::min(start + blockSize, axisDim);
+            dataType *outputRow = output + r * axisDim;
+            for (size_t i = start; i < end; i++)
+                outputRow[reverse ? (axisDim - 1 - i) : i] += carry;
+        });
+    }
+
+    // The scan axis strides over `inner` contiguous elements, so the dependent loop is kept
+    // outermost and each step adds whole slabs elementwise, which vectorizes; parallelism comes
+    // from the outer dims and from chunking the slabs.
+    template <bool reverse, bool exclusive, typename dataType>
+    void cumSumAcrossInnerDims(const dataType *input, dataType *output, size_t inner) {
+        const size_t axisDim = shape5d[axis];
+        size_t outer = 1;
+        for (size_t i = 0; i < axis; i++)
+            outer *= shape5d[i];
+        const size_t innerBlockSize = 1024;  // keeps the two slabs a task touches within L1/L2
+        const size_t innerBlocks = (inner + innerBlockSize - 1) / innerBlockSize;
+
+        parallel_for2d(outer, innerBlocks, [&](size_t o, size_t b) {
+            const size_t wStart = b * innerBlockSize;
+            const size_t wEnd = std::min(wStart + innerBlockSize, inner);
+            const dataType *inputStart = input + o * axisDim * inner;
+            dataType *outputStart = output + o * axisDim * inner;
+
+            const size_t firstIdx = (reverse ? (axisDim - 1) : 0) * inner;
+            if (exclusive) {
+                for (size_t w = wStart; w < wEnd; w++)
+                    outputStart[firstIdx + w] = 0;
             } else {
+                for (size_t w = wStart; w < wEnd; w++)
+                    outputStart[firstIdx + w] = inputStart[firstIdx + w];
+            }
+            for (size_t i = 1; i < axisDim; i++) {
+                const size_t idx = (reverse ? (axisDim - 1 - i) : i) * inner;
+                const size_t prevIdx = (reverse ? (axisDim - i) : (i - 1)) * inner;
                 if (exclusive) {
-                    outputStart[0] = 0;
-                    for (size_t i = 1; i < shape5d[axis]; i++) {
-                        outputStart[i*offset] = inputStart[(i-1)*offset] + outputStart[(i-1)*offset];
-                    }
+                    for (size_t w = wStart; w < wEnd; w++)
+                        outputStart[idx + w] = outputStart[prevIdx + w] + inputStart[prevIdx + w];
                 } else {
-                    outputStart[0] = inputStart[0];
-                    for (size_t i = 1; i < shape5d[axis]; i++) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i-1)*offset];
-                    }
+                    for (size_t w = wStart; w < wEnd; w++)
+                        outputStart[idx + w] = outputStart[prevIdx + w] + inputStart[idx + w];
                 }
             }
         });
     }
 
-    size_t getStartOffset(std::vector<size_t> &forStartOffset) {
-        return forStartOffset[N]*shape5d[C]*shape5d[D]*shape5d[H]*shape5d[W] + forStartOffset[C]*shape5d[D]*shape5d[H]*shape5d[W] +
-               forStartOffset[D]*shape5d[H]*shape5d[W] + forStartOffset[H]*shape5d[W] + forStartOffset[W];
-    }
-
     size_t getAxis(const Blob::CPtr& _axis, const Blob::CPtr& _data) {
         const auto& axisPrecision = _axis->getTensorDesc().getPrecision();
         const int64_t dataShapeSize = static_cast<int64_t>(_data->getTensorDesc().getDims().size());
@@ -5,6 +5,7 @@
 #include "base.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
@@ -70,6 +71,30 @@ public:
             if (supported_precision_sizes.find(computePrc.size()) == supported_precision_sizes.end())
                 THROW_IE_EXCEPTION << "DepthToSpace layer with name '" << layer->name << " doesn't support precision: " << computePrc.name();
 
+            if (inDims.size() == 4 && mode == DepthToSpaceMode::BLOCKS_FIRST) {
+                // channel-blocked layouts can be kept when every group of blk output
+                // channels aligns with one lane-ordered group of input channels, which
+                // holds whenever the output channel count is a multiple of the block;
+                // the kernel then moves whole blocks and the reorders around the
+                // neighbouring blocked convolutions disappear
+                for (size_t blkSize : {16, 8}) {
+                    if ((inDims[1] / blockStep) % blkSize)
+                        continue;
+                    LayerConfig config;
+                    DataConfig inConfig;
+                    inConfig.desc = TensorDesc(computePrc, inDims,
+                        {{inDims[0], inDims[1] / blkSize, inDims[2], inDims[3], blkSize}, {0, 1, 2, 3, 1}});
+                    config.inConfs.push_back(inConfig);
+
+                    DataConfig outConfig;
+                    outConfig.desc = TensorDesc(computePrc, outDims,
+                        {{outDims[0], outDims[1] / blkSize, outDims[2], outDims[3], blkSize}, {0, 1, 2, 3, 1}});
+                    config.outConfs.push_back(outConfig);
+
+                    config.dynBatchSupport = false;
+                    confs.push_back(config);
+                }
+            }
 
             if (inDims.size() == 4 || inDims.size() == 5) {
                 LayerConfig config;
@@ -155,6 +180,37 @@ private:
         size_t blockShift = mode == DepthToSpaceMode::BLOCKS_FIRST ? (dstChannels) : 1;
         size_t channelShift = mode == DepthToSpaceMode::BLOCKS_FIRST ? 1 : blockStep;
 
+        if (inputs[0]->getTensorDesc().getLayout() == BLOCKED) {
+            // nChwXc path (4D, blocks_first only): the output channel count is a
+            // multiple of the channel block, so every group of blk output channels is
+            // a lane-aligned copy of a group of input channels and the inner loop
+            // moves whole blocks - a cache line per step for fp32/nChw16c - out of a
+            // contiguous source row
+            const size_t blk = inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims().back();
+            const size_t IH = shape5D[2];
+            const size_t IW = shape5D[3];
+            const size_t OH = IH * blockSize;
+            const size_t OW = IW * blockSize;
+            const size_t srcBlocks = srcChannels / blk;
+            const size_t dstBlocks = dstChannels / blk;
+            parallel_for2d(shape5D[0], dstBlocks, [&](size_t n, size_t cb) {
+                for (size_t oy = 0; oy < OH; oy++) {
+                    const size_t sy = oy / blockSize;
+                    const size_t by = oy % blockSize;
+                    T *dst_row = dst_data + ((n * dstBlocks + cb) * OH + oy) * OW * blk;
+                    for (size_t bx = 0; bx < blockSize; bx++) {
+                        const size_t srcChannel = (by * blockSize + bx) * dstChannels + cb * blk;
+                        const T *src_row = src_data + ((n * srcBlocks + srcChannel / blk) * IH + sy) * IW * blk;
+                        T *dst = dst_row + bx * blk;
+                        for (size_t sx = 0; sx < IW; sx++) {
+                            std::memcpy(dst + sx * blockSize * blk, src_row + sx * blk, blk * sizeof(T));
+                        }
+                    }
+                }
+            });
+            return;
+        }
+
         if (inputs[0]->getTensorDesc().getLayout() == NHWC || inputs[0]->getTensorDesc().getLayout() == NDHWC) {
             parallel_for2d(shape5D[0], shape5D[2], [&](size_t i0, size_t i2) {
                 size_t srcIdx1 = i0 * batchStep;
@@ -170,10 +226,16 @@ private:
                                 for (size_t b4 = 0; b4 < block3D[2]; b4++) {
                                     size_t srcIdx4 = srcIdx3 + i4 * srcChannels + b4 * blockShift;
                                     size_t dstIdx4 = dstIdx3 + (i4 * block3D[2] + b4) * dstChannels;
-                                    for (size_t i1 = 0; i1 < dstChannels; i1++) {
-                                        size_t srcIdx5 = srcIdx4 + i1 * channelShift;
-                                        size_t dstIdx5 = dstIdx4 + i1;
-                                        dst_data[dstIdx5] = src_data[srcIdx5];
+                                    if (channelShift == 1) {
+                                        // blocks_first: the output channel group is a
+                                        // contiguous slice of the input channels
+                                        std::memcpy(dst_data + dstIdx4, src_data + srcIdx4, dstChannels * sizeof(T));
+                                    } else {
+                                        for (size_t i1 = 0; i1 < dstChannels; i1++) {
+                                            size_t srcIdx5 = srcIdx4 + i1 * channelShift;
+                                            size_t dstIdx5 = dstIdx4 + i1;
+                                            dst_data[dstIdx5] = src_data[srcIdx5];
+                                        }
                                     }
                                 }
                             }
@@ -11,6 +11,9 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -162,45 +165,43 @@ public:
             }
         }
 
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                }
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            for (int p = 0; p < _num_priors; ++p) {
+                reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
             }
-        }
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        // Images are independent from here on: every (image, class) pair works on its own slice
+        // of the buffers preallocated in the constructor, so the batch is processed across threads.
+        if (!_decrease_label_id) {
+            // Caffe style
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -208,14 +209,18 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
+            });
+        }
 
+        parallel_for(N, [&](int n) {
+            int detections_total = 0;
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
                 std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                conf_index_class_map.reserve(detections_total);
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -243,7 +248,7 @@ public:
                     detections_data[n*_num_classes + label]++;
                 }
             }
-        }
+        });
 
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
         if (DETECTION_SIZE != 7) {
@@ -430,6 +435,28 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
     }
 
     parallel_for(num_priors_actual[n], [&](int p) {
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        // One whole box fits a 128-bit register in the corner code path of normalized priors,
+        // and the operation order matches the scalar code exactly, so the results stay bit-exact.
+        if (_code_type == CodeType::CORNER && _normalized) {
+            const __m128 prior = _mm_loadu_ps(prior_data + p*4);
+            const __m128 loc = _mm_loadu_ps(loc_data + 4*p*_num_loc_classes);
+            __m128 decoded;
+            if (_variance_encoded_in_target) {
+                decoded = _mm_add_ps(prior, loc);
+            } else {
+                decoded = _mm_add_ps(prior, _mm_mul_ps(_mm_loadu_ps(variance_data + p*4), loc));
+            }
+            if (_clip_before_nms) {
+                // operand order keeps the NaN behavior of (std::max)(0.f, (std::min)(1.f, x))
+                decoded = _mm_max_ps(_mm_min_ps(decoded, _mm_set1_ps(1.0f)), _mm_setzero_ps());
+            }
+            _mm_storeu_ps(decoded_bboxes + p*4, decoded);
+            decoded_bbox_sizes[p] = (decoded_bboxes[p*4 + 2] - decoded_bboxes[p*4 + 0]) *
+                                    (decoded_bboxes[p*4 + 3] - decoded_bboxes[p*4 + 1]);
+            return;
+        }
+#endif
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
@@ -7,13 +7,26 @@
 #include "jit_generator.hpp"
 #include "list.hpp"
 
+#include <algorithm>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::Extensions::Cpu;
 
+static inline void prefetchLine(const void* addr) {
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0);
+#else
+    (void)addr;
+#endif
+}
+
 
 const std::set<size_t> MKLDNNEmbeddingBagSum::_supportedIndicesTypeSize = {sizeof(INT32), sizeof(INT64)};
 
@@ -146,6 +159,17 @@ void MKLDNNEmbeddingBagSum::processData(
 
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
 
+    // the gathered rows are scattered over the table, so each upcoming row is requested a few
+    // iterations ahead of its use; for wide rows only the head is prefetched explicitly and the
+    // hardware prefetcher streams the rest
+    const size_t prefetchDistance = 4lu;
+    const size_t cacheLineSize = 64lu;
+    const size_t prefetchBytes = std::min(_embDepth * sizeof(T), 16lu * cacheLineSize);
+    // bags at least this long are gathered in table order, which turns the random walk into a
+    // monotonic one and saves TLB misses on tables exceeding the LLC; the reordering re-associates
+    // the per-bag sum, which is exact for the integer types and a tolerable rounding change for fp32
+    const size_t minSortedBagSize = 16lu;
+
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
         splitter(outputBagsNum, nthr, ithr, start, end);
@@ -156,6 +180,7 @@ void MKLDNNEmbeddingBagSum::processData(
         const size_t* indices = nullptr;
         size_t weightsIdx = 0lu;
         bool withWeights = _withWeights;
+        std::vector<std::pair<size_t, size_t>> order;
 
         for (size_t obi = start; obi < end; obi++) {
             size_t dstIndex = obi * _embDepth;
@@ -164,37 +189,60 @@ void MKLDNNEmbeddingBagSum::processData(
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
+                const bool sorted = indicesSize >= minSortedBagSize;
+                if (sorted) {
+                    order.resize(indicesSize);
+                    for (size_t j = 0lu; j < indicesSize; j++)
+                        order[j] = std::make_pair(indices[j], weightsIdx + j);
+                    std::sort(order.begin(), order.end());
                 }
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
+                auto rowIndex = [&](size_t j) {
+                    return sorted ? order[j].first : indices[j];
+                };
+                auto rowWeight = [&](size_t j) {
+                    return weightsData[sorted ? order[j].second : (weightsIdx + j)];
+                };
+                auto prefetchRow = [&](size_t j) {
+                    if (j >= indicesSize)
+                        return;
+                    const char* row = reinterpret_cast<const char*>(srcData + rowIndex(j) * _embDepth);
+                    for (size_t b = 0lu; b < prefetchBytes; b += cacheLineSize)
+                        prefetchLine(row + b);
+                };
+
+                for (size_t j = 0lu; j < std::min(prefetchDistance, indicesSize); j++)
+                    prefetchRow(j);
+
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    prefetchRow(inIdx + prefetchDistance);
+                    const size_t rowIdx = rowIndex(inIdx);
+                    if (rowIdx >= inDataDims[0])
                         THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
+                            << "' has invalid embedding bag index: " << rowIdx;
+                    const T* srcRow = srcData + rowIdx * _embDepth;
 
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
+                    if (inIdx == 0lu) {
+                        if (withWeights) {
+                            const T weight = rowWeight(inIdx);
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dstData[dstIndex + i] = srcRow[i] * weight;
+                            }
+                        } else {
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dstData[dstIndex + i] = srcRow[i];
+                            }
                         }
-                        weightsIdx++;
                     } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
+                        if (withWeights) {
+                            const T weight = rowWeight(inIdx);
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dstData[dstIndex + i] += srcRow[i] * weight;
+                            }
+                        } else {
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dstData[dstIndex + i] += srcRow[i];
+                            }
                         }
                     }
                 }
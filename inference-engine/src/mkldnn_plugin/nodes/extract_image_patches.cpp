@@ -6,7 +6,9 @@
 #include "base.hpp"
 #include "details/caseless.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
@@ -187,47 +189,45 @@ public:
         const int64_t IH_IW = IH * IW;
         const int64_t IC_IH_IW = IC * IH_IW;
 
-        const int64_t work_amount = OB;
-
-        auto thread_body = [&](const int ithr, const int nthr) {
-            int64_t start(0lu), end(0lu);
-            splitter(work_amount, nthr, ithr, start, end);
-            if (start >= end)
-                return;
-
-            for (int64_t ob = start; ob < end; ob++) {
-                const int64_t ibICIHIW = ob * IC_IH_IW;
-                const int64_t obOCOHOW = ob * OC_OH_OW;
-                for (int64_t oh = 0; oh < OH; oh++) {
-                    const int64_t obOCOHOWohOW = obOCOHOW + oh * OW;
-                    int64_t ih0 = oh * SH - PT;
-                    for (int64_t ow = 0; ow < OW; ow++) {
-                        const int64_t obOCOHOWohOWow = obOCOHOWohOW + ow;
-                        int64_t iw0 = ow * SW - PL;
-                        int64_t oc = 0;
-
-                        for (int64_t kh = 0; kh < KH; kh++) {
-                            int64_t ihKH = ih0 + kh * RH;
-                            int64_t ibICIHIWihFHIW = ibICIHIW + ihKH * IW;
-                            for (int64_t kw = 0; kw < KW; kw++) {
-                                for (int64_t ic = 0; ic < IC; ic++, oc++) {
-                                    int64_t iwKW = iw0 + kw * RW;
-                                    int64_t dst_idx = obOCOHOWohOWow + oc * OH_OW;
-                                    if (ihKH < 0 || ihKH >= IH || iwKW < 0 || iwKW >= IW) {
-                                        dst_data[dst_idx] = T(0);
-                                    } else {
-                                        int64_t src_idx = ibICIHIWihFHIW + ic * IH_IW + iwKW;
-                                        dst_data[dst_idx] = src_data[src_idx];
-                                    }
-                                }
-                            }
-                        }
+        // Every output channel plane is a strided 2D window over one input channel:
+        // dst[oh][ow] = src[oh * SH + kh * RH - PT][ow * SW + kw * RW - PL] with zero
+        // fill outside the image. Walking the plane row by row keeps the stores unit
+        // stride, so the inner loop vectorizes over the strided loads, and a stride-1
+        // window degenerates into a row memcpy. Planes are independent, hence the
+        // (batch, output channel) collapse below spreads them across the threads.
+        parallel_for2d(OB, OC, [&](int64_t ob, int64_t oc) {
+            const int64_t ic = oc % IC;
+            const int64_t kw = (oc / IC) % KW;
+            const int64_t kh = oc / (IC * KW);
+            const int64_t offH = kh * RH - PT;
+            const int64_t offW = kw * RW - PL;
+
+            const T* src_plane = src_data + ob * IC_IH_IW + ic * IH_IW;
+            T* dst_plane = dst_data + ob * OC_OH_OW + oc * OH_OW;
+
+            // columns whose sampling point ow * SW + offW stays inside the image
+            const int64_t owStart = (offW < 0) ? (-offW + SW - 1) / SW : 0;
+            const int64_t owEnd = (IW <= offW) ? 0 : std::min(OW, (IW - 1 - offW) / SW + 1);
+
+            for (int64_t oh = 0; oh < OH; oh++) {
+                T* dst_row = dst_plane + oh * OW;
+                const int64_t ih = oh * SH + offH;
+                if (ih < 0 || ih >= IH || owStart >= owEnd) {
+                    std::fill(dst_row, dst_row + OW, T(0));
+                    continue;
+                }
+                std::fill(dst_row, dst_row + owStart, T(0));
+                std::fill(dst_row + owEnd, dst_row + OW, T(0));
+                const T* src_row = src_plane + ih * IW + offW;
+                if (SW == 1) {
+                    memcpy(dst_row + owStart, src_row + owStart, (owEnd - owStart) * sizeof(T));
+                } else {
+                    for (int64_t ow = owStart; ow < owEnd; ow++) {
+                        dst_row[ow] = src_row[ow * SW];
                     }
                 }
             }
-        };
-
-        parallel_nt(0, thread_body);
+        });
     }
 
 private:
@@ -10,14 +10,116 @@
 #include <cassert>
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include "ie_parallel.hpp"
-#include "common/simple_copy.h"
+#include "common/element_copy.h"
 #include "common/fp16_utils.h"
+#include "jit_generator.hpp"
+
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+#define GET_OFF(field) offsetof(jit_args_gather, field)
+
+struct jit_args_gather {
+    const int32_t *indexes;
+    const uint8_t *dict;    // dictionary slice of the current outer dim
+    uint8_t *dst;
+    size_t work_amount;     // number of full vector iterations
+};
+
+struct jit_gather_config_params {
+    uint32_t index_range;
+};
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_args_gather *);
+
+    void operator()(const jit_args_gather *args) { assert(ker_); ker_(args); }
+
+    jit_uni_gather_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_gather_kernel() {}
+
+    int simd_w = 0;  // indexes processed per vector iteration
+};
+
+//  Gathers 32-bit dictionary elements with vgatherdps; out of range indexes
+//  produce zeros, matching the clipping of the scalar implementation
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_f32 : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_f32)
+
+    explicit jit_uni_gather_kernel_f32(jit_gather_config_params jcp) : jit_uni_gather_kernel(), jit_generator() {
+        simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+        this->preamble();
+
+        mov(reg_indexes, ptr[reg_params + GET_OFF(indexes)]);
+        mov(reg_dict, ptr[reg_params + GET_OFF(dict)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        mov(reg_tmp_32, jcp.index_range);
+        movd(xmm_range, reg_tmp_32);
+        vpbroadcastd(vmm_range, xmm_range);
+
+        Xbyak::Label gather_loop_label;
+        Xbyak::Label gather_loop_end_label;
+        L(gather_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(gather_loop_end_label, T_NEAR);
+
+            uni_vmovdqu(vmm_index, ptr[reg_indexes]);
+            uni_vpxor(vmm_val, vmm_val, vmm_val);
+            if (isa == avx512_common) {
+                // unsigned compare treats negative indexes as out of range too
+                vpcmpud(k_mask, vmm_index, vmm_range, 1);
+                vgatherdps(vmm_val | k_mask, ptr[reg_dict + vmm_index * sizeof(float)]);
+            } else {
+                // valid = (index_range > index) && (index > -1)
+                vpcmpgtd(vmm_mask, vmm_range, vmm_index);
+                vpcmpeqd(vmm_aux, vmm_aux, vmm_aux);
+                vpcmpgtd(vmm_aux, vmm_index, vmm_aux);
+                vpand(vmm_mask, vmm_mask, vmm_aux);
+                vgatherdps(vmm_val, ptr[reg_dict + vmm_index * sizeof(float)], vmm_mask);
+            }
+            uni_vmovups(ptr[reg_dst], vmm_val);
+
+            add(reg_indexes, simd_w * sizeof(int32_t));
+            add(reg_dst, simd_w * sizeof(float));
+            sub(reg_work_amount, 1);
+            jmp(gather_loop_label, T_NEAR);
+        }
+        L(gather_loop_end_label);
+
+        this->postamble();
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == sse42, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    Xbyak::Reg64 reg_indexes = r8;
+    Xbyak::Reg64 reg_dict = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg32 reg_tmp_32 = r12d;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_index = Vmm(0);
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_mask = Vmm(2);
+    Vmm vmm_aux = Vmm(3);
+    Vmm vmm_range = Vmm(4);
+    Xbyak::Xmm xmm_range = Xbyak::Xmm(4);
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+};
+
 class GatherImpl: public ExtLayerBase {
 public:
     explicit GatherImpl(const CNNLayer* layer) {
@@ -68,6 +170,18 @@ public:
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
             confs.push_back(config);
+
+            //  Embedding-style gathers move one 32-bit element per index and are
+            //  dominated by the indexed loads, which is where vgatherdps pays off
+            if (dataLength == 1 && dataPrecision.size() == sizeof(float)) {
+                jit_gather_config_params jcp;
+                jcp.index_range = static_cast<uint32_t>(indexRange);
+                if (mayiuse(avx512_common)) {
+                    gather_kernel.reset(new jit_uni_gather_kernel_f32<avx512_common>(jcp));
+                } else if (mayiuse(avx2)) {
+                    gather_kernel.reset(new jit_uni_gather_kernel_f32<avx2>(jcp));
+                }
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -92,6 +206,11 @@ public:
     };
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        if (gather_kernel && inputs[GATHER_INDEXES]->getTensorDesc().getPrecision() == Precision::I32) {
+            gatherElementwise(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+            return OK;
+        }
+
         switch (inputs[GATHER_INDEXES]->getTensorDesc().getPrecision()) {
             case Precision::FP32:
                 gather<float, f32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
@@ -110,6 +229,40 @@ public:
     }
 
 private:
+    //  Fast path for 32-bit elements with I32 indexes: the kernel gathers
+    //  simd_w dictionary elements per iteration, the scalar tail is done here
+    void gatherElementwise(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
+        size_t src_indexSize = indexes->size();
+        const int32_t *src_index = indexes->cbuffer().as<const int32_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const uint8_t *src_dataDict = dictionary->cbuffer().as<const uint8_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const size_t simd_w = gather_kernel->simd_w;
+        //  enough indexes per work item to amortize the task overhead
+        const size_t blockSize = 4096;
+        const size_t blocks = (src_indexSize + blockSize - 1) / blockSize;
+
+        parallel_for2d(numDictionaries, blocks, [&](size_t j, size_t b) {
+            const size_t start = b * blockSize;
+            const size_t count = std::min(blockSize, src_indexSize - start);
+            const uint8_t *dict = src_dataDict + j * indexRange * sizeof(int32_t);
+            int32_t *dst = reinterpret_cast<int32_t *>(dst_data) + j * src_indexSize + start;
+
+            jit_args_gather args;
+            args.indexes = src_index + start;
+            args.dict = dict;
+            args.dst = reinterpret_cast<uint8_t *>(dst);
+            args.work_amount = count / simd_w;
+            if (args.work_amount)
+                (*gather_kernel)(&args);
+
+            for (size_t i = (count / simd_w) * simd_w; i < count; i++) {
+                unsigned int idx = static_cast<unsigned int>(src_index[start + i]);
+                dst[i] = (idx < indexRange) ? reinterpret_cast<const int32_t *>(dict)[idx] : 0;
+            }
+        });
+    }
+
     template <typename index_t, class Conversion>
     void gather(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
         size_t src_indexSize = indexes->size();
@@ -117,23 +270,42 @@ private:
         const uint8_t *src_dataDict = dictionary->cbuffer().as<const uint8_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
+        //  the element width is resolved to a typed kernel once here, so the row
+        //  copies below move whole elements instead of guarded single bytes
+        const element_copy_fn copy_row = element_copy_for_width(dictionary->getTensorDesc().getPrecision().size());
+
+        //  Split large slice copies into blocks so that a few huge indexes
+        //  still spread over all threads
+        const size_t copyBlockBytes = 16 * 1024;
+        if (len >= 2 * copyBlockBytes) {
+            const size_t blocks = (len + copyBlockBytes - 1) / copyBlockBytes;
+            parallel_for3d(numDictionaries, src_indexSize, blocks, [&](size_t j, size_t i, size_t b) {
+                unsigned int idx = Conversion()(src_index[i]);
+                const size_t offset = b * copyBlockBytes;
+                const size_t size = std::min(copyBlockBytes, len - offset);
+                const size_t dstOffset = len * (i + j * src_indexSize) + offset;
 
-        parallel_for(src_indexSize, [&](size_t i) {
+                //  Index clipping
+                if (idx < indexRange) {
+                    copy_row(&dst_data[dstOffset], &src_dataDict[len * (idx + j * indexRange) + offset], size);
+                } else {
+                    memset(&dst_data[dstOffset], 0, size);
+                }
+            });
+            return;
+        }
+
+        parallel_for2d(numDictionaries, src_indexSize, [&](size_t j, size_t i) {
             unsigned int idx = Conversion()(src_index[i]);
 
             //  Index clipping
             if (idx < indexRange) {
                 //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    simple_copy(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
-                }
+                copy_row(&dst_data[len * (i + j * src_indexSize)],
+                         &src_dataDict[len * (idx + j * indexRange)],
+                         len);
             } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
-                }
+                memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
             }
         });
     }
@@ -144,6 +316,8 @@ private:
     size_t dataLength = 1;
     const size_t GATHER_DICTIONARY = 0;
     const size_t GATHER_INDEXES = 1;
+
+    std::shared_ptr<jit_uni_gather_kernel> gather_kernel;
 };
 
 
@@ -208,6 +208,13 @@ public:
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
                 }
             }
+
+            // the geometry is fixed at load time, so the bilinear coefficients are
+            // computed once here instead of per output pixel per inference
+            const auto& in_dims = inData->getTensorDesc().getDims();
+            const auto& out_dims = layer->outData[0]->getTensorDesc().getDims();
+            buildCoeffTables(in_dims[2] + pad_beg + pad_end, in_dims[3] + pad_beg + pad_end,
+                             out_dims[2], out_dims[3]);
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -293,6 +300,48 @@ private:
     bool align_corners;
     std::shared_ptr<jit_uni_interp_kernel> interp_kernel;
 
+    // per-axis bilinear coefficients, filled once by buildCoeffTables()
+    std::vector<int> tab_ih0, tab_ih1, tab_iw0, tab_iw1;
+    std::vector<float> tab_h_lambda0, tab_h_lambda1, tab_w_lambda0, tab_w_lambda1;
+
+    void buildCoeffTables(int IH_pad, int IW_pad, int OH_pad, int OW_pad) {
+        float rh;
+        float rw;
+        if (align_corners) {
+            rh = (OH_pad > 1) ? static_cast<float>(IH_pad - 1) / (OH_pad - 1) : 0.0f;
+            rw = (OW_pad > 1) ? static_cast<float>(IW_pad - 1) / (OW_pad - 1) : 0.0f;
+        } else {
+            rh = static_cast<float>(IH_pad) / (OH_pad);
+            rw = static_cast<float>(IW_pad) / (OW_pad);
+        }
+
+        tab_ih0.resize(OH_pad);
+        tab_ih1.resize(OH_pad);
+        tab_h_lambda0.resize(OH_pad);
+        tab_h_lambda1.resize(OH_pad);
+        for (int h = 0; h < OH_pad; h++) {
+            float fh = rh * h;
+            int ih0 = static_cast<int>(fh);
+            tab_ih0[h] = ih0;
+            tab_ih1[h] = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
+            tab_h_lambda0[h] = fh - ih0;
+            tab_h_lambda1[h] = 1.0f - tab_h_lambda0[h];
+        }
+
+        tab_iw0.resize(OW_pad);
+        tab_iw1.resize(OW_pad);
+        tab_w_lambda0.resize(OW_pad);
+        tab_w_lambda1.resize(OW_pad);
+        for (int w = 0; w < OW_pad; w++) {
+            float fw = rw * w;
+            int iw0 = static_cast<int>(fw);
+            tab_iw0[w] = iw0;
+            tab_iw1[w] = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
+            tab_w_lambda0[w] = fw - iw0;
+            tab_w_lambda1[w] = 1.0f - tab_w_lambda0[w];
+        }
+    }
+
     void interpolate(const size_t N, const size_t C,
                      const float *src, const int x1, const int y1,
                      const int IH_pad, const int IW_pad, const size_t IH, const size_t IW,
@@ -305,16 +354,6 @@ private:
             return;
         }
 
-        float rh;
-        float rw;
-        if (align_corners) {
-            rh = (OH_pad > 1) ? static_cast<float>(IH_pad - 1) / (OH_pad - 1) : 0.0f;
-            rw = (OW_pad > 1) ? static_cast<float>(IW_pad - 1) / (OW_pad - 1) : 0.0f;
-        } else {
-            rh = static_cast<float>(IH_pad) / (OH_pad);
-            rw = static_cast<float>(IW_pad) / (OW_pad);
-        }
-
         int block_size = 1;
         if (interp_kernel) {
             if (mayiuse(avx512_common)) {
@@ -332,35 +371,26 @@ private:
         parallel_for3d(N, CH, OH_pad, [&](size_t n, size_t cb, size_t h) {
                     const float *psrc_n_cb = src + n * CB * IH * IW + cb * block_size * IW * IH;  //  n+cb src address
 
-                    // h is output h
-                    float fh = rh * h;
-                    // ih0 is higher input h position
-                    int ih0 = static_cast<int>(fh);
-                    // ih1 is lower input h position
-                    int ih1 = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
-
-                    float h_lambda0 = fh - ih0;  // for lower input h weight
-                    float h_lambda1 = 1.0f - h_lambda0;  // for higher input h weight
+                    // h is output h; ih0/ih1 are the higher/lower input h positions,
+                    // lambdas are the respective weights, all precomputed at load time
+                    float h_lambda0 = tab_h_lambda0[h];
+                    float h_lambda1 = tab_h_lambda1[h];
 
-                    const float *psrc_h0 = psrc_n_cb + (y1 + ih0) * IW * block_size + x1 * block_size;
-                    const float *psrc_h1 = psrc_n_cb + (y1 + ih1) * IW * block_size + x1 * block_size;
+                    const float *psrc_h0 = psrc_n_cb + (y1 + tab_ih0[h]) * IW * block_size + x1 * block_size;
+                    const float *psrc_h1 = psrc_n_cb + (y1 + tab_ih1[h]) * IW * block_size + x1 * block_size;
                     float *pdst_h = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size + x2 * block_size;
 
                     auto arg = jit_args_interp();
                     arg.h_lambda0 = static_cast<float*>(&h_lambda0);
                     arg.h_lambda1 = static_cast<float*>(&h_lambda1);
                     for (int w = 0; w < OW_pad; ++w) {
-                        float fw = rw * w;
-                        int iw0 = static_cast<int>(fw);
-                        int iw1 = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
-
-                        float w_lambda0 = fw - iw0;  // for right input w weight
-                        float w_lambda1 = 1.0f - w_lambda0;  // for left input w weight
+                        float w_lambda0 = tab_w_lambda0[w];  // for right input w weight
+                        float w_lambda1 = tab_w_lambda1[w];  // for left input w weight
 
-                        const float *psrc00 = psrc_h0 + iw0 * block_size;
-                        const float *psrc01 = psrc_h0 + iw1 * block_size;
-                        const float *psrc10 = psrc_h1 + iw0 * block_size;
-                        const float *psrc11 = psrc_h1 + iw1 * block_size;
+                        const float *psrc00 = psrc_h0 + tab_iw0[w] * block_size;
+                        const float *psrc01 = psrc_h0 + tab_iw1[w] * block_size;
+                        const float *psrc10 = psrc_h1 + tab_iw0[w] * block_size;
+                        const float *psrc11 = psrc_h1 + tab_iw1[w] * block_size;
 
                         float *pdst = pdst_h + w * block_size;
 
@@ -395,33 +425,21 @@ private:
             return;
         }
 
-        float rh;
-        float rw;
-        if (align_corners) {
-            rh = (OH_pad > 1) ? static_cast<float>(IH_pad - 1) / (OH_pad - 1) : 0.0f;
-            rw = (OW_pad > 1) ? static_cast<float>(IW_pad - 1) / (OW_pad - 1) : 0.0f;
-        } else {
-            rh = static_cast<float>(IH_pad) / (OH_pad);
-            rw = static_cast<float>(IW_pad) / (OW_pad);
-        }
-
         parallel_for3d(N, C, OH_pad, [&](size_t n, size_t cb, size_t h) {
             const uint8_t *psrc = src + n * C * IH * IW;
 
-            float fh = rh * h;
-            int ih0 = static_cast<int>(fh);
-            int ih1 = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
+            int ih0 = tab_ih0[h];
+            int ih1 = tab_ih1[h];
 
-            float h_lambda0 = fh - ih0;
-            float h_lambda1 = 1.0f - h_lambda0;
+            float h_lambda0 = tab_h_lambda0[h];
+            float h_lambda1 = tab_h_lambda1[h];
 
             for (int w = 0; w < OW_pad; ++w) {
-                float fw = rw * w;
-                int iw0 = static_cast<int>(fw);
-                int iw1 = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
+                int iw0 = tab_iw0[w];
+                int iw1 = tab_iw1[w];
 
-                float w_lambda0 = fw - iw0;
-                float w_lambda1 = 1.0f - w_lambda0;
+                float w_lambda0 = tab_w_lambda0[w];
+                float w_lambda1 = tab_w_lambda1[w];
 
                 dst[n * C * OH * OW + cb * OW * OH + (y2 + h) * OW + (x2 + w)] =
                     h_lambda1 * (w_lambda1 * static_cast<float>(psrc[cb * IW * IH + (y1 + ih0) * IW + (x1 + iw0)]) +
@@ -8,22 +8,45 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
-#define FACTORY_DECLARATION(__prim, __type) \
-    void __prim ## __type(MKLDNNExtensions * extInstance)
+IE_SUPPRESS_DEPRECATED_START
 
-#define FACTORY_CALL(__prim, __type) \
-    __prim ## __type(this)
+#define FACTORY_DECLARATION(__prim, __type) \
+    ILayerImplFactory* __prim ## __type(const CNNLayer* layer);
 
 #define MKLDNN_EXTENSION_NODE(__prim, __type) FACTORY_DECLARATION(__prim, __type)
 # include "list_tbl.hpp"
 #undef MKLDNN_EXTENSION_NODE
 
-MKLDNNExtensions::MKLDNNExtensions() {
-    #define MKLDNN_EXTENSION_NODE(__prim, __type) FACTORY_CALL(__prim, __type)
+namespace {
+
+struct ExtensionNodeDescriptor {
+    const char* type;
+    ILayerImplFactory* (*factory)(const CNNLayer*);
+};
+
+// The table is built at compile time from plain function pointers, so loading the
+// plugin executes no registration code; the factory map is filled from it on the
+// first lookup instead (see MKLDNNExtensions::factories)
+constexpr ExtensionNodeDescriptor extensionNodeTable[] = {
+    #define MKLDNN_EXTENSION_NODE(__prim, __type) { #__type, __prim ## __type },
     # include "list_tbl.hpp"
     #undef MKLDNN_EXTENSION_NODE
+};
+
+}  // namespace
+
+std::map<std::string, ext_factory>& MKLDNNExtensions::factories() {
+    if (!factoriesRegistered) {
+        // emplace keeps any factory added via AddExt before the first lookup
+        for (const auto& node : extensionNodeTable)
+            extensionsHolder->list.emplace(node.type, node.factory);
+        factoriesRegistered = true;
+    }
+    return extensionsHolder->list;
 }
 
+IE_SUPPRESS_DEPRECATED_END
+
 }  // namespace Cpu
 }  // namespace Extensions
 }  // namespace InferenceEngine
@@ -26,16 +26,14 @@ struct ExtensionsHolder {
 
 class MKLDNNExtensions : public IExtension {
 public:
-    MKLDNNExtensions();
-
     StatusCode getPrimitiveTypes(char**& types, unsigned int& size, ResponseDesc* resp) noexcept override {
-        collectTypes(types, size, extensionsHolder->list);
+        collectTypes(types, size, factories());
         return OK;
     }
 
     StatusCode
     getFactoryFor(ILayerImplFactory*& factory, const CNNLayer* cnnLayer, ResponseDesc* resp) noexcept override {
-        auto& factories = extensionsHolder->list;
+        auto& factories = this->factories();
         if (factories.find(cnnLayer->type) == factories.end()) {
             std::string errorMsg = std::string("Factory for ") + cnnLayer->type + " wasn't found!";
             errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
@@ -70,11 +68,16 @@ public:
     }
 
     void AddExt(std::string name, ext_factory factory) {
-        extensionsHolder->list[name] = factory;
+        factories()[name] = factory;
     }
 
 private:
+    // Populates the factory map from the compile-time registration table on the first
+    // lookup, keeping plugin load free of per-node registration work
+    std::map<std::string, ext_factory>& factories();
+
     std::shared_ptr<ExtensionsHolder> extensionsHolder = std::make_shared<ExtensionsHolder>();
+    bool factoriesRegistered = false;
 
     template<class T>
     void collectTypes(char**& types, unsigned int& size, const std::map<std::string, T> &factories) {
@@ -7,10 +7,12 @@
 #include <cmath>
 #include <limits>
 #include <cfloat>
+#include <memory>
 #include <string>
 #include <vector>
 #include <cassert>
 #include "ie_parallel.hpp"
+#include "common/softmax.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -23,12 +25,16 @@ public:
             if (layer->insData.empty() || layer->outData.empty())
                 THROW_IE_EXCEPTION << layer->name << " Incorrect number of input/output edges!";
 
-            if (layer->insData.size() != 1)
+            if (layer->insData.size() != 1 && layer->insData.size() != 2)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges!";
 
             if (layer->insData[0].lock()->getTensorDesc().getPrecision() != Precision::FP32)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect input data tensor precision. Only FP32 is supported!";
 
+            with_mask = layer->insData.size() == 2;
+            if (with_mask && layer->insData[1].lock()->getTensorDesc().getPrecision() != Precision::FP32)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect mask tensor precision. Only FP32 is supported!";
+
             SizeVector dims = layer->insData[0].lock()->getTensorDesc().getDims();
             if (!dims.size())
                 dims = SizeVector(1, 1);
@@ -51,7 +57,30 @@ public:
             for (size_t i = (axis + 1); i < dims.size(); i++)
                 reduced_axis_stride *= dims[i];
 
-            addConfig(layer, { { ConfLayout::PLN, false, 0 } }, { { ConfLayout::PLN, false, 0 } });
+            if (with_mask) {
+                // the additive mask (attention scores) is applied along the reduced axis, either
+                // one row per outer step or a single row broadcast over all of them
+                if (!is_last_dim)
+                    THROW_IE_EXCEPTION << layer->name << " Additive mask is supported for the innermost axis only!";
+
+                size_t mask_size = 1;
+                for (const auto &dim : layer->insData[1].lock()->getTensorDesc().getDims())
+                    mask_size *= dim;
+                if (mask_size == axis_step * reduced_axis_size)
+                    mask_stride = reduced_axis_size;
+                else if (mask_size == reduced_axis_size)
+                    mask_stride = 0;
+                else
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect mask tensor dimensions!";
+            }
+
+            if (is_last_dim)
+                fused_log_softmax.reset(new SoftmaxInnerDim(true));
+
+            if (with_mask)
+                addConfig(layer, { { ConfLayout::PLN, false, 0 }, { ConfLayout::PLN, false, 0 } }, { { ConfLayout::PLN, false, 0 } });
+            else
+                addConfig(layer, { { ConfLayout::PLN, false, 0 } }, { { ConfLayout::PLN, false, 0 } });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -64,16 +93,10 @@ public:
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         if (is_last_dim) {
-            parallel_for(axis_step, [&](size_t i) {
-                float reduce_prod = 0.0f;
-                const float *src_dataPtr = &src_data[i * reduced_axis_size];
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    reduce_prod += expf(src_dataPtr[j]);
-                reduce_prod = logf(reduce_prod);
-                float *dst_dataPtr = reinterpret_cast<float*>(&dst_data[i * reduced_axis_size]);
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    dst_dataPtr[j] = src_dataPtr[j] - reduce_prod;
-            });
+            const float *mask_data = with_mask ? inputs[1]->cbuffer().as<float *>() +
+                inputs[1]->getTensorDesc().getBlockingDesc().getOffsetPadding() : nullptr;
+            fused_log_softmax->execute(src_data, dst_data, static_cast<int>(axis_step),
+                                       static_cast<int>(reduced_axis_size), mask_data, mask_stride);
         } else {
             parallel_for2d(axis_step, reduced_axis_stride, [&](size_t k, size_t i) {
                 float reduce_prod = 0.0f;
@@ -102,6 +125,9 @@ private:
     size_t reduced_axis_stride = 1;
     size_t axis_step = 1;
     bool is_last_dim = false;
+    bool with_mask = false;
+    size_t mask_stride = 0;
+    std::shared_ptr<SoftmaxInnerDim> fused_log_softmax;
 };
 
 REG_FACTORY_FOR(LogSoftmaxImpl, LogSoftmax);
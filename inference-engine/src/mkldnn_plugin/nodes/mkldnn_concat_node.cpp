@@ -16,6 +16,7 @@
 #include "mkldnn_dims.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_memory.h"
+#include "mkldnn_scratch_arena.hpp"
 #include "ie_parallel.hpp"
 #include "mkldnn_conv_node.h"
 #include "mkldnn_quantize_node.h"
@@ -154,7 +155,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    if (axis != 1 || hasEltwise)
+    // In-place concat makes the inputs strided views into the output buffer, which the
+    // descriptors below express for any non-batch axis. The int8 paths stay copy-based for
+    // axis != 1: their NHWC layout and the specialized copy in execute() assume channel
+    // concatenation. Batch axis is excluded to keep the dynamic batch semantics intact.
+    if (axis < 1 || hasEltwise ||
+        (axis != 1 && (outputPrecision == Precision::I8 || outputPrecision == Precision::U8)))
         return;
 
     auto numOfDim = static_cast<size_t>(dstDims.ndims());
@@ -374,7 +380,7 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
                 canOptimize = false;
         }
     }
-    if (hasUnknown && axis == 1) {
+    if (hasUnknown) {
         if (canSelectPrimitive.size() == 1) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(canSelectPrimitive[0]));
             return;
@@ -626,18 +632,31 @@ void MKLDNNConcatNode::execute(mkldnn::stream strm) {
 
         const size_t num_src = getParentEdges().size();
 
-        std::vector<size_t> channels;
-        size_t channels_size = 0;
-        std::vector<const uint8_t*> src_ptrs;
-        std::vector<uint8_t*> dst_ptrs;
+        // the per-source tables live in the graph's per-request arena when one is
+        // attached, so the steady state makes no heap allocation here
+        std::vector<uint8_t> heap_scratch;
+        size_t* channels;
+        const uint8_t** src_ptrs;
+        uint8_t** dst_ptrs;
+        if (scratchArena) {
+            channels = scratchArena->allocate<size_t>(num_src);
+            src_ptrs = scratchArena->allocate<const uint8_t*>(num_src);
+            dst_ptrs = scratchArena->allocate<uint8_t*>(num_src);
+        } else {
+            heap_scratch.resize(num_src * (sizeof(size_t) + sizeof(const uint8_t*) + sizeof(uint8_t*)));
+            channels = reinterpret_cast<size_t*>(heap_scratch.data());
+            src_ptrs = reinterpret_cast<const uint8_t**>(channels + num_src);
+            dst_ptrs = reinterpret_cast<uint8_t**>(src_ptrs + num_src);
+        }
 
+        size_t channels_size = 0;
         for (size_t i = 0; i < num_src; i++) {
             const MKLDNNMemory& src_mem = getParentEdgeAt(i)->getMemory();
             const size_t num_channels = src_mem.GetDims()[1];
 
-            channels.push_back(num_channels);
-            src_ptrs.push_back(reinterpret_cast<const uint8_t*>(src_mem.GetData()));
-            dst_ptrs.push_back(dst_ptr + channels_size);
+            channels[i] = num_channels;
+            src_ptrs[i] = reinterpret_cast<const uint8_t*>(src_mem.GetData());
+            dst_ptrs[i] = dst_ptr + channels_size;
             channels_size += num_channels;
         }
 
@@ -655,6 +655,39 @@ void MKLDNNConvolutionNode::createPrimitive() {
     }
 }
 
+size_t MKLDNNConvolutionNode::getTheoreticalFlops() const {
+    if (weightDims.empty() || getChildEdges().empty())
+        return 0;
+    auto outDims = getChildEdgeAt(0)->getDims();
+    if (outDims.ndims() < 2)
+        return 0;
+
+    size_t outputs = 1;
+    for (int i = 0; i < outDims.ndims(); i++)
+        outputs *= outDims[i];
+    size_t weights = 1;
+    for (auto dim : weightDims)
+        weights *= dim;
+
+    // every output element of a group consumes (IC / group) * kernel weights,
+    // which folds into outputs / OC * total weight elements for any grouping
+    return 2 * (outputs / outDims[1]) * weights;
+}
+
+size_t MKLDNNConvolutionNode::getTheoreticalBytes() const {
+    size_t weights = 1;
+    for (auto dim : weightDims)
+        weights *= dim;
+
+    const auto *selected = getSelectedPrimitiveDescriptor();
+    size_t itemSize = sizeof(float);
+    if (selected != nullptr && !selected->getConfig().inConfs.empty() &&
+        selected->getConfig().inConfs[0].desc.getPrecision() != InferenceEngine::Precision::UNSPECIFIED)
+        itemSize = selected->getConfig().inConfs[0].desc.getPrecision().size();
+
+    return MKLDNNNode::getTheoreticalBytes() + weights * itemSize;
+}
+
 bool MKLDNNConvolutionNode::created() const {
     return getType() == Convolution;
 }
@@ -49,6 +49,9 @@ public:
 
     bool canBeExecutedInInt8();
 
+    size_t getTheoreticalFlops() const override;
+    size_t getTheoreticalBytes() const override;
+
     std::vector<uint8_t> inputZeroPoints;
     std::vector<float> weightsZeroPoints;
     std::vector<int32_t> outputCompensation;
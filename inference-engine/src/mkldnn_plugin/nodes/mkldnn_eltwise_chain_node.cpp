@@ -0,0 +1,255 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_eltwise_chain_node.h"
+#include <ie_layers.h>
+#include <mkldnn.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+
+#include "jit_generator.hpp"
+#include "jit_uni_eltwise.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_eltwise_chain_call_args, field)
+
+// A chain of per-tensor eltwise operations collapsed into a single kernel:
+// each vector is loaded once, passed through every operation register-to-register
+// and stored once, so k fused nodes cost one pass over memory instead of k.
+template <cpu_isa_t isa>
+struct jit_uni_eltwise_chain_kernel_f32 : public jit_uni_eltwise_chain_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_eltwise_chain_kernel_f32)
+
+    explicit jit_uni_eltwise_chain_kernel_f32(const std::vector<MKLDNNEltwiseChainNode::ChainOp> &ops)
+            : jit_uni_eltwise_chain_kernel(), jit_generator() {
+        for (auto &op : ops) {
+            eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                    this, op.alg, op.alpha, op.beta));
+        }
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        int step = vlen / sizeof(float);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_loop_end_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(main_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            for (auto &inj : eltwise_injectors)
+                inj->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            uni_vmovups(ptr[reg_dst], vmm_val);
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(tail_loop_end_label, T_NEAR);
+
+            // the remaining lanes hold leftovers of the last full vector; only
+            // the first lane is stored, so whatever they compute is dropped
+            movss(Xmm(vmm_val.getIdx()), ptr[reg_src]);
+            for (auto &inj : eltwise_injectors)
+                inj->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            movss(ptr[reg_dst], Xmm(vmm_val.getIdx()));
+
+            add(reg_src, sizeof(float));
+            add(reg_dst, sizeof(float));
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_loop_end_label);
+
+        this->postamble();
+
+        for (auto &inj : eltwise_injectors)
+            inj->prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+};
+
+MKLDNNEltwiseChainNode::MKLDNNEltwiseChainNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(layer, eng, cache) {}
+
+bool MKLDNNEltwiseChainNode::isSupportedAlgorithm(mkldnn::algorithm alg) {
+    return alg == eltwise_relu || alg == eltwise_elu || alg == eltwise_tanh || alg == eltwise_logistic ||
+           alg == eltwise_square || alg == eltwise_abs || alg == eltwise_sqrt || alg == eltwise_linear ||
+           alg == eltwise_bounded_relu || alg == eltwise_soft_relu || alg == eltwise_clamp || alg == eltwise_exp ||
+           alg == eltwise_swish;
+}
+
+void MKLDNNEltwiseChainNode::getSupportedDescriptors() {
+    if (ops.empty())
+        THROW_IE_EXCEPTION << "Operation chain is empty for layer " << getName();
+    for (const auto& op : ops) {
+        if (!isSupportedAlgorithm(op.alg))
+            THROW_IE_EXCEPTION << "Unsupported operation in chain for layer " << getName();
+    }
+
+    if (getParentEdges().size() != 1)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+}
+
+void MKLDNNEltwiseChainNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+    for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, format);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, format);
+        if (format != memory::any) {
+            config.inConfs[0].desc = InferenceEngine::TensorDesc(config.inConfs[0].desc.getPrecision(),
+                                                                 config.inConfs[0].desc.getDims(), {
+                                                                         config.inConfs[0].desc.getBlockingDesc().getBlockDims(),
+                                                                         config.inConfs[0].desc.getBlockingDesc().getOrder(),
+                                                                         (std::numeric_limits<size_t>::max)()
+                                                                 });
+            config.outConfs[0].desc = InferenceEngine::TensorDesc(config.outConfs[0].desc.getPrecision(),
+                                                                  config.outConfs[0].desc.getDims(), {
+                                                                          config.outConfs[0].desc.getBlockingDesc().getBlockDims(),
+                                                                          config.outConfs[0].desc.getBlockingDesc().getOrder(),
+                                                                          (std::numeric_limits<size_t>::max)()
+                                                                  });
+        }
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, format);
+    }
+}
+
+void MKLDNNEltwiseChainNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    if (mayiuse(cpu::avx512_common)) {
+        eltwise_chain_kernel.reset(new jit_uni_eltwise_chain_kernel_f32<cpu::avx512_common>(ops));
+    } else if (mayiuse(cpu::avx2)) {
+        eltwise_chain_kernel.reset(new jit_uni_eltwise_chain_kernel_f32<cpu::avx2>(ops));
+    } else if (mayiuse(cpu::sse42)) {
+        eltwise_chain_kernel.reset(new jit_uni_eltwise_chain_kernel_f32<cpu::sse42>(ops));
+    }
+}
+
+void MKLDNNEltwiseChainNode::executeReference(const float* src_ptr, float* dst_ptr, size_t dataSize) {
+    parallel_for(dataSize, [&](size_t i) {
+        float val = src_ptr[i];
+        for (const auto& op : ops) {
+            switch (op.alg) {
+                case eltwise_relu: val = val >= 0.0f ? val : op.alpha * val; break;
+                case eltwise_elu: val = val >= 0.0f ? val : op.alpha * (expf(val) - 1.0f); break;
+                case eltwise_tanh: val = tanhf(val); break;
+                case eltwise_logistic: val = 1.0f / (1.0f + expf(-val)); break;
+                case eltwise_square: val = val * val; break;
+                case eltwise_abs: val = fabsf(val); break;
+                case eltwise_sqrt: val = sqrtf(val); break;
+                case eltwise_linear: val = op.alpha * val + op.beta; break;
+                case eltwise_bounded_relu: val = (std::min)((std::max)(val, 0.0f), op.alpha); break;
+                case eltwise_soft_relu: val = logf(1.0f + expf(val)); break;
+                case eltwise_clamp: val = (std::min)((std::max)(val, op.beta), op.alpha); break;
+                case eltwise_exp: val = expf(val); break;
+                case eltwise_swish: val = val / (1.0f + expf(-op.alpha * val)); break;
+                default: THROW_IE_EXCEPTION << "Unsupported operation in chain for layer " << getName();
+            }
+        }
+        dst_ptr[i] = val;
+    });
+}
+
+void MKLDNNEltwiseChainNode::execute(mkldnn::stream strm) {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const size_t dataSize = srcMemory.GetSize() / sizeof(float) / srcMemory.GetDims()[0] * batchToProcess();
+
+    const auto *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    if (!eltwise_chain_kernel) {
+        executeReference(src_ptr, dst_ptr, dataSize);
+        return;
+    }
+
+    // large enough blocks to amortize task scheduling, small enough to keep all threads busy
+    const size_t blockSize = 16384;
+    const size_t blocksNum = (dataSize + blockSize - 1) / blockSize;
+    parallel_for(blocksNum, [&](size_t b) {
+        const size_t start = b * blockSize;
+
+        jit_eltwise_chain_call_args args;
+        args.src = src_ptr + start;
+        args.dst = dst_ptr + start;
+        args.work_amount = (std::min)(blockSize, dataSize - start);
+        (*eltwise_chain_kernel)(&args);
+    });
+}
+
+bool MKLDNNEltwiseChainNode::created() const {
+    return getType() == EltwiseChain;
+}
+REG_MKLDNN_PRIM_FOR(MKLDNNEltwiseChainNode, EltwiseChain);
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_eltwise_chain_call_args {
+    const float *src;
+    float *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_eltwise_chain_kernel {
+    void (*ker_)(const jit_eltwise_chain_call_args *);
+
+    void operator()(const jit_eltwise_chain_call_args *args) { assert(ker_); ker_(args); }
+
+    jit_uni_eltwise_chain_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_eltwise_chain_kernel() {}
+};
+
+class MKLDNNEltwiseChainNode : public MKLDNNNode {
+public:
+    struct ChainOp {
+        mkldnn::algorithm alg;
+        float alpha;
+        float beta;
+    };
+
+    MKLDNNEltwiseChainNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNEltwiseChainNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    void appendOp(const ChainOp& op) {
+        ops.push_back(op);
+    }
+    const std::vector<ChainOp>& getOps() const {
+        return ops;
+    }
+
+    static bool isSupportedAlgorithm(mkldnn::algorithm alg);
+
+private:
+    void executeReference(const float* src_ptr, float* dst_ptr, size_t dataSize);
+
+    std::vector<ChainOp> ops;
+    std::shared_ptr<jit_uni_eltwise_chain_kernel> eltwise_chain_kernel;
+};
+
+}  // namespace MKLDNNPlugin
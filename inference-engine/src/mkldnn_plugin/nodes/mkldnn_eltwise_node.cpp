@@ -9,13 +9,17 @@
 #include <memory>
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
 #include "mkldnn_quantize_node.h"
+#include "mkldnn_depthwise_node.h"
 #include "mkldnn_activation_node.h"
 #include <map>
 #include "jit_uni_eltwise.hpp"
+#include "jit_uni_depthwise.hpp"
 #include "jit_uni_quantization.hpp"
 
 using namespace mkldnn;
@@ -39,6 +43,9 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             if (post_op.is_eltwise()) {
                 eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
                         this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op.depthwise.alg));
             } else if (post_op.is_quantization()) {
                 quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
                         this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
@@ -97,12 +104,20 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             }
 
             int eltwise_inj_idx = 0;
+            int depthwise_inj_idx = 0;
             int quantization_inj_idx = 0;
             for (int i = 0; i < p.len_; i++) {
                 auto &post_op = p.entry_[i];
                 if (post_op.is_eltwise()) {
                     eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
                     eltwise_inj_idx++;
+                } else if (post_op.is_depthwise()) {
+                    mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                    mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                    add(reg_d_weights, reg_oc_off);
+                    add(reg_d_bias, reg_oc_off);
+                    depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1, reg_d_weights, reg_d_bias);
+                    depthwise_inj_idx++;
                 } else if (post_op.is_quantization()) {
                     bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
                     bool do_rounding = do_dequantization || jep_.dst_dt == data_type::f32 || i != p.len_ - 1;
@@ -153,12 +168,20 @@ struct jit_uni_eltwise_fq_generic : public jit_uni_eltwise_fq_kernel, public jit
             }
 
             int eltwise_inj_idx = 0;
+            int depthwise_inj_idx = 0;
             int quantization_inj_idx = 0;
             for (int i = 0; i < p.len_; i++) {
                 auto &post_op = p.entry_[i];
                 if (post_op.is_eltwise()) {
                     eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
                     eltwise_inj_idx++;
+                } else if (post_op.is_depthwise()) {
+                    mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                    mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                    add(reg_d_weights, reg_oc_off);
+                    add(reg_d_bias, reg_oc_off);
+                    depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1, reg_d_weights, reg_d_bias);
+                    depthwise_inj_idx++;
                 } else if (post_op.is_quantization()) {
                     bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
                     bool do_rounding = do_dequantization || jep_.dst_dt == data_type::f32 || i != p.len_ - 1;
@@ -232,6 +255,7 @@ private:
     Vmm vmm_zero = Vmm(5);
 
     std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
     std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
 
     inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, memory::data_type src_dt) {
@@ -443,8 +467,12 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     if (with_coeffs && eltwiseLayer->coeff.size() != getParentEdges().size())
         THROW_IE_EXCEPTION << "Number of provided coefficients is not equal to number of operands";
 
-    if (with_coeffs && eltwiseLayer->precision != Precision::FP32)
-        THROW_IE_EXCEPTION << "Sum with coefficients supports only FP32 precision";
+    if (with_coeffs && eltwiseLayer->precision != Precision::FP32 &&
+        eltwiseLayer->precision != Precision::I8 && eltwiseLayer->precision != Precision::U8)
+        THROW_IE_EXCEPTION << "Sum with coefficients supports only FP32, I8 and U8 precisions";
+
+    if (with_coeffs && broadcast)
+        THROW_IE_EXCEPTION << "Sum with coefficients doesn't support broadcasting";
 
     sum_scales.clear();
     for (int i = 0; i < getParentEdges().size(); i++)
@@ -635,6 +663,7 @@ void MKLDNNEltwiseNode::initOptimalPrimitiveDescriptor() {
 }
 
 void MKLDNNEltwiseNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
+    int blob_idx = 0;
     mkldnn::post_ops ops;
 
     for (auto &node : fusedWith) {
@@ -645,6 +674,64 @@ void MKLDNNEltwiseNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeight
             continue;
         }
 
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            if (initWeights) {
+                auto* depthwiseLayer = reinterpret_cast<WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+                MKLDNNDims depthwiseDims({static_cast<ptrdiff_t>(rnd_up(getChildEdgeAt(0)->getDims()[1], 16))});
+
+                PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                PostOpsIntBlobMemory[blob_idx]->Create(depthwiseDims, memory::data_type::f32, memory::format::x);
+
+                PostOpsIntBlobMemory[blob_idx]->SetData(memory::data_type::f32, memory::x,
+                                                        depthwiseLayer->_weights->buffer(),
+                                                        depthwiseLayer->_weights->size() *
+                                                        MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                if (depthwiseNode->isBroadcast()) {
+                    float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[0];
+                    for (int i = 1; i < PostOpsIntBlobMemory[blob_idx]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                        static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[i] = broadcastValue;
+                    }
+                }
+
+                if (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift) {
+                    PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                    PostOpsIntBlobMemory[blob_idx + 1]->Create(depthwiseDims, memory::data_type::f32,
+                                                               memory::format::x);
+                    PostOpsIntBlobMemory[blob_idx + 1]->SetData(memory::data_type::f32, memory::x,
+                                                                depthwiseLayer->_biases->buffer(),
+                                                                depthwiseLayer->_biases->size() *
+                                                                MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                    if (depthwiseNode->isBroadcast()) {
+                        float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[0];
+                        for (int i = 1; i < PostOpsIntBlobMemory[blob_idx + 1]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                            static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[i] = broadcastValue;
+                        }
+                    }
+
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx + 1]->GetData());
+
+                    blob_idx += 2;
+                } else {
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         nullptr);
+
+                    blob_idx += 1;
+                }
+            } else {
+                ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                     nullptr,
+                                     nullptr);
+            }
+
+            continue;
+        }
+
         auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
         if (quantizeNode) {
             quantizeNode->appendPostOps(ops);
@@ -696,6 +783,48 @@ void MKLDNNEltwiseNode::offset_in_calc(int *offset, int *dims_in, int *dims_out)
     }
 }
 
+void MKLDNNEltwiseNode::bcast_collapse(int *dims_out, int *dims_in0, int *dims_in1) {
+    // merges neighbouring axes whose broadcast pattern agrees (both inputs full on
+    // both axes, or both broadcast on both axes), so the loop nest below runs over
+    // the fewest, longest axes the pattern allows: a fully elementwise pair
+    // collapses to a single contiguous run and an outer-scalar operand keeps only
+    // the axes the pattern actually distinguishes. Size-1 output axes merge freely.
+    int out[5] = {1, 1, 1, 1, 1}, in0[5] = {1, 1, 1, 1, 1}, in1[5] = {1, 1, 1, 1, 1};
+    auto pattern = [](int d0, int d1) {
+        return (d0 == 1 ? 1 : 0) | (d1 == 1 ? 2 : 0);
+    };
+    int k = 4;
+    out[k] = dims_out[4]; in0[k] = dims_in0[4]; in1[k] = dims_in1[4];
+    for (int i = 3; i >= 0; i--) {
+        const bool mergeable = dims_out[i] == 1 || out[k] == 1 ||
+                pattern(dims_in0[i], dims_in1[i]) == pattern(in0[k], in1[k]);
+        if (mergeable) {
+            out[k] *= dims_out[i]; in0[k] *= dims_in0[i]; in1[k] *= dims_in1[i];
+        } else {
+            k--;
+            out[k] = dims_out[i]; in0[k] = dims_in0[i]; in1[k] = dims_in1[i];
+        }
+    }
+    // the outer axes feed parallel_for4d: when the whole pattern collapsed into the
+    // inner run (e.g. a scalar operand), split the run back into parallel chunks.
+    // Splitting an axis is pattern-preserving: a full input splits with it, a
+    // broadcast input stays broadcast on both halves
+    if (out[0] * out[1] * out[2] * out[3] == 1 && out[4] > 1) {
+        const int target = std::min(out[4], 4 * parallel_get_max_threads());
+        for (int chunks = target; chunks > 1; chunks--) {
+            if (out[4] % chunks == 0) {
+                out[3] = chunks; out[4] /= chunks;
+                in0[3] = (in0[4] == 1) ? 1 : chunks; in0[4] = (in0[4] == 1) ? 1 : in0[4] / chunks;
+                in1[3] = (in1[4] == 1) ? 1 : chunks; in1[4] = (in1[4] == 1) ? 1 : in1[4] / chunks;
+                break;
+            }
+        }
+    }
+    for (int i = 0; i < 5; i++) {
+        dims_out[i] = out[i]; dims_in0[i] = in0[i]; dims_in1[i] = in1[i];
+    }
+}
+
 // Intel C++ Compiler 18.0 for Windows contains bug that doesn't allow to use templates to generate eltwise implementations
 // and to avoid all copypaste below
 template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_add(
@@ -732,6 +861,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_add(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -830,6 +961,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_prod(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -926,6 +1059,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_max(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1024,6 +1159,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_sub(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1122,6 +1259,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_min(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1220,6 +1359,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_div(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1318,6 +1459,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_squared_diff
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1416,6 +1559,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_floor_mod(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1514,6 +1659,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_pow(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1612,6 +1759,8 @@ template <typename T0, typename T1, typename T2> void MKLDNNEltwiseNode::eltwise
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1710,6 +1859,8 @@ template <typename T0, typename T1, typename T2> void MKLDNNEltwiseNode::eltwise
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1808,6 +1959,8 @@ template <typename T0, typename T1, typename T2> void MKLDNNEltwiseNode::eltwise
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -1906,6 +2059,8 @@ template <typename T0, typename T1, typename T2> void MKLDNNEltwiseNode::eltwise
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -2004,6 +2159,8 @@ template <typename T0, typename T1, typename T2> void MKLDNNEltwiseNode::eltwise
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -2102,6 +2259,8 @@ template <typename T0, typename T1, typename T2> void MKLDNNEltwiseNode::eltwise
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -2200,6 +2359,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_and(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -2298,6 +2459,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_or(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -2396,6 +2559,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::eltwise_logical_xor(
         dims_calc(dims_out, child_edge_dims);
         dims_calc(dims_in0, parent0_edge_dims);
         dims_calc(dims_in1, parent1_edge_dims);
+        if (getParentEdges().size() == 2)
+            bcast_collapse(dims_out, dims_in0, dims_in1);
         offset_out_calc(offset_out, dims_out);
         offset_in_calc(offset_in0, dims_in0, dims_out);
         offset_in_calc(offset_in1, dims_in1, dims_out);
@@ -2522,6 +2687,46 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0,
     }
 }
 
+// Sum with per-input coefficients: the operands may be quantized with independent scales,
+// so accumulate in fp32 and round the result back with saturation to the output type
+template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise_scaled_sum(int in0, int in1) {
+    IE_ASSERT(getParentEdges().size() > 1);
+
+    auto& srcMemory0 = getParentEdgeAt(in0)->getMemory();
+    auto& srcMemory1 = getParentEdgeAt(in1)->getMemory();
+    const T0 *src0_ptr = reinterpret_cast<const T0*>(srcMemory0.GetData()) +
+            srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const T1 *src1_ptr = reinterpret_cast<const T1*>(srcMemory1.GetData()) +
+            srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    T0 *dst_ptr = reinterpret_cast<T0*>(getChildEdgeAt(0)->getMemory().GetData()) +
+            getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t dst_data_size = srcMemory0.GetSize() / sizeof(T0) / srcMemory0.GetDims()[0] * batchToProcess();
+
+    auto round_saturate = [](float value) -> T0 {
+        if (!std::is_integral<T0>::value)
+            return static_cast<T0>(value);
+        const float lo = static_cast<float>(std::numeric_limits<T0>::lowest());
+        const float hi = static_cast<float>((std::numeric_limits<T0>::max)());
+        return static_cast<T0>((std::max)(lo, (std::min)(hi, roundf(value))));
+    };
+
+    const float scale0 = sum_scales[in0];
+    const float scale1 = sum_scales[in1];
+    parallel_for(dst_data_size, [&](size_t i) {
+        dst_ptr[i] = round_saturate(scale0 * static_cast<float>(src0_ptr[i]) + scale1 * static_cast<float>(src1_ptr[i]));
+    });
+
+    for (int j = 2; j < getParentEdges().size(); j++) {
+        const T1 *src_ptr = reinterpret_cast<const T1*>(getParentEdgeAt(j)->getMemory().GetData()) +
+                            getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+        const float scale = sum_scales[j];
+        parallel_for(dst_data_size, [&](size_t i) {
+            dst_ptr[i] = round_saturate(static_cast<float>(dst_ptr[i]) + scale * static_cast<float>(src_ptr[i]));
+        });
+    }
+}
+
 void MKLDNNEltwiseNode::jit_eltwise_fq() {
     auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
     auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
@@ -2608,12 +2813,19 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
             if (pi != po) {
                 THROW_IE_EXCEPTION << "If Eltwise node has more than 2 inputs, all inputs and output must have same precision";
             }
-            if (pi == Precision::FP32)
+            bool with_scales = op == EltwiseLayer::Sum && !isUnitScales();
+            if (pi == Precision::FP32 && with_scales)
+                ref_eltwise_scaled_sum<float, float>(0, 1);
+            else if (pi == Precision::FP32)
                 ref_eltwise<float, float>(0, 1);
             else if (pi == Precision::I32)
                 ref_eltwise<int32_t, int32_t>(0, 1);
+            else if (pi == Precision::I8 && with_scales)
+                ref_eltwise_scaled_sum<int8_t, int8_t>(0, 1);
             else if (pi == Precision::I8)
                 ref_eltwise<int8_t, int8_t>(0, 1);
+            else if (pi == Precision::U8 && with_scales)
+                ref_eltwise_scaled_sum<uint8_t, uint8_t>(0, 1);
             else if (pi == Precision::U8)
                 ref_eltwise<uint8_t, uint8_t>(0, 1);
             else
@@ -2635,22 +2847,57 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
                                             op == EltwiseLayer::Greater || op == EltwiseLayer::Greater_equal ||
                                             op == EltwiseLayer::Less || op == EltwiseLayer::Less_equal);
 
+            // Sum with non-unit coefficients keeps quantized operands in their native
+            // precision: the inputs are scaled and accumulated in fp32 without a
+            // dequantize-requantize round-trip through fp32 tensors
+            bool with_scales = op == EltwiseLayer::Sum && !isUnitScales();
+
             if (po == Precision::FP32 && pi0 == po && pi1 == po) {
-                ref_eltwise<float, float>(0, 1);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<float, float>(0, 1);
+                else
+                    ref_eltwise<float, float>(0, 1);
             } else if (po == Precision::FP32 && pi0 == po && pi1 == Precision::I8) {
-                ref_eltwise<float, int8_t>(0, 1);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<float, int8_t>(0, 1);
+                else
+                    ref_eltwise<float, int8_t>(0, 1);
             } else if (po == Precision::FP32 && pi1 == po && pi0 == Precision::I8) {
-                ref_eltwise<float, int8_t>(1, 0);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<float, int8_t>(1, 0);
+                else
+                    ref_eltwise<float, int8_t>(1, 0);
             } else if (po == Precision::FP32 && pi0 == po && pi1 == Precision::U8) {
-                ref_eltwise<float, uint8_t>(0, 1);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<float, uint8_t>(0, 1);
+                else
+                    ref_eltwise<float, uint8_t>(0, 1);
             } else if (po == Precision::FP32 && pi1 == po && pi0 == Precision::U8) {
-                ref_eltwise<float, uint8_t>(1, 0);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<float, uint8_t>(1, 0);
+                else
+                    ref_eltwise<float, uint8_t>(1, 0);
             } else if (po == Precision::I8 && pi0 == po && pi1 == po) {
-                ref_eltwise<int8_t, int8_t>(0, 1);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<int8_t, int8_t>(0, 1);
+                else
+                    ref_eltwise<int8_t, int8_t>(0, 1);
             } else if (po == Precision::I8 && pi0 == po && pi1 == Precision::U8) {
-                ref_eltwise<int8_t, uint8_t>(0, 1);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<int8_t, uint8_t>(0, 1);
+                else
+                    ref_eltwise<int8_t, uint8_t>(0, 1);
             } else if (po == Precision::I8 && pi1 == po && pi0 == Precision::U8) {
-                ref_eltwise<int8_t, uint8_t>(1, 0);
+                if (with_scales)
+                    ref_eltwise_scaled_sum<int8_t, uint8_t>(1, 0);
+                else
+                    ref_eltwise<int8_t, uint8_t>(1, 0);
+            } else if (po == Precision::U8 && pi0 == po && pi1 == po && with_scales) {
+                ref_eltwise_scaled_sum<uint8_t, uint8_t>(0, 1);
+            } else if (po == Precision::U8 && pi0 == po && pi1 == Precision::I8 && with_scales) {
+                ref_eltwise_scaled_sum<uint8_t, int8_t>(0, 1);
+            } else if (po == Precision::U8 && pi1 == po && pi0 == Precision::I8 && with_scales) {
+                ref_eltwise_scaled_sum<uint8_t, int8_t>(1, 0);
             } else if (po == Precision::I32 && pi0 == po && pi1 == po) {
                 ref_eltwise<int32_t, int32_t>(0, 1);
             } else if (po == Precision::U8 && pi0 == Precision::I32 && pi0 == pi1 && is_eltwise_compare_node) {
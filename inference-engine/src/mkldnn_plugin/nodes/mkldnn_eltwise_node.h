@@ -81,10 +81,12 @@ private:
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
     template <typename T0, typename T1> void ref_eltwise(int in0, int in1);
+    template <typename T0, typename T1> void ref_eltwise_scaled_sum(int in0, int in1);
     template <typename T0, typename T1, typename T2> void ref_eltwise2(int in0, int in1);
     void dims_calc(int *dims, const MKLDNNDims &edge_dims, bool channels_first);
     void offset_out_calc(int *offset, int *dims);
     void offset_in_calc(int *offset, int *dims_in, int *dims_out);
+    void bcast_collapse(int *dims_out, int *dims_in0, int *dims_in1);
 
     template <typename T0, typename T1> void eltwise_add(const T0 *src0_ptr, const T1 *src1_ptr, T0 *dst_ptr, size_t dst_data_size);
     template <typename T0, typename T1> void eltwise_prod(const T0 *src0_ptr, const T1 *src1_ptr, T0 *dst_ptr, size_t dst_data_size);
@@ -12,6 +12,7 @@
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -165,10 +166,99 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+bool MKLDNNFullyConnectedNode::canUseSparseWeights() const {
+    if (baseInputsNumber != 1 || !fusedWith.empty() || wScale != nullptr || oScale != nullptr)
+        return false;
+    if (weightsDims.size() != 2)
+        return false;
+
+    auto *fcLayer = dynamic_cast<FullyConnectedLayer *>(getCnnLayer().get());
+    if (fcLayer == nullptr || fcLayer->_weights == nullptr ||
+        fcLayer->_weights->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+    if (withBiases && (fcLayer->_biases == nullptr || fcLayer->_biases->getTensorDesc().getPrecision() != Precision::FP32))
+        return false;
+
+    auto *selectedPD = getSelectedPrimitiveDescriptor();
+    if (selectedPD == nullptr)
+        return false;
+    const auto &config = selectedPD->getConfig();
+    return config.inConfs[0].desc.getPrecision() == Precision::FP32 &&
+           config.outConfs[0].desc.getPrecision() == Precision::FP32;
+}
+
+void MKLDNNFullyConnectedNode::prepareSparseWeights() {
+    // roughly the break-even point of the row-wise CSR kernel against the dense
+    // GEMM: below it the irregular gathers cost more than the skipped multiplies
+    static const float sparsityThreshold = 0.7f;
+
+    auto *fcLayer = dynamic_cast<FullyConnectedLayer *>(getCnnLayer().get());
+    const float *weights = fcLayer->_weights->cbuffer().as<const float *>();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+
+    size_t zeros = 0;
+    for (size_t i = 0; i < OC * IC; i++)
+        if (weights[i] == 0.0f)
+            zeros++;
+    if (static_cast<float>(zeros) < sparsityThreshold * OC * IC)
+        return;
+
+    sparseRowPtr.resize(OC + 1, 0);
+    sparseColIdx.reserve(OC * IC - zeros);
+    sparseValues.reserve(OC * IC - zeros);
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t ic = 0; ic < IC; ic++) {
+            float value = weights[oc * IC + ic];
+            if (value == 0.0f)
+                continue;
+            sparseColIdx.push_back(static_cast<int>(ic));
+            sparseValues.push_back(value);
+        }
+        sparseRowPtr[oc + 1] = static_cast<int>(sparseValues.size());
+    }
+
+    if (withBiases) {
+        const float *biases = fcLayer->_biases->cbuffer().as<const float *>();
+        sparseBias.assign(biases, biases + OC);
+    }
+
+    useSparseWeights = true;
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src_ptr = reinterpret_cast<const float *>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float *>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t MB = batchToProcess();
+
+    parallel_for2d(MB, OC, [&](size_t mb, size_t oc) {
+        const float *src = src_ptr + mb * IC;
+        float acc = sparseBias.empty() ? 0.0f : sparseBias[oc];
+        for (int k = sparseRowPtr[oc]; k < sparseRowPtr[oc + 1]; k++)
+            acc += sparseValues[k] * src[sparseColIdx[k]];
+        dst_ptr[mb * OC + oc] = acc;
+    });
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || useSparseWeights)
         return;
 
+    if (canUseSparseWeights()) {
+        prepareSparseWeights();
+        // the sparse representation replaces the inner product primitive, so the
+        // dense reordered copy of the weights is never materialized
+        if (useSparseWeights)
+            return;
+    }
+
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
@@ -188,6 +278,53 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     }
 }
 
+size_t MKLDNNFullyConnectedNode::getTheoreticalFlops() const {
+    if (weightsDims.empty() || getChildEdges().empty())
+        return 0;
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    size_t outputs = 1;
+    for (int i = 0; i < outDims.ndims(); i++)
+        outputs *= outDims[i];
+    // the sparse path multiplies only by the surviving weights
+    size_t weights = sparseValues.size();
+    if (!useSparseWeights) {
+        weights = 1;
+        for (auto dim : weightsDims)
+            weights *= dim;
+    }
+
+    return 2 * (outputs / weightsDims[0]) * weights;
+}
+
+size_t MKLDNNFullyConnectedNode::getTheoreticalBytes() const {
+    size_t weightsBytes;
+    if (useSparseWeights) {
+        weightsBytes = sparseValues.size() * (sizeof(float) + sizeof(int)) + sparseRowPtr.size() * sizeof(int);
+    } else {
+        size_t weights = 1;
+        for (auto dim : weightsDims)
+            weights *= dim;
+        const auto *selected = getSelectedPrimitiveDescriptor();
+        size_t itemSize = sizeof(float);
+        if (selected != nullptr && !selected->getConfig().inConfs.empty() &&
+            selected->getConfig().inConfs[0].desc.getPrecision() != InferenceEngine::Precision::UNSPECIFIED)
+            itemSize = selected->getConfig().inConfs[0].desc.getPrecision().size();
+        weightsBytes = weights * itemSize;
+    }
+
+    return MKLDNNNode::getTheoreticalBytes() + weightsBytes;
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (useSparseWeights) {
+        executeSparse();
+        return;
+    }
+
+    MKLDNNNode::execute(strm);
+}
+
 void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) {
     int blob_idx = 0;
     mkldnn::post_ops ops;
@@ -19,6 +19,7 @@ public:
 
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -37,6 +38,9 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    size_t getTheoreticalFlops() const override;
+    size_t getTheoreticalBytes() const override;
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -52,6 +56,18 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    // compressed sparse rows over the output channels, built at load time when
+    // the share of zero weights of a plain fp32 2D FC crosses the threshold;
+    // the dense inner product primitive is not created in that case
+    bool canUseSparseWeights() const;
+    void prepareSparseWeights();
+    void executeSparse();
+    bool useSparseWeights = false;
+    std::vector<int> sparseRowPtr;
+    std::vector<int> sparseColIdx;
+    std::vector<float> sparseValues;
+    std::vector<float> sparseBias;
 };
 
 }  // namespace MKLDNNPlugin
@@ -254,6 +254,26 @@ void MKLDNNGemmNode::process_data() {
         beta = 0.f;
     }
 
+    // stacks of small matrices (multi-head attention issues one GEMM per head) gain
+    // little from the internal threading of a single call; dispatching the batch
+    // across the threads instead scales their throughput with the cores. Large
+    // matrices keep the serial loop so each call runs the threaded kernel on the
+    // whole machine
+    const bool parallelBatch = (MB1 * MB2 > 1) && (static_cast<int64_t>(M) * N * K <= 128 * 128 * 128);
+    if (parallelBatch) {
+        parallel_for2d(MB1, MB2, [&](int b1, int b2) {
+            const T0 *a_ptr = src0_ptr + b1 * aOffsets[1] + b2 * aOffsets[0];
+            const T1 *b_ptr = src1_ptr + b1 * bOffsets[1] + b2 * bOffsets[0];
+            float *d_ptr = dst_ptr + (b1 * MB2 + b2) * M * N;
+            if (isThreeInputs) {
+                const float *c_ptr = src2_ptr + b1 * cOffsets[1] + b2 * cOffsets[0];
+                memcpy(d_ptr, c_ptr, M * N * sizeof(float));
+            }
+            process_gemm(transa, transb, M, N, K, alpha, a_ptr, lda, b_ptr, ldb, beta, d_ptr, ldc);
+        });
+        return;
+    }
+
     for (int b1 = 0; b1 < MB1; b1++) {
         const T0 *a_ptr = src0_ptr;
         const T1 *b_ptr = src1_ptr;
@@ -6,6 +6,7 @@
 #include "../mkldnn_extension_utils.h"
 #include <string>
 #include "details/caseless.hpp"
+#include "blob_factory.hpp"
 #include "ie_memcpy.h"
 
 using namespace mkldnn;
@@ -25,6 +26,45 @@ MKLDNNInputNode::MKLDNNInputNode(const InferenceEngine::CNNLayerPtr& layer, cons
     }
 }
 
+void MKLDNNInputNode::replicateConstBlob(const MKLDNNWeightsSharing::Ptr &cache) {
+    if (!constBlob || !cache)
+        return;
+
+    const uint64_t dataHash = cache->GetHashFunc().hash(
+            constBlob->cbuffer().as<const unsigned char *>(), constBlob->byteSize());
+    std::string replicaKey;
+    if (cache->persistentMode()) {
+        // name-independent key, see the matching branch in prepareMemory(): the
+        // replica is shared with every network carrying the same constant
+        replicaKey = "ConstReplica_" + std::string(constBlob->getTensorDesc().getPrecision().name());
+        for (auto dim : constBlob->getTensorDesc().getDims())
+            replicaKey += "_" + std::to_string(dim);
+        replicaKey += "_" + std::to_string(constBlob->byteSize())
+                + "_" + std::to_string(dataHash);
+    } else {
+        replicaKey = "ConstReplica_" + getName()
+                + "_" + std::to_string(constBlob->byteSize())
+                + "_" + std::to_string(dataHash);
+    }
+
+    try {
+        constBlobReplica = cache->findOrCreate(replicaKey, [&] () {
+            // the copy is performed by a stream thread pinned to the target node,
+            // so the pages are first-touched locally
+            MKLDNNMemoryPtr memory = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+            memory->Create(MKLDNNMemoryDesc(constBlob->getTensorDesc()));
+            ie_memcpy(memory->GetData(), constBlob->byteSize(),
+                      constBlob->cbuffer().as<const void *>(), constBlob->byteSize());
+            return memory;
+        }, &getEngine());
+    } catch (const InferenceEngine::details::InferenceEngineException &) {
+        // the tensor cannot be described as an mkldnn memory, keep the shared blob
+        return;
+    }
+
+    constBlob = make_blob_with_precision(constBlob->getTensorDesc(), constBlobReplica->GetData());
+}
+
 void MKLDNNInputNode::getSupportedDescriptors() {
     if (getType() == Input) {
         if (!getParentEdges().empty())
@@ -25,10 +25,17 @@ public:
         isMeanImage = true;
     }
 
+    /**
+     * Replaces the shared constant blob with a copy which is local to the NUMA node
+     * owning the passed cache. The copy is shared between all graphs on that node.
+     */
+    void replicateConstBlob(const MKLDNNWeightsSharing::Ptr &cache);
+
 private:
     InferenceEngine::Precision precision;
 
     InferenceEngine::Blob::Ptr constBlob;
+    MKLDNNMemoryPtr constBlobReplica;
     bool isMeanImage = false;
 };
 
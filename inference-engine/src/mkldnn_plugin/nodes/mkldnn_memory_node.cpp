@@ -50,6 +50,35 @@ const MKLDNNEdgePtr MKLDNNMemoryOutputNode::getChildEdgeAt(size_t idx) const {
     return MKLDNNNode::getChildEdgeAt(idx);
 }
 
+void MKLDNNMemoryOutputNode::createPrimitive() {
+    // Let the producer write straight into the state storage of the paired MemoryInput, so
+    // execute() finds the state already in place and skips the copy. Only the case where this
+    // node is the sole consumer of the producer port is retargeted: sibling consumer edges wrap
+    // the original buffer pointer in memory objects of their own and would keep reading it.
+    if (inputNode == nullptr)
+        return;
+
+    auto srcEdge = getParentEdgeAt(0);
+    auto producer = srcEdge->getParent();
+    if (producer->isConstant() || producer->isInplace())
+        return;
+
+    size_t consumers = 0;
+    for (size_t i = 0; i < producer->getChildEdges().size(); i++) {
+        auto edge = producer->getChildEdgeAt(i);
+        if (!edge->isDropped() && edge->getInputNum() == srcEdge->getInputNum())
+            consumers++;
+    }
+    if (consumers != 1)
+        return;
+
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    if (MKLDNNMemoryDesc(srcEdge->getMemory().GetDescriptor()) != MKLDNNMemoryDesc(dstMemory.GetDescriptor()))
+        return;
+
+    srcEdge->getMemoryPtr()->GetPrimitivePtr()->set_data_handle(dstMemory.GetData());
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -58,6 +87,10 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
+    // the producer was retargeted onto the state storage in createPrimitive()
+    if (src_ptr == dst_ptr)
+        return;
+
     // TODO: this can be eliminated by completely removing MKLDNN memory output NODE, to fuse it with output of prev layer
     memcpy(dst_ptr, src_ptr, srcMemory.GetSize());
 }
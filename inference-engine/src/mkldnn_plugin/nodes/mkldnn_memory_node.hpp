@@ -70,7 +70,7 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     const MKLDNNEdgePtr getChildEdgeAt(size_t idx) const override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override {
         return getType() == MemoryOutput;
@@ -528,7 +528,7 @@ void MKLDNNMVNNode::initSupportedPrimitiveDescriptors() {
             }
         }
 
-        if (fusedWith.empty()) {
+        if (fusedWith.empty() || getParentEdgeAt(0)->getDims().ndims() < 4) {
             if (canBeInplace)
                 config.inConfs[0].inPlace = 0;
             pushDesc(MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()));
@@ -556,8 +556,24 @@ void MKLDNNMVNNode::createPrimitive() {
     jcp.normalize_variance = normalize_variance;
     jcp.across_channels = across_channels;
 
+    // The depthwise post-op injector indexes weights by vector lane while the planar kernel sweeps
+    // the spatial elements of a single channel, so a fused ScaleShift cannot be applied by the jit
+    // post ops on the planar path. It is folded into the per-channel mean/variance scalars in
+    // mvn_pln() instead, and the kernels are built without the depthwise entry.
+    const mkldnn_primitive_attr *kernel_attr = attr.get();
+    if (jcp.planar_layout && !fusedWith.empty()) {
+        mkldnn::post_ops ops;
+        for (auto &node : fusedWith) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+            if (activationNode)
+                ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(), activationNode->getBeta());
+        }
+        planar_attr.set_post_ops(ops);
+        kernel_attr = planar_attr.get();
+    }
+
     if (mayiuse(cpu::avx512_common)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
+        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx512_common>(jcp, *kernel_attr));
 
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
@@ -566,7 +582,7 @@ void MKLDNNMVNNode::createPrimitive() {
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
         }
     } else if (mayiuse(cpu::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx2>(jcp, *kernel_attr));
 
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
@@ -575,7 +591,7 @@ void MKLDNNMVNNode::createPrimitive() {
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
         }
     } else if (mayiuse(cpu::sse42)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::sse42>(jcp, *attr.get()));
+        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::sse42>(jcp, *kernel_attr));
 
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
@@ -744,6 +760,32 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
     size_t C2 = C1 * D;
     size_t C3 = C2 * C;
 
+    // a ScaleShift fused on the planar path is not applied by the jit post ops (see createPrimitive);
+    // its per-channel weights are folded into the scalars of the final normalization sweep below
+    const float* fused_weights_data = nullptr;
+    const float* fused_biases_data = nullptr;
+    if (!fusedWith.empty()) {
+        const auto &p = (*attr.get()).post_ops_;
+        for (int i = 0; i < p.len_; i++) {
+            if (p.entry_[i].is_depthwise()) {
+                fused_weights_data = p.entry_[i].depthwise.weights_data;
+                fused_biases_data = p.entry_[i].depthwise.biases_data;
+            }
+        }
+    }
+
+    auto apply_eltwise_post_ops = [&](float dst_value) {
+        const auto &p = (*attr.get()).post_ops_;
+        for (int i = 0; i < p.len_; i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                //  only eltwise_relu supported
+                if (dst_value < 0) dst_value = 0;
+            }
+        }
+        return dst_value;
+    };
+
     for (size_t b = 0lu; b < N; b++) {
         size_t cb = b * C3;
         if (across_channels) {
@@ -899,10 +941,29 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
                         }
                         variance = 1.f / sqrtf(variance * C2inv + eps);
 
+                        if (fused_weights_data) {
+                            // fold ScaleShift into the sweep: (x - mean') * variance' == ((x - mean) * variance) * w + b
+                            float w = fused_weights_data[c];
+                            float b = fused_biases_data[c];
+                            if (w == 0.f) {
+                                // the normalized value is annihilated, only the (activated) shift remains
+                                float dst_value = apply_eltwise_post_ops(b);
+                                for (size_t tail = 0lu; tail < C2; tail++) {
+                                    dst_data[cc + tail] = dst_value;
+                                }
+                                return;
+                            }
+                            variance *= w;
+                            mean -= b / variance;
+                        }
+
                         // mvn for this channel
                         (*mvn_kernel)(&arg);
                         for (size_t tail = tail_per_channel; tail < C2; tail++) {
-                            dst_data[cc + tail] = (src_data[cc + tail] - mean) * variance;
+                            float dst_value = (src_data[cc + tail] - mean) * variance;
+                            if (!fusedWith.empty())
+                                dst_value = apply_eltwise_post_ops(dst_value);
+                            dst_data[cc + tail] = dst_value;
                         }
                     } else {
                         // mvn for this channel
@@ -932,9 +993,26 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
                         }
                         variance = 1.f / sqrtf(variance * C2inv + eps);
 
+                        if (fused_weights_data) {
+                            float w = fused_weights_data[c];
+                            float b = fused_biases_data[c];
+                            if (w == 0.f) {
+                                float dst_value = apply_eltwise_post_ops(b);
+                                for (size_t tail = 0lu; tail < C2; tail++) {
+                                    dst_data[cc + tail] = dst_value;
+                                }
+                                return;
+                            }
+                            variance *= w;
+                            mean -= b / variance;
+                        }
+
                         // mvn for this channel
                         for (size_t tail = 0lu; tail < C2; tail++) {
-                            dst_data[cc + tail] = (src_data[cc + tail] - mean) * variance;
+                            float dst_value = (src_data[cc + tail] - mean) * variance;
+                            if (!fusedWith.empty())
+                                dst_value = apply_eltwise_post_ops(dst_value);
+                            dst_data[cc + tail] = dst_value;
                         }
                     } else {
                         // mvn for this channel
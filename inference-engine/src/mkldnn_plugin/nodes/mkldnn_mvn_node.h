@@ -98,6 +98,9 @@ private:
     size_t src_data_size, dst_data_size;
 
     mkldnn::primitive_attr attr;
+    // post ops for the planar kernels: same as attr but without the depthwise entry,
+    // which is folded into the per-channel scalars in mvn_pln()
+    mkldnn::primitive_attr planar_attr;
 
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
 
@@ -411,6 +411,29 @@ static void permute_to_0213(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr&
     });
 }
 
+//  permutes of a dense tensor which reduce to a plain 2-D transpose share a cache-blocked
+//  kernel: a 16x16 fp32 tile of both source and destination fits in L1, and threading is
+//  done over macro-tiles so small outer dimensions still scale with the core count
+static const int transpose_tile = 16;
+
+static void transpose2d_tiled(int MB, const float* src_data, float* dst_data, int rows, int cols) {
+    const int row_tiles = div_up(rows, transpose_tile);
+    const int col_tiles = div_up(cols, transpose_tile);
+
+    parallel_for3d(MB, row_tiles, col_tiles, [&](int n, int rt, int ct) {
+        const float* src = src_data + n * rows * cols;
+        float* dst = dst_data + n * rows * cols;
+
+        const int row_end = std::min((rt + 1) * transpose_tile, rows);
+        const int col_end = std::min((ct + 1) * transpose_tile, cols);
+        for (int r = rt * transpose_tile; r < row_end; r++) {
+            for (int c = ct * transpose_tile; c < col_end; c++) {
+                dst[c * rows + r] = src[r * cols + c];
+            }
+        }
+    });
+}
+
 static void permute_to_0312(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
     auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
     auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
@@ -421,13 +444,8 @@ static void permute_to_0312(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr&
     const int H = srcMemPtr->GetDims()[2];
     const int W = srcMemPtr->GetDims()[3];
 
-    parallel_for3d(MB, C, H, [&](int n, int c, int h) {
-        for (int w = 0; w < W; w++) {
-            int src_off = n*C*H*W + c*H*W + h*W + w;
-            int dst_off = n*W*C*H + w*C*H + c*H + h;
-            dst_data[dst_off] = src_data[src_off];
-        }
-    });
+    //  dst[n][w][c][h] = src[n][c][h][w] is a transpose of the (C*H) x W matrix
+    transpose2d_tiled(MB, src_data, dst_data, C * H, W);
 }
 
 template <size_t scale_H = 0, size_t scale_W = 0>
@@ -479,24 +497,8 @@ static void permute_to_3012(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr&
     const int H  = srcMemPtr->GetDims()[2];
     const int W  = srcMemPtr->GetDims()[3];
 
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int w = 0; w < W; w++) {
-        for (int n = 0; n < MB; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                     src_off = n * C * H * W +
-                               c * H * W +
-                               h * W +
-                               w;
-
-                     dst_data[dst_off] = src_data[src_off];
-                     dst_off++;
-                }
-            }
-        }
-    }
+    //  dst[w][n][c][h] = src[n][c][h][w] is a transpose of the (MB*C*H) x W matrix
+    transpose2d_tiled(1, src_data, dst_data, MB * C * H, W);
 }
 
 static void permute_to_021(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
@@ -508,21 +510,8 @@ static void permute_to_021(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr&
     const int C  = srcMemPtr->GetDims()[1];
     const int S  = srcMemPtr->GetDims()[2];
 
-    parallel_for2d(MB, S, [&](int n, int s) {
-        int src_off = 0;
-        int dst_off = 0;
-
-        for (int c = 0; c < C; c++) {
-            src_off = n * C * S +
-                      c * S +
-                      s;
-            dst_off = n * S * C +
-                      s * C +
-                      c;
-
-            dst_data[dst_off] = src_data[src_off];
-        }
-    });
+    //  dst[n][s][c] = src[n][c][s] is a transpose of the C x S matrix
+    transpose2d_tiled(MB, src_data, dst_data, C, S);
 }
 
 static void permute_to_034152(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
@@ -577,6 +566,12 @@ static void permute_to_0132(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr&
     const int H = srcMemPtr->GetDims()[2];
     const int W = srcMemPtr->GetDims()[3];
 
+    if (src_block_size == 1) {
+        //  dst[n][c][w][h] = src[n][c][h][w] is a transpose of the H x W matrix per (n, c)
+        transpose2d_tiled(MB * C, src_data, dst_data, H, W);
+        return;
+    }
+
     parallel_for3d(MB, C/src_block_size, H, [&](int n, int c, int h) {
         for (int w = 0; w < W; w++) {
             int src_off = n*C*H*W + (c*H*W + h*W + w)*src_block_size;
@@ -765,22 +760,8 @@ static void permute_to_02341(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr
     const int DIM3 = srcMemPtr->GetDims()[3];
     const int DIM4 = srcMemPtr->GetDims()[4];
 
-    parallel_for4d(MB, DIM2, DIM3, DIM4, [&](int n, int dim2, int dim3, int dim4) {
-        for (int dim1 = 0; dim1 < DIM1; dim1++) {
-            int src_off = n * DIM1 * DIM2 * DIM3 * DIM4 +
-                          dim1 * DIM2 * DIM3 * DIM4 +
-                          dim2 * DIM3 * DIM4 +
-                          dim3 * DIM4 +
-                          dim4;
-            int dst_off = n * DIM2 * DIM3 * DIM4 * DIM1 +
-                          dim2 * DIM3 * DIM4 * DIM1 +
-                          dim3 * DIM4 * DIM1 +
-                          dim4 * DIM1 +
-                          dim1;
-
-            dst_data[dst_off] = src_data[src_off];
-        }
-    });
+    //  dst[n][d2][d3][d4][d1] = src[n][d1][d2][d3][d4] is a transpose of the DIM1 x (DIM2*DIM3*DIM4) matrix
+    transpose2d_tiled(MB, src_data, dst_data, DIM1, DIM2 * DIM3 * DIM4);
 }
 
 static void permute_to_04123(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
@@ -794,22 +775,8 @@ static void permute_to_04123(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr
     const int DIM3 = srcMemPtr->GetDims()[3];
     const int DIM4 = srcMemPtr->GetDims()[4];
 
-    parallel_for4d(MB, DIM4, DIM1, DIM2, [&](int n, int dim4, int dim1, int dim2) {
-        for (int dim3 = 0; dim3 < DIM3; dim3++) {
-            int src_off = n * DIM1 * DIM2 * DIM3 * DIM4 +
-                          dim1 * DIM2 * DIM3 * DIM4 +
-                          dim2 * DIM3 * DIM4 +
-                          dim3 * DIM4 +
-                          dim4;
-            int dst_off = n * DIM4 * DIM1 * DIM2 * DIM3 +
-                          dim4 * DIM1 * DIM2 * DIM3 +
-                          dim1 * DIM2 * DIM3 +
-                          dim2 * DIM3 +
-                          dim3;
-
-            dst_data[dst_off] = src_data[src_off];
-        }
-    });
+    //  dst[n][d4][d1][d2][d3] = src[n][d1][d2][d3][d4] is a transpose of the (DIM1*DIM2*DIM3) x DIM4 matrix
+    transpose2d_tiled(MB, src_data, dst_data, DIM1 * DIM2 * DIM3, DIM4);
 }
 
 const std::multimap<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDNNPermuteNode::OptimizedCases = {
@@ -52,7 +52,7 @@ void MKLDNNPowerNode::initSupportedPrimitiveDescriptors() {
     config.outConfs.resize(1);
     config.inConfs[0].inPlace = -1;
     config.inConfs[0].constant = false;
-    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].inPlace = canBeInPlace() ? 0 : -1;
     config.outConfs[0].constant = false;
     for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
         config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, format);
@@ -425,6 +425,8 @@ void MKLDNNResampleNode::createPrimitive() {
             blk_size = 8;
         }
     }
+
+    buildIndexTables();
 }
 
 void MKLDNNResampleNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
@@ -596,22 +598,7 @@ void MKLDNNResampleNode::execute(mkldnn::stream strm) {
 // f32 and no fused, f32->input is f32, no fuse->output is f32
 void MKLDNNResampleNode::NearestNeighbor_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int ID, int IH, int IW,
                                              float fx, float fy, float fz, int OD, int OH, int OW) {
-    std::vector<int> index_buffer(OD * OH * OW);
-    for (int oz = 0; oz < OD; oz++) {
-        float iz = oz * fz;
-        int iz_offset = static_cast<int>(std::floor(iz)) * IH * IW;
-        int oz_offset = oz * OH * OW;
-        for (int oy = 0; oy < OH; oy++) {
-            float iy = oy * fy;
-            int iy_offset = static_cast<int>(std::floor(iy)) * IW + iz_offset;
-            int oy_offset = oy * OW + oz_offset;
-            for (int ox = 0; ox < OW; ox++) {
-                float ix = ox * fx;
-                int ix_index = static_cast<int>(std::floor(ix)) + iy_offset;
-                index_buffer[oy_offset + ox] = ix_index;
-            }
-        }
-    }
+    const std::vector<int> &index_buffer = nn_index_planar;
     if (resample_nearest_kernel) {
         parallel_for2d(B, C, [&](size_t b, size_t c) {
             const float *in_ptr = in_ptr_ + IW * IH * ID * C * b + IW * IH * ID * c;
@@ -621,7 +608,7 @@ void MKLDNNResampleNode::NearestNeighbor_PLN(const float *in_ptr_, float *out_pt
             auto arg = jit_resample_call_args();
             arg.src = in_ptr;
             arg.dst = out_ptr;
-            arg.index = static_cast<int*>(&index_buffer[0]);
+            arg.index = index_buffer.data();
             arg.index_stride = blk_size * sizeof(int);
             arg.dst_stride = blk_size * dst_data_size;
             arg.work_amount = OW * OH * OD / blk_size;
@@ -649,21 +636,9 @@ void MKLDNNResampleNode::NearestNeighbor_PLN(const float *in_ptr_, float *out_pt
 template <typename in_data_t, typename out_data_t>
 void MKLDNNResampleNode::NearestNeighbor_BLK(const in_data_t *in_ptr_, out_data_t *out_ptr_, int B, int C, int ID, int IH, int IW,
                                              float fx, float fy, float fz, int OD, int OH, int OW) {
-    std::vector<int> index_d(OD);
-    std::vector<int> index_h(OH);
-    std::vector<int> index_w(OW);
-    for (int oz = 0; oz < OD; oz++) {
-        float iz = oz * fz;
-        index_d[oz] = static_cast<int>(std::floor(iz));
-    }
-    for (int oy = 0; oy < OH; oy++) {
-        float iy = oy * fy;
-        index_h[oy] = static_cast<int>(std::floor(iy));
-    }
-    for (int ox = 0; ox < OW; ox++) {
-        float ix = ox * fx;
-        index_w[ox] = static_cast<int>(std::floor(ix));
-    }
+    const std::vector<int> &index_d = nn_index_d;
+    const std::vector<int> &index_h = nn_index_h;
+    const std::vector<int> &index_w = nn_index_w;
 
     Layout layout = getParentEdgeAt(0)->getDesc().getLayout();
     bool is_nhwc = (layout == NHWC || layout == NDHWC) ? true : false;
@@ -742,10 +717,7 @@ void MKLDNNResampleNode::NearestNeighbor_BLK(const in_data_t *in_ptr_, out_data_
             const in_data_t *in_ptr = in_ptr_ + IW * IH * ID * CB * blk_size * b;
             out_data_t *out_ptr = out_ptr_ + OW * OH * OD * CB * blk_size * b;
             if (resample_nearest_kernel) {
-                std::vector<int> index_w_kernel(OW);
-                for (int ox = 0; ox < OW; ox++) {
-                    index_w_kernel[ox] = index_w[ox] * blk_size * sizeof(in_data_t);
-                }
+                const std::vector<int> &index_w_kernel = nn_index_w_kernel;
                 parallel_for2d(CB, OD, [&](size_t cb, size_t d) {
                     out_data_t *out_ptr_cbd = out_ptr + blk_size * OW * OH * OD * cb + blk_size * OW * OH * d;
                     const in_data_t *in_ptr_cbd = in_ptr +  blk_size * IW * IH * ID * cb + blk_size * IW * IH * index_d[d];
@@ -753,7 +725,7 @@ void MKLDNNResampleNode::NearestNeighbor_BLK(const in_data_t *in_ptr_, out_data_
                     for (int h = 0; h < OH; h++) {  // kernel for blk_size * OW
                         arg.dst = out_ptr_cbd + blk_size * OW * h;
                         arg.src = in_ptr_cbd + blk_size * IW * index_h[h];
-                        arg.index = static_cast<int*>(&(index_w_kernel[0]));
+                        arg.index = index_w_kernel.data();
                         arg.dst_stride = static_cast<size_t>(blk_size * sizeof(out_data_t));
                         arg.index_stride = static_cast<size_t>(1 * sizeof(int));
                         arg.work_amount = static_cast<size_t>(OW);
@@ -798,6 +770,86 @@ static inline float triangleCoeff(float x) {
     return (std::max)(0.0f, 1 - std::abs(x));
 }
 
+MKLDNNResampleNode::LinearCoeffTable MKLDNNResampleNode::buildLinearCoeffs(int in_size, int out_size, float f,
+                                                                           int kernel_width, bool antialias) {
+    LinearCoeffTable table;
+    const float a = 1.0f / (antialias ? f : 1.0f);
+    const int r = (f < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / a));
+    table.stride = 2 * r + 1;
+    table.begin.resize(out_size);
+    table.count.resize(out_size);
+    table.wsum.resize(out_size);
+    table.weights.assign(static_cast<size_t>(out_size) * table.stride, 0.0f);
+    for (int o = 0; o < out_size; o++) {
+        const float i = o * f + f / 2.0f - 0.5f;
+        const int i_r = static_cast<int>(round(i));
+        const int lo = (std::max)(i_r - r, 0);
+        const int hi = (std::min)(i_r + r, in_size - 1);
+        table.begin[o] = lo;
+        table.count[o] = (std::max)(hi - lo + 1, 0);
+        float wsum = 0.0f;
+        for (int p = lo; p <= hi; p++) {
+            const float w = a * triangleCoeff(a * (i - p));
+            table.weights[o * table.stride + (p - lo)] = w;
+            wsum += w;
+        }
+        table.wsum[o] = wsum;
+    }
+    return table;
+}
+
+void MKLDNNResampleNode::buildIndexTables() {
+    SizeVector src_dim = getParentEdgeAt(0)->getDesc().getDims();
+    SizeVector dst_dim = getChildEdgeAt(0)->getDesc().getDims();
+
+    size_t dims_size = src_dim.size();
+    int ID = (dims_size == 5) ? src_dim[dims_size - 3] : 1;
+    int IH = src_dim[dims_size - 2];
+    int IW = src_dim[dims_size - 1];
+
+    int OD = (dims_size == 5) ? dst_dim[dims_size - 3] : 1;
+    int OH = dst_dim[dims_size - 2];
+    int OW = dst_dim[dims_size - 1];
+
+    float fx = static_cast<float>(IW) / static_cast<float>(OW);
+    float fy = static_cast<float>(IH) / static_cast<float>(OH);
+    float fz = static_cast<float>(ID) / static_cast<float>(OD);
+
+    if (type == "caffe.ResampleParameter.NEAREST") {
+        nn_index_d.resize(OD);
+        nn_index_h.resize(OH);
+        nn_index_w.resize(OW);
+        for (int oz = 0; oz < OD; oz++)
+            nn_index_d[oz] = static_cast<int>(std::floor(oz * fz));
+        for (int oy = 0; oy < OH; oy++)
+            nn_index_h[oy] = static_cast<int>(std::floor(oy * fy));
+        for (int ox = 0; ox < OW; ox++)
+            nn_index_w[ox] = static_cast<int>(std::floor(ox * fx));
+
+        // flat source index of every output element of one channel for the planar
+        // path, and per-ox byte offsets for the blocked jit kernel
+        nn_index_planar.resize(static_cast<size_t>(OD) * OH * OW);
+        for (int oz = 0; oz < OD; oz++) {
+            for (int oy = 0; oy < OH; oy++) {
+                int i_offset = nn_index_d[oz] * IH * IW + nn_index_h[oy] * IW;
+                int o_offset = oz * OH * OW + oy * OW;
+                for (int ox = 0; ox < OW; ox++)
+                    nn_index_planar[o_offset + ox] = i_offset + nn_index_w[ox];
+            }
+        }
+        nn_index_w_kernel.resize(OW);
+        for (int ox = 0; ox < OW; ox++)
+            nn_index_w_kernel[ox] = nn_index_w[ox] * blk_size * static_cast<int>(src_data_size);
+    } else if (type == "caffe.ResampleParameter.LINEAR") {
+        const int kernel_width = 2;
+        bool isDownsample = (fx > 1) || (fy > 1) || (fz > 1);
+        bool aa = isDownsample && antialias;
+        linear_coeffs_w = buildLinearCoeffs(IW, OW, fx, kernel_width, aa);
+        linear_coeffs_h = buildLinearCoeffs(IH, OH, fy, kernel_width, aa);
+        linear_coeffs_d = buildLinearCoeffs(ID, OD, fz, kernel_width, aa);
+    }
+}
+
 template <typename in_data_t, typename out_data_t>
 void MKLDNNResampleNode::LinearInterpolation(const in_data_t *in_ptr_, out_data_t *out_ptr_, int B, int C, int ID, int IH, int IW,
                                              float fx, float fy, float fz, int OD, int OH, int OW, int kernel_width, bool antialias) {
@@ -810,79 +862,56 @@ void MKLDNNResampleNode::LinearInterpolation(const in_data_t *in_ptr_, out_data_
         return;
     }
 
-    for (size_t b = 0; b < B; b++) {
-        const in_data_t *in_ptr_n = in_ptr_ + IW * IH * ID * C * b;
-        out_data_t *out_ptr_n = out_ptr_ + OW * OH * OD * C * b;
-        for (size_t c = 0; c < C; c++) {
-            const in_data_t *in_ptr_nc = in_ptr_n + IW * IH * ID * c;
-            out_data_t *out_ptr_nc = out_ptr_n + OW * OH * OD * c;
-
-            for (size_t oz = 0; oz < OD; oz++) {
-                out_data_t *out_ptr_ncd = out_ptr_nc + OW * OH * oz;
-                for (size_t oy = 0; oy < OH; oy++) {
-                    out_data_t *out_ptr_ncdh = out_ptr_ncd + OW * oy;
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fx / 2.0f - 0.5f;
-                        float iy = oy * fy + fy / 2.0f - 0.5f;
-                        float iz = oz * fz + fz / 2.0f - 0.5f;
-
-                        int ix_r = static_cast<int>(round(ix));
-                        int iy_r = static_cast<int>(round(iy));
-                        int iz_r = static_cast<int>(round(iz));
-
-                        float sum = 0;
-                        float wsum = 0;
-
-                        float ax = 1.0f / (antialias ? fx : 1.0f);
-                        float ay = 1.0f / (antialias ? fy : 1.0f);
-                        float az = 1.0f / (antialias ? fz : 1.0f);
-
-                        int rx = (fx < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ax));
-                        int ry = (fy < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ay));
-                        int rz = (fz < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / az));
-
-                        for (int z = iz_r - rz; z <= iz_r + rz; z++) {
-                            for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                                for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                                    bool is_continue =  z < 0                     ||
-                                                        y < 0                     ||
-                                                        x < 0                     ||
-                                                        z >= static_cast<int>(ID) ||
-                                                        y >= static_cast<int>(IH) ||
-                                                        x >= static_cast<int>(IW);
-                                    if (is_continue)
-                                        continue;
-
-                                    float dx = ix - x;
-                                    float dy = iy - y;
-                                    float dz = iz - z;
-
-                                    float w = ax * triangleCoeff(ax * dx) *
-                                              ay * triangleCoeff(ay * dy) *
-                                              az * triangleCoeff(az * dz);
-
-                                    sum += w * static_cast<float>(in_ptr_nc[z * IH * IW + y * IW + x]);
-                                    wsum += w;
-                                }
-                            }
-                        }
-                        if (!wsum) {
-                            out_ptr_ncdh[ox] = 0;
-                        } else {
-                            float dst_value = sum / wsum;
-                            if (output_prec == Precision::FP32) {
-                                out_ptr_ncdh[ox] = dst_value;
-                            } else if (output_prec == Precision::U8) {
-                                out_ptr_ncdh[ox] = (dst_value >= 0) ? lroundf(dst_value) : 0;
-                            } else if (output_prec == Precision::I8) {
-                                out_ptr_ncdh[ox] = lroundf(dst_value);
+    const LinearCoeffTable &tx = linear_coeffs_w;
+    const LinearCoeffTable &ty = linear_coeffs_h;
+    const LinearCoeffTable &tz = linear_coeffs_d;
+
+    // The taps are separable, so the per-pixel weight recomputation of the old code
+    // collapses into table lookups: the x taps are accumulated over contiguous input
+    // and the partial sums are scaled by the precomputed y and z weights
+    parallel_for2d(B, C, [&](size_t b, size_t c) {
+        const in_data_t *in_ptr_nc = in_ptr_ + IW * IH * ID * C * b + IW * IH * ID * c;
+        out_data_t *out_ptr_nc = out_ptr_ + OW * OH * OD * C * b + OW * OH * OD * c;
+
+        for (int oz = 0; oz < OD; oz++) {
+            out_data_t *out_ptr_ncd = out_ptr_nc + OW * OH * oz;
+            for (int oy = 0; oy < OH; oy++) {
+                out_data_t *out_ptr_ncdh = out_ptr_ncd + OW * oy;
+                for (int ox = 0; ox < OW; ox++) {
+                    const float wsum = tz.wsum[oz] * ty.wsum[oy] * tx.wsum[ox];
+                    if (!wsum) {
+                        out_ptr_ncdh[ox] = 0;
+                        continue;
+                    }
+
+                    float sum = 0;
+                    for (int z = 0; z < tz.count[oz]; z++) {
+                        const float wz = tz.weights[oz * tz.stride + z];
+                        const in_data_t *in_ptr_z = in_ptr_nc + (tz.begin[oz] + z) * IH * IW;
+                        for (int y = 0; y < ty.count[oy]; y++) {
+                            const float wzy = wz * ty.weights[oy * ty.stride + y];
+                            const in_data_t *in_ptr_zy = in_ptr_z + (ty.begin[oy] + y) * IW + tx.begin[ox];
+                            const float *wx = &tx.weights[ox * tx.stride];
+                            float acc = 0;
+                            for (int x = 0; x < tx.count[ox]; x++) {
+                                acc += wx[x] * static_cast<float>(in_ptr_zy[x]);
                             }
+                            sum += wzy * acc;
                         }
                     }
+
+                    float dst_value = sum / wsum;
+                    if (output_prec == Precision::FP32) {
+                        out_ptr_ncdh[ox] = dst_value;
+                    } else if (output_prec == Precision::U8) {
+                        out_ptr_ncdh[ox] = (dst_value >= 0) ? lroundf(dst_value) : 0;
+                    } else if (output_prec == Precision::I8) {
+                        out_ptr_ncdh[ox] = lroundf(dst_value);
+                    }
                 }
             }
         }
-    }
+    });
 }
 
 inline void MKLDNNResampleNode::apply_post_ops_scalar(float &dst_value, int index_c) {
@@ -89,6 +89,20 @@ private:
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
     inline void apply_post_ops_scalar(float &dst_value, int index_c);
 
+    // Per-axis linear interpolation coefficients. The geometry is fixed at load
+    // time, so the taps are computed once in createPrimitive() instead of per
+    // output pixel per inference.
+    struct LinearCoeffTable {
+        int stride = 0;                  // allocated taps per output element
+        std::vector<int> begin;          // first in-bounds input coordinate
+        std::vector<int> count;          // number of in-bounds taps
+        std::vector<float> weights;      // taps, stride entries per output element
+        std::vector<float> wsum;         // sum of the in-bounds taps
+    };
+
+    void buildIndexTables();
+    LinearCoeffTable buildLinearCoeffs(int in_size, int out_size, float f, int kernel_width, bool antialias);
+
     int blk_size;
 
     std::string type;
@@ -102,6 +116,17 @@ private:
     size_t src_data_size, dst_data_size;
 
     std::shared_ptr<jit_uni_resample_nearest_kernel> resample_nearest_kernel;
+
+    // nearest-neighbor index tables, filled in createPrimitive()
+    std::vector<int> nn_index_d;
+    std::vector<int> nn_index_h;
+    std::vector<int> nn_index_w;
+    std::vector<int> nn_index_planar;    // flat src index per output element of one channel
+    std::vector<int> nn_index_w_kernel;  // per-ox src byte offsets fed to the jit kernel
+
+    LinearCoeffTable linear_coeffs_d;
+    LinearCoeffTable linear_coeffs_h;
+    LinearCoeffTable linear_coeffs_w;
 };
 
 }  // namespace MKLDNNPlugin
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_memcpy.h>
@@ -99,6 +100,7 @@ public:
                 reorders.emplace_back(from->GetPrimitive(), chunk_mem_prim);
             }
         }
+        prims.assign(reorders.begin(), reorders.end());
     }
 
     void execute(int n_iter, mkldnn::stream strm) override {
@@ -111,13 +113,17 @@ public:
             chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
                     chunk_offset_in_byte + chunk_stride_in_byte * n_iter);
 
-            strm.submit({reorders.begin(), reorders.end()});
+            strm.submit(prims);
         } else {
             if (as_input ? n_iter == 0 : n_iter == (iter_count - 1))
-                strm.submit({reorders.begin(), reorders.end()});
+                strm.submit(prims);
         }
     };
 
+    bool isLoopInvariant() const {
+        return chunk_stride_in_byte == 0;
+    }
+
 private:
     bool as_input;
     ptrdiff_t chunk_stride_in_byte = 0;
@@ -129,18 +135,25 @@ private:
 
 class BackEdgePortHelper : public PortMapHelper {
 public:
-    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter) {
+    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter,
+            bool keep_last = false) : keep_last(keep_last) {
         auto mem_desc =  from->GetDescriptor();
         mem_holder.emplace_back(mkldnn::memory::primitive_desc(mem_desc, eng));
         reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
+        prims.assign(reorders.begin(), reorders.end());
         iter_count = n_iter;
     }
 
     void execute(int n_iter, mkldnn::stream strm) override {
-        if (n_iter < iter_count - 1) {
-            strm.submit({reorders.begin(), reorders.end()});
+        // in streaming mode the copy runs after the last trip as well, so the
+        // input side holds the state the next infer call continues from
+        if (keep_last || n_iter < iter_count - 1) {
+            strm.submit(prims);
         }
     };
+
+private:
+    bool keep_last;
 };
 
 }  // namespace MKLDNNPlugin
@@ -195,24 +208,43 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
+    // inputs fed by a back edge carry the recurrent state
+    std::set<int> back_edge_inputs;
+    for (auto map_rule : ti->back_edges)
+        back_edge_inputs.insert(map_rule.to);
+
     for (auto map_rule : ti->input_port_map) {
         auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = input_mem[map_rule.to];
 
-        auto mapper = std::shared_ptr<PortMapHelper>(
+        auto mapper = std::shared_ptr<PortIteratorHelper>(
                 new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
 
-        in_port_mappers.push_back(mapper);
+        // ports which don't iterate (axis == -1) are copied once before the loop;
+        // in streaming mode initializers of the recurrent state run on the first
+        // execute only, later calls continue from the kept state
+        if (mapper->isLoopInvariant()) {
+            if (streaming_mode && back_edge_inputs.count(map_rule.to))
+                state_init_mappers.push_back(mapper);
+            else
+                first_iter_mappers.push_back(mapper);
+        } else {
+            in_port_mappers.push_back(mapper);
+        }
     }
 
     for (auto map_rule : ti->output_port_map) {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = output_mem[map_rule.to];
 
-        auto mapper = std::shared_ptr<PortMapHelper>(
+        auto mapper = std::shared_ptr<PortIteratorHelper>(
                 new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
 
-        out_port_mappers.push_back(mapper);
+        // ports which don't iterate produce their value in the last trip only
+        if (mapper->isLoopInvariant())
+            last_iter_mappers.push_back(mapper);
+        else
+            out_port_mappers.push_back(mapper);
     }
 
     for (auto map_rule : ti->back_edges) {
@@ -220,15 +252,33 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto to_mem = input_mem[map_rule.to];
 
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
+                new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter, streaming_mode));
 
         out_port_mappers.push_back(mapper);
+
+        if (streaming_mode)
+            streaming_states.emplace_back(getName() + "/back_edge:" + std::to_string(map_rule.to), to_mem);
     }
 }
 
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     sub_graph.ResetInferCount();
 
+    if (n_iter < 1)
+        return;
+
+    // the recurrent state is seeded from the network input on the first call only;
+    // in streaming mode later calls continue from the state kept by the back edges
+    if (!state_initialized) {
+        for (auto &mapper : state_init_mappers)
+            mapper->execute(0, strm);
+        state_initialized = true;
+    }
+
+    // loop-invariant inputs are copied into the body once, before the trips
+    for (auto &mapper : first_iter_mappers)
+        mapper->execute(0, strm);
+
     for (int i = 0; i < n_iter; i++) {
         // copy data to subgraph iteration
         for (auto &mapper : in_port_mappers)
@@ -241,6 +291,10 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
         for (auto &mapper : out_port_mappers)
             mapper->execute(i, strm);
     }
+
+    // non-iterating outputs carry the value of the last trip only
+    for (auto &mapper : last_iter_mappers)
+        mapper->execute(n_iter - 1, strm);
 }
 
 bool MKLDNNTensorIteratorNode::created() const {
@@ -9,6 +9,7 @@
 #include <mkldnn_graph.h>
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -20,6 +21,9 @@ public:
 protected:
     std::vector<mkldnn::reorder> reorders;
     std::vector<mkldnn::memory> mem_holder;
+    // submit list prepared once at construction so the per-iteration path
+    // doesn't rebuild a primitive vector on every trip
+    std::vector<mkldnn::primitive> prims;
     int iter_count;
 };
 
@@ -35,14 +39,42 @@ public:
     void execute(mkldnn::stream strm) override;
 
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
+
+    /**
+     * Enables KEY_CPU_TENSOR_ITERATOR_STREAMING mode: the back-edge state reached at
+     * the end of an execute() is kept and the next execute() continues from it, so a
+     * stream can be fed chunk by chunk; the initial state from the network input is
+     * read on the first execute() only. Must be set before createPrimitive().
+     */
+    void setStreamingMode(bool streaming) { streaming_mode = streaming; }
+
+    /**
+     * Name/storage pairs of the recurrent state kept between infer calls; filled by
+     * createPrimitive() in streaming mode and published through the memory-state API.
+     */
+    const std::vector<std::pair<std::string, MKLDNNMemoryPtr>>& getStreamingStates() const {
+        return streaming_states;
+    }
+
 private:
     int n_iter = 0;
+    bool streaming_mode = false;
+    // whether the initial state was already seeded from the network input
+    bool state_initialized = false;
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
 
+    // loop-invariant port maps (axis == -1) are hoisted out of the trip loop:
+    // the first group runs once before it, the last group once after it
+    std::vector<std::shared_ptr<PortMapHelper>> first_iter_mappers, last_iter_mappers;
     std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
+
+    // streaming mode only: initializers of back-edge inputs, run on the first
+    // execute() and skipped afterwards so the kept state survives between calls
+    std::vector<std::shared_ptr<PortMapHelper>> state_init_mappers;
+    std::vector<std::pair<std::string, MKLDNNMemoryPtr>> streaming_states;
 };
 
 }  // namespace MKLDNNPlugin
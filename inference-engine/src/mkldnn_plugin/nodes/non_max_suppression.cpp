@@ -169,44 +169,97 @@ public:
         // scores shape: {num_batches, num_classes, num_boxes}
         int num_batches = static_cast<int>(scores_dims[0]);
         int num_classes = static_cast<int>(scores_dims[1]);
-        std::vector<filteredBoxes> fb;
 
-        for (int batch = 0; batch < num_batches; batch++) {
+        //  Stage 1: filter out boxes below score_threshold. The counting pass is
+        //  branchless so the compiler can vectorize it; blocks keep all threads
+        //  busy even for a single (batch, class) pair with many boxes
+        const int blockSize = 32 * 1024;
+        const int num_blocks = (num_boxes + blockSize - 1) / blockSize;
+        std::vector<int> block_counts(num_batches * num_classes * num_blocks);
+        parallel_for3d(num_batches, num_classes, num_blocks, [&](int batch, int class_idx, int block) {
+            const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            const int begin = block * blockSize;
+            const int end = (std::min)(begin + blockSize, num_boxes);
+            int count = 0;
+            for (int box_idx = begin; box_idx < end; box_idx++)
+                count += scoresPtr[box_idx] > score_threshold;
+            block_counts[(batch * num_classes + class_idx) * num_blocks + block] = count;
+        });
+
+        std::vector<std::vector<std::pair<float, int>>> candidates(num_batches * num_classes);
+        for (int bc = 0; bc < num_batches * num_classes; bc++) {
+            int total = 0;
+            for (int block = 0; block < num_blocks; block++)
+                total += block_counts[bc * num_blocks + block];
+            candidates[bc].resize(total);
+        }
+        parallel_for3d(num_batches, num_classes, num_blocks, [&](int batch, int class_idx, int block) {
+            const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            const int bc = batch * num_classes + class_idx;
+            int offset = 0;
+            for (int prev = 0; prev < block; prev++)
+                offset += block_counts[bc * num_blocks + prev];
+            const int begin = block * blockSize;
+            const int end = (std::min)(begin + blockSize, num_boxes);
+            for (int box_idx = begin; box_idx < end; box_idx++) {
+                if (scoresPtr[box_idx] > score_threshold)
+                    candidates[bc][offset++] = std::make_pair(scoresPtr[box_idx], box_idx);
+            }
+        });
+
+        //  Stage 2: per class suppression. Candidates are sorted lazily a chunk
+        //  at a time: classes which fill max_output_boxes_per_class from the few
+        //  top scoring boxes never pay for sorting the whole list
+        std::vector<std::vector<filteredBoxes>> class_boxes(num_batches * num_classes);
+        parallel_for2d(num_batches, num_classes, [&](int batch, int class_idx) {
+            auto &scores_vector = candidates[batch * num_classes + class_idx];
+            if (scores_vector.empty())
+                return;
             float *boxesPtr = boxes + batch * boxesStrides[0];
-            for (int class_idx = 0; class_idx < num_classes; class_idx++) {
-                float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
-                std::vector<std::pair<float, int> > scores_vector;
-                for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                    if (scoresPtr[box_idx] > score_threshold)
-                        scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
+            auto &fb = class_boxes[batch * num_classes + class_idx];
+
+            const auto descending = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                return l.first > r.first;
+            };
+            const size_t sortChunk = (std::max)(static_cast<size_t>(max_output_boxes_per_class) * 4, static_cast<size_t>(256));
+            size_t sorted_upto = 0;
+            auto ensure_sorted = [&](size_t idx) {
+                if (idx >= sorted_upto && sorted_upto < scores_vector.size()) {
+                    const size_t next = (std::min)(scores_vector.size(), sorted_upto + sortChunk);
+                    std::partial_sort(scores_vector.begin() + sorted_upto, scores_vector.begin() + next,
+                                      scores_vector.end(), descending);
+                    sorted_upto = next;
                 }
-
-                if (scores_vector.size()) {
-                    parallel_sort(scores_vector.begin(), scores_vector.end(),
-                        [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
-
-                    int io_selection_size = 1;
-                    fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
-                    for (int box_idx = 1; (box_idx < static_cast<int>(scores_vector.size()) && io_selection_size < max_output_boxes_per_class); box_idx++) {
-                        bool box_is_selected = true;
-                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
-                                             &boxesPtr[scores_vector[idx].second * 4], center_point_box);
-                            if (iou > iou_threshold) {
-                                box_is_selected = false;
-                                break;
-                            }
-                        }
-
-                        if (box_is_selected) {
-                            scores_vector[io_selection_size] = scores_vector[box_idx];
-                            io_selection_size++;
-                            fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
-                        }
+            };
+
+            ensure_sorted(0);
+            std::vector<int> selected;
+            selected.push_back(scores_vector[0].second);
+            fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
+            for (size_t box_idx = 1; (box_idx < scores_vector.size() &&
+                                      static_cast<int>(selected.size()) < max_output_boxes_per_class); box_idx++) {
+                ensure_sorted(box_idx);
+                bool box_is_selected = true;
+                for (int idx = static_cast<int>(selected.size()) - 1; idx >= 0; idx--) {
+                    float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
+                                     &boxesPtr[selected[idx] * 4], center_point_box);
+                    if (iou > iou_threshold) {
+                        box_is_selected = false;
+                        break;
                     }
                 }
+
+                if (box_is_selected) {
+                    selected.push_back(scores_vector[box_idx].second);
+                    fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
+                }
             }
-        }
+        });
+
+        //  concatenation order matches the former batch-major serial loop
+        std::vector<filteredBoxes> fb;
+        for (auto &boxes_per_class : class_boxes)
+            fb.insert(fb.end(), boxes_per_class.begin(), boxes_per_class.end());
 
         if (sort_result_descending) {
             parallel_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) { return l.score > r.score; });
@@ -75,18 +75,20 @@ private:
 
         std::size_t suffix_size = input->size() / prefix_size;
 
-        // fill the output with off_value
-        std::size_t dst_size = prefix_size * depth * suffix_size;
-        std::fill(dst_data, dst_data + dst_size, off_value);
-
-        // set on_value at needed locations
+        // every prefix index owns the contiguous output slice
+        // [prefix_idx * depth * suffix_size, +depth * suffix_size), so the
+        // off_value fill is blocked per slice: it runs with whole vector
+        // stores on the same thread which then writes the on_value entries
+        // while the slice is still in its cache
         parallel_for(prefix_size, [&](std::size_t prefix_idx) {
+            float* dst_slice = dst_data + prefix_idx * depth * suffix_size;
+            std::fill(dst_slice, dst_slice + depth * suffix_size, off_value);
+
             for (std::size_t suffix_idx = 0; suffix_idx < suffix_size; ++suffix_idx) {
                 auto src_index = prefix_idx * suffix_size + suffix_idx;
                 std::size_t v = static_cast<std::size_t>(src_data[src_index]);
                 if (v < depth) {
-                    std::size_t dst_offset = prefix_idx * depth * suffix_size + v * suffix_size + suffix_idx;
-                    dst_data[dst_offset] = on_value;
+                    dst_slice[v * suffix_size + suffix_idx] = on_value;
                 }
             }
         });
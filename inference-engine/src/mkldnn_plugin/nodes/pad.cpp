@@ -4,11 +4,13 @@
 
 #include "base.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <vector>
 #include <cassert>
 #include "ie_parallel.hpp"
+#include "common/simple_copy.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -132,62 +134,83 @@ inline void parallel_step(size_t size, std::vector<size_t> &counters, std::vecto
     }
 }
 
+// All modes process the output row by row along the innermost dimension: the row offset math is
+// done once per row, the interior is moved with a single contiguous copy, and only the padding
+// ring is synthesized element-wise. This keeps the per-element coordinate walk off the hot path.
 void PadImpl::pad_constant(const float *src_data, float* dst_data) {
-    int offset = 0;
-    for (size_t i = 0; i < srcStrides.size(); ++i)
-        offset += pads_begin[i] * srcStrides[i];
+    const size_t outer_size = dst_dims.size() - 1;
+    const size_t inner_dim = dst_dims[outer_size];
+    const size_t inner_begin = pads_begin[outer_size];
+    const size_t inner_end = src_o_dms[outer_size];
+    const size_t outer_work = work_amount / inner_dim;
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
+        SizeVector counters(outer_size, 0);
+        splitter(outer_work, nthr, ithr, start, end);
 
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
+        parallel_init(start, outer_size, counters, dst_dims);
         for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 1;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
+            size_t dstIdx = 0;
+            for (size_t i = 0; i < outer_size; ++i)
                 dstIdx += counters[i] * dstStrides[i];
+            float* dst_row = dst_data + dstIdx;
 
-            for (size_t i = 0; i < counters.size(); ++i) {
+            size_t srcIdx = 0;
+            bool row_is_pad = false;
+            for (size_t i = 0; i < outer_size; ++i) {
                 if (counters[i] < pads_begin[i] || counters[i] >= src_o_dms[i]) {
-                    dst_data[dstIdx] = pad_value;
-                    srcIdx = 0;
+                    row_is_pad = true;
                     break;
                 }
+                srcIdx += (counters[i] - pads_begin[i]) * srcStrides[i];
             }
-            if (srcIdx) {
-                int srcIdx = 0;
-                for (size_t i = 0; i < srcStrides.size(); ++i)
-                    srcIdx += counters[i] * srcStrides[i];
-                dst_data[dstIdx] = src_data[srcIdx - offset];
+
+            if (row_is_pad) {
+                std::fill(dst_row, dst_row + inner_dim, pad_value);
+            } else {
+                std::fill(dst_row, dst_row + inner_begin, pad_value);
+                simple_copy(dst_row + inner_begin, (inner_end - inner_begin) * sizeof(float),
+                            src_data + srcIdx, (inner_end - inner_begin) * sizeof(float));
+                std::fill(dst_row + inner_end, dst_row + inner_dim, pad_value);
             }
-            parallel_step(dst_dims.size(), counters, dst_dims);
+            parallel_step(outer_size, counters, dst_dims);
         }
     });
 }
 
 void PadImpl::pad_edge(const float *src_data, float* dst_data) {
+    const size_t outer_size = dst_dims.size() - 1;
+    const size_t inner_dim = dst_dims[outer_size];
+    const size_t inner_begin = pads_begin[outer_size];
+    const size_t inner_end = src_o_dms[outer_size];
+    const size_t inner_src = src_dims[outer_size];
+    const size_t outer_work = work_amount / inner_dim;
+
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
+        SizeVector counters(outer_size, 0);
+        splitter(outer_work, nthr, ithr, start, end);
 
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
+        parallel_init(start, outer_size, counters, dst_dims);
         for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
+            size_t dstIdx = 0;
+            for (size_t i = 0; i < outer_size; ++i)
                 dstIdx += counters[i] * dstStrides[i];
+            float* dst_row = dst_data + dstIdx;
 
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? 0 :
+            size_t srcIdx = 0;
+            for (size_t i = 0; i < outer_size; ++i) {
+                size_t idx = (counters[i] < pads_begin[i]) ? 0 :
                     ((counters[i] >= src_o_dms[i]) ? (src_dims[i] - 1) : (counters[i] - pads_begin[i]));
                 srcIdx += idx * srcStrides[i];
             }
+            const float* src_row = src_data + srcIdx;
 
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
+            std::fill(dst_row, dst_row + inner_begin, src_row[0]);
+            simple_copy(dst_row + inner_begin, inner_src * sizeof(float), src_row, inner_src * sizeof(float));
+            std::fill(dst_row + inner_end, dst_row + inner_dim, src_row[inner_src - 1]);
+            parallel_step(outer_size, counters, dst_dims);
         }
     });
 }
@@ -197,26 +220,39 @@ void PadImpl::pad_reflect(const float *src_data, float* dst_data) {
     for (size_t i = 0; i < src_dims.size(); i++)
         src_2.push_back(src_dims[i] + src_o_dms[i] - 2);
 
+    const size_t outer_size = dst_dims.size() - 1;
+    const size_t inner_dim = dst_dims[outer_size];
+    const size_t inner_begin = pads_begin[outer_size];
+    const size_t inner_end = src_o_dms[outer_size];
+    const size_t inner_src = src_dims[outer_size];
+    const size_t outer_work = work_amount / inner_dim;
+
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
+        SizeVector counters(outer_size, 0);
+        splitter(outer_work, nthr, ithr, start, end);
 
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
+        parallel_init(start, outer_size, counters, dst_dims);
         for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
+            size_t dstIdx = 0;
+            for (size_t i = 0; i < outer_size; ++i)
                 dstIdx += counters[i] * dstStrides[i];
+            float* dst_row = dst_data + dstIdx;
 
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - counters[i]) :
+            size_t srcIdx = 0;
+            for (size_t i = 0; i < outer_size; ++i) {
+                size_t idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - counters[i]) :
                     ((counters[i] >= src_o_dms[i]) ? (src_2[i] - counters[i]) : (counters[i] - pads_begin[i]));
                 srcIdx += idx * srcStrides[i];
             }
-
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
+            const float* src_row = src_data + srcIdx;
+
+            for (size_t j = 0; j < inner_begin; ++j)
+                dst_row[j] = src_row[inner_begin - j];
+            simple_copy(dst_row + inner_begin, inner_src * sizeof(float), src_row, inner_src * sizeof(float));
+            for (size_t j = inner_end; j < inner_dim; ++j)
+                dst_row[j] = src_row[src_2[outer_size] - j];
+            parallel_step(outer_size, counters, dst_dims);
         }
     });
 }
@@ -226,26 +262,39 @@ void PadImpl::pad_symmetric(const float *src_data, float* dst_data) {
     for (size_t i = 0; i < src_dims.size(); i++)
         src_2.push_back(src_dims[i] + src_o_dms[i] - 1);
 
+    const size_t outer_size = dst_dims.size() - 1;
+    const size_t inner_dim = dst_dims[outer_size];
+    const size_t inner_begin = pads_begin[outer_size];
+    const size_t inner_end = src_o_dms[outer_size];
+    const size_t inner_src = src_dims[outer_size];
+    const size_t outer_work = work_amount / inner_dim;
+
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
+        SizeVector counters(outer_size, 0);
+        splitter(outer_work, nthr, ithr, start, end);
 
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
+        parallel_init(start, outer_size, counters, dst_dims);
         for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 0;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
+            size_t dstIdx = 0;
+            for (size_t i = 0; i < outer_size; ++i)
                 dstIdx += counters[i] * dstStrides[i];
+            float* dst_row = dst_data + dstIdx;
 
-            for (size_t i = 0; i < srcStrides.size(); ++i) {
-                int idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - 1 - counters[i]) :
+            size_t srcIdx = 0;
+            for (size_t i = 0; i < outer_size; ++i) {
+                size_t idx = (counters[i] < pads_begin[i]) ? (pads_begin[i] - 1 - counters[i]) :
                     ((counters[i] >= src_o_dms[i]) ? (src_2[i] - counters[i]) : (counters[i] - pads_begin[i]));
                 srcIdx += idx * srcStrides[i];
             }
-
-            dst_data[dstIdx] = src_data[srcIdx];
-            parallel_step(dst_dims.size(), counters, dst_dims);
+            const float* src_row = src_data + srcIdx;
+
+            for (size_t j = 0; j < inner_begin; ++j)
+                dst_row[j] = src_row[inner_begin - 1 - j];
+            simple_copy(dst_row + inner_begin, inner_src * sizeof(float), src_row, inner_src * sizeof(float));
+            for (size_t j = inner_end; j < inner_dim; ++j)
+                dst_row[j] = src_row[src_2[outer_size] - j];
+            parallel_step(outer_size, counters, dst_dims);
         }
     });
 }
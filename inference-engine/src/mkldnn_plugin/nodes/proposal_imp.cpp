@@ -34,28 +34,142 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
     const float* p_anchors_wp = anchors + 2 * num_anchors;
     const float* p_anchors_hp = anchors + 3 * num_anchors;
 
-    parallel_for2d(bottom_H, bottom_W, [&](size_t h, size_t w) {
-        const float x = static_cast<float>((swap_xy ? h : w) * feat_stride);
-        const float y = static_cast<float>((swap_xy ? w : h) * feat_stride);
+    // (anchor, h) work items keep every input row contiguous in w, so both the
+    // AVX2 path and the scalar tail below walk unit-stride memory
+    parallel_for2d(num_anchors, bottom_H, [&](size_t anchor, size_t h) {
+        const float anchor_wm = p_anchors_wm[anchor];
+        const float anchor_hm = p_anchors_hm[anchor];
+        const float anchor_wp = p_anchors_wp[anchor];
+        const float anchor_hp = p_anchors_hp[anchor];
+
+        const float* p_dx    = d_anchor4d + (anchor * 4 + 0) * bottom_area + h * bottom_W;
+        const float* p_dy    = d_anchor4d + (anchor * 4 + 1) * bottom_area + h * bottom_W;
+        const float* p_dw    = d_anchor4d + (anchor * 4 + 2) * bottom_area + h * bottom_W;
+        const float* p_dh    = d_anchor4d + (anchor * 4 + 3) * bottom_area + h * bottom_W;
+        const float* p_score = bottom4d   + anchor * bottom_area + h * bottom_W;
+
+        float* p_proposal = proposals + (h * bottom_W * num_anchors + anchor) * 5;
+
+        int w = 0;
+#if defined(HAVE_AVX2)
+        const __m256 vzero   = _mm256_setzero_ps();
+        const __m256 vhalf   = _mm256_set1_ps(0.5f);
+        const __m256 vone    = _mm256_set1_ps(1.0f);
+        const __m256 voffset = _mm256_set1_ps(coordinates_offset);
+        const __m256 vimg_W  = _mm256_set1_ps(img_W);
+        const __m256 vimg_H  = _mm256_set1_ps(img_H);
+        const __m256 vclip_W = _mm256_set1_ps(img_W - coordinates_offset);
+        const __m256 vclip_H = _mm256_set1_ps(img_H - coordinates_offset);
+        const __m256 vcoord_scale = _mm256_set1_ps(box_coordinate_scale);
+        const __m256 vsize_scale  = _mm256_set1_ps(box_size_scale);
+        const __m256 vmin_w  = _mm256_set1_ps(min_box_W);
+        const __m256 vmin_h  = _mm256_set1_ps(min_box_H);
+        const __m256i vlane  = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i vfeat_stride = _mm256_set1_epi32(feat_stride);
+        const __m256 vrow = _mm256_set1_ps(static_cast<float>(h * feat_stride));
+
+        for (; w <= bottom_W - 8; w += 8) {
+            // the along-row coordinate, computed in integers and converted the same
+            // way as in the scalar tail
+            const __m256i vwi = _mm256_add_epi32(_mm256_set1_epi32(w), vlane);
+            const __m256 vcol = _mm256_cvtepi32_ps(_mm256_mullo_epi32(vwi, vfeat_stride));
+            const __m256 vx = swap_xy ? vrow : vcol;
+            const __m256 vy = swap_xy ? vcol : vrow;
+
+            const __m256 vdx = _mm256_div_ps(_mm256_loadu_ps(p_dx + w), vcoord_scale);
+            const __m256 vdy = _mm256_div_ps(_mm256_loadu_ps(p_dy + w), vcoord_scale);
+            const __m256 vd_log_w = _mm256_div_ps(_mm256_loadu_ps(p_dw + w), vsize_scale);
+            const __m256 vd_log_h = _mm256_div_ps(_mm256_loadu_ps(p_dh + w), vsize_scale);
+
+            __m256 vx0 = _mm256_add_ps(vx, _mm256_set1_ps(anchor_wm));
+            __m256 vy0 = _mm256_add_ps(vy, _mm256_set1_ps(anchor_hm));
+            __m256 vx1 = _mm256_add_ps(vx, _mm256_set1_ps(anchor_wp));
+            __m256 vy1 = _mm256_add_ps(vy, _mm256_set1_ps(anchor_hp));
 
-        const float* p_box   = d_anchor4d + h * bottom_W + w;
-        const float* p_score = bottom4d   + h * bottom_W + w;
+            if (initial_clip) {
+                vx0 = _mm256_max_ps(vzero, _mm256_min_ps(vx0, vimg_W));
+                vy0 = _mm256_max_ps(vzero, _mm256_min_ps(vy0, vimg_H));
+                vx1 = _mm256_max_ps(vzero, _mm256_min_ps(vx1, vimg_W));
+                vy1 = _mm256_max_ps(vzero, _mm256_min_ps(vy1, vimg_H));
+            }
+
+            const __m256 vww = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), voffset);
+            const __m256 vhh = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), voffset);
+            const __m256 vctr_x = _mm256_add_ps(vx0, _mm256_mul_ps(vhalf, vww));
+            const __m256 vctr_y = _mm256_add_ps(vy0, _mm256_mul_ps(vhalf, vhh));
+
+            const __m256 vpred_ctr_x = _mm256_add_ps(_mm256_mul_ps(vdx, vww), vctr_x);
+            const __m256 vpred_ctr_y = _mm256_add_ps(_mm256_mul_ps(vdy, vhh), vctr_y);
+
+            // std::exp has no vector counterpart here; spilling the lanes keeps the
+            // results bit-identical to the scalar tail
+            float log_w[8], log_h[8];
+            _mm256_storeu_ps(log_w, vd_log_w);
+            _mm256_storeu_ps(log_h, vd_log_h);
+            for (int k = 0; k < 8; ++k) {
+                log_w[k] = std::exp(log_w[k]);
+                log_h[k] = std::exp(log_h[k]);
+            }
+            const __m256 vpred_w = _mm256_mul_ps(_mm256_loadu_ps(log_w), vww);
+            const __m256 vpred_h = _mm256_mul_ps(_mm256_loadu_ps(log_h), vhh);
 
-        float* p_proposal = proposals + (h * bottom_W + w) * num_anchors * 5;
+            vx0 = _mm256_sub_ps(vpred_ctr_x, _mm256_mul_ps(vhalf, vpred_w));
+            vy0 = _mm256_sub_ps(vpred_ctr_y, _mm256_mul_ps(vhalf, vpred_h));
+            vx1 = _mm256_add_ps(vpred_ctr_x, _mm256_mul_ps(vhalf, vpred_w));
+            vy1 = _mm256_add_ps(vpred_ctr_y, _mm256_mul_ps(vhalf, vpred_h));
 
-        for (int anchor = 0; anchor < num_anchors; ++anchor) {
-            const float dx = p_box[(anchor * 4 + 0) * bottom_area] / box_coordinate_scale;
-            const float dy = p_box[(anchor * 4 + 1) * bottom_area] / box_coordinate_scale;
+            if (clip_before_nms) {
+                vx0 = _mm256_max_ps(vzero, _mm256_min_ps(vx0, vclip_W));
+                vy0 = _mm256_max_ps(vzero, _mm256_min_ps(vy0, vclip_H));
+                vx1 = _mm256_max_ps(vzero, _mm256_min_ps(vx1, vclip_W));
+                vy1 = _mm256_max_ps(vzero, _mm256_min_ps(vy1, vclip_H));
+            }
 
-            const float d_log_w = p_box[(anchor * 4 + 2) * bottom_area] / box_size_scale;
-            const float d_log_h = p_box[(anchor * 4 + 3) * bottom_area] / box_size_scale;
+            const __m256 vbox_w = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), voffset);
+            const __m256 vbox_h = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), voffset);
+
+            // (min <= box) * score, with the comparison masks turned into 1.0f/0.0f
+            // so the multiply matches the scalar expression exactly
+            const __m256 vkeep = _mm256_and_ps(
+                _mm256_and_ps(_mm256_cmp_ps(vmin_w, vbox_w, _CMP_LE_OS),
+                              _mm256_cmp_ps(vmin_h, vbox_h, _CMP_LE_OS)), vone);
+            const __m256 vscore = _mm256_mul_ps(vkeep, _mm256_loadu_ps(p_score + w));
+
+            // the proposal array interleaves anchors per position, so the five
+            // result vectors are spilled and written out with scalar stores
+            float r0[8], r1[8], r2[8], r3[8], r4[8];
+            _mm256_storeu_ps(r0, vx0);
+            _mm256_storeu_ps(r1, vy0);
+            _mm256_storeu_ps(r2, vx1);
+            _mm256_storeu_ps(r3, vy1);
+            _mm256_storeu_ps(r4, vscore);
+            for (int k = 0; k < 8; ++k) {
+                float* out = p_proposal + (w + k) * num_anchors * 5;
+                out[0] = r0[k];
+                out[1] = r1[k];
+                out[2] = r2[k];
+                out[3] = r3[k];
+                out[4] = r4[k];
+            }
+        }
+#endif
 
-            const float score = p_score[anchor * bottom_area];
+        for (; w < bottom_W; ++w) {
+            const float x = static_cast<float>((swap_xy ? h : static_cast<size_t>(w)) * feat_stride);
+            const float y = static_cast<float>((swap_xy ? static_cast<size_t>(w) : h) * feat_stride);
 
-            float x0 = x + p_anchors_wm[anchor];
-            float y0 = y + p_anchors_hm[anchor];
-            float x1 = x + p_anchors_wp[anchor];
-            float y1 = y + p_anchors_hp[anchor];
+            const float dx = p_dx[w] / box_coordinate_scale;
+            const float dy = p_dy[w] / box_coordinate_scale;
+
+            const float d_log_w = p_dw[w] / box_size_scale;
+            const float d_log_h = p_dh[w] / box_size_scale;
+
+            const float score = p_score[w];
+
+            float x0 = x + anchor_wm;
+            float y0 = y + anchor_hm;
+            float x1 = x + anchor_wp;
+            float y1 = y + anchor_hp;
 
             if (initial_clip) {
                 // adjust new corner locations to be within the image region
@@ -98,11 +212,12 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
             const float box_w = x1 - x0 + coordinates_offset;
             const float box_h = y1 - y0 + coordinates_offset;
 
-            p_proposal[5*anchor + 0] = x0;
-            p_proposal[5*anchor + 1] = y0;
-            p_proposal[5*anchor + 2] = x1;
-            p_proposal[5*anchor + 3] = y1;
-            p_proposal[5*anchor + 4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
+            float* out = p_proposal + w * num_anchors * 5;
+            out[0] = x0;
+            out[1] = y0;
+            out[2] = x1;
+            out[3] = y1;
+            out[4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
         }
     });
 }
@@ -336,9 +451,6 @@ void proposal_exec(const float* input0, const float* input1,
     // number of top-n proposals before NMS
     const int pre_nms_topn = std::min<int>(num_proposals, conf.pre_nms_topn_);
 
-    // number of final RoIs
-    int num_rois = 0;
-
     // enumerate all proposals
     //   num_proposals = num_anchors * H * W
     //   (x1, y1, x2, y2, score) for each proposal
@@ -350,34 +462,51 @@ void proposal_exec(const float* input0, const float* input1,
         float y1;
         float score;
     };
-    std::vector<ProposalBox> proposals_(num_proposals);
     const int unpacked_boxes_buffer_size = store_prob ? 5 * pre_nms_topn : 4 * pre_nms_topn;
-    std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
-    std::vector<int> is_dead(pre_nms_topn);
 
     // Execute
     int nn = dims0[0];
-    for (int n = 0; n < nn; ++n) {
+
+    auto process_image = [&](int n, ProposalBox* proposals_, float* unpacked_boxes, int* is_dead, int* roi_idx) {
+        int num_rois = 0;
         enumerate_proposals_cpu(p_bottom_item + num_proposals + n * num_proposals * 2,
                                 p_d_anchor_item + n * num_proposals * 4,
-                                anchors, reinterpret_cast<float *>(&proposals_[0]),
+                                anchors, reinterpret_cast<float *>(proposals_),
                                 conf.anchors_shape_0, bottom_H, bottom_W, img_H, img_W,
                                 min_box_H, min_box_W, conf.feat_stride_,
                                 conf.box_coordinate_scale_, conf.box_size_scale_,
                                 conf.coordinates_offset, conf.initial_clip, conf.swap_xy, conf.clip_before_nms);
-        std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
+        std::partial_sort(proposals_, proposals_ + pre_nms_topn, proposals_ + num_proposals,
                           [](const ProposalBox &struct1, const ProposalBox &struct2) {
                               return (struct1.score > struct2.score);
                           });
 
-        unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn, store_prob);
-        nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], roi_indices, &num_rois, 0, conf.nms_thresh_,
+        unpack_boxes(reinterpret_cast<float *>(proposals_), unpacked_boxes, pre_nms_topn, store_prob);
+        nms_cpu(pre_nms_topn, is_dead, unpacked_boxes, roi_idx, &num_rois, 0, conf.nms_thresh_,
                 conf.post_nms_topn_, conf.coordinates_offset);
 
         float* p_probs = store_prob ? p_prob_item + n * conf.post_nms_topn_ : nullptr;
-        retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], roi_indices,
+        retrieve_rois_cpu(num_rois, n, pre_nms_topn, unpacked_boxes, roi_idx,
                           p_roi_item + n * conf.post_nms_topn_ * 5,
                           conf.post_nms_topn_, conf.normalize_, img_H, img_W, conf.clip_after_nms, p_probs);
+    };
+
+    if (nn == 1) {
+        std::vector<ProposalBox> proposals_(num_proposals);
+        std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
+        std::vector<int> is_dead(pre_nms_topn);
+        process_image(0, proposals_.data(), unpacked_boxes.data(), is_dead.data(), roi_indices);
+    } else {
+        // the sort and NMS of one image do not parallelize, so at batch > 1 the
+        // images themselves become the parallel work items; each owns its scratch
+        // (including the roi index buffer the serial path borrows from the caller)
+        parallel_for(nn, [&](int n) {
+            std::vector<ProposalBox> proposals_(num_proposals);
+            std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
+            std::vector<int> is_dead(pre_nms_topn);
+            std::vector<int> roi_idx(conf.post_nms_topn_);
+            process_image(n, proposals_.data(), unpacked_boxes.data(), is_dead.data(), roi_idx.data());
+        });
     }
 }
 
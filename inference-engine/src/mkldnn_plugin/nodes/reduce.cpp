@@ -12,11 +12,23 @@
 #include <cassert>
 #include <ie_util_internal.hpp>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "common/uni_simd.h"
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+#if defined(HAVE_AVX512F)
+using namespace AVX512F;
+#elif defined(HAVE_AVX2)
+using namespace AVX2;
+#elif defined(HAVE_SSE42)
+using namespace SSE42;
+#endif
+
 class ReduceImpl: public ExtLayerBase {
 public:
     explicit ReduceImpl(const CNNLayer* layer) {
@@ -171,6 +183,180 @@ private:
                 SizeVector axes_for_reduction, SizeVector dst_dims);
     enum class Reduce { And, L1, L2, LogSum, LogSumExp, Max, Mean, Min, Or, Prod, Sum, SumSquare };
 
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+#elif defined(HAVE_SSE42)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+#endif
+
+#if defined(HAVE_AVX2)
+    const int block_size_i8 = 32;
+    typedef __m256i vec_type_i8;
+#elif defined(HAVE_SSE42)
+    const int block_size_i8 = 16;
+    typedef __m128i vec_type_i8;
+#endif
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    struct reduce_add_ps {
+        static inline vec_type_f vec(vec_type_f x, vec_type_f y) { return _mm_uni_add_ps(x, y); }
+        static inline float scalar(float x, float y) { return x + y; }
+    };
+
+    struct reduce_max_ps {
+        static inline vec_type_f vec(vec_type_f x, vec_type_f y) { return _mm_uni_max_ps(x, y); }
+        static inline float scalar(float x, float y) { return x > y ? x : y; }
+    };
+
+    struct reduce_min_ps {
+        static inline vec_type_f vec(vec_type_f x, vec_type_f y) { return _mm_uni_min_ps(x, y); }
+        static inline float scalar(float x, float y) { return x < y ? x : y; }
+    };
+
+    struct reduce_mul_ps {
+        static inline vec_type_f vec(vec_type_f x, vec_type_f y) { return _mm_uni_mul_ps(x, y); }
+        static inline float scalar(float x, float y) { return x * y; }
+    };
+
+    static inline vec_type_i8 loadu_i8(const int8_t *psrc) {
+#if defined(HAVE_AVX2)
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(psrc));
+#else
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(psrc));
+#endif
+    }
+
+    static inline void storeu_i8(int8_t *pdst, vec_type_i8 vec) {
+#if defined(HAVE_AVX2)
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pdst), vec);
+#else
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pdst), vec);
+#endif
+    }
+
+    static inline vec_type_i8 set1_i8(int8_t value) {
+#if defined(HAVE_AVX2)
+        return _mm256_set1_epi8(value);
+#else
+        return _mm_set1_epi8(value);
+#endif
+    }
+
+    struct reduce_add_epi8 {
+        static inline vec_type_i8 vec(vec_type_i8 x, vec_type_i8 y) {
+#if defined(HAVE_AVX2)
+            return _mm256_add_epi8(x, y);
+#else
+            return _mm_add_epi8(x, y);
+#endif
+        }
+        static inline int8_t scalar(int8_t x, int8_t y) { return x + y; }
+    };
+
+    struct reduce_max_epi8 {
+        static inline vec_type_i8 vec(vec_type_i8 x, vec_type_i8 y) {
+#if defined(HAVE_AVX2)
+            return _mm256_max_epi8(x, y);
+#else
+            return _mm_max_epi8(x, y);
+#endif
+        }
+        static inline int8_t scalar(int8_t x, int8_t y) { return x > y ? x : y; }
+    };
+
+    struct reduce_min_epi8 {
+        static inline vec_type_i8 vec(vec_type_i8 x, vec_type_i8 y) {
+#if defined(HAVE_AVX2)
+            return _mm256_min_epi8(x, y);
+#else
+            return _mm_min_epi8(x, y);
+#endif
+        }
+        static inline int8_t scalar(int8_t x, int8_t y) { return x < y ? x : y; }
+    };
+
+    // Blocked tree reduction of one contiguous slice: four independent vector accumulators
+    // hide the latency of the combine operation, lanes and the tail are folded in scalar code.
+    template <class Op>
+    float reduce_slice_f32(const float *src, size_t len, float init_value) {
+        vec_type_f vacc0 = _mm_uni_set1_ps(init_value);
+        vec_type_f vacc1 = vacc0, vacc2 = vacc0, vacc3 = vacc0;
+        size_t i = 0;
+        for (; i + 4 * block_size <= len; i += 4 * block_size) {
+            vacc0 = Op::vec(vacc0, _mm_uni_loadu_ps(src + i));
+            vacc1 = Op::vec(vacc1, _mm_uni_loadu_ps(src + i + block_size));
+            vacc2 = Op::vec(vacc2, _mm_uni_loadu_ps(src + i + 2 * block_size));
+            vacc3 = Op::vec(vacc3, _mm_uni_loadu_ps(src + i + 3 * block_size));
+        }
+        for (; i + block_size <= len; i += block_size)
+            vacc0 = Op::vec(vacc0, _mm_uni_loadu_ps(src + i));
+        vacc0 = Op::vec(Op::vec(vacc0, vacc1), Op::vec(vacc2, vacc3));
+        float lanes[16];
+        _mm_uni_storeu_ps(lanes, vacc0);
+        float acc = init_value;
+        for (int lane = 0; lane < block_size; lane++)
+            acc = Op::scalar(acc, lanes[lane]);
+        for (; i < len; i++)
+            acc = Op::scalar(acc, src[i]);
+        return acc;
+    }
+
+    template <class Op>
+    int8_t reduce_slice_i8(const int8_t *src, size_t len, int8_t init_value) {
+        vec_type_i8 vacc0 = set1_i8(init_value);
+        vec_type_i8 vacc1 = vacc0, vacc2 = vacc0, vacc3 = vacc0;
+        size_t i = 0;
+        for (; i + 4 * block_size_i8 <= len; i += 4 * block_size_i8) {
+            vacc0 = Op::vec(vacc0, loadu_i8(src + i));
+            vacc1 = Op::vec(vacc1, loadu_i8(src + i + block_size_i8));
+            vacc2 = Op::vec(vacc2, loadu_i8(src + i + 2 * block_size_i8));
+            vacc3 = Op::vec(vacc3, loadu_i8(src + i + 3 * block_size_i8));
+        }
+        for (; i + block_size_i8 <= len; i += block_size_i8)
+            vacc0 = Op::vec(vacc0, loadu_i8(src + i));
+        vacc0 = Op::vec(Op::vec(vacc0, vacc1), Op::vec(vacc2, vacc3));
+        int8_t lanes[32];
+        storeu_i8(lanes, vacc0);
+        int8_t acc = init_value;
+        for (int lane = 0; lane < block_size_i8; lane++)
+            acc = Op::scalar(acc, lanes[lane]);
+        for (; i < len; i++)
+            acc = Op::scalar(acc, src[i]);
+        return acc;
+    }
+
+    // The vectorized path handles the common case when reduction goes over the innermost
+    // dimensions of a dense tensor, so every output element is produced from a contiguous slice.
+    bool is_dense_slice_reduce(const SizeVector &axes_for_reduction, size_t work_amount_dst,
+                               size_t reduced_dims_work_amount) const {
+        if (axes_for_reduction.empty() || reduced_dims_work_amount < static_cast<size_t>(block_size))
+            return false;
+        if (srcStrides.size() != src_dims.size() || src_dims.empty())
+            return false;
+        size_t expected_stride = 1;
+        for (int j = src_dims.size() - 1; j >= 0; j--) {
+            if (srcStrides[j] != expected_stride)
+                return false;
+            expected_stride *= src_dims[j];
+        }
+        for (size_t i = 0; i < axes_for_reduction.size(); i++) {
+            if (axes_for_reduction[i] != src_dims.size() - axes_for_reduction.size() + i)
+                return false;
+        }
+        return work_amount_dst * reduced_dims_work_amount == srcStrides[0] * src_dims[0];
+    }
+
+    template <typename src_d, typename dst_t>
+    bool reduce_dense(const src_d *, dst_t *, size_t, size_t) {
+        return false;
+    }
+#endif
+
     const size_t REDUCE_DATA = 0;
     const size_t REDUCE_INDEXES = 1;
     bool keep_dims = true;
@@ -181,6 +367,15 @@ private:
     SizeVector srcStrides;
 };
 
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+template <>
+bool ReduceImpl::reduce_dense<float, float>(const float *src_data, float *dst_data,
+                                            size_t work_amount_dst, size_t reduced_dims_work_amount);
+template <>
+bool ReduceImpl::reduce_dense<int8_t, int8_t>(const int8_t *src_data, int8_t *dst_data,
+                                              size_t work_amount_dst, size_t reduced_dims_work_amount);
+#endif
+
 template <typename src_d, typename dst_t>
 StatusCode ReduceImpl::reduce_type(
         std::vector<Blob::Ptr>& inputs,
@@ -195,6 +390,18 @@ StatusCode ReduceImpl::reduce_type(
     dst_t* dst_data = outputs[0]->cbuffer().as<dst_t *>() +
                       outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (is_dense_slice_reduce(axes_for_reduction, work_amount_dst, reduced_dims_work_amount) &&
+            reduce_dense<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount)) {
+        if (reduceMode == Reduce::Mean) {
+            parallel_for(work_amount_dst, [&](size_t i) {
+                dst_data[i] /= static_cast<dst_t>(reduced_dims_work_amount);
+            });
+        }
+        return OK;
+    }
+#endif
+
     switch (reduceMode) {
         case Reduce::And:
             reduce<src_d, dst_t>(src_data, dst_data, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims, static_cast<dst_t>(1),
@@ -387,6 +594,88 @@ void ReduceImpl::reduce(
     }
 }
 
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+template <>
+bool ReduceImpl::reduce_dense<float, float>(
+    const float *src_data,
+    float       *dst_data,
+    size_t       work_amount_dst,
+    size_t       reduced_dims_work_amount
+) {
+    float init_value;
+    switch (reduceMode) {
+        case Reduce::Sum:
+        case Reduce::Mean:
+            init_value = 0.0f;
+            parallel_for(work_amount_dst, [&](size_t o) {
+                dst_data[o] = reduce_slice_f32<reduce_add_ps>(src_data + o * reduced_dims_work_amount,
+                                                              reduced_dims_work_amount, init_value);
+            });
+            return true;
+        case Reduce::Max:
+            init_value = (std::numeric_limits<float>::min)();
+            parallel_for(work_amount_dst, [&](size_t o) {
+                dst_data[o] = reduce_slice_f32<reduce_max_ps>(src_data + o * reduced_dims_work_amount,
+                                                              reduced_dims_work_amount, init_value);
+            });
+            return true;
+        case Reduce::Min:
+            init_value = (std::numeric_limits<float>::max)();
+            parallel_for(work_amount_dst, [&](size_t o) {
+                dst_data[o] = reduce_slice_f32<reduce_min_ps>(src_data + o * reduced_dims_work_amount,
+                                                              reduced_dims_work_amount, init_value);
+            });
+            return true;
+        case Reduce::Prod:
+            init_value = 1.0f;
+            parallel_for(work_amount_dst, [&](size_t o) {
+                dst_data[o] = reduce_slice_f32<reduce_mul_ps>(src_data + o * reduced_dims_work_amount,
+                                                              reduced_dims_work_amount, init_value);
+            });
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <>
+bool ReduceImpl::reduce_dense<int8_t, int8_t>(
+    const int8_t *src_data,
+    int8_t       *dst_data,
+    size_t        work_amount_dst,
+    size_t        reduced_dims_work_amount
+) {
+    int8_t init_value;
+    switch (reduceMode) {
+        case Reduce::Sum:
+        case Reduce::Mean:
+            init_value = 0;
+            parallel_for(work_amount_dst, [&](size_t o) {
+                dst_data[o] = reduce_slice_i8<reduce_add_epi8>(src_data + o * reduced_dims_work_amount,
+                                                               reduced_dims_work_amount, init_value);
+            });
+            return true;
+        case Reduce::Max:
+            init_value = (std::numeric_limits<int8_t>::min)();
+            parallel_for(work_amount_dst, [&](size_t o) {
+                dst_data[o] = reduce_slice_i8<reduce_max_epi8>(src_data + o * reduced_dims_work_amount,
+                                                               reduced_dims_work_amount, init_value);
+            });
+            return true;
+        case Reduce::Min:
+            init_value = (std::numeric_limits<int8_t>::max)();
+            parallel_for(work_amount_dst, [&](size_t o) {
+                dst_data[o] = reduce_slice_i8<reduce_min_epi8>(src_data + o * reduced_dims_work_amount,
+                                                               reduced_dims_work_amount, init_value);
+            });
+            return true;
+        default:
+            // there is no epi8 multiply, so ReduceProd stays on the generic implementation
+            return false;
+    }
+}
+#endif
+
 REG_FACTORY_FOR(ReduceImpl, ReduceAnd);
 REG_FACTORY_FOR(ReduceImpl, ReduceL1);
 REG_FACTORY_FOR(ReduceImpl, ReduceL2);
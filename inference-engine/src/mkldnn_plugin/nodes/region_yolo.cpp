@@ -179,6 +179,30 @@ public:
             do_softmax = layer->GetParamAsBool("do_softmax", true);
             mask = layer->GetParamAsInts("mask", {});
 
+            // Opt-in fused decoding: instead of the activated feature map the layer emits a
+            // compact DetectionOutput-style list of [batch, class, conf, xmin, ymin, xmax, ymax]
+            // rows terminated by a batch id of -1. Activation, anchor decode and confidence
+            // filtering happen in one sweep, so cells below the threshold never pay for the
+            // per-class work. The pipeline enabling it reshapes the layer output accordingly.
+            do_decode = layer->GetParamAsBool("decode", false);
+            if (do_decode) {
+                anchors = layer->GetParamAsFloats("anchors", {});
+                confidence_threshold = layer->GetParamAsFloat("confidence_threshold", 0.5f);
+                // Yolo v3 anchors are in pixels of the network input, which the layer cannot
+                // see; the pipeline passes the input resolution along. When absent, anchors
+                // are taken in grid cells (the Yolo v2 convention).
+                img_h = layer->GetParamAsInt("img_h", 0);
+                img_w = layer->GetParamAsInt("img_w", 0);
+
+                if (coords != 4)
+                    THROW_IE_EXCEPTION << "Decode mode supports only coords == 4!";
+                int boxes = do_softmax ? num
+                        : (mask.empty() ? 0 : *std::max_element(mask.begin(), mask.end()) + 1);
+                if (static_cast<int>(anchors.size()) < 2 * boxes)
+                    THROW_IE_EXCEPTION << "Decode mode got " << anchors.size()
+                                       << " anchor values for " << boxes << " boxes!";
+            }
+
             block_size = 1;
             if (mayiuse(avx512_common)) {
                 logistic_kernel.reset(new jit_uni_logistic_kernel_f32<avx512_common>());
@@ -211,6 +235,9 @@ public:
         int IC = (inputs[0]->getTensorDesc().getDims().size() > 1) ? inputs[0]->getTensorDesc().getDims()[1] : 1;
         int B = (inputs[0]->getTensorDesc().getDims().size() > 0) ? inputs[0]->getTensorDesc().getDims()[0] : 1;
 
+        if (do_decode)
+            return decode(src_data, dst_data, outputs[0]->size(), B, IH, IW);
+
         parallel_for(B * IC * IH * IW, [&](int i) {
             dst_data[i] = src_data[i];
         });
@@ -256,6 +283,12 @@ private:
     float do_softmax;
     std::vector<int> mask;
 
+    bool do_decode = false;
+    std::vector<float> anchors;
+    float confidence_threshold = 0.5f;
+    int img_h = 0;
+    int img_w = 0;
+
     int block_size;
     std::shared_ptr<jit_uni_logistic_kernel> logistic_kernel;
     std::shared_ptr<SoftmaxGeneric> softmax_kernel;
@@ -281,6 +314,97 @@ private:
         return src;
     }
 
+    // One kernel invocation over the whole range: the jit kernel handles the
+    // vector tail itself, and decode() already threads over anchor planes.
+    inline void calculate_logistic(const float* src, float* dst, int count) {
+        if (logistic_kernel) {
+            auto arg = jit_args_logistic();
+            arg.src = src;
+            arg.dst = dst;
+            arg.work_amount = static_cast<size_t>(count);
+            (*logistic_kernel)(&arg);
+        } else {
+            for (int i = 0; i < count; i++) {
+                dst[i] = logistic_scalar(src[i]);
+            }
+        }
+    }
+
+    StatusCode decode(const float* src_data, float* dst_data, size_t dst_size, int B, int IH, int IW) {
+        const int DETECTION_SIZE = 7;
+        int num_ = do_softmax ? num : static_cast<int>(mask.size());
+        int entry_size = classes + coords + 1;
+        int inputs_size = IH * IW * num_ * entry_size;
+        float w_norm = img_w > 0 ? static_cast<float>(img_w) : static_cast<float>(IW);
+        float h_norm = img_h > 0 ? static_cast<float>(img_h) : static_cast<float>(IH);
+
+        std::vector<std::vector<float>> detections(B * num_);
+        parallel_for(B * num_, [&](int bn) {
+            int b = bn / num_;
+            int n = bn % num_;
+            const float* entry = src_data + b * inputs_size + n * IW * IH * entry_size;
+
+            // the objectness plane is contiguous: sigmoid it vectorized in one sweep,
+            // then only the cells passing the threshold pay for box and class decode
+            std::vector<float> obj(IH * IW);
+            calculate_logistic(entry + coords * IW * IH, obj.data(), IH * IW);
+
+            float anchor_w = anchors[2 * (do_softmax ? n : mask[n])] / w_norm;
+            float anchor_h = anchors[2 * (do_softmax ? n : mask[n]) + 1] / h_norm;
+            std::vector<float> probs(classes);
+            auto& out = detections[bn];
+            for (int i = 0; i < IH * IW; i++) {
+                if (obj[i] < confidence_threshold)
+                    continue;
+
+                float x = (i % IW + logistic_scalar(entry[0 * IW * IH + i])) / IW;
+                float y = (i / IW + logistic_scalar(entry[1 * IW * IH + i])) / IH;
+                float w = std::exp(entry[2 * IW * IH + i]) * anchor_w;
+                float h = std::exp(entry[3 * IW * IH + i]) * anchor_h;
+
+                if (do_softmax) {
+                    float max = entry[(coords + 1) * IW * IH + i];
+                    for (int c = 1; c < classes; c++)
+                        max = std::max(max, entry[(coords + 1 + c) * IW * IH + i]);
+                    float sum = 0.f;
+                    for (int c = 0; c < classes; c++) {
+                        probs[c] = std::exp(entry[(coords + 1 + c) * IW * IH + i] - max);
+                        sum += probs[c];
+                    }
+                    for (int c = 0; c < classes; c++)
+                        probs[c] /= sum;
+                } else {
+                    for (int c = 0; c < classes; c++)
+                        probs[c] = logistic_scalar(entry[(coords + 1 + c) * IW * IH + i]);
+                }
+
+                for (int c = 0; c < classes; c++) {
+                    float conf = obj[i] * probs[c];
+                    if (conf < confidence_threshold)
+                        continue;
+                    out.push_back(static_cast<float>(b));
+                    out.push_back(static_cast<float>(c));
+                    out.push_back(conf);
+                    out.push_back(x - w / 2);
+                    out.push_back(y - h / 2);
+                    out.push_back(x + w / 2);
+                    out.push_back(y + h / 2);
+                }
+            }
+        });
+
+        size_t capacity = dst_size / DETECTION_SIZE * DETECTION_SIZE;
+        size_t pos = 0;
+        for (auto& out : detections) {
+            size_t count = std::min(out.size(), capacity - pos);
+            std::copy(out.begin(), out.begin() + count, dst_data + pos);
+            pos += count;
+        }
+        if (pos < capacity)
+            dst_data[pos] = -1.f;
+        return OK;
+    }
+
     inline void calculate_logistic(int start_index, int count, float* dst_data) {
         if (logistic_kernel) {
             int blocks_num = div_up(count, block_size);
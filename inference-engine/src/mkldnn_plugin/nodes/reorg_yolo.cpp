@@ -4,6 +4,7 @@
 
 #include "base.hpp"
 #include <vector>
+#include <ie_parallel.hpp>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -37,25 +38,22 @@ public:
         int ic_off = IC / (stride * stride);
         int ih_off = IH * stride;
         int iw_off = IW * stride;
-        for (int b = 0; b < B; b++) {
-            for (int ic = 0; ic < IC; ic++) {
-                for (int ih = 0; ih < IH; ih++) {
-                    for (int iw = 0; iw < IW; iw++) {
-                        int dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
+        parallel_for2d(B, IC, [&](int b, int ic) {
+            int oc = ic % ic_off;
+            int offset = ic / ic_off;
+            for (int ih = 0; ih < IH; ih++) {
+                for (int iw = 0; iw < IW; iw++) {
+                    int dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
 
-                        int oc = ic % ic_off;
-                        int offset = ic / ic_off;
+                    int ow = iw * stride + offset % stride;
+                    int oh = ih * stride + offset / stride;
 
-                        int ow = iw * stride + offset % stride;
-                        int oh = ih * stride + offset / stride;
+                    int srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
 
-                        int srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
-
-                        dst_data[dstIndex] = src_data[srcIndex];
-                    }
+                    dst_data[dstIndex] = src_data[srcIndex];
                 }
             }
-        }
+        });
         return OK;
     }
 
@@ -11,7 +11,7 @@
 #include <algorithm>
 #include <limits>
 #include "ie_parallel.hpp"
-#include "common/simple_copy.h"
+#include "common/element_copy.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -121,6 +121,9 @@ private:
         const uint8_t *src_updates = updates->cbuffer().as<const uint8_t *>() + updates->getTensorDesc().getBlockingDesc().getOffsetPadding();
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t data_size = data->getTensorDesc().getPrecision().size();
+        // element width resolved to a typed kernel once per execute; the per update
+        // copies below move one whole element instead of looping over its bytes
+        const element_copy_fn copy_element = element_copy_for_width(data_size);
 
         InferenceEngine::SizeVector index_dims = indexes->getTensorDesc().getDims();
         InferenceEngine::SizeVector data_dims = data->getTensorDesc().getDims();
@@ -132,45 +135,87 @@ private:
                 splitter(output->size(), nthr, ithr, start, end);
                 size_t size = (end - start) * data_size;
                 start *= data_size;
-                simple_copy(dst_data + start, size, src_data + start, size);
+                copy_element(dst_data + start, src_data + start, size);
             });
         }
 
-        parallel_nt(0, [&](const int ithr, const int nthr) {
-            int j;
-            size_t i, dst_idx = 0, start = 0, end = 0;
-            SizeVector counters(index_dims.size(), 0);
-            splitter(indexes->size(), nthr, ithr, start, end);
-            for (j = index_dims.size() - 1, i = start; j >= 0; j--) {
-                counters[j] = i % index_dims[j];
+        const size_t index_count = indexes->size();
+        const size_t axis_dim = data_dims[axis];
+
+        // offset of the update destination with the axis coordinate left out;
+        // the scattered index supplies that coordinate
+        auto dst_offset_for = [&](size_t iwork) {
+            size_t dst_idx = 0, i = iwork;
+            for (int j = index_dims.size() - 1; j >= 0; j--) {
+                size_t counter = i % index_dims[j];
                 i /= index_dims[j];
+                if (j != axis)
+                    dst_idx += counter * dataStrides[j];
+            }
+            return dst_idx;
+        };
+
+        const size_t chunks = parallel_get_max_threads();
+        const size_t buckets = std::min(chunks, axis_dim);
+        if (buckets <= 1) {
+            // the destination cannot be partitioned along the axis, apply in index order
+            for (size_t iwork = 0; iwork < index_count; iwork++) {
+                unsigned int idx = static_cast<unsigned int>(src_index[iwork]);
+                if (idx < axis_dim)
+                    copy_element(dst_data + data_size * (dst_offset_for(iwork) + idx * dataStrides[axis]),
+                                 src_updates + iwork * data_size, data_size);
             }
+            return;
+        }
 
-            for (i = 0; i < static_cast<size_t>(axis); ++i)
-                dst_idx += counters[i] * dataStrides[i];
-            for (i++; i < data_dims.size(); ++i)
-                dst_idx += counters[i] * dataStrides[i];
+        // Radix pass over the indices: the updates are bucketed by the destination region
+        // along the scatter axis, so every region is applied by exactly one thread and
+        // duplicated indices keep the last-write-wins order of a sequential scatter.
+        const size_t bucket_size = (axis_dim + buckets - 1) / buckets;
+        std::vector<size_t> hist(chunks * buckets, 0);
+        parallel_for(chunks, [&](size_t chunk) {
+            size_t start = 0, end = 0;
+            splitter(index_count, chunks, chunk, start, end);
+            size_t *chunk_hist = &hist[chunk * buckets];
+            for (size_t iwork = start; iwork < end; iwork++) {
+                unsigned int idx = static_cast<unsigned int>(src_index[iwork]);
+                if (idx < axis_dim)
+                    chunk_hist[idx / bucket_size]++;
+            }
+        });
 
+        // exclusive scan ordered by (bucket, chunk) keeps the entries of every bucket
+        // in their original order across the per-chunk pieces
+        std::vector<size_t> bucket_start(buckets + 1, 0);
+        size_t sum = 0;
+        for (size_t b = 0; b < buckets; b++) {
+            bucket_start[b] = sum;
+            for (size_t chunk = 0; chunk < chunks; chunk++) {
+                size_t count = hist[chunk * buckets + b];
+                hist[chunk * buckets + b] = sum;
+                sum += count;
+            }
+        }
+        bucket_start[buckets] = sum;
+
+        std::vector<size_t> order(sum);
+        parallel_for(chunks, [&](size_t chunk) {
+            size_t start = 0, end = 0;
+            splitter(index_count, chunks, chunk, start, end);
+            size_t *chunk_cursor = &hist[chunk * buckets];
             for (size_t iwork = start; iwork < end; iwork++) {
                 unsigned int idx = static_cast<unsigned int>(src_index[iwork]);
-                if (idx < data_dims[axis])
-                    simple_copy(dst_data + data_size * (dst_idx + idx * dataStrides[axis]), data_size,
-                                src_updates + iwork * data_size, data_size);
-
-                for (j = index_dims.size() - 1; j >= 0; j--) {
-                    counters[j]++;
-                    if (counters[j] < index_dims[j]) {
-                        if (j != static_cast<size_t>(axis))
-                            dst_idx += dataStrides[j];
-                        break;
-                    } else {
-                        counters[j] = 0;
-                        for (dst_idx = 0, i = 0; i < static_cast<size_t>(axis); ++i)
-                            dst_idx += counters[i] * dataStrides[i];
-                        for (i++; i < data_dims.size(); ++i)
-                            dst_idx += counters[i] * dataStrides[i];
-                    }
-                }
+                if (idx < axis_dim)
+                    order[chunk_cursor[idx / bucket_size]++] = iwork;
+            }
+        });
+
+        parallel_for(buckets, [&](size_t b) {
+            for (size_t p = bucket_start[b]; p < bucket_start[b + 1]; p++) {
+                size_t iwork = order[p];
+                unsigned int idx = static_cast<unsigned int>(src_index[iwork]);
+                copy_element(dst_data + data_size * (dst_offset_for(iwork) + idx * dataStrides[axis]),
+                             src_updates + iwork * data_size, data_size);
             }
         });
     }
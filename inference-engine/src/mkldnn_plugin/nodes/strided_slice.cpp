@@ -10,6 +10,7 @@
 #include <cassert>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include <cpu_isa_traits.hpp>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -144,6 +145,21 @@ public:
                 addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN),
                                    DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
             }
+
+            //  A blocked data layout is also offered for the cases without axis modification, so the
+            //  Reorder nodes MKLDNNGraph inserts around the slice disappear when the surrounding
+            //  nodes run blocked. Values of 'begin', 'end' and 'stride' are known at execution time
+            //  only; non channel-aligned slices fall back to a per-element blocked copy there.
+            if (shrink_axis == 0 && new_axis == 0 && ellipsis_mask_counter == 0 &&
+                    (src_dims.size() == 4 || src_dims.size() == 5) && src_dims.size() == dst_dims.size() &&
+                    layer->insData[STRIDEDSLICE_DATA].lock()->getTensorDesc().getPrecision() == Precision::FP32 &&
+                    layer->outData[0]->getTensorDesc().getPrecision() == Precision::FP32) {
+                ConfLayout blkLayout = mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::avx512_common) ? ConfLayout::BLK16
+                                                                                                    : ConfLayout::BLK8;
+                std::vector<DataConfigurator> blkInConfs(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+                blkInConfs[STRIDEDSLICE_DATA] = DataConfigurator(blkLayout);
+                addConfig(layer, blkInConfs, { DataConfigurator(blkLayout) });
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -230,6 +246,15 @@ public:
                 return PARAMETER_MISMATCH;
         }
 
+        const auto& srcBlockingDesc = inputs[STRIDEDSLICE_DATA]->getTensorDesc().getBlockingDesc();
+        if (srcBlockingDesc.getBlockDims().size() == src_dims.size() + 1) {
+            //  Blocked layout is only configured for the cases without axis modification
+            strided_slice_blk(src_data, dst_data, srcBlockingDesc.getBlockDims(), srcBlockingDesc.getStrides(),
+                              outputs[0]->getTensorDesc().getBlockingDesc().getBlockDims(),
+                              outputs[0]->getTensorDesc().getBlockingDesc().getStrides());
+            return OK;
+        }
+
         if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0 &&
                 stride_dms[stride_dms.size()-1] == 1 && stride_dms.size() > 1)
             strided_slice_vp(src_data, dst_data);
@@ -250,6 +275,9 @@ private:
     void strided_slice(const float *src_data, float* dst_data, std::vector<size_t> &dims);
     void strided_slice_vp(const float *src_data, float* dst_data);
     void strided_slice_p(const float *src_data, float* dst_data);
+    void strided_slice_blk(const float *src_data, float* dst_data,
+                           const SizeVector &srcBlockDims, const SizeVector &srcBlkStrides,
+                           const SizeVector &dstBlockDims, const SizeVector &dstBlkStrides);
 
     SizeVector begin_dims;
     SizeVector end_dims;
@@ -375,6 +403,112 @@ void StridedSliceImpl::strided_slice_p(const float *src_data, float* dst_data) {
     });
 }
 
+void StridedSliceImpl::strided_slice_blk(const float *src_data, float* dst_data,
+                                         const SizeVector &srcBlockDims, const SizeVector &srcBlkStrides,
+                                         const SizeVector &dstBlockDims, const SizeVector &dstBlkStrides) {
+    const int blk = srcBlockDims.back();
+    const size_t dims_size = dst_dims.size();
+
+    //  the whole padded volume is rewritten below, so stale values never leak through the padding
+    memset(dst_data, 0, dstBlkStrides[0] * dstBlockDims[0] * sizeof(float));
+
+    const bool channel_aligned = stride_dms[1] == 1 && (begin_dms[1] % blk) == 0 &&
+            ((static_cast<int>(dst_dims[1]) % blk) == 0 || (begin_dms[1] == 0 && dst_dims[1] == src_dims[1]));
+
+    if (channel_aligned) {
+        //  Vectorized copy: the innermost dimension is moved as contiguous blk-wide rows,
+        //  outer dimensions are N, C/blk and the remaining spatial dimensions
+        const size_t inner_pos = dims_size - 1;
+        const size_t inner_out = dst_dims[inner_pos];
+        const int inner_stride = stride_dms[inner_pos];
+        const int inner_begin = begin_dms[inner_pos];
+
+        SizeVector outer_dims;
+        outer_dims.push_back(dst_dims[0]);
+        outer_dims.push_back(dstBlockDims[1]);
+        for (size_t d = 2; d < inner_pos; d++)
+            outer_dims.push_back(dst_dims[d]);
+
+        size_t work_amount_dst = 1;
+        for (auto d : outer_dims)
+            work_amount_dst *= d;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            SizeVector counters(outer_dims.size(), 0);
+            splitter(work_amount_dst, nthr, ithr, start, end);
+            size_t i = start;
+            for (int j = static_cast<int>(outer_dims.size()) - 1; j >= 0; j--) {
+                counters[j] = i % outer_dims[j];
+                i /= outer_dims[j];
+            }
+            for (size_t iwork = start; iwork < end; ++iwork) {
+                int src_idx = (begin_dms[0] + static_cast<int>(counters[0]) * stride_dms[0]) * srcBlkStrides[0] +
+                              (begin_dms[1] / blk + static_cast<int>(counters[1])) * srcBlkStrides[1];
+                int dst_idx = counters[0] * dstBlkStrides[0] + counters[1] * dstBlkStrides[1];
+                for (size_t d = 2; d < outer_dims.size(); d++) {
+                    src_idx += (begin_dms[d] + static_cast<int>(counters[d]) * stride_dms[d]) * srcBlkStrides[d];
+                    dst_idx += counters[d] * dstBlkStrides[d];
+                }
+
+                if (inner_stride == 1) {
+                    memcpy(&dst_data[dst_idx], &src_data[src_idx + inner_begin * blk], inner_out * blk * sizeof(float));
+                } else {
+                    int s = src_idx + inner_begin * blk;
+                    int p = dst_idx;
+                    for (size_t w = 0; w < inner_out; w++, s += inner_stride * blk, p += blk)
+                        memcpy(&dst_data[p], &src_data[s], blk * sizeof(float));
+                }
+
+                for (int j = static_cast<int>(outer_dims.size()) - 1; j >= 0; j--) {
+                    counters[j]++;
+                    if (counters[j] < outer_dims[j])
+                        break;
+                    else
+                        counters[j] = 0;
+                }
+            }
+        });
+    } else {
+        //  Per-element fallback for slices which break the channel blocks
+        size_t work_amount_dst = 1;
+        for (auto d : dst_dims)
+            work_amount_dst *= d;
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            SizeVector counters(dims_size, 0);
+            splitter(work_amount_dst, nthr, ithr, start, end);
+            size_t i = start;
+            for (int j = static_cast<int>(dims_size) - 1; j >= 0; j--) {
+                counters[j] = i % dst_dims[j];
+                i /= dst_dims[j];
+            }
+            for (size_t iwork = start; iwork < end; ++iwork) {
+                const int src_c = begin_dms[1] + static_cast<int>(counters[1]) * stride_dms[1];
+                int src_idx = (begin_dms[0] + static_cast<int>(counters[0]) * stride_dms[0]) * srcBlkStrides[0] +
+                              (src_c / blk) * srcBlkStrides[1] + src_c % blk;
+                int dst_idx = counters[0] * dstBlkStrides[0] +
+                              (counters[1] / blk) * dstBlkStrides[1] + counters[1] % blk;
+                for (size_t d = 2; d < dims_size; d++) {
+                    src_idx += (begin_dms[d] + static_cast<int>(counters[d]) * stride_dms[d]) * srcBlkStrides[d];
+                    dst_idx += counters[d] * dstBlkStrides[d];
+                }
+
+                dst_data[dst_idx] = src_data[src_idx];
+
+                for (int j = static_cast<int>(dims_size) - 1; j >= 0; j--) {
+                    counters[j]++;
+                    if (counters[j] < dst_dims[j])
+                        break;
+                    else
+                        counters[j] = 0;
+                }
+            }
+        });
+    }
+}
+
 REG_FACTORY_FOR(StridedSliceImpl, StridedSlice);
 
 }  // namespace Cpu
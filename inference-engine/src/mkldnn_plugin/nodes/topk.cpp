@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
+#include <utility>
 #include <functional>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
@@ -457,6 +459,104 @@ public:
         });
     }
 
+    // Partitioned selection over the last (dense) axis for long axes: threads select
+    // local top K candidates over disjoint chunks of the axis, then the candidates are
+    // merged serially (chunks * K elements, negligible against the axis length).
+    // The K-th best value of the filled window is an admission threshold, so whole
+    // vector blocks with no admissible element are rejected with a single compare.
+    template <class Compare1, template <typename> class Compare2>
+    void topk_partitioned(const float* src_data, float* dst_data, int* dst_idx, int chunks) {
+        for (int i0 = 0; i0 < before_num; i0++) {
+            const float* src = src_data + static_cast<size_t>(i0) * dim;
+            std::vector<float> cand_values(static_cast<size_t>(chunks) * src_k);
+            std::vector<int> cand_indexes(static_cast<size_t>(chunks) * src_k);
+
+            parallel_for(chunks, [&](int c) {
+                // axis_chunks() guarantees every chunk holds at least K elements
+                const int begin = c * dim / chunks;
+                const int end = (c + 1) * dim / chunks;
+                float* values = &cand_values[static_cast<size_t>(c) * src_k];
+                int* indexes = &cand_indexes[static_cast<size_t>(c) * src_k];
+
+                auto insert_func = [&](float value, int index) {
+                    values[src_k - 1] = value;
+                    indexes[src_k - 1] = index;
+                    for (int i = src_k - 1; i > 0 && Compare2<float>()(values[i], values[i - 1]); i--) {
+                        std::swap(values[i], values[i - 1]);
+                        std::swap(indexes[i], indexes[i - 1]);
+                    }
+                };
+
+                for (int i = 0; i < src_k; i++) {
+                    values[i] = src[begin + i];
+                    indexes[i] = begin + i;
+                }
+                for (int i2 = 0; i2 < src_k - 1; i2++) {
+                    for (int i3 = src_k - 1; i3 > i2; i3--) {
+                        if (Compare2<float>()(values[i3], values[i3 - 1])) {
+                            std::swap(values[i3], values[i3 - 1]);
+                            std::swap(indexes[i3], indexes[i3 - 1]);
+                        }
+                    }
+                }
+
+                int i = begin + src_k;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                for (; i + block_size <= end; i += block_size) {
+                    vec_type_f vthresh = _mm_uni_set1_ps(values[src_k - 1]);
+                    vec_type_f vsrc = _mm_uni_loadu_ps(src + i);
+                    vmask_type vmask = Compare1::cmp_ps(vsrc, vthresh);
+#if defined(HAVE_AVX512F)
+                    unsigned mask = vmask;
+#else
+                    unsigned mask = _mm_uni_movemask_ps(vmask);
+#endif
+                    for (int lane = 0; mask; lane++, mask >>= 1) {
+                        if ((mask & 1) && Compare2<float>()(src[i + lane], values[src_k - 1]))
+                            insert_func(src[i + lane], i + lane);
+                    }
+                }
+#endif
+                for (; i < end; i++) {
+                    if (Compare2<float>()(src[i], values[src_k - 1]))
+                        insert_func(src[i], i);
+                }
+            });
+
+            // merge per-chunk candidates into the final selection
+            std::vector<float> max_values(cand_values.begin(), cand_values.begin() + src_k);
+            std::vector<int> max_indexes(cand_indexes.begin(), cand_indexes.begin() + src_k);
+            for (size_t i = src_k; i < cand_values.size(); i++) {
+                if (Compare2<float>()(cand_values[i], max_values[src_k - 1])) {
+                    max_values[src_k - 1] = cand_values[i];
+                    max_indexes[src_k - 1] = cand_indexes[i];
+                    for (int i2 = src_k - 1; i2 > 0 && Compare2<float>()(max_values[i2], max_values[i2 - 1]); i2--) {
+                        std::swap(max_values[i2], max_values[i2 - 1]);
+                        std::swap(max_indexes[i2], max_indexes[i2 - 1]);
+                    }
+                }
+            }
+            if (!sort_value) {
+                for (int i2 = 0; i2 < src_k - 1; i2++) {
+                    for (int i3 = src_k - 1; i3 > i2; i3--) {
+                        if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
+                            std::swap(max_values[i3], max_values[i3 - 1]);
+                            std::swap(max_indexes[i3], max_indexes[i3 - 1]);
+                        }
+                    }
+                }
+            }
+            if (dst_data) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_data[i0 * src_k + i2] = max_values[i2];
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_idx[i0 * src_k + i2] = max_indexes[i2];
+            }
+        }
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -525,10 +625,17 @@ public:
             }
         } else {
             if (is_last_dim) {
-                if (mode_max)
+                int chunks = axis_chunks();
+                if (chunks > 1) {
+                    if (mode_max)
+                        topk_partitioned<cmpgt_ps, std::greater>(src, dst_data, dst_idx, chunks);
+                    else
+                        topk_partitioned<cmplt_ps, std::less>(src, dst_data, dst_idx, chunks);
+                } else if (mode_max) {
                     topk<std::greater>(src, dst_data, dst_idx, in_dims);
-                else
+                } else {
                     topk<std::less>(src, dst_data, dst_idx, in_dims);
+                }
             } else {
                 if (mode_max)
                     topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
@@ -565,6 +672,19 @@ private:
     const int count_vec = 16;
 #endif
 
+    // Number of partitions of the last axis for topk_partitioned. Returns 1 when
+    // the plain single-pass selection is preferable: short axes, batched outer
+    // dimension which is parallelized as is, or K too large for per-chunk windows.
+    inline int axis_chunks() {
+        const int min_axis_chunk = 4096;
+        if (before_num >= parallel_get_max_threads() || dim < 2 * min_axis_chunk)
+            return 1;
+        int chunks = std::min(parallel_get_max_threads(), dim / min_axis_chunk);
+        while (chunks > 1 && dim / chunks < src_k)
+            chunks--;
+        return chunks;
+    }
+
     inline int count(SizeVector dims, size_t start_ind, size_t end_ind) {
         size_t count = 1;
         for (size_t i = start_ind; i < end_ind; i++)
@@ -0,0 +1,110 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tensor_parallel.h"
+
+#include <details/caseless.hpp>
+#include <details/ie_cnn_network_tools.h>
+#include <ie_layers.h>
+#include <ie_memcpy.h>
+
+#include <ngraph/distributed.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace TensorParallel {
+
+void splitFullyConnected(ICNNNetwork &network) {
+    auto distributed = ngraph::get_distributed_interface();
+    const int groupSize = distributed->get_size();
+    if (groupSize < 2)
+        return;
+    const int rank = distributed->get_rank();
+
+    details::CaselessEq<std::string> equal;
+    for (auto &layer : details::CNNNetSortTopologically(network)) {
+        if (!equal(layer->type, "FullyConnected") && !equal(layer->type, "InnerProduct"))
+            continue;
+        auto *fc = dynamic_cast<WeightableLayer *>(layer.get());
+        if (fc == nullptr || fc->_weights == nullptr ||
+            fc->_weights->getTensorDesc().getPrecision() != Precision::FP32)
+            continue;
+        if (layer->insData.size() != 1 || layer->outData.size() != 1)
+            continue;
+        auto input = layer->insData[0].lock();
+        if (!input || input->getTensorDesc().getDims().size() != 2 ||
+            input->getTensorDesc().getPrecision() != Precision::FP32)
+            continue;
+        // the reduced result flows through an inserted AllReduce node, which
+        // cannot stand in for a network output
+        if (layer->outData[0]->getInputTo().empty())
+            continue;
+
+        const size_t N = input->getTensorDesc().getDims()[0];
+        const size_t K = input->getTensorDesc().getDims()[1];
+        if (K < static_cast<size_t>(groupSize) || fc->_weights->size() % K != 0)
+            continue;
+        const size_t O = fc->_weights->size() / K;
+
+        const size_t chunk = K / groupSize;
+        const size_t k0 = chunk * rank;
+        const size_t kr = (rank == groupSize - 1) ? K - k0 : chunk;
+
+        // each rank materializes only its column slice of the weights
+        auto sliced = make_shared_blob<float>(TensorDesc(Precision::FP32, {O * kr}, Layout::C));
+        sliced->allocate();
+        const float *weights = fc->_weights->cbuffer().as<const float *>();
+        float *slice = sliced->buffer().as<float *>();
+        for (size_t o = 0; o < O; o++) {
+            ie_memcpy(slice + o * kr, kr * sizeof(float), weights + o * K + k0, kr * sizeof(float));
+        }
+        fc->_weights = sliced;
+        fc->blobs["weights"] = sliced;
+        // the bias has to enter the reduced sum exactly once
+        if (rank != 0) {
+            fc->_biases = nullptr;
+            fc->blobs.erase("biases");
+        }
+
+        // crop the replicated activation down to this rank's columns
+        LayerParams cropParams{layer->name + "_tp_crop", "Crop", Precision::FP32};
+        auto crop = std::make_shared<CropLayer>(cropParams);
+        crop->axis = {1};
+        crop->offset = {static_cast<int>(k0)};
+        crop->dim = {static_cast<int>(kr)};
+        DataPtr cropped(new Data(crop->name, TensorDesc(Precision::FP32, {N, kr}, Layout::NC)));
+        cropped->getCreatorLayer() = crop;
+        cropped->getInputTo()[layer->name] = layer;
+        crop->outData.push_back(cropped);
+        crop->insData.push_back(input);
+        layer->insData[0] = cropped;
+        input->getInputTo().erase(layer->name);
+        input->getInputTo()[crop->name] = crop;
+
+        // sum the partial products over the process group
+        LayerParams reduceParams{layer->name + "_tp_allreduce", "AllReduce", Precision::FP32};
+        auto allReduce = std::make_shared<CNNLayer>(reduceParams);
+        DataPtr partial = layer->outData[0];
+        DataPtr reduced(new Data(allReduce->name, partial->getTensorDesc()));
+        reduced->getCreatorLayer() = allReduce;
+        reduced->getInputTo() = partial->getInputTo();
+        for (auto &consumer : reduced->getInputTo()) {
+            for (auto &consumerInput : consumer.second->insData) {
+                if (consumerInput.lock() == partial)
+                    consumerInput = reduced;
+            }
+        }
+        partial->getInputTo().clear();
+        partial->getInputTo()[allReduce->name] = allReduce;
+        allReduce->insData.push_back(partial);
+        allReduce->outData.push_back(reduced);
+    }
+}
+
+}  // namespace TensorParallel
+}  // namespace MKLDNNPlugin
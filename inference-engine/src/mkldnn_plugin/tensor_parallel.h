@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_icnn_network.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Tensor-parallel sharding of FullyConnected layers over the distributed
+ * process group (see ngraph/distributed.hpp). Each rank keeps only its
+ * contiguous column slice of the weights and multiplies the matching slice of
+ * the replicated activation, so a model whose FC weights exceed one machine
+ * can serve from several: the weight memory per rank shrinks by the group
+ * size. The partial products are summed by an inserted AllReduce node, so the
+ * tensors flowing to the rest of the graph are identical on every rank.
+ */
+namespace TensorParallel {
+
+/**
+ * @brief Rewrites every eligible FullyConnected layer of the network into the
+ *        per-rank sharded form: Crop (this rank's activation columns) ->
+ *        FullyConnected (sliced weights) -> AllReduce. Does nothing when the
+ *        process is not part of a distributed group.
+ */
+void splitFullyConnected(InferenceEngine::ICNNNetwork &network);
+
+}  // namespace TensorParallel
+}  // namespace MKLDNNPlugin
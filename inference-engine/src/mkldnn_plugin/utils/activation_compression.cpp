@@ -0,0 +1,80 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "activation_compression.h"
+
+#include <cstring>
+
+namespace MKLDNNPlugin {
+namespace ActivationCompression {
+
+namespace {
+const size_t WORD_BITS = 64;
+}  // namespace
+
+float estimateSparsity(const float *data, size_t count) {
+    if (count == 0)
+        return 0.0f;
+    // at most a few thousand strided probes: enough to separate dense from
+    // post-ReLU sparse tensors without scanning the whole buffer
+    size_t stride = count / 4096;
+    if (stride == 0)
+        stride = 1;
+    size_t probes = 0, zeros = 0;
+    for (size_t i = 0; i < count; i += stride) {
+        zeros += (data[i] == 0.0f) ? 1 : 0;
+        probes++;
+    }
+    return static_cast<float>(zeros) / static_cast<float>(probes);
+}
+
+size_t packedBound(size_t count) {
+    size_t words = (count + WORD_BITS - 1) / WORD_BITS;
+    return words * sizeof(uint64_t) + count * sizeof(float);
+}
+
+size_t pack(const float *src, size_t count, uint8_t *dst) {
+    size_t words = (count + WORD_BITS - 1) / WORD_BITS;
+    uint64_t *bitmap = reinterpret_cast<uint64_t *>(dst);
+    float *values = reinterpret_cast<float *>(dst + words * sizeof(uint64_t));
+
+    size_t stored = 0;
+    for (size_t w = 0; w < words; w++) {
+        uint64_t bits = 0;
+        const size_t base = w * WORD_BITS;
+        const size_t limit = (count - base < WORD_BITS) ? count - base : WORD_BITS;
+        for (size_t b = 0; b < limit; b++) {
+            float value = src[base + b];
+            if (value != 0.0f) {
+                bits |= uint64_t(1) << b;
+                values[stored++] = value;
+            }
+        }
+        bitmap[w] = bits;
+    }
+    return words * sizeof(uint64_t) + stored * sizeof(float);
+}
+
+void unpack(const uint8_t *src, size_t count, float *dst) {
+    size_t words = (count + WORD_BITS - 1) / WORD_BITS;
+    const uint64_t *bitmap = reinterpret_cast<const uint64_t *>(src);
+    const float *values = reinterpret_cast<const float *>(src + words * sizeof(uint64_t));
+
+    size_t taken = 0;
+    for (size_t w = 0; w < words; w++) {
+        const uint64_t bits = bitmap[w];
+        const size_t base = w * WORD_BITS;
+        const size_t limit = (count - base < WORD_BITS) ? count - base : WORD_BITS;
+        if (bits == 0) {
+            memset(dst + base, 0, limit * sizeof(float));
+            continue;
+        }
+        for (size_t b = 0; b < limit; b++) {
+            dst[base + b] = (bits >> b) & 1 ? values[taken++] : 0.0f;
+        }
+    }
+}
+
+}  // namespace ActivationCompression
+}  // namespace MKLDNNPlugin
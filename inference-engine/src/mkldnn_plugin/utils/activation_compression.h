@@ -0,0 +1,47 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Bitmap+values codec for FP32 activation tensors with many zeros.
+ *
+ * Post-ReLU activations are often 60-90% zeros, so moving them dense wastes
+ * bandwidth. The packed form stores one presence bit per element (64-element
+ * words) followed by the non-zero values, cutting the moved bytes roughly by
+ * the zero fraction. The codec is intentionally simple and word-wise: both
+ * sides of a copy are memory-bound, so the scan is paid back as soon as the
+ * tensor is reasonably sparse.
+ */
+namespace ActivationCompression {
+
+/**
+ * @brief Estimates the zero fraction of a tensor from a strided sample,
+ *        cheap enough to decide per copy whether packing pays off
+ */
+float estimateSparsity(const float *data, size_t count);
+
+/**
+ * @brief Worst-case packed size in bytes for a tensor of the given element count
+ */
+size_t packedBound(size_t count);
+
+/**
+ * @brief Packs the tensor into dst (at least packedBound(count) bytes)
+ * @return The packed size in bytes
+ */
+size_t pack(const float *src, size_t count, uint8_t *dst);
+
+/**
+ * @brief Restores the dense tensor from its packed form
+ */
+void unpack(const uint8_t *src, size_t count, float *dst);
+
+}  // namespace ActivationCompression
+}  // namespace MKLDNNPlugin
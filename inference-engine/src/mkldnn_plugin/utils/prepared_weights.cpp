@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "prepared_weights.h"
+
+#include <details/ie_exception.hpp>
+
+#include <string>
+
+namespace MKLDNNPlugin {
+namespace PreparedWeights {
+
+std::string key(const std::string& nodeName, std::size_t blobIndex) {
+    return nodeName + "#" + std::to_string(blobIndex);
+}
+
+void serialize(std::ostream& stream, const Store& store) {
+    std::uint64_t marker = SECTION_MARKER;
+    stream.write(reinterpret_cast<const char*>(&marker), sizeof(marker));
+    std::uint64_t count = store.size();
+    stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+    for (const auto& entry : store) {
+        std::uint32_t keySize = static_cast<std::uint32_t>(entry.first.size());
+        stream.write(reinterpret_cast<const char*>(&keySize), sizeof(keySize));
+        stream.write(entry.first.data(), keySize);
+        std::uint64_t blobSize = entry.second.size();
+        stream.write(reinterpret_cast<const char*>(&blobSize), sizeof(blobSize));
+        stream.write(reinterpret_cast<const char*>(entry.second.data()), blobSize);
+    }
+}
+
+void deserialize(std::istream& stream, Store& store) {
+    std::uint64_t count = 0;
+    stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+    for (std::uint64_t i = 0; i < count; i++) {
+        std::uint32_t keySize = 0;
+        stream.read(reinterpret_cast<char*>(&keySize), sizeof(keySize));
+        std::string entryKey(keySize, '\0');
+        stream.read(&entryKey[0], keySize);
+        std::uint64_t blobSize = 0;
+        stream.read(reinterpret_cast<char*>(&blobSize), sizeof(blobSize));
+        auto& blob = store[entryKey];
+        blob.resize(static_cast<std::size_t>(blobSize));
+        stream.read(reinterpret_cast<char*>(blob.data()), blobSize);
+        if (!stream)
+            THROW_IE_EXCEPTION << "Corrupted prepared weights section: truncated entry " << entryKey;
+    }
+}
+
+}  // namespace PreparedWeights
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+namespace PreparedWeights {
+
+/**
+ * Storage for weight tensors already reordered into the layouts the CPU
+ * primitives execute with. compile_tool performs the reorders offline and
+ * appends the results to the exported blob; on import prepareMemory takes a
+ * matching entry verbatim instead of reordering, which removes the dominant
+ * cost of loading a pre-compiled network.
+ *
+ * The section is best effort: an entry whose byte size does not match the
+ * descriptor chosen on the importing machine is simply ignored and the
+ * weights are reordered as usual.
+ */
+
+/** Written after the weights section to mark trailing prepared weights */
+constexpr std::uint64_t SECTION_MARKER = 0x315750455250574dull;  // "MWPREPW1"
+
+/** Reordered weight blobs keyed by "<node name>#<internal blob index>" */
+using Store = std::map<std::string, std::vector<std::uint8_t>>;
+
+/** Builds the store key of one internal blob of a node */
+std::string key(const std::string& nodeName, std::size_t blobIndex);
+
+/**
+ * Writes the prepared weights section: the marker and the entry count as
+ * uint64, then per entry the key length as uint32, the key bytes, the blob
+ * byte size as uint64 and the blob bytes.
+ */
+void serialize(std::ostream& stream, const Store& store);
+
+/** Reads the section written by serialize; the caller has consumed the marker */
+void deserialize(std::istream& stream, Store& store);
+
+}  // namespace PreparedWeights
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,136 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tensor_tap.h"
+#include "activation_compression.h"
+#include "blob_dump.h"
+
+#include <blob_factory.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+TensorTap::TensorTap(const std::string &dumpDir, bool sparseCapture, size_t ringDepth)
+    : _dumpDir(dumpDir), _sparseCapture(sparseCapture), _ringDepth(std::max<size_t>(ringDepth, 2)) {}
+
+TensorTap::~TensorTap() {
+    if (_drainThread.joinable()) {
+        _stop.store(true, std::memory_order_release);
+        _drainThread.join();
+        // flush the samples captured before the stop flag was seen
+        drainOnce();
+    }
+
+    for (const auto &ring : _rings) {
+        size_t dropped = ring->dropped.load(std::memory_order_relaxed);
+        if (dropped > 0)
+            std::cout << "TensorTap: " << dropped << " sample(s) of " << ring->name
+                      << " dropped because the drain thread fell behind" << std::endl;
+    }
+}
+
+int TensorTap::RegisterTap(const std::string &name, const InferenceEngine::TensorDesc &desc, size_t byteSize) {
+    auto ring = std::unique_ptr<Ring>(new Ring());
+    ring->name = name;
+    std::replace(ring->name.begin(), ring->name.end(), '\\', '_');
+    std::replace(ring->name.begin(), ring->name.end(), '/', '_');
+    std::replace(ring->name.begin(), ring->name.end(), ' ', '_');
+    std::replace(ring->name.begin(), ring->name.end(), ':', '-');
+    ring->desc = desc;
+    if (_sparseCapture && desc.getPrecision() == InferenceEngine::Precision::FP32 &&
+        byteSize % sizeof(float) == 0)
+        ring->elementCount = byteSize / sizeof(float);
+
+    ring->slots.resize(_ringDepth);
+    for (auto &slot : ring->slots)
+        slot.data.resize(ring->elementCount != 0
+                             ? std::max(byteSize, ActivationCompression::packedBound(ring->elementCount))
+                             : byteSize);
+
+    _rings.push_back(std::move(ring));
+    return static_cast<int>(_rings.size()) - 1;
+}
+
+void TensorTap::Start() {
+    if (_rings.empty() || _drainThread.joinable())
+        return;
+    _drainThread = std::thread([this] {
+        while (!_stop.load(std::memory_order_acquire)) {
+            if (!drainOnce())
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+}
+
+void TensorTap::Capture(int tapId, const void *data, size_t byteSize) {
+    Ring &ring = *_rings[tapId];
+    const size_t head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) >= ring.slots.size()) {
+        // losing a sample is preferred over stalling the inference thread
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        ring.captured++;
+        return;
+    }
+
+    Slot &slot = ring.slots[head % ring.slots.size()];
+    slot.packed = false;
+    if (ring.elementCount != 0 && byteSize == ring.elementCount * sizeof(float)) {
+        const float *values = reinterpret_cast<const float *>(data);
+        // the bitmap costs 1/32 of the dense bytes; half zeros leaves a clear win
+        if (ActivationCompression::estimateSparsity(values, ring.elementCount) >= 0.5f) {
+            slot.size = ActivationCompression::pack(values, ring.elementCount, slot.data.data());
+            slot.packed = true;
+        }
+    }
+    if (!slot.packed) {
+        slot.size = std::min(byteSize, slot.data.size());
+        memcpy(slot.data.data(), data, slot.size);
+    }
+    slot.sequence = ring.captured++;
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+bool TensorTap::drainOnce() {
+    bool drained = false;
+    for (auto &ringPtr : _rings) {
+        Ring &ring = *ringPtr;
+        size_t tail = ring.tail.load(std::memory_order_relaxed);
+        while (tail != ring.head.load(std::memory_order_acquire)) {
+            writeSlot(ring, ring.slots[tail % ring.slots.size()]);
+            tail++;
+            // the store frees the slot for the producer
+            ring.tail.store(tail, std::memory_order_release);
+            drained = true;
+        }
+    }
+    return drained;
+}
+
+void TensorTap::writeSlot(const Ring &ring, const Slot &slot) {
+    // the slot keeps raw bytes; wrap them into a blob of the tapped tensor
+    // shape without copying so BlobDumper stores the real precision and dims
+    std::vector<float> dense;
+    const uint8_t *bytes = slot.data.data();
+    if (slot.packed) {
+        dense.resize(ring.elementCount);
+        ActivationCompression::unpack(slot.data.data(), ring.elementCount, dense.data());
+        bytes = reinterpret_cast<const uint8_t *>(dense.data());
+    }
+    InferenceEngine::Blob::Ptr blob =
+        make_blob_with_precision(ring.desc, const_cast<uint8_t *>(bytes));
+
+    std::string file_name = ring.name + "_seq" + std::to_string(slot.sequence) + ".ieb";
+    if (file_name.size() > 240)
+        file_name = file_name.substr(file_name.size() - 240);
+
+    BlobDumper dumper(blob);
+    dumper.dump(_dumpDir + "/" + file_name);
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_blob.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Production-safe capture of selected node outputs during inference.
+ *
+ * Every tapped node owns a single-producer single-consumer ring of
+ * preallocated byte buffers. The inference thread copies the output into
+ * the next free slot and never blocks: when the ring is full the sample is
+ * dropped and counted instead. A background thread drains the rings and
+ * writes the samples to disk in the BlobDumper format, so accuracy drift
+ * can be diagnosed on a live service without serializing inference.
+ *
+ * With sparseCapture enabled FP32 samples whose sampled zero fraction makes
+ * packing worthwhile are stored in the bitmap+values form of
+ * ActivationCompression, so the inference thread writes a fraction of the
+ * dense bytes; the drain thread restores them before dumping.
+ */
+class TensorTap {
+public:
+    typedef std::shared_ptr<TensorTap> Ptr;
+
+    TensorTap(const std::string &dumpDir, bool sparseCapture = false, size_t ringDepth = 8);
+    ~TensorTap();
+
+    TensorTap(const TensorTap&) = delete;
+    TensorTap& operator = (const TensorTap&) = delete;
+
+    /**
+     * Preallocates the ring for one tapped tensor and returns the tap id the
+     * producer passes to Capture(). The byte size is taken separately from the
+     * descriptor because blocked layouts pad the tensor beyond its plain dims.
+     * Must not be called after Start().
+     */
+    int RegisterTap(const std::string &name, const InferenceEngine::TensorDesc &desc, size_t byteSize);
+
+    /**
+     * Starts the drain thread. Call once after all taps are registered.
+     */
+    void Start();
+
+    /**
+     * Copies one sample into the ring of the given tap. Wait-free: the sample
+     * is dropped when the drain thread has fallen behind. Safe to call from
+     * exactly one producer thread per tap.
+     */
+    void Capture(int tapId, const void *data, size_t byteSize);
+
+private:
+    struct Slot {
+        std::vector<uint8_t> data;
+        size_t size = 0;
+        size_t sequence = 0;
+        bool packed = false;
+    };
+
+    struct Ring {
+        std::string name;
+        InferenceEngine::TensorDesc desc;
+        size_t elementCount = 0;    // FP32 element count when packing applies, 0 otherwise
+        std::vector<Slot> slots;
+        // indexes grow monotonically; the slot is (index % slots.size())
+        std::atomic<size_t> head {0};   // next slot the producer fills
+        std::atomic<size_t> tail {0};   // next slot the drain thread reads
+        size_t captured = 0;            // producer-side sample counter
+        std::atomic<size_t> dropped {0};
+    };
+
+    bool drainOnce();
+    void writeSlot(const Ring &ring, const Slot &slot);
+
+    std::string _dumpDir;
+    bool _sparseCapture;
+    size_t _ringDepth;
+    std::vector<std::unique_ptr<Ring>> _rings;
+    std::thread _drainThread;
+    std::atomic<bool> _stop {false};
+};
+
+}  // namespace MKLDNNPlugin
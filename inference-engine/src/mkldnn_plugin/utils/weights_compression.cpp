@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_compression.h"
+
+#include <ie_parallel.hpp>
+#include <details/ie_exception.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace MKLDNNPlugin {
+namespace WeightsCompression {
+
+namespace {
+
+// 1MB chunks: enough of them to feed every thread on import, small enough to
+// keep the match table and the chunk buffers cache-friendly on export
+constexpr std::size_t CHUNK_SIZE = 1 << 20;
+constexpr std::size_t WINDOW_SIZE = 1 << 16;
+constexpr std::size_t MIN_MATCH = 4;
+constexpr std::size_t HASH_BITS = 14;
+
+void putVarint(std::vector<std::uint8_t>& out, std::size_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+const std::uint8_t* getVarint(const std::uint8_t* ptr, const std::uint8_t* end, std::size_t& value) {
+    value = 0;
+    unsigned shift = 0;
+    while (ptr < end && (*ptr & 0x80)) {
+        value |= static_cast<std::size_t>(*ptr++ & 0x7f) << shift;
+        shift += 7;
+    }
+    if (ptr == end)
+        THROW_IE_EXCEPTION << "Corrupted compressed weights chunk: truncated length";
+    value |= static_cast<std::size_t>(*ptr++) << shift;
+    return ptr;
+}
+
+std::uint32_t hash4(const std::uint8_t* ptr) {
+    std::uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+}  // namespace
+
+std::vector<std::uint8_t> compressChunk(const std::uint8_t* data, std::size_t size) {
+    std::vector<std::uint8_t> out;
+    out.reserve(size / 2 + 16);
+    std::vector<std::int64_t> table(std::size_t(1) << HASH_BITS, -1);
+
+    // each sequence is: varint literal count, the literals, varint match
+    // length, 16-bit match offset; a match length of zero terminates the chunk
+    std::size_t pos = 0;
+    std::size_t litStart = 0;
+    while (pos + MIN_MATCH <= size) {
+        const auto hash = hash4(data + pos);
+        const auto candidate = table[hash];
+        table[hash] = static_cast<std::int64_t>(pos);
+        // strict comparison: a distance of exactly WINDOW_SIZE would wrap to 0
+        // in the 16-bit offset and be rejected on import
+        if (candidate >= 0 && pos - candidate < WINDOW_SIZE &&
+            0 == std::memcmp(data + candidate, data + pos, MIN_MATCH)) {
+            std::size_t length = MIN_MATCH;
+            while (pos + length < size && data[candidate + length] == data[pos + length])
+                length++;
+            putVarint(out, pos - litStart);
+            out.insert(out.end(), data + litStart, data + pos);
+            putVarint(out, length);
+            const auto offset = static_cast<std::uint16_t>(pos - candidate);
+            out.push_back(static_cast<std::uint8_t>(offset & 0xff));
+            out.push_back(static_cast<std::uint8_t>(offset >> 8));
+            pos += length;
+            litStart = pos;
+        } else {
+            pos++;
+        }
+    }
+    putVarint(out, size - litStart);
+    out.insert(out.end(), data + litStart, data + size);
+    putVarint(out, 0);
+    return out;
+}
+
+void decompressChunk(const std::uint8_t* data, std::size_t compressedSize,
+                     std::uint8_t* out, std::size_t rawSize) {
+    const std::uint8_t* ptr = data;
+    const std::uint8_t* end = data + compressedSize;
+    std::uint8_t* dst = out;
+    std::uint8_t* dstEnd = out + rawSize;
+    while (ptr < end) {
+        std::size_t litCount = 0;
+        ptr = getVarint(ptr, end, litCount);
+        if (litCount > static_cast<std::size_t>(end - ptr) || litCount > static_cast<std::size_t>(dstEnd - dst))
+            THROW_IE_EXCEPTION << "Corrupted compressed weights chunk: literals out of bounds";
+        std::memcpy(dst, ptr, litCount);
+        ptr += litCount;
+        dst += litCount;
+
+        std::size_t matchLength = 0;
+        ptr = getVarint(ptr, end, matchLength);
+        if (matchLength == 0)
+            break;
+        if (end - ptr < 2)
+            THROW_IE_EXCEPTION << "Corrupted compressed weights chunk: truncated offset";
+        const std::size_t offset = ptr[0] | (static_cast<std::size_t>(ptr[1]) << 8);
+        ptr += 2;
+        if (offset == 0 || offset > static_cast<std::size_t>(dst - out) ||
+            matchLength > static_cast<std::size_t>(dstEnd - dst))
+            THROW_IE_EXCEPTION << "Corrupted compressed weights chunk: match out of bounds";
+        // the match may overlap its own output, so copy byte by byte
+        const std::uint8_t* src = dst - offset;
+        for (std::size_t i = 0; i < matchLength; i++)
+            dst[i] = src[i];
+        dst += matchLength;
+    }
+    if (dst != dstEnd)
+        THROW_IE_EXCEPTION << "Corrupted compressed weights chunk: size mismatch";
+}
+
+void serialize(std::ostream& stream, const std::uint8_t* data, std::uint64_t size) {
+    const auto marker = COMPRESSED_MARKER;
+    stream.write(reinterpret_cast<const char*>(&marker), sizeof(marker));
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    const std::uint64_t chunkSize = CHUNK_SIZE;
+    stream.write(reinterpret_cast<const char*>(&chunkSize), sizeof(chunkSize));
+
+    const auto numChunks = static_cast<std::size_t>((size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    std::vector<std::vector<std::uint8_t>> chunks(numChunks);
+    InferenceEngine::parallel_for(numChunks, [&](std::size_t chunk) {
+        const auto offset = chunk * CHUNK_SIZE;
+        const auto rawSize = std::min<std::size_t>(CHUNK_SIZE, static_cast<std::size_t>(size - offset));
+        chunks[chunk] = compressChunk(data + offset, rawSize);
+        if (chunks[chunk].size() >= rawSize)
+            chunks[chunk].assign(data + offset, data + offset + rawSize);
+    });
+    for (const auto& chunk : chunks) {
+        const auto chunkBytes = static_cast<std::uint32_t>(chunk.size());
+        stream.write(reinterpret_cast<const char*>(&chunkBytes), sizeof(chunkBytes));
+        stream.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+    }
+    if (!stream.good())
+        THROW_IE_EXCEPTION << "Failed to write compressed weights";
+}
+
+void deserialize(std::istream& stream, std::uint8_t* out, std::uint64_t rawSize) {
+    std::uint64_t chunkSize = 0;
+    stream.read(reinterpret_cast<char*>(&chunkSize), sizeof(chunkSize));
+    if (!stream.good() || chunkSize == 0)
+        THROW_IE_EXCEPTION << "Failed to read compressed weights header";
+
+    const auto numChunks = static_cast<std::size_t>((rawSize + chunkSize - 1) / chunkSize);
+    std::vector<std::vector<std::uint8_t>> chunks(numChunks);
+    for (auto& chunk : chunks) {
+        std::uint32_t chunkBytes = 0;
+        stream.read(reinterpret_cast<char*>(&chunkBytes), sizeof(chunkBytes));
+        chunk.resize(chunkBytes);
+        stream.read(reinterpret_cast<char*>(chunk.data()), chunkBytes);
+        if (!stream.good())
+            THROW_IE_EXCEPTION << "Failed to read compressed weights";
+    }
+    InferenceEngine::parallel_for(numChunks, [&](std::size_t chunk) {
+        const auto offset = chunk * static_cast<std::size_t>(chunkSize);
+        const auto chunkRawSize =
+            std::min<std::size_t>(static_cast<std::size_t>(chunkSize), static_cast<std::size_t>(rawSize - offset));
+        if (chunks[chunk].size() == chunkRawSize)
+            std::memcpy(out + offset, chunks[chunk].data(), chunkRawSize);
+        else
+            decompressChunk(chunks[chunk].data(), chunks[chunk].size(), out + offset, chunkRawSize);
+    });
+}
+
+}  // namespace WeightsCompression
+}  // namespace MKLDNNPlugin
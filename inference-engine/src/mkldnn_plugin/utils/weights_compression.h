@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace MKLDNNPlugin {
+namespace WeightsCompression {
+
+/**
+ * Self-contained byte-oriented LZ77 codec for the weights section of an
+ * exported CPU blob. The weights are split into fixed-size chunks which
+ * compress and decompress independently, so the load path spreads the
+ * decompression over all threads while the blob streams in.
+ *
+ * The format favours decompression speed over ratio: greedy matching
+ * against a 64KB window, varint lengths, raw 16-bit offsets. A chunk which
+ * does not shrink is stored as-is.
+ */
+
+/** Written in place of the weights size field to mark a compressed section */
+constexpr std::uint64_t COMPRESSED_MARKER = 0x30505a434e4b574dull;  // "MWKNCZP0"
+
+/** Compresses one chunk; the result may be larger than the input */
+std::vector<std::uint8_t> compressChunk(const std::uint8_t* data, std::size_t size);
+
+/** Decompresses one chunk of the known raw size; throws on corrupted input */
+void decompressChunk(const std::uint8_t* data, std::size_t compressedSize,
+                     std::uint8_t* out, std::size_t rawSize);
+
+/**
+ * Writes the compressed weights section: the marker, the raw size and the
+ * chunk size as uint64, then per chunk its byte count as uint32 followed by
+ * the bytes. A chunk whose byte count equals its raw size is stored raw.
+ */
+void serialize(std::ostream& stream, const std::uint8_t* data, std::uint64_t size);
+
+/**
+ * Reads the section written by serialize. The caller has already consumed
+ * the marker and allocated rawSize bytes; chunks are read sequentially and
+ * decompressed in parallel.
+ */
+void deserialize(std::istream& stream, std::uint8_t* out, std::uint64_t rawSize);
+
+}  // namespace WeightsCompression
+}  // namespace MKLDNNPlugin
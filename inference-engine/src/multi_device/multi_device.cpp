@@ -3,9 +3,12 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <map>
@@ -64,6 +67,33 @@ void MultiDeviceInferRequest::SetBlobsToAnotherRequest(InferRequest& req) {
     }
 }
 
+void MultiDeviceInferRequest::CopyInputsToBatchedRequest(InferRequest& req, size_t batchSlot) {
+    for (const auto &it : _networkInputs) {
+        Blob::Ptr blob;
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        GetBlob(name.c_str(), blob);
+        auto batchedBlob = req.GetBlob(name.c_str());
+        // batch is the outermost dimension, so a batch slot is a contiguous slice of the batched blob
+        std::memcpy(batchedBlob->buffer().as<char*>() + batchSlot * blob->byteSize(),
+                    blob->cbuffer().as<const char*>(),
+                    blob->byteSize());
+    }
+}
+
+void MultiDeviceInferRequest::CopyOutputsFromBatchedRequest(InferRequest& req, size_t batchSlot) {
+    for (const auto &it : _networkOutputs) {
+        Blob::Ptr blob;
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        GetBlob(name.c_str(), blob);
+        auto batchedBlob = req.GetBlob(name.c_str());
+        std::memcpy(blob->buffer().as<char*>(),
+                    batchedBlob->cbuffer().as<const char*>() + batchSlot * blob->byteSize(),
+                    blob->byteSize());
+    }
+}
+
 MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
     const MultiDeviceInferRequest::Ptr&         inferRequest,
     const bool                                  needPerfCounters,
@@ -82,8 +112,37 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
     };
+    if (_multiDeviceExecutableNetwork->_batchSize > 1) {
+        struct BatchedRequestExecutor : public ITaskExecutor {
+            explicit BatchedRequestExecutor(MultiDeviceAsyncInferRequest* _this_) : _this{_this_} {}
+            void run(Task task) override {
+                _this->_multiDeviceExecutableNetwork->RunBatched(_this->_inferRequest.get(), std::move(task));
+            };
+            MultiDeviceAsyncInferRequest* _this = nullptr;
+        };
+        // the task below runs on the batched worker's completion callback, after the outputs were
+        // scattered back to this request. Per-request performance counters are not available in
+        // this mode, since several requests share one device-side inference
+        _pipeline = {
+            {std::make_shared<BatchedRequestExecutor>(this), [] {
+                auto status = MultiDeviceExecutableNetwork::_thisBatchStatus;
+                if (InferenceEngine::StatusCode::OK != status) {
+                    if (nullptr != InferenceEngine::CurrentException()) {
+                        std::rethrow_exception(InferenceEngine::CurrentException());
+                    } else {
+                        THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+                    }
+                }
+            }}
+        };
+        return;
+    }
     _pipeline = {
         {_multiDeviceExecutableNetwork, [this] {
+            if (MultiDeviceExecutableNetwork::_thisRequestExpired) {
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::StatusCode::INFER_NOT_STARTED
+                    << "The deadline of the infer request passed while it was queued";
+            }
             _workerInferRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
             _inferRequest->SetBlobsToAnotherRequest(_workerInferRequest->_inferRequest);
         }},
@@ -118,6 +177,8 @@ MultiDeviceAsyncInferRequest::~MultiDeviceAsyncInferRequest() {
 // ------------------------------MultiDeviceExecutableNetwork----------------------------
 
 thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecutableNetwork::_thisWorkerInferRequest = nullptr;
+thread_local InferenceEngine::StatusCode MultiDeviceExecutableNetwork::_thisBatchStatus = InferenceEngine::StatusCode::OK;
+thread_local bool MultiDeviceExecutableNetwork::_thisRequestExpired = false;
 
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
@@ -142,13 +203,28 @@ struct IdleGuard {
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const DeviceMap<DeviceInformation>&                                  networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
-                                                           const bool                                                           needPerfCounters) :
+                                                           const bool                                                           needPerfCounters,
+                                                           const DeviceMap<InferenceEngine::ExecutableNetwork>&                 batchedNetworksPerDevice,
+                                                           unsigned int                                                         batchSize,
+                                                           unsigned int                                                         batchTimeoutMs,
+                                                           unsigned int                                                         requestDeadlineMs) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
     _devicePriorities{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _batchSize{batchSize},
+    _batchTimeout{batchTimeoutMs},
+    _batchedNetworksPerDevice{batchedNetworksPerDevice} {
+    _requestDeadlineMs = requestDeadlineMs;
     _taskExecutor.reset();
+    {
+        auto deviceOrder = std::make_shared<std::vector<DeviceName>>();
+        for (auto&& networkValue : _networksPerDevice) {
+            deviceOrder->push_back(networkValue.first);
+        }
+        std::atomic_store(&_deviceOrder, std::shared_ptr<const std::vector<DeviceName>>{std::move(deviceOrder)});
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -168,6 +244,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
+        idleWorkerRequests.init(numRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
@@ -188,24 +265,80 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                 });
         }
     }
+    for (auto&& networkValue : _batchedNetworksPerDevice) {
+        auto& device  = networkValue.first;
+        auto& network = networkValue.second;
+
+        unsigned int optimalNum = 0;
+        try {
+            optimalNum = network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const details::InferenceEngineException &iie) {
+            THROW_IE_EXCEPTION
+                    << "Every device used with the Multi-Device should "
+                    << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                    << "Failed to query the metric for the " << device << " with error:" << iie.what();
+        }
+        auto& batchedWorkerRequests = _batchedWorkerRequests[device];
+        auto& idleBatchedWorkerRequests = _idleBatchedWorkerRequests[device];
+        batchedWorkerRequests.resize(optimalNum);
+        idleBatchedWorkerRequests.init(optimalNum);
+        auto* idleBatchedWorkerRequestsPtr = &(idleBatchedWorkerRequests);
+        for (auto&& batchedWorkerRequest : batchedWorkerRequests) {
+            batchedWorkerRequest._inferRequest = network.CreateInferRequest();
+            auto* batchedWorkerRequestPtr = &batchedWorkerRequest;
+            idleBatchedWorkerRequests.push(batchedWorkerRequestPtr);
+            batchedWorkerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [batchedWorkerRequestPtr, this, idleBatchedWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                    batchedWorkerRequestPtr->_status = status;
+                    auto slots = std::move(batchedWorkerRequestPtr->_slots);
+                    for (size_t batchSlot = 0; batchSlot < slots.size(); ++batchSlot) {
+                        if (StatusCode::OK == status) {
+                            slots[batchSlot]._request->CopyOutputsFromBatchedRequest(
+                                batchedWorkerRequestPtr->_inferRequest, batchSlot);
+                        }
+                    }
+                    if (!_terminate) {
+                        idleBatchedWorkerRequestsPtr->push(batchedWorkerRequestPtr);
+                        _batchCondVar.notify_all();
+                    }
+                    // continue the pipelines of all the aggregated requests (this also completes them)
+                    for (auto&& slot : slots) {
+                        _thisBatchStatus = status;
+                        auto capturedTask = std::move(slot._task);
+                        capturedTask();
+                    }
+                });
+        }
+    }
+    if (_batchSize > 1) {
+        _batchCollector = std::thread([this] { CollectBatches(); });
+    }
 }
 
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
-    for (auto&& device : devices) {
-        auto& idleWorkerRequests = _idleWorkerRequests[device.first];
+    // the device order snapshot is swapped wholesale by SetConfig, so no lock is taken here and
+    // the completion callback thread that calls this is never blocked
+    auto deviceOrder = std::atomic_load(&_deviceOrder);
+    for (auto&& device : *deviceOrder) {
+        auto& idleWorkerRequests = _idleWorkerRequests[device];
         WorkerInferRequest* workerRequestPtr = nullptr;
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            Task inferPipelineTask;
-            if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
+            DeadlineTask inferPipelineTask;
+            while (_inferPipelineTasks.try_pop(inferPipelineTask)) {
+                if (inferPipelineTask._deadline < std::chrono::steady_clock::now()) {
+                    // the deadline passed while the request was queued: its first pipeline
+                    // stage reports the expiry instead of occupying the popped worker, and
+                    // the worker stays available for the next task
+                    _thisRequestExpired = true;
+                    inferPipelineTask._task();
+                    _thisRequestExpired = false;
+                    continue;
+                }
                 _thisWorkerInferRequest = workerRequestPtr;
-                inferPipelineTask();
+                inferPipelineTask._task();
                 idleGuard.Release();
-                break;
+                return;
             }
         }
     }
@@ -213,21 +346,101 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     if (!_terminate) {
-        _inferPipelineTasks.push(std::move(inferPipelineTask));
+        DeadlineTask task;
+        task._task = std::move(inferPipelineTask);
+        task._order = _taskOrder++;
+        const auto deadlineMs = _requestDeadlineMs.load();
+        if (deadlineMs > 0) {
+            task._deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(deadlineMs);
+        }
+        _inferPipelineTasks.push(std::move(task));
         ScheduleToWorkerInferRequest();
     }
 }
 
+void MultiDeviceExecutableNetwork::RunBatched(MultiDeviceInferRequest* request, Task task) {
+    if (!_terminate) {
+        BatchSlot slot;
+        slot._request = request;
+        slot._task = std::move(task);
+        {
+            std::lock_guard<std::mutex> lock{_batchMutex};
+            _batchSlots.push_back(std::move(slot));
+        }
+        _batchCondVar.notify_all();
+    }
+}
+
+void MultiDeviceExecutableNetwork::CollectBatches() {
+    while (!_terminate) {
+        std::vector<BatchSlot> slots;
+        {
+            std::unique_lock<std::mutex> lock{_batchMutex};
+            _batchCondVar.wait(lock, [this] { return _terminate || !_batchSlots.empty(); });
+            if (_terminate) {
+                return;
+            }
+            // the window opens with the first queued request and closes when the batch is
+            // either full or the timeout has elapsed
+            const auto deadline = std::chrono::steady_clock::now() + _batchTimeout;
+            _batchCondVar.wait_until(lock, deadline, [this] {
+                return _terminate || (_batchSlots.size() >= _batchSize);
+            });
+            if (_terminate) {
+                return;
+            }
+            const auto count = std::min<std::size_t>(_batchSize, _batchSlots.size());
+            slots.assign(std::make_move_iterator(_batchSlots.begin()),
+                         std::make_move_iterator(_batchSlots.begin() + count));
+            _batchSlots.erase(_batchSlots.begin(), _batchSlots.begin() + count);
+        }
+        // grab an idle batched worker request, preferring the devices in the priority order
+        BatchedWorkerInferRequest* batchedWorkerRequestPtr = nullptr;
+        while (nullptr == batchedWorkerRequestPtr && !_terminate) {
+            auto deviceOrder = std::atomic_load(&_deviceOrder);
+            for (auto&& device : *deviceOrder) {
+                auto itIdleRequests = _idleBatchedWorkerRequests.find(device);
+                if (_idleBatchedWorkerRequests.end() != itIdleRequests &&
+                    itIdleRequests->second.try_pop(batchedWorkerRequestPtr)) {
+                    break;
+                }
+            }
+            if (nullptr == batchedWorkerRequestPtr) {
+                std::unique_lock<std::mutex> lock{_batchMutex};
+                _batchCondVar.wait_for(lock, std::chrono::milliseconds{1});
+            }
+        }
+        if (_terminate) {
+            return;
+        }
+        // gather the inputs into the batched request and submit. Slots that are left unfilled by a
+        // partial batch keep the data of the previous run; their outputs are simply never read back
+        batchedWorkerRequestPtr->_slots = std::move(slots);
+        for (size_t batchSlot = 0; batchSlot < batchedWorkerRequestPtr->_slots.size(); ++batchSlot) {
+            batchedWorkerRequestPtr->_slots[batchSlot]._request->CopyInputsToBatchedRequest(
+                batchedWorkerRequestPtr->_inferRequest, batchSlot);
+        }
+        batchedWorkerRequestPtr->_inferRequest.StartAsync();
+    }
+}
+
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _devicePriorities.clear();
     }
+    std::atomic_store(&_deviceOrder,
+                      std::shared_ptr<const std::vector<DeviceName>>{std::make_shared<std::vector<DeviceName>>()});
     _terminate = true;
+    _batchCondVar.notify_all();
+    if (_batchCollector.joinable()) {
+        _batchCollector.join();
+    }
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` Context are those that are used by Worker infer requests.
      *       But AsyncInferRequest destructor should waits for all asynchronous tasks that are used by the request
      */
     _workerRequests.clear();
+    _batchedWorkerRequests.clear();
 }
 
 InferenceEngine::InferRequestInternal::Ptr MultiDeviceExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -248,10 +461,25 @@ void MultiDeviceExecutableNetwork::CreateInferRequest(IInferRequest::Ptr& asyncR
 
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config,
         InferenceEngine::ResponseDesc * /* resp */) {
+    // the deadline only affects how the requests queued from now on are scheduled,
+    // so it can be changed at any time without draining the pipeline
+    auto deadline = config.find(MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE);
+    if (deadline != config.end() && config.size() == 1) {
+        int val = std::stoi(deadline->second.as<std::string>());
+        if (val < 0) {
+            THROW_IE_EXCEPTION << "Value for KEY_MULTI_REQUEST_DEADLINE must be >= 0, while " << val
+                << " is passed";
+        }
+        _requestDeadlineMs = static_cast<unsigned int>(val);
+        std::lock_guard<std::mutex> lock{_mutex};
+        _config[MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE] = deadline->second;
+        return;
+    }
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
     if (priorities == config.end() || config.size() > 1) {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str <<
-            "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
+            "The only configs supported for the Network's SetConfig are MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES"
+            " and MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE";
     } else {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
@@ -274,6 +502,11 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                 }
             }
             _devicePriorities = metaDevices;
+            auto deviceOrder = std::make_shared<std::vector<DeviceName>>();
+            for (auto&& device : _devicePriorities) {
+                deviceOrder->push_back(device.first);
+            }
+            std::atomic_store(&_deviceOrder, std::shared_ptr<const std::vector<DeviceName>>{std::move(deviceOrder)});
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -318,7 +551,10 @@ void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter
             METRIC_KEY(SUPPORTED_CONFIG_KEYS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_BATCH_SIZE,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_BATCH_TIMEOUT,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE };
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -459,7 +695,10 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
         std::string name = { "MULTI" };
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, name);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_BATCH_SIZE,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_BATCH_TIMEOUT,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
@@ -483,16 +722,70 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
 
     DeviceMap<DeviceInformation> metaDevices = ParseMetaDevices(priorities->second, fullConfig);
 
+    // parse the request aggregation settings, if any
+    unsigned int batchSize = 1;
+    auto batchSizeCfg = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_REQUEST_BATCH_SIZE);
+    if (batchSizeCfg != fullConfig.end()) {
+        int val = std::stoi(batchSizeCfg->second);
+        if (val <= 0) {
+            THROW_IE_EXCEPTION << "Value for KEY_MULTI_REQUEST_BATCH_SIZE must be > 0, while " << val
+                << " is passed";
+        }
+        batchSize = static_cast<unsigned int>(val);
+    }
+    unsigned int batchTimeout = 1;
+    auto batchTimeoutCfg = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_REQUEST_BATCH_TIMEOUT);
+    if (batchTimeoutCfg != fullConfig.end()) {
+        int val = std::stoi(batchTimeoutCfg->second);
+        if (val < 0) {
+            THROW_IE_EXCEPTION << "Value for KEY_MULTI_REQUEST_BATCH_TIMEOUT must be >= 0, while " << val
+                << " is passed";
+        }
+        batchTimeout = static_cast<unsigned int>(val);
+    }
+    unsigned int requestDeadline = 0;
+    auto requestDeadlineCfg = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE);
+    if (requestDeadlineCfg != fullConfig.end()) {
+        int val = std::stoi(requestDeadlineCfg->second);
+        if (val < 0) {
+            THROW_IE_EXCEPTION << "Value for KEY_MULTI_REQUEST_DEADLINE must be >= 0, while " << val
+                << " is passed";
+        }
+        requestDeadline = static_cast<unsigned int>(val);
+    }
+
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    if (batchSizeCfg != fullConfig.end())
+        multiNetworkConfig.insert(*batchSizeCfg);
+    if (batchTimeoutCfg != fullConfig.end())
+        multiNetworkConfig.insert(*batchTimeoutCfg);
+    if (requestDeadlineCfg != fullConfig.end())
+        multiNetworkConfig.insert(*requestDeadlineCfg);
+
+    // a batched version of the network that the coalesced (aggregated) requests are run on
+    ICNNNetwork::Ptr batchedClonedNetwork;
+    if (batchSize > 1) {
+        batchedClonedNetwork = cloneNet(network);
+        ResponseDesc resp;
+        auto status = batchedClonedNetwork->setBatchSize(batchSize, &resp);
+        if (status != StatusCode::OK) {
+            THROW_IE_EXCEPTION << "Failed to set the batch size of " << batchSize
+                << " required for KEY_MULTI_REQUEST_BATCH_SIZE: " << resp.msg;
+        }
+    }
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
+    DeviceMap<ExecutableNetwork> batchedNetworkPerDevice;
     for (auto& p : metaDevices) {
         auto & deviceName = p.first;
         auto & metaDevice = p.second;
         auto & deviceConfig = metaDevice.config;
         executableNetworkPerDevice.insert({ deviceName, GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, deviceName, deviceConfig) });
+        if (batchedClonedNetwork != nullptr) {
+            batchedNetworkPerDevice.insert({ deviceName, GetCore()->LoadNetwork(CNNNetwork{batchedClonedNetwork}, deviceName, deviceConfig) });
+        }
         multiNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
     }
     if (executableNetworkPerDevice.empty())
@@ -505,7 +798,11 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     return std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
                                                           metaDevices,
                                                           multiNetworkConfig,
-                                                          enablePerfCounters);
+                                                          enablePerfCounters,
+                                                          batchedNetworkPerDevice,
+                                                          batchSize,
+                                                          batchTimeout,
+                                                          requestDeadline);
 }
 
 void MultiDeviceInferencePlugin::QueryNetwork(const ICNNNetwork&                        network,
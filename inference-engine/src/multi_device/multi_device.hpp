@@ -6,8 +6,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <mutex>
 #include <queue>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -26,6 +32,7 @@
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 #include <tbb/concurrent_queue.h>
+#include <tbb/concurrent_priority_queue.h>
 #endif
 
 namespace MultiDevicePlugin {
@@ -53,6 +60,10 @@ public:
     }
     // Multi-Device impl specific: sets the data (blobs from the device-less requets to the specific device request)
     void SetBlobsToAnotherRequest(InferenceEngine::InferRequest& req);
+    // Multi-Device impl specific: copies the input data of this (batch-1) request into the given slot of a batched device request
+    void CopyInputsToBatchedRequest(InferenceEngine::InferRequest& req, size_t batchSlot);
+    // Multi-Device impl specific: copies the given slot of the batched device request outputs back into this request
+    void CopyOutputsFromBatchedRequest(InferenceEngine::InferRequest& req, size_t batchSlot);
 };
 
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -89,6 +100,131 @@ protected:
 };
 #endif
 
+#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
+template <typename T, typename C>
+using ThreadSafePriorityQueue = tbb::concurrent_priority_queue<T, C>;
+#else
+template <typename T, typename C>
+class ThreadSafePriorityQueue {
+public:
+    void push(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push(std::move(value));
+    }
+
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_queue.empty()) {
+            value = std::move(const_cast<T&>(_queue.top()));
+            _queue.pop();
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+protected:
+    std::priority_queue<T, std::vector<T>, C>   _queue;
+    std::mutex                                  _mutex;
+};
+#endif
+
+// an infer pipeline task together with its absolute deadline; without the deadline feature
+// every task carries time_point::max() and the order counter keeps plain arrival order
+struct DeadlineTask {
+    std::chrono::steady_clock::time_point   _deadline = std::chrono::steady_clock::time_point::max();
+    uint64_t                                _order = 0;
+    InferenceEngine::Task                   _task;
+};
+
+// priority queues pop the largest element, so "largest" has to mean the earliest deadline,
+// with the arrival order breaking the ties
+struct DeadlineTaskCompare {
+    bool operator()(const DeadlineTask& left, const DeadlineTask& right) const {
+        return std::tie(right._deadline, right._order) < std::tie(left._deadline, left._order);
+    }
+};
+
+// Bounded lock-free multi-producer/multi-consumer queue (the array-based design by Dmitry Vyukov):
+// every cell carries a sequence number that tells whether the cell is ready for the next push or
+// the next pop. Used for the idle worker request lists, whose capacity is known upfront, so that
+// scheduling work from a completion callback thread never takes a lock
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    // sets the capacity (rounded up to a power of two). Must be called before the first push
+    void init(std::size_t capacity) {
+        std::size_t size = 1;
+        while (size < capacity) {
+            size *= 2;
+        }
+        _buffer.reset(new Cell[size]);
+        _bufferMask = size - 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            _buffer[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    // the capacity is sized for every item that can ever be in flight, so a full-looking cell only
+    // means a pop at the same position is still completing; spin until it does rather than fail and
+    // lose the item
+    void push(T value) {
+        Cell* cell = nullptr;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_buffer[pos & _bufferMask];
+            const std::size_t sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto dif = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (dif == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (dif < 0) {
+                std::this_thread::yield();
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_buffer[pos & _bufferMask];
+            const std::size_t sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto dif = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (dif == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (dif < 0) {
+                return false;  // the queue is empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_sequence.store(pos + _bufferMask + 1, std::memory_order_release);
+        return true;
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+    std::unique_ptr<Cell[]>         _buffer;
+    std::size_t                     _bufferMask = 0;
+    std::atomic<std::size_t>        _enqueuePos = {0};
+    std::atomic<std::size_t>        _dequeuePos = {0};
+};
+
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
                                      public ITaskExecutor {
 public:
@@ -98,12 +234,27 @@ public:
         Task                            _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
     };
-    using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
+    using NotBusyWorkerRequests = LockFreeBoundedQueue<WorkerInferRequest*>;
+    // one application-level (batch-1) request waiting to be coalesced into a batched inference
+    struct BatchSlot {
+        MultiDeviceInferRequest*        _request = nullptr;
+        Task                            _task;
+    };
+    struct BatchedWorkerInferRequest {
+        InferenceEngine::InferRequest   _inferRequest;
+        std::vector<BatchSlot>          _slots;
+        InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+    };
+    using NotBusyBatchedWorkerRequests = LockFreeBoundedQueue<BatchedWorkerInferRequest*>;
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const DeviceMap<DeviceInformation>&                                        networkDevices,
                                           const std::unordered_map<std::string, InferenceEngine::Parameter>&    config,
-                                          const bool                                                            needPerfCounters = false);
+                                          const bool                                                            needPerfCounters = false,
+                                          const DeviceMap<InferenceEngine::ExecutableNetwork>&                  batchedNetworksPerDevice = {},
+                                          unsigned int                                                          batchSize = 1,
+                                          unsigned int                                                          batchTimeoutMs = 1,
+                                          unsigned int                                                          requestDeadlineMs = 0);
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config, InferenceEngine::ResponseDesc *resp) override;
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
@@ -115,17 +266,41 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest();
+    // enqueues the request to be coalesced with others into one batched inference
+    void RunBatched(MultiDeviceInferRequest* request, Task task);
+    // body of the collector thread: waits out the batching window, gathers the inputs and submits
+    void CollectBatches();
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
+    // status of the batched inference the current task was part of, valid only inside its pipeline stage
+    static thread_local InferenceEngine::StatusCode             _thisBatchStatus;
+    // set by the scheduler around a task whose deadline passed while it was queued, so the
+    // first pipeline stage reports the expiry instead of starting the device inference
+    static thread_local bool                                    _thisRequestExpired;
     std::atomic_bool                                            _terminate = {false};
     std::mutex                                                  _mutex;
     DeviceMap<DeviceInformation>                                _devicePriorities;
+    // read-only snapshot of the device order, swapped wholesale by SetConfig, so that the
+    // scheduler and the batch collector read it without taking `_mutex`
+    std::shared_ptr<const std::vector<DeviceName>>              _deviceOrder;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
-    ThreadSafeQueue<Task>                                       _inferPipelineTasks;
+    ThreadSafePriorityQueue<DeadlineTask, DeadlineTaskCompare>  _inferPipelineTasks;
+    // relative deadline given to every queued request; 0 keeps plain arrival order
+    std::atomic<unsigned int>                                   _requestDeadlineMs = {0};
+    std::atomic<uint64_t>                                       _taskOrder = {0};
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    unsigned int                                                _batchSize = 1;
+    std::chrono::milliseconds                                   _batchTimeout = std::chrono::milliseconds{1};
+    DeviceMap<InferenceEngine::ExecutableNetwork>               _batchedNetworksPerDevice;
+    DeviceMap<NotBusyBatchedWorkerRequests>                     _idleBatchedWorkerRequests;
+    DeviceMap<std::vector<BatchedWorkerInferRequest>>           _batchedWorkerRequests;
+    std::deque<BatchSlot>                                       _batchSlots;
+    std::mutex                                                  _batchMutex;
+    std::condition_variable                                     _batchCondVar;
+    std::thread                                                 _batchCollector;
 };
 
 class MultiDeviceAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -10,6 +10,7 @@
 
 #include "cpp_interfaces/exception2status.hpp"
 #include "ie_iinfer_request.hpp"
+#include "ie_memory_accounting.hpp"
 #include "ie_preprocess.hpp"
 #include "ie_profiling.hpp"
 
@@ -33,6 +34,7 @@ public:
 
     StatusCode Infer(ResponseDesc* resp) noexcept override {
         IE_PROFILING_AUTO_SCOPE(Infer);
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Infer);
         TO_STATUS(_impl->Infer());
     }
 
@@ -49,6 +51,10 @@ public:
         TO_STATUS(_impl->SetBlob(name, data, info));
     }
 
+    StatusCode SetBlobs(const BlobMap& blobs, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->SetBlobs(blobs));
+    }
+
     StatusCode GetBlob(const char* name, Blob::Ptr& data, ResponseDesc* resp) noexcept override {
         TO_STATUS(_impl->GetBlob(name, data));
     }
@@ -87,6 +93,10 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetPriority(Priority priority, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->SetPriority(priority));
+    }
+
 private:
     ~InferRequestBase() = default;
 };
@@ -45,6 +45,11 @@ public:
         _userData = data;
     }
 
+    void SetPriority(IInferRequest::Priority priority) override {
+        (void)priority;
+        THROW_IE_EXCEPTION << "Request priority is not supported";
+    }
+
     /**
      * @brief Set weak pointer to the corresponding public interface: IInferRequest. This allow to pass it to
      * IInferRequest::CompletionCallback
@@ -13,6 +13,7 @@
 #include <ie_system_conf.h>
 
 #include <exception>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
@@ -131,6 +132,81 @@ public:
         }
     }
 
+    /**
+     * @brief A one-shot completion token used by Await().
+     *        The token receives the pipeline status and, if the pipeline failed, the exception.
+     */
+    using CompletionToken = std::function<void(StatusCode, std::exception_ptr)>;
+
+    /**
+     * @brief Registers a completion token for the pipeline started last.
+     *        Unlike Wait() no thread is parked on the request: the token is invoked exactly once
+     *        when the pipeline finishes, on `executor` if one is given, otherwise in the context
+     *        of the thread which finished the pipeline. If the pipeline has already finished or
+     *        was never started the token is dispatched right away. This lets an event loop await
+     *        thousands of outstanding requests from a handful of threads.
+     * @param token    The completion token
+     * @param executor Optional executor the token is posted to
+     */
+    void Await(CompletionToken token, const ITaskExecutor::Ptr& executor = {}) {
+        if (nullptr == token) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Completion token should not be empty";
+        }
+        std::shared_future<void> future;
+        {
+            std::lock_guard<std::mutex> lock {_mutex};
+            future = _futures.empty() ? std::shared_future<void> {} : _futures.back();
+            if (future.valid() && (std::future_status::ready != future.wait_for(std::chrono::milliseconds {0}))) {
+                _completionTokens.emplace_back(std::move(token), executor);
+                return;
+            }
+        }
+
+        // the pipeline has finished already or was never started - dispatch right away
+        StatusCode status = StatusCode::INFER_NOT_STARTED;
+        std::exception_ptr exception = nullptr;
+        if (future.valid()) {
+            status = StatusCode::OK;
+            try {
+                future.get();
+            } catch (details::InferenceEngineException& ie_ex) {
+                status = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
+                exception = std::current_exception();
+            } catch (...) {
+                status = StatusCode::GENERAL_ERROR;
+                exception = std::current_exception();
+            }
+        }
+        DispatchCompletionToken({std::move(token), executor}, status, exception);
+    }
+
+    /**
+     * @brief Adds a hook executed on every successful pipeline completion, before the
+     *        completion callback is called and before Wait() is released. Hooks run in
+     *        the context of the final pipeline stage, i.e. on the callback executor when
+     *        one is configured, so output post-processing overlaps the next request
+     *        started on the device instead of serializing on the caller thread. A plugin
+     *        may expose its raw output memory to the hooks, letting them skip the blob
+     *        copy-out. A throwing hook fails the request the same way a failing pipeline
+     *        stage does; hooks are not run when the pipeline itself failed.
+     * @param hook The hook to run
+     */
+    void AddCompletionHook(Task hook) {
+        if (nullptr == hook) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Completion hook should not be empty";
+        }
+        std::lock_guard<std::mutex> lock {_mutex};
+        _completionHooks.emplace_back(std::move(hook));
+    }
+
+    /**
+     * @brief Removes all hooks registered with AddCompletionHook
+     */
+    void ClearCompletionHooks() {
+        std::lock_guard<std::mutex> lock {_mutex};
+        _completionHooks.clear();
+    }
+
     /**
      * @brief Sets the pointer to public interface.
      * @note Needed to correctly handle ownership between objects
@@ -184,7 +260,8 @@ protected:
             try {
                 auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
                 IE_ASSERT(nullptr != firstStageExecutor);
-                firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+                firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)),
+                                        _taskPriority);
             } catch (...) {
                 _promise.set_exception(std::current_exception());
                 throw;
@@ -236,6 +313,7 @@ protected:
     ITaskExecutor::Ptr _syncCallbackExecutor;  //!< Used to run post inference callback in synchronous pipline
     Pipeline _pipeline;  //!< Pipeline variable that should be filled by inherited class.
     Pipeline _syncPipeline;  //!< Synchronous pipeline variable that should be filled by inherited class.
+    TaskPriority _taskPriority = TaskPriority::NORMAL;  //!< Scheduling priority used for pipeline stage tasks.
 
     void StartAsync_ThreadUnsafe() override {
         _syncRequest->checkBlobs();
@@ -258,6 +336,10 @@ protected:
         _syncRequest->SetBlob(name, data, info);
     }
 
+    void SetBlobs_ThreadUnsafe(const BlobMap& blobs) override {
+        _syncRequest->SetBlobs(blobs);
+    }
+
     void GetBlob_ThreadUnsafe(const char* name, Blob::Ptr& data) override {
         _syncRequest->GetBlob(name, data);
     }
@@ -283,7 +365,24 @@ protected:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetPriority_ThreadUnsafe(IInferRequest::Priority priority) override {
+        _taskPriority = (IInferRequest::PRIORITY_HIGH == priority) ? TaskPriority::HIGH : TaskPriority::NORMAL;
+    }
+
 private:
+    using TokenEntry = std::pair<CompletionToken, ITaskExecutor::Ptr>;
+
+    static void DispatchCompletionToken(TokenEntry entry, StatusCode status, std::exception_ptr exception) {
+        if (nullptr != entry.second) {
+            auto token = std::move(entry.first);
+            entry.second->run([token, status, exception] () mutable {
+                token(status, exception);
+            });
+        } else {
+            entry.first(status, exception);
+        }
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -312,7 +411,8 @@ private:
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)),
+                                           _taskPriority);
                 }
             } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
                 requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
@@ -327,6 +427,24 @@ private:
                     auto promise = std::move(_promise);
                     auto callback = _callback.load();
                     if (setIsRequestBusy(false)) {
+                        if (nullptr == localCurrentException && StatusCode::OK == requestStatus) {
+                            std::vector<Task> hooks;
+                            {
+                                std::lock_guard<std::mutex> lock {_mutex};
+                                hooks = _completionHooks;
+                            }
+                            try {
+                                for (auto&& hook : hooks) {
+                                    hook();
+                                }
+                            } catch (details::InferenceEngineException& ie_ex) {
+                                requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
+                                localCurrentException = std::current_exception();
+                            } catch (...) {
+                                requestStatus = StatusCode::GENERAL_ERROR;
+                                localCurrentException = std::current_exception();
+                            }
+                        }
                         if (nullptr != callback) {
                             InferenceEngine::CurrentException() = localCurrentException;
                             try {
@@ -341,6 +459,14 @@ private:
                         } else {
                             promise.set_exception(localCurrentException);
                         }
+                        std::vector<TokenEntry> tokens;
+                        {
+                            std::lock_guard<std::mutex> lock {_mutex};
+                            tokens.swap(_completionTokens);
+                        }
+                        for (auto&& entry : tokens) {
+                            DispatchCompletionToken(std::move(entry), requestStatus, localCurrentException);
+                        }
                     }
                 };
 
@@ -359,6 +485,8 @@ private:
     std::promise<void> _promise;
     mutable std::mutex _mutex;
     Futures _futures;
+    std::vector<TokenEntry> _completionTokens;
+    std::vector<Task> _completionHooks;
     bool _stop = false;
 };
 }  // namespace InferenceEngine
@@ -117,6 +117,11 @@ public:
         SetBlob_ThreadUnsafe(name, data, info);
     }
 
+    void SetBlobs(const BlobMap& blobs) override {
+        CheckBusy();
+        SetBlobs_ThreadUnsafe(blobs);
+    }
+
     void GetBlob(const char* name, Blob::Ptr& data) override {
         CheckBusy();
         GetBlob_ThreadUnsafe(name, data);
@@ -131,6 +136,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetPriority(IInferRequest::Priority priority) override {
+        CheckBusy();
+        SetPriority_ThreadUnsafe(priority);
+    }
+
 protected:
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
@@ -198,6 +208,14 @@ protected:
      */
     virtual void SetBlob_ThreadUnsafe(const char* name, const Blob::Ptr& data, const PreProcessInfo& info) = 0;
 
+    /**
+     * @brief Sets several blobs in one call thread unsafe.
+     * @note Used by AsyncInferRequestThreadSafeInternal::SetBlobs which ensures thread-safety
+     *       and calls this method after.
+     * @param[in]  blobs  The map of input / output blobs to set accessed by blob names
+     */
+    virtual void SetBlobs_ThreadUnsafe(const BlobMap& blobs) = 0;
+
     /**
      * @brief Gets the input or output blob thread unsafe.
      * @note Used by AsyncInferRequestThreadSafeInternal::GetBlob which ensures thread-safety
@@ -223,6 +241,14 @@ protected:
      * @param[in]  batch  The dynamic batch value
      */
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    /**
+     * @brief Sets the scheduling priority thread unsafe.
+     * @note Used by AsyncInferRequestThreadSafeInternal::SetPriority which ensures thread-safety
+     *       and calls this method after.
+     * @param[in]  priority  The scheduling priority
+     */
+    virtual void SetPriority_ThreadUnsafe(IInferRequest::Priority priority) = 0;
 };
 
 }  // namespace InferenceEngine
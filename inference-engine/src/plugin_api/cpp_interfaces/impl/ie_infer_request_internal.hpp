@@ -70,63 +70,30 @@ public:
      */
     void SetBlob(const char* name, const Blob::Ptr& data) override {
         IE_PROFILING_AUTO_SCOPE(SetBlob)
-        if (name == nullptr) {
-            THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blob with empty name";
-        }
-        if (!data) THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << name << "\'";
-        const bool compoundBlobPassed = data->is<CompoundBlob>();
-        if (!compoundBlobPassed && data->buffer() == nullptr)
-            THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
-        if (data->size() == 0) {
-            THROW_IE_EXCEPTION << "Input data is empty. Input name: \'" << name << "\'";
-        }
-
         InputInfo::Ptr foundInput;
         DataPtr foundOutput;
-        size_t dataSize = data->size();
-        if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-            if (foundInput->getPrecision() != data->getTensorDesc().getPrecision()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
-                                   << "Failed to set Blob with precision not corresponding to user input precision";
-            }
-
-            const bool preProcRequired = preProcessingRequired(foundInput, data);
-            if (compoundBlobPassed && !preProcRequired) {
-                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
-                                   << "cannot set compound blob: supported only for input pre-processing";
-            }
+        checkBlobToSet(name, data, foundInput, foundOutput);
+        setBlobChecked(name, data, foundInput);
+    }
 
-            if (preProcRequired) {
-                if (_preProcData.find(name) == _preProcData.end()) {
-                    _preProcData.emplace(name, CreatePreprocDataHelper());
-                }
-                _preProcData[name]->isApplicable(data, _inputs[name]);
-                // Stores the given blob as ROI blob. It will be used to fill in network input
-                // during pre-processing
-                _preProcData[name]->setRoiBlob(data);
-            } else {
-                size_t inputSize = details::product(foundInput->getTensorDesc().getDims());
-                if (dataSize != inputSize) {
-                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size (" << dataSize
-                                       << "!=" << inputSize << ").";
-                }
-                _inputs[name] = data;
-            }
-        } else {
-            if (compoundBlobPassed) {
-                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
-                                   << "cannot set compound blob: supported only for input pre-processing";
-            }
-            size_t outputSize = details::product(foundOutput->getDims());
-            if (dataSize != outputSize) {
-                THROW_IE_EXCEPTION << "Output blob size is not equal network output size (" << dataSize
-                                   << "!=" << outputSize << ").";
-            }
-            if (foundOutput->getPrecision() != data->getTensorDesc().getPrecision()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
-                                   << "Failed to set Blob with precision not corresponding to user output precision";
-            }
-            _outputs[name] = data;
+    /**
+     * @brief Given optional implementation of setting several blobs in one call to avoid need for it to be
+     * implemented by plugin. The whole batch is validated before any blob is set, so a failing entry does not
+     * leave the request with a partially updated blob set.
+     * @param blobs - a map of input or output blobs accessed by blob names. The type of each Blob must
+     * correspond to the network input or output precision and size.
+     */
+    void SetBlobs(const BlobMap& blobs) override {
+        IE_PROFILING_AUTO_SCOPE(SetBlobs)
+        std::map<std::string, InputInfo::Ptr> foundInputs;
+        for (auto&& blob : blobs) {
+            InputInfo::Ptr foundInput;
+            DataPtr foundOutput;
+            checkBlobToSet(blob.first.c_str(), blob.second, foundInput, foundOutput);
+            foundInputs[blob.first] = foundInput;
+        }
+        for (auto&& blob : blobs) {
+            setBlobChecked(blob.first.c_str(), blob.second, foundInputs[blob.first]);
         }
     }
 
@@ -289,6 +256,87 @@ protected:
         }
     }
 
+    /**
+     * @brief Runs all SetBlob validations for a @p name / @p data pair without modifying the request state
+     * @param name A name of input or output blob
+     * @param data The blob to validate
+     * @param foundInput A pointer to input information if @p name is an input
+     * @param foundOutput A pointer to output DataPtr if @p name is an output
+     */
+    void checkBlobToSet(const char* name, const Blob::Ptr& data, InputInfo::Ptr& foundInput,
+                        DataPtr& foundOutput) {
+        if (name == nullptr) {
+            THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set blob with empty name";
+        }
+        if (!data) THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty blob with name: \'" << name << "\'";
+        const bool compoundBlobPassed = data->is<CompoundBlob>();
+        if (!compoundBlobPassed && data->buffer() == nullptr)
+            THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
+        if (data->size() == 0) {
+            THROW_IE_EXCEPTION << "Input data is empty. Input name: \'" << name << "\'";
+        }
+
+        size_t dataSize = data->size();
+        if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
+            if (foundInput->getPrecision() != data->getTensorDesc().getPrecision()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                                   << "Failed to set Blob with precision not corresponding to user input precision";
+            }
+
+            const bool preProcRequired = preProcessingRequired(foundInput, data);
+            if (compoundBlobPassed && !preProcRequired) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
+                                   << "cannot set compound blob: supported only for input pre-processing";
+            }
+
+            if (!preProcRequired) {
+                size_t inputSize = details::product(foundInput->getTensorDesc().getDims());
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size (" << dataSize
+                                       << "!=" << inputSize << ").";
+                }
+            }
+        } else {
+            if (compoundBlobPassed) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
+                                   << "cannot set compound blob: supported only for input pre-processing";
+            }
+            size_t outputSize = details::product(foundOutput->getDims());
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size (" << dataSize
+                                   << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getPrecision() != data->getTensorDesc().getPrecision()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                                   << "Failed to set Blob with precision not corresponding to user output precision";
+            }
+        }
+    }
+
+    /**
+     * @brief Stores a blob which already passed checkBlobToSet into the request
+     * @param name A name of input or output blob
+     * @param data The blob to set
+     * @param foundInput The input information resolved by checkBlobToSet, nullptr for an output blob
+     */
+    void setBlobChecked(const char* name, const Blob::Ptr& data, const InputInfo::Ptr& foundInput) {
+        if (foundInput) {
+            if (preProcessingRequired(foundInput, data)) {
+                if (_preProcData.find(name) == _preProcData.end()) {
+                    _preProcData.emplace(name, CreatePreprocDataHelper());
+                }
+                _preProcData[name]->isApplicable(data, _inputs[name]);
+                // Stores the given blob as ROI blob. It will be used to fill in network input
+                // during pre-processing
+                _preProcData[name]->setRoiBlob(data);
+            } else {
+                _inputs[name] = data;
+            }
+        } else {
+            _outputs[name] = data;
+        }
+    }
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -66,6 +66,12 @@ public:
      * @param callback - function to be called with the following description:
      */
     virtual void SetCompletionCallback(IInferRequest::CompletionCallback callback) = 0;
+
+    /**
+     * @brief Set scheduling priority used by the following StartAsync calls for this request
+     * @param priority A new scheduling priority
+     */
+    virtual void SetPriority(IInferRequest::Priority priority) = 0;
 };
 
 }  // namespace InferenceEngine
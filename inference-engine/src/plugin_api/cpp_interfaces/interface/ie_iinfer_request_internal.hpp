@@ -54,6 +54,15 @@ public:
      */
     virtual void SetBlob(const char* name, const Blob::Ptr& data) = 0;
 
+    /**
+     * @brief Set several input/output blobs in one call
+     * @note Memory allocation doesn't happen. All blobs are validated before any of them is set,
+     * so a failure leaves the request unchanged.
+     * @param blobs - a map of input or output blobs accessed by blob names. The type of each Blob must
+     * correspond to the network input or output precision and size.
+     */
+    virtual void SetBlobs(const BlobMap& blobs) = 0;
+
     /**
      * @brief Get input/output data to infer
      * @note Memory allocation doesn't happen
@@ -44,6 +44,27 @@ DECLARE_CONFIG_KEY(SUBNETWORK_WITH_NETWORK_INPUTS);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Explicit comma-separated list of logical cpu ids the CPU Executor Streams pin their threads to
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_THREAD_BINDING_CORE_LIST);
+
+/**
+ * @brief Confines each stream to a contiguous group of this many cores, so streams do not
+ *        straddle sub-NUMA clusters or L2 complexes of that size
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_THREAD_BINDING_GROUP_SIZE);
+
+/**
+ * @brief Makes idle CPU Executor Stream workers spin for this many microseconds before parking
+ *        on the condition variable, trading idle cpu for low-jitter task dispatch; 0 parks
+ *        immediately
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_SPIN_WAIT_US);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -53,4 +53,16 @@ static const char OUTPUT_LAYOUTS[] = "outputLayouts";
  */
 static const char EXECUTION_ORDER[] = "execOrder";
 
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the number of bytes the executable
+ *        primitive read from its input edges since the execution graph was previously queried.
+ */
+static const char EDGE_BYTES_READ[] = "edgeBytesRead";
+
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the number of bytes the executable
+ *        primitive wrote to its output edges since the execution graph was previously queried.
+ */
+static const char EDGE_BYTES_WRITTEN[] = "edgeBytesWritten";
+
 }  // namespace ExecGraphInfoSerialization
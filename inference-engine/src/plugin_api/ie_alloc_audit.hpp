@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Debug accounting of heap allocations on the inference hot path
+ * @file ie_alloc_audit.hpp
+ */
+
+#pragma once
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Returns whether allocation auditing was requested.
+ *
+ * Auditing is enabled by setting the IE_ALLOC_AUDIT environment variable to a non-zero
+ * value before the process starts. When enabled, the core library counts every operator
+ * new call made while an audit scope is open on the calling thread, and prints a per-label
+ * summary to stderr at process exit, so per-request allocations can be tracked down to the
+ * node that makes them. When disabled the scopes cost one thread local check.
+ */
+INFERENCE_ENGINE_API_CPP(bool) AllocAuditEnabled() noexcept;
+
+/**
+ * @brief Opens an audit scope labeled @p label on the calling thread
+ *
+ * Scopes may nest; allocations are counted towards every scope open on the thread, so an
+ * outer "Infer" scope sees the totals and the inner per-node scopes the breakdown.
+ * The label must stay valid until the matching AllocAuditEnd.
+ */
+INFERENCE_ENGINE_API_CPP(void) AllocAuditBegin(const char* label) noexcept;
+
+/**
+ * @brief Closes the innermost audit scope and records its allocation delta
+ */
+INFERENCE_ENGINE_API_CPP(void) AllocAuditEnd() noexcept;
+
+/**
+ * @brief RAII helper opening an audit scope for the lifetime of the object
+ */
+struct AllocAuditScope {
+    explicit AllocAuditScope(const char* label) {
+        AllocAuditBegin(label);
+    }
+    ~AllocAuditScope() {
+        AllocAuditEnd();
+    }
+    AllocAuditScope(const AllocAuditScope&) = delete;
+    AllocAuditScope& operator=(const AllocAuditScope&) = delete;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Optional 2MB huge-page backing for large allocations
+ * @file ie_large_pages.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Enables or disables huge-page backing for subsequent large allocations.
+ *
+ * Off by default. A plugin turns it on when its configuration asks for large pages;
+ * the setting is process wide because the default system allocator is shared.
+ */
+INFERENCE_ENGINE_API_CPP(void) SetLargePagesEnabled(bool enabled) noexcept;
+
+/**
+ * @brief Returns whether huge-page backing is currently enabled
+ */
+INFERENCE_ENGINE_API_CPP(bool) LargePagesEnabled() noexcept;
+
+/**
+ * @brief Allocates memory backed by 2MB pages when possible.
+ *
+ * Returns nullptr - and the caller is expected to fall back to a regular allocation -
+ * when huge pages are disabled, the size is below one huge page, or the platform does
+ * not support them. When no pre-reserved huge pages are available the allocation falls
+ * back to transparent huge pages, so the call succeeds and the kernel may still back
+ * the range with 2MB pages.
+ */
+INFERENCE_ENGINE_API_CPP(void*) AllocLargePages(std::size_t size) noexcept;
+
+/**
+ * @brief Releases an allocation made by AllocLargePages.
+ *
+ * Returns false when the handle was not huge-page backed, in which case the caller
+ * owns the release through its regular path.
+ */
+INFERENCE_ENGINE_API_CPP(bool) FreeLargePages(void* handle) noexcept;
+
+}  // namespace InferenceEngine
@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Process-wide accounting of allocations made through Inference Engine allocators
+ * @file ie_memory_accounting.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Tracks current and peak allocated byte counts per pipeline phase.
+ *
+ * The accounting covers allocations routed through the default system allocator, which
+ * backs Blob memory. Each allocation is attributed to the phase active on the allocating
+ * thread (model read, ngraph conversion, compilation or inference), so process RSS can be
+ * split between weights, intermediates and framework overhead without an external heap
+ * profiler. The snapshot is exposed through the MEMORY_ACCOUNTING Core metric.
+ */
+class INFERENCE_ENGINE_API_CLASS(MemoryAccounting) {
+public:
+    /**
+     * @brief Pipeline phase an allocation is attributed to
+     */
+    enum class Phase : std::size_t {
+        Read = 0,       //!< Core::ReadNetwork
+        Transform = 1,  //!< conversion of the ngraph function to the legacy representation
+        Compile = 2,    //!< Core::LoadNetwork / Core::ImportNetwork
+        Infer = 3,      //!< synchronous inference calls
+        Other = 4,      //!< everything outside the phases above
+    };
+
+    /**
+     * @brief Returns the process-wide accounting instance
+     */
+    static MemoryAccounting& get() noexcept;
+
+    /**
+     * @brief Records an allocation attributed to the phase active on the current thread
+     */
+    void allocated(void* handle, std::size_t size) noexcept;
+
+    /**
+     * @brief Records that the given allocation was released
+     */
+    void freed(void* handle) noexcept;
+
+    /**
+     * @brief Returns <PHASE>_CURRENT and <PHASE>_PEAK byte counters plus TOTAL_CURRENT / TOTAL_PEAK
+     */
+    std::map<std::string, uint64_t> report() const;
+
+    /**
+     * @brief Makes the given phase active on the current thread for the scope lifetime
+     */
+    class INFERENCE_ENGINE_API_CLASS(ScopedPhase) final {
+    public:
+        explicit ScopedPhase(Phase phase) noexcept;
+        ~ScopedPhase();
+
+        ScopedPhase(const ScopedPhase&) = delete;
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+    private:
+        Phase _previous;
+    };
+
+private:
+    MemoryAccounting() = default;
+
+    struct Counters {
+        uint64_t current = 0;
+        uint64_t peak = 0;
+
+        void add(uint64_t size) noexcept {
+            current += size;
+            if (current > peak) {
+                peak = current;
+            }
+        }
+    };
+
+    struct Allocation {
+        std::size_t size;
+        Phase phase;
+    };
+
+    static constexpr std::size_t _phasesCount = 5;
+
+    mutable std::mutex _mutex;
+    Counters _perPhase[_phasesCount];
+    Counters _total;
+    std::unordered_map<void*, Allocation> _allocations;
+};
+
+}  // namespace InferenceEngine
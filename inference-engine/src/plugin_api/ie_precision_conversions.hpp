@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Vectorized array conversions between U8, FP32, BF16 and FP16 with runtime ISA dispatch
+ * @file ie_precision_conversions.hpp
+ */
+
+#pragma once
+
+#include <ie_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+
+/**
+ * @brief A namespace with array precision-conversion helpers. The implementations pick a
+ *        vectorized kernel at runtime when the processor supports it and fall back to
+ *        scalar code otherwise.
+ * @ingroup ie_dev_api_precision
+ */
+namespace PrecisionConversions {
+
+/**
+ * @brief Converts an array of unsigned 8-bit integers to 32-bit floats
+ * @param[in]  src   Source array
+ * @param[out] dst   Destination array
+ * @param[in]  count Number of elements
+ */
+INFERENCE_ENGINE_API_CPP(void) convertArrayU8ToF32(const uint8_t* src, float* dst, size_t count);
+
+/**
+ * @brief Converts an array of 32-bit floats to unsigned 8-bit integers. Values outside
+ *        [0, 255] saturate to the nearest bound, in-range values truncate toward zero.
+ * @param[in]  src   Source array
+ * @param[out] dst   Destination array
+ * @param[in]  count Number of elements
+ */
+INFERENCE_ENGINE_API_CPP(void) convertArrayF32ToU8(const float* src, uint8_t* dst, size_t count);
+
+/**
+ * @brief Converts an array of bfloat16 values (stored as 16-bit integers) to 32-bit floats
+ * @param[in]  src   Source array
+ * @param[out] dst   Destination array
+ * @param[in]  count Number of elements
+ */
+INFERENCE_ENGINE_API_CPP(void) convertArrayBF16ToF32(const int16_t* src, float* dst, size_t count);
+
+/**
+ * @brief Converts an array of 32-bit floats to bfloat16 with rounding to nearest even
+ * @param[in]  src   Source array
+ * @param[out] dst   Destination array
+ * @param[in]  count Number of elements
+ */
+INFERENCE_ENGINE_API_CPP(void) convertArrayF32ToBF16(const float* src, int16_t* dst, size_t count);
+
+/**
+ * @brief Converts an array of FP16 values (stored as 16-bit integers) to 32-bit floats
+ *        applying `dst = src * scale + bias`
+ * @param[in]  src   Source array
+ * @param[out] dst   Destination array
+ * @param[in]  count Number of elements
+ * @param[in]  scale Scale applied after the conversion
+ * @param[in]  bias  Bias applied after the conversion
+ */
+INFERENCE_ENGINE_API_CPP(void)
+convertArrayF16ToF32(const short* src, float* dst, size_t count, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief Converts an array of 32-bit floats to FP16 applying `dst = src * scale + bias`
+ *        before the conversion
+ * @param[in]  src   Source array
+ * @param[out] dst   Destination array
+ * @param[in]  count Number of elements
+ * @param[in]  scale Scale applied before the conversion
+ * @param[in]  bias  Bias applied before the conversion
+ */
+INFERENCE_ENGINE_API_CPP(void)
+convertArrayF32ToF16(const float* src, short* dst, size_t count, float scale = 1.f, float bias = 0.f);
+
+}  // namespace PrecisionConversions
+
+}  // namespace InferenceEngine
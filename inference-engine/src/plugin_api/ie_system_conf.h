@@ -44,6 +44,18 @@ INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores();
 
+/**
+ * @brief      Returns the groups of logical cpus forming one core complex: cpus of the same core
+ *             class (P/E cores on hybrid parts), package and L2 cache complex. Threads of one
+ *             stream confined to one group never mix core classes within a primitive, which
+ *             otherwise drags the primitive to the speed of the slowest class. A single group or
+ *             an empty result means the machine has no topology worth slicing by (detection is
+ *             implemented on Linux via sysfs; other OSes report no topology).
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Vector of logical cpu id groups
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<std::vector<int>>) getCoreComplexes();
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
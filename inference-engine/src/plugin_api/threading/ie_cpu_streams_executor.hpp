@@ -44,12 +44,20 @@ public:
 
     void run(Task task) override;
 
+    void run(Task task, TaskPriority priority) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Returns a snapshot of the scheduling counters of this executor
+     * @return An ExecutorDiagnostics structure filled from the live counters
+     */
+    ExecutorDiagnostics GetDiagnostics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -30,12 +30,16 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
     // for tests purposes
     size_t getIdleCPUStreamsExecutorsNumber();
 
+    std::vector<ExecutorDiagnostics> getDiagnostics();
+
     void clear(const std::string& id = {});
 
 private:
@@ -84,6 +88,25 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns a streams executor with the given configuration which may be already leased
+     *        by other holders. All holders multiplex their tasks onto the same stream threads
+     *        (with the affinity the configuration defines), so loading many networks keeps one
+     *        thread pool per distinct configuration instead of one pool per network.
+     * @param config Streams executor configuration
+     * @return A shared pointer to an existing or newly created CPUStreamsExecutor
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
+    /**
+     * @brief Returns the scheduling counters of every executor the manager handed out:
+     *        queued tasks, dispatch latency and the busy ratio of the stream threads.
+     *        The counters are updated lock-free on the scheduling paths, so querying them
+     *        does not perturb the executors.
+     * @return A vector with one ExecutorDiagnostics entry per executor
+     */
+    std::vector<ExecutorDiagnostics> getDiagnostics();
+
     /**
      * @cond
      */
@@ -13,11 +13,29 @@
 #include "threading/ie_itask_executor.hpp"
 #include "ie_api.h"
 #include "ie_parameter.hpp"
+#include <cstdint>
 #include <vector>
 #include <string>
 
 namespace InferenceEngine {
 
+/**
+ * @struct ExecutorDiagnostics
+ * @ingroup ie_dev_api_threading
+ * @brief Snapshot of the scheduling counters of one streams executor.
+ *        The counters are maintained with relaxed atomics on the enqueue/dispatch paths,
+ *        so taking a snapshot never blocks the scheduler; in exchange the fields are only
+ *        individually, not mutually, consistent.
+ */
+struct ExecutorDiagnostics {
+    std::string name;            //!< Name of the executor configuration
+    uint64_t enqueuedTasks = 0;  //!< Tasks handed to the worker queues since construction
+    uint64_t completedTasks = 0; //!< Tasks that finished executing
+    uint64_t queuedTasks = 0;    //!< Tasks currently waiting in the worker queues
+    double avgDispatchUs = 0.0;  //!< Mean time a task waited in a queue before a stream picked it up, in microseconds
+    double busyRatio = 0.0;      //!< Fraction of the stream threads' lifetime spent executing tasks
+};
+
 /**
  * @interface IStreamsExecutor
  * @ingroup ie_dev_api_threading
@@ -75,6 +93,11 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        std::vector<int>   _threadBindingCoreList;  //!< In case of @ref CORES binding, explicit list of logical cpu ids the threads are pinned to; empty means the default round-robin placement
+        int                _threadBindingGroupSize  = 0;  //!< In case of @ref CORES binding, confines each stream to a group of this many consecutive cores (e.g. a sub-NUMA cluster or an L2 complex); 0 disables grouping
+        int                _numaNodeId              = -1;  //!< If non negative, every stream is placed on this NUMA node instead of the default round-robin distribution over the available nodes
+        int                _spinWaitUs              = 0;  //!< Idle stream workers poll the task queues for this many microseconds before parking on the condition variable; 0 parks immediately
+        bool               _denormalsOptimization   = false;  //!< Stream worker threads set the FTZ/DAZ bits of their floating point control register on construction, so denormal values are flushed to zero
 
         /**
          * @brief      A constructor with arguments
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -24,6 +25,17 @@ namespace InferenceEngine {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling priority of a task submitted to a task executor.
+ *        Tasks with `HIGH` priority are scheduled ahead of already queued `NORMAL` tasks,
+ *        tasks of the same priority keep FIFO order.
+ * @ingroup ie_dev_api_threading
+ */
+enum class TaskPriority : std::uint8_t {
+    NORMAL = 0,  //!< Default priority, FIFO order
+    HIGH = 1,    //!< Scheduled ahead of queued NORMAL tasks
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ie_dev_api_threading
@@ -61,6 +73,15 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task inside task executor context with the given scheduling priority.
+     *        Default implementation ignores the priority and forwards to run(), executors which maintain
+     *        a task queue are expected to override it.
+     * @param task A task to start
+     * @param priority A scheduling priority of the task
+     */
+    virtual void run(Task task, TaskPriority priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default runAndWait() method implementation uses run() pure virtual method
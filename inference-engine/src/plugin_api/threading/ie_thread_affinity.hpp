@@ -8,6 +8,7 @@
 
 #include <tuple>
 #include <memory>
+#include <vector>
 
 #if !(defined(__APPLE__) || defined(_WIN32))
 #include <sched.h>
@@ -77,6 +78,26 @@ INFERENCE_ENGINE_API_CPP(bool) PinThreadToVacantCore(int thrIdx, int hyperThread
  */
 INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadByMask(int ncores, const CpuSet& processMask);
 
+/**
+ * @brief      Pins current thread to the `thrIdx`-th entry (modulo the list size) of an explicit
+ *             core list, provided that core is admitted by the process mask
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  thrIdx       The thr index
+ * @param[in]  coreList     Logical cpu ids, in pinning order
+ * @param[in]  ncores       The ncores
+ * @param[in]  processMask  The process mask
+ * @return     `True` in case of success, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) PinThreadToCoreList(int thrIdx, const std::vector<int>& coreList, int ncores, const CpuSet& processMask);
+
+/**
+ * @brief      Enumerates the logical cpus admitted by the process affinity mask, in mask order
+ * @ingroup    ie_dev_api_threading
+ * @return     A vector of logical cpu ids; empty when the mask cannot be queried
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) GetProcessMaskCores();
+
 /**
  * @brief      Pins a current thread to a socket.
  * @ingroup    ie_dev_api_threading
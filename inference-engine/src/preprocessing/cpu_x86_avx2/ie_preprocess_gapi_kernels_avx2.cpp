@@ -351,6 +351,153 @@ void calcRowLinear_8U(C4, std::array<std::array<uint8_t*, 4>, 4> &dst,
     calcRowLinear_8UC_Impl<chanNum>(dst, src0, src1, alpha, clone, mapsx, beta, tmp, inSz, outSz, lpi);
 }
 
+// Resize (bi-linear, 8U)
+void calcRowLinear_8U(uint8_t *dst[],
+                      const uint8_t *src0[],
+                      const uint8_t *src1[],
+                      const short    alpha[],
+                      const short    clone[],  // 4 clones of alpha
+                      const short    mapsx[],
+                      const short    beta[],
+                      uint8_t  tmp[],
+                      const Size   & inSz,
+                      const Size   & outSz,
+                      int      lpi) {
+    constexpr const int chanNum = 1;
+
+    // single plane is the 1-channel case of the generic kernel
+    std::array<std::array<uint8_t*, 4>, chanNum> out = {};
+    for (int l = 0; l < lpi; l++) {
+        out[0][l] = dst[l];
+    }
+
+    calcRowLinear_8UC_Impl<chanNum>(out, src0, src1, alpha, clone, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                       const float *src0[],
+                       const float *src1[],
+                       const float  alpha[],
+                       const int    mapsx[],
+                       const float  beta[],
+                       const Size & inSz,
+                       const Size & outSz,
+                       int    lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    constexpr int nlanes = v_float32::nlanes;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+            for (; x <= outSz.width - nlanes; x += nlanes) {
+                v_float32 alpha0 = vx_load(&alpha[x]);
+            //  v_float32 alpha1 = 1.f - alpha0;
+
+                v_int32 sx = vx_load(&mapsx[x]);
+
+                v_float32 s0l, s0h, s00, s01;
+                v_gather_pairs(src0[l], sx, s0l, s0h);
+                v_deinterleave(s0l, s0h, s00, s01);
+
+            //  v_float32 res0 = s00*alpha0 + s01*alpha1;
+                v_float32 res0 = v_fma(s00 - s01, alpha0, s01);
+
+                v_float32 s1l, s1h, s10, s11;
+                v_gather_pairs(src1[l], sx, s1l, s1h);
+                v_deinterleave(s1l, s1h, s10, s11);
+
+            //  v_float32 res1 = s10*alpha0 + s11*alpha1;
+                v_float32 res1 = v_fma(s10 - s11, alpha0, s11);
+
+            //  v_float32 d = res0*beta0 + res1*beta1;
+                v_float32 d = v_fma(res0 - res1, beta0, res1);
+
+                vx_store(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                dst[l][x] = beta0*res0 + beta1*res1;
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        for (int l = 0; l < lpi; l++) {
+            int x = 0;
+
+            for (; x <= outSz.width - nlanes; x += nlanes) {
+                v_float32 alpha0 = vx_load(&alpha[x]);
+            //  v_float32 alpha1 = 1.f - alpha0;
+
+                v_int32 sx = vx_load(&mapsx[x]);
+
+                v_float32 s0l, s0h, s00, s01;
+                v_gather_pairs(src0[l], sx, s0l, s0h);
+                v_deinterleave(s0l, s0h, s00, s01);
+
+            //  v_float32 d = s00*alpha0 + s01*alpha1;
+                v_float32 d = v_fma(s00 - s01, alpha0, s01);
+
+                vx_store(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                dst[l][x] = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+            for (; x <= length - nlanes; x += nlanes) {
+                v_float32 s0 = vx_load(&src0[l][x]);
+                v_float32 s1 = vx_load(&src1[l][x]);
+
+            //  v_float32 d = s0*beta0 + s1*beta1;
+                v_float32 d = v_fma(s0 - s1, beta0, s1);
+
+                vx_store(&dst[l][x], d);
+            }
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length * sizeof(float));
+        }
+    }
+}
+
 void copyRow_8U(const uint8_t in[], uint8_t out[], int length) {
     copyRow_8U_impl(in, out, length);
 }
@@ -783,6 +783,10 @@ public:
     void Release() noexcept override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
+
+private:
+    void preprocess(Blob::Ptr &roiBlob, Blob::Ptr &outBlob, ResizeAlgorithm algorithm, ColorFormat fmt,
+                    bool serial, int batchSize);
 };
 
 StatusCode CreatePreProcessData(IPreProcessData *& data, ResponseDesc */*resp*/) noexcept {
@@ -818,12 +822,53 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
     }
 
+    if (auto batched = _roiBlob->as<BatchedBlob>()) {
+        const auto& dstDesc = outBlob->getTensorDesc();
+        const auto& dstDims = dstDesc.getDims();
+        if (dstDims.size() != 4) {
+            THROW_IE_EXCEPTION << "Batched pre-processing is applicable to 4D network inputs only";
+        }
+        if (batched->size() != dstDims[0]) {
+            THROW_IE_EXCEPTION << "Number of batch items (" << batched->size() << ") is not equal to "
+                                  "the network's input batch size (" << dstDims[0] << ")";
+        }
+
+        SizeVector itemDims(dstDims);
+        itemDims[0] = 1;
+        const TensorDesc itemDesc(dstDesc.getPrecision(), itemDims, dstDesc.getLayout());
+        const size_t itemByteSize = outBlob->byteSize() / dstDims[0];
+        auto basePtr = outBlob->buffer().as<uint8_t*>();
+
+        // each item is pre-processed directly into its slice of the output batch,
+        // so no intermediate gather copy is required
+        for (size_t i = 0; i < batched->size(); i++) {
+            uint8_t* itemPtr = basePtr + i * itemByteSize;
+            Blob::Ptr itemOut;
+            if (itemDesc.getPrecision() == Precision::FP32) {
+                itemOut = make_shared_blob<float>(itemDesc, reinterpret_cast<float*>(itemPtr));
+            } else if (itemDesc.getPrecision() == Precision::U8) {
+                itemOut = make_shared_blob<uint8_t>(itemDesc, itemPtr);
+            } else {
+                THROW_IE_EXCEPTION << "Unsupported network's input precision for batched pre-processing: "
+                                   << itemDesc.getPrecision();
+            }
+            auto item = batched->getBlob(i);
+            preprocess(item, itemOut, algorithm, fmt, serial, 1);
+        }
+        return;
+    }
+
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
 
+    preprocess(_roiBlob, outBlob, algorithm, fmt, serial, batchSize);
+}
+
+void PreProcessData::preprocess(Blob::Ptr &roiBlob, Blob::Ptr &outBlob, ResizeAlgorithm algorithm,
+        ColorFormat fmt, bool serial, int batchSize) {
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
+    if (_preproc->preprocessWithGAPI(roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
         return;
     }
 
@@ -839,23 +884,23 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
     }
 
     Blob::Ptr res_in, res_out;
-    if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
-            if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                _tmp1 = make_shared_blob<float>({Precision::FP32, _roiBlob->getTensorDesc().getDims(), Layout::NCHW});
+    if (roiBlob->getTensorDesc().getLayout() == NHWC) {
+        if (!_tmp1 || _tmp1->size() != roiBlob->size()) {
+            if (roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp1 = make_shared_blob<float>({Precision::FP32, roiBlob->getTensorDesc().getDims(), Layout::NCHW});
             } else {
-                _tmp1 = make_shared_blob<uint8_t>({Precision::U8, _roiBlob->getTensorDesc().getDims(), Layout::NCHW});
+                _tmp1 = make_shared_blob<uint8_t>({Precision::U8, roiBlob->getTensorDesc().getDims(), Layout::NCHW});
             }
             _tmp1->allocate();
         }
 
         {
             IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_before)
-            blob_copy(_roiBlob, _tmp1);
+            blob_copy(roiBlob, _tmp1);
         }
         res_in = _tmp1;
     } else {
-        res_in = _roiBlob;
+        res_in = roiBlob;
     }
 
     if (outBlob->getTensorDesc().getLayout() == NHWC) {
@@ -890,6 +935,24 @@ void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
         return;
     }
 
+    if (auto batched = src->as<BatchedBlob>()) {
+        auto &dst_dims = dst->getTensorDesc().getDims();
+        if (dst_dims.size() != 4)
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Only 4D tensors are supported.";
+        if (batched->size() != dst_dims[0])
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of batch items ("
+                               << batched->size() << ") is not equal to the network's input batch size ("
+                               << dst_dims[0] << ").";
+        for (size_t i = 0; i < batched->size(); i++) {
+            auto &item_dims = batched->getBlob(i)->getTensorDesc().getDims();
+            if (item_dims.size() != 4 || item_dims[1] != dst_dims[1])
+                THROW_IE_EXCEPTION << "Preprocessing is not applicable. Wrong shape. Network expected 4D input "
+                                      "tensor with shape [1," << dst_dims[1] << ",H,W] but batch item " << i
+                                   << " has shape " << details::dumpVec(item_dims) << ".";
+        }
+        return;
+    }
+
     if (!src->is<MemoryBlob>() || !dst->is<MemoryBlob>()) {
         THROW_IE_EXCEPTION << "Preprocessing is not applicable. Source and destination blobs must "
                               "be memory blobs";
@@ -654,79 +654,6 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
-
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
-    // Given our knowledge about Fluid, full graph rebuild is required
-    // if and only if:
-    // 0. This is the first call ever
-    // 1. precision has changed (affects kernel versions)
-    // 2. layout has changed (affects graph topology)
-    // 3. algorithm has changed (affects kernel version)
-    // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
-    // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
-    BlobDesc last_in;
-    BlobDesc last_out;
-    ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
-
-    CallDesc newCall = newCallOrig;
-    BlobDesc new_in;
-    BlobDesc new_out;
-    ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
-
-    // Declare two empty vectors per each call
-    SizeVector last_in_size;
-    SizeVector last_out_size;
-    SizeVector new_in_size;
-    SizeVector new_out_size;
-
-    // Now swap it with in/out descriptor vectors
-    // Now last_in/last_out would contain everything but sizes
-    last_in_size.swap(std::get<2>(last_in));
-    last_out_size.swap(std::get<2>(last_out));
-    new_in_size.swap(std::get<2>(new_in));
-    new_out_size.swap(std::get<2>(new_out));
-
-    // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
-        return Update::REBUILD;
-    }
-
-    // If output sizes change, graph should be regenerated (resize
-    // ratio is taken from parameters)
-    if (last_out_size != new_out_size) {
-        return Update::REBUILD;
-    }
-
-    // If interpolation is AREA and sizes change upscale/downscale
-    // mode, rebuild is required
-    if (last_algo == RESIZE_AREA) {
-        // 0123 == NCHW
-        const auto is_upscale = [](const SizeVector &in, const SizeVector &out) -> bool {
-            return in[2] < out[2] || in[3] < out[3];
-        };
-        const bool old_upscale = is_upscale(last_in_size, last_out_size);
-        const bool new_upscale = is_upscale(new_in_size, new_out_size);
-        if (old_upscale != new_upscale) {
-            return Update::REBUILD;
-        }
-    }
-
-    // If only sizes changes (considering the above exception),
-    // reshape is enough
-    if (last_in_size != new_in_size) {
-        return Update::RESHAPE;
-    }
-
-    return Update::NOTHING;
-}
-
 bool PreprocEngine::useGAPI() {
     static const bool NO_GAPI = [](const char *str) -> bool {
         std::string var(str ? str : "");
@@ -739,6 +666,25 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
+    // a batched src blob holds one image blob per batch item; check every item against the
+    // network's input and the item count against its batch dimension
+    if (src->is<BatchedBlob>()) {
+        auto batched = src->as<BatchedBlob>();
+        const auto &dst_dims = dst->getTensorDesc().getDims();
+        if (dst_dims.size() != 4) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Only 4D tensors are supported.";
+        }
+        if (batched->size() != dst_dims[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of batch items "
+                               << batched->size() << " is not equal to the network's input batch size "
+                               << dst_dims[0];
+        }
+        for (size_t i = 0; i < batched->size(); i++) {
+            checkApplicabilityGAPI(batched->getBlob(i), dst);
+        }
+        return;
+    }
+
     // src is either a memory blob, an NV12, or an I420 blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
     if (!src->is<MemoryBlob>() && !yuv420_blob) {
@@ -793,6 +739,7 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
 }
 
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    std::vector<cv::GCompiled>& compiledPlans,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -815,9 +762,9 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
+        auto& compiled = compiledPlans[slice_n];
+        if (Update::REBUILD == update) {
+            //  need to compile own object for a particular ROI
             IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
 
             using cv::gapi::own::Rect;
@@ -849,13 +796,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             // TODO: make a ROI a runtime argument to avoid
             // recompilations
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
-                compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
-            } else {
-                IE_ASSERT(compiled);
-                compiled.reshape(descrs_of(input_plane_mats), std::move(args));
-            }
+            auto& computation = lastComputation.value();
+            compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
         }
 
         for (int i = 0; i < batch_size; ++i) {
@@ -919,13 +861,22 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_desc_ie.getDims(),
                                             out_fmt },
                                   algorithm };
-    const Update update = needUpdate(thisCall);
 
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
+    // LRU lookup: the pipelines compiled for every call descriptor seen so far
+    // are kept (up to MAX_CACHED_PLANS), so traffic alternating between several
+    // resolutions hits its previously compiled plans instead of rebuilding
+    auto plan = _planCache.begin();
+    for (; plan != _planCache.end(); ++plan) {
+        if (plan->first == thisCall) {
+            break;
+        }
+    }
 
-        if (Update::REBUILD == update) {
+    Update update = Update::NOTHING;
+    Opt<cv::GComputation> _lastComputation;
+    if (plan == _planCache.end()) {
+        update = Update::REBUILD;
+        {
             //  rebuild the graph
             IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
             // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
@@ -940,13 +891,22 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            out_fmt,
                            get_cv_depth(in_desc_ie)));
         }
+        if (_planCache.size() >= MAX_CACHED_PLANS) {
+            _planCache.pop_back();  // drop the least recently used plan
+        }
+        _planCache.emplace_front(std::move(thisCall),
+                                 std::vector<cv::GCompiled>(parallel_get_max_threads()));
+        plan = _planCache.begin();
+    } else if (plan != _planCache.begin()) {
+        _planCache.splice(_planCache.begin(), _planCache, plan);
+        plan = _planCache.begin();
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    executeGraph(_lastComputation, plan->second, batched_input_plane_mats, batched_output_plane_mats,
+        batch_size, omp_serial, update);
 
     return true;
 }
@@ -8,7 +8,9 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
@@ -25,18 +27,24 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Compiled pipelines are cached per call descriptor (source/destination
+    // blob descriptors plus the resize algorithm), most recently used first,
+    // so traffic alternating between several resolutions does not recompile
+    // the graph on every switch. Each entry holds one cv::GCompiled per
+    // executor slice, exactly as the former single-plan cache did.
+    using PlanCacheEntry = std::pair<CallDesc, std::vector<cv::GCompiled>>;
+    std::list<PlanCacheEntry> _planCache;
+    static constexpr size_t MAX_CACHED_PLANS = 8;
 
     ProfilingTask _perf_graph_building {"Preproc Graph Building"};
     ProfilingTask _perf_exec_tile  {"Preproc Calc Tile"};
     ProfilingTask _perf_exec_graph {"Preproc Exec Graph"};
     ProfilingTask _perf_graph_compiling {"Preproc Graph compiling"};
 
-    enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    enum class Update { REBUILD, NOTHING };
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      std::vector<cv::GCompiled>& compiledPlans,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -49,7 +57,7 @@ class PreprocEngine {
         int batch_size);
 
 public:
-    PreprocEngine();
+    PreprocEngine() = default;
     static bool useGAPI();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
@@ -806,6 +806,66 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
         dst[l] = out.OutLine<T>(l);
     }
 
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= 64 && outSz.width >= 32) {
+                avx512::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                         reinterpret_cast<const uint8_t**>(src0),
+                                         reinterpret_cast<const uint8_t**>(src1),
+                                         reinterpret_cast<const short*>(alpha),
+                                         reinterpret_cast<const short*>(clone),
+                                         reinterpret_cast<const short*>(mapsx),
+                                         reinterpret_cast<const short*>(beta),
+                                         reinterpret_cast<uint8_t*>(tmp),
+                                         inSz, outSz, lpi);
+                return;
+            }
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                      reinterpret_cast<const float**>(src0),
+                                      reinterpret_cast<const float**>(src1),
+                                      reinterpret_cast<const float*>(alpha),
+                                      reinterpret_cast<const int*>(mapsx),
+                                      reinterpret_cast<const float*>(beta),
+                                      inSz, outSz, lpi);
+            return;
+        }
+    }
+    #endif
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= 32 && outSz.width >= 16) {
+                avx::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                      reinterpret_cast<const uint8_t**>(src0),
+                                      reinterpret_cast<const uint8_t**>(src1),
+                                      reinterpret_cast<const short*>(alpha),
+                                      reinterpret_cast<const short*>(clone),
+                                      reinterpret_cast<const short*>(mapsx),
+                                      reinterpret_cast<const short*>(beta),
+                                      reinterpret_cast<uint8_t*>(tmp),
+                                      inSz, outSz, lpi);
+                return;
+            }
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                   reinterpret_cast<const float**>(src0),
+                                   reinterpret_cast<const float**>(src1),
+                                   reinterpret_cast<const float*>(alpha),
+                                   reinterpret_cast<const int*>(mapsx),
+                                   reinterpret_cast<const float*>(beta),
+                                   inSz, outSz, lpi);
+            return;
+        }
+    }
+    #endif
+
     #ifdef HAVE_SSE
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value) {
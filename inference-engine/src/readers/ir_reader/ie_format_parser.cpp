@@ -4,11 +4,15 @@
 
 #include "ie_format_parser.h"
 
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <unordered_set>
 
+#include <ie_parallel.hpp>
+
 #include "ie_blob_proxy.hpp"
 #include "ie_icnn_network_stats.hpp"
 #include "ie_layer_parsers.h"
@@ -289,11 +293,43 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
     int nodeCnt = 0;
     std::map<int, CNNLayer::Ptr> layerById;
     bool identifyNetworkPrecision = _defPrecision == Precision::UNSPECIFIED;
+
+    // Two-phase parse: the attribute extraction of a layer is independent of every
+    // other layer, so it runs in parallel over the <layer> nodes first, and only the
+    // phase below, which wires the results into the network, stays serial and keeps
+    // the file order. TensorIterator is the one exception - its creator parses the
+    // whole nested body - and is deferred to the serial phase.
+    std::vector<pugi::xml_node> layerNodes;
     for (auto node = allLayersNode.child("layer"); !node.empty(); node = node.next_sibling("layer")) {
-        LayerParseParameters lprms;
-        ParseGenericParams(node, lprms);
+        layerNodes.push_back(node);
+    }
+
+    std::vector<LayerParseParameters> parsedParams(layerNodes.size());
+    std::vector<CNNLayer::Ptr> parsedLayers(layerNodes.size());
+    {
+        CaselessEq<std::string> cmp;
+        std::mutex exceptionMutex;
+        std::exception_ptr parseException;
+        parallel_for(layerNodes.size(), [&](size_t i) {
+            try {
+                ParseGenericParams(layerNodes[i], parsedParams[i]);
+                if (!cmp(parsedParams[i].prms.type, "TensorIterator")) {
+                    parsedLayers[i] = CreateLayer(layerNodes[i], parsedParams[i]);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!parseException) parseException = std::current_exception();
+            }
+        });
+        if (parseException) std::rethrow_exception(parseException);
+    }
+
+    for (size_t layerIdx = 0; layerIdx < layerNodes.size(); ++layerIdx) {
+        auto& node = layerNodes[layerIdx];
+        LayerParseParameters& lprms = parsedParams[layerIdx];
 
-        CNNLayer::Ptr layer = CreateLayer(node, lprms);
+        CNNLayer::Ptr layer = parsedLayers[layerIdx];
+        if (!layer) layer = CreateLayer(node, lprms);
         if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << lprms.prms.type;
 
         layersParseInfo[layer->name] = lprms;
@@ -496,7 +532,40 @@ inline Blob::Ptr GetTypedBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, con
     return binBlob;
 }
 
-Blob::Ptr FormatParser::GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& segment) const {
+static uint64_t SegmentContentHash(const uint8_t* data, size_t size) {
+    // FNV-1a; collisions are resolved with a byte compare in DeduplicateSegment
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+WeightSegment FormatParser::DeduplicateSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& segment) const {
+    // scalar constants are not worth a hash map entry, and malformed segments are
+    // left as they are so the caller reports its usual error
+    const size_t minDedupSize = 64;
+    if (segment.size < minDedupSize || !segment.inRange(weights->size()))
+        return segment;
+
+    const uint8_t* base = weights->cbuffer().as<const uint8_t*>();
+    const uint8_t* data = base + segment.start;
+    auto& candidates = _equalSegments[SegmentContentHash(data, segment.size)];
+    for (const auto& candidate : candidates) {
+        if (candidate.size == segment.size &&
+            (candidate.start == segment.start || std::memcmp(base + candidate.start, data, segment.size) == 0)) {
+            WeightSegment deduplicated = segment;
+            deduplicated.start = candidate.start;
+            return deduplicated;
+        }
+    }
+    candidates.push_back(segment);
+    return segment;
+}
+
+Blob::Ptr FormatParser::GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& weight_segment) const {
+    WeightSegment segment = DeduplicateSegment(weights, weight_segment);
     if (segment.precision == Precision::FP32) {
         return GetTypedBlobFromSegment<float>(weights, segment);
     } else if (segment.precision == Precision::I64) {
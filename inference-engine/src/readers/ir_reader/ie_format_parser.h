@@ -79,6 +79,9 @@ public:
 
     Blob::Ptr GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& weight_segment) const;
     void SetWeights(const TBlob<uint8_t>::Ptr& weights) override;
+    // maps a segment to the first segment with identical payload, so blobs of
+    // constants serialized several times alias one region of the weights buffer
+    WeightSegment DeduplicateSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& weight_segment) const;
     void ParseDims(SizeVector& dims, const pugi::xml_node& node) const;
     const DataPtr& GetDataBy(int layer_id, int port_id) const;
 
@@ -93,6 +96,9 @@ private:
 
     CNNNetworkImplPtr _network;
     std::map<std::string, std::vector<WeightSegment>> _preProcessSegments;
+    // content hash -> canonical segments seen with that hash; filled lazily while
+    // the weights are set (see DeduplicateSegment)
+    mutable std::map<uint64_t, std::vector<WeightSegment>> _equalSegments;
     void ParsePort(LayerParseParameters::LayerPortData& port, pugi::xml_node& node) const;
     void ParseGenericParams(pugi::xml_node& node, LayerParseParameters& layerParsePrms) const;
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& prms) const;
@@ -202,6 +202,13 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
         auto node = createNode(inputs, p.xml, binStream, p.params);
         id_to_node[layer_id] = node;
 
+        // The layer subtree is not needed anymore: release it so that the DOM
+        // shrinks while the nGraph function grows instead of peaking together.
+        // Only generic parameters of the layer (kept in p.params) are accessed below.
+        pugi::xml_node layers = root.child("layers");
+        layers.remove_child(p.xml);
+        p.xml = pugi::xml_node();
+
         // Check that output shape after nGraph node validation the same as in IR
         // because IR always right!
         // Temporary disabled!
@@ -297,121 +304,125 @@ V10Parser::GenericLayerParams V10Parser::parseGenericParams(const pugi::xml_node
     return params;
 }
 
-bool V10Parser::LayerBaseCreator::shouldCreate(const std::string& nodeType) const {
-    InferenceEngine::details::CaselessEq<std::string> comparator;
-    return comparator(nodeType, type);
-}
-
 std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Output<ngraph::Node>>& inputs,
                                                     const pugi::xml_node& node, std::istream& binStream,
                                                     const GenericLayerParams& params) {
-    static std::vector<std::shared_ptr<LayerBaseCreator>> creators = {
-        std::make_shared<LayerCreator<ngraph::op::Abs>>("Abs"),
-        std::make_shared<LayerCreator<ngraph::op::Acos>>("Acos"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Add>>("Add"),
-        std::make_shared<LayerCreator<ngraph::op::Asin>>("Asin"),
-        std::make_shared<LayerCreator<ngraph::op::Atan>>("Atan"),
-        std::make_shared<LayerCreator<ngraph::op::v1::AvgPool>>("AvgPool"),
-        std::make_shared<LayerCreator<ngraph::op::BatchNormInference>>("BatchNormInference"),
-        std::make_shared<LayerCreator<ngraph::op::Ceiling>>("Ceiling"),
-        std::make_shared<LayerCreator<ngraph::op::Clamp>>("Clamp"),
-        std::make_shared<LayerCreator<ngraph::op::Concat>>("Concat"),
-        std::make_shared<LayerCreator<ngraph::op::Constant>>("Const"),
-        std::make_shared<LayerCreator<ngraph::op::Convert>>("Convert"),
-        std::make_shared<LayerCreator<ngraph::op::CTCGreedyDecoder>>("CTCGreedyDecoder"),
-        std::make_shared<LayerCreator<ngraph::op::ReverseSequence>>("ReverseSequence"),
-        std::make_shared<LayerCreator<ngraph::op::Cos>>("Cos"),
-        std::make_shared<LayerCreator<ngraph::op::Cosh>>("Cosh"),
-        std::make_shared<LayerCreator<ngraph::op::DetectionOutput>>("DetectionOutput"),
-        std::make_shared<LayerCreator<ngraph::op::v1::DeformableConvolution>>("DeformableConvolution"),
-        std::make_shared<LayerCreator<ngraph::op::v1::DeformablePSROIPooling>>("DeformablePSROIPooling"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Divide>>("Divide"),
-        std::make_shared<LayerCreator<ngraph::op::SpaceToDepth>>("SpaceToDepth"),
-        std::make_shared<LayerCreator<ngraph::op::DepthToSpace>>("DepthToSpace"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Subtract>>("Subtract"),
-        std::make_shared<LayerCreator<ngraph::op::MatMul>>("MatMul"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Broadcast>>("Broadcast"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Reshape>>("Reshape"),
-        std::make_shared<LayerCreator<ngraph::op::v1::StridedSlice>>("StridedSlice"),
-        std::make_shared<LayerCreator<ngraph::op::Elu>>("ELU"),
-        std::make_shared<LayerCreator<ngraph::op::Exp>>("Exp"),
-        std::make_shared<LayerCreator<ngraph::op::Erf>>("Erf"),
-        std::make_shared<LayerCreator<ngraph::op::FakeQuantize>>("FakeQuantize"),
-        std::make_shared<LayerCreator<ngraph::op::Floor>>("Floor"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Gather>>("Gather"),
-        std::make_shared<LayerCreator<ngraph::op::v1::GatherTree>>("GatherTree"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Greater>>("Greater"),
-        std::make_shared<LayerCreator<ngraph::op::v1::GreaterEqual>>("GreaterEqual"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Convolution>>("Convolution"),
-        std::make_shared<LayerCreator<ngraph::op::v1::GroupConvolution>>("GroupConvolution"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ConvolutionBackpropData>>("ConvolutionBackpropData"),
-        std::make_shared<LayerCreator<ngraph::op::v1::GroupConvolutionBackpropData>>("GroupConvolutionBackpropData"),
-        std::make_shared<LayerCreator<ngraph::op::v1::BinaryConvolution>>("BinaryConvolution"),
-        std::make_shared<LayerCreator<ngraph::op::GRN>>("GRN"),
-        std::make_shared<LayerCreator<ngraph::op::HardSigmoid>>("HardSigmoid"),
-        std::make_shared<LayerCreator<ngraph::op::Interpolate>>("Interpolate"),
-        std::make_shared<LayerCreator<ngraph::op::Log>>("Log"),
-        std::make_shared<LayerCreator<ngraph::op::SquaredDifference>>("SquaredDifference"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Less>>("Less"),
-        std::make_shared<LayerCreator<ngraph::op::v1::LessEqual>>("LessEqual"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Equal>>("Equal"),
-        std::make_shared<LayerCreator<ngraph::op::v1::NotEqual>>("NotEqual"),
-        std::make_shared<LayerCreator<ngraph::op::v1::FloorMod>>("FloorMod"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Select>>("Select"),
-        std::make_shared<LayerCreator<ngraph::op::LRN>>("LRN"),
-        std::make_shared<LayerCreator<ngraph::op::MVN>>("MVN"),
-        std::make_shared<LayerCreator<ngraph::op::LSTMCell>>("LSTMCell"),
-        std::make_shared<LayerCreator<ngraph::op::v1::MaxPool>>("MaxPool"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Maximum>>("Maximum"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Minimum>>("Minimum"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Multiply>>("Multiply"),
-        std::make_shared<LayerCreator<ngraph::op::Negative>>("Negative"),
-        std::make_shared<LayerCreator<ngraph::op::v1::NonMaxSuppression>>("NonMaxSuppression"),
-        std::make_shared<LayerCreator<ngraph::op::NormalizeL2>>("NormalizeL2"),
-        std::make_shared<LayerCreator<ngraph::op::v1::OneHot>>("OneHot"),
-        std::make_shared<LayerCreator<ngraph::op::PRelu>>("PReLU"),
-        std::make_shared<LayerCreator<ngraph::op::Relu>>("ReLU"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Pad>>("Pad"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Power>>("Power"),
-        std::make_shared<LayerCreator<ngraph::op::Range>>("Range"),
-        std::make_shared<LayerCreator<ngraph::op::PriorBox>>("PriorBox"),
-        std::make_shared<LayerCreator<ngraph::op::PriorBoxClustered>>("PriorBoxClustered"),
-        std::make_shared<LayerCreator<ngraph::op::Proposal>>("Proposal"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ReduceMax>>("ReduceMax"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ReduceMin>>("ReduceMin"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ReduceMean>>("ReduceMean"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ReduceProd>>("ReduceProd"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ReduceSum>>("ReduceSum"),
-        std::make_shared<LayerCreator<ngraph::op::ReorgYolo>>("ReorgYolo"),
-        std::make_shared<LayerCreator<ngraph::op::RegionYolo>>("RegionYolo"),
-        std::make_shared<LayerCreator<ngraph::op::Result>>("Result"),
-        std::make_shared<LayerCreator<ngraph::op::ROIPooling>>("ROIPooling"),
-        std::make_shared<LayerCreator<ngraph::op::PSROIPooling>>("PSROIPooling"),
-        std::make_shared<LayerCreator<ngraph::op::ShapeOf>>("ShapeOf"),
-        std::make_shared<LayerCreator<ngraph::op::v0::Selu>>("Selu"),
-        std::make_shared<LayerCreator<ngraph::op::Sigmoid>>("Sigmoid"),
-        std::make_shared<LayerCreator<ngraph::op::Sin>>("Sin"),
-        std::make_shared<LayerCreator<ngraph::op::Sign>>("Sign"),
-        std::make_shared<LayerCreator<ngraph::op::Sinh>>("Sinh"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Softmax>>("Softmax"),
-        std::make_shared<LayerCreator<ngraph::op::v1::Split>>("Split"),
-        std::make_shared<LayerCreator<ngraph::op::VariadicSplit>>("VariadicSplit"),
-        std::make_shared<LayerCreator<ngraph::op::Sqrt>>("Sqrt"),
-        std::make_shared<LayerCreator<ngraph::op::Squeeze>>("Squeeze"),
-        std::make_shared<LayerCreator<ngraph::op::Tan>>("Tan"),
-        std::make_shared<LayerCreator<ngraph::op::Tanh>>("TanH"),
-        std::make_shared<LayerCreator<ngraph::op::Tile>>("Tile"),
-        std::make_shared<LayerCreator<ngraph::op::v1::TopK>>("TopK"),
-        std::make_shared<LayerCreator<ngraph::op::TensorIterator>>("TensorIterator"),
-        std::make_shared<LayerCreator<ngraph::op::Transpose>>("Transpose"),
-        std::make_shared<LayerCreator<ngraph::op::Unsqueeze>>("Unsqueeze"),
-        std::make_shared<LayerCreator<ngraph::op::v1::LogicalAnd>>("LogicalAnd"),
-        std::make_shared<LayerCreator<ngraph::op::v1::LogicalOr>>("LogicalOr"),
-        std::make_shared<LayerCreator<ngraph::op::v1::LogicalXor>>("LogicalXor"),
-        std::make_shared<LayerCreator<ngraph::op::v1::LogicalNot>>("LogicalNot"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ReduceLogicalAnd>>("ReduceLogicalAnd"),
-        std::make_shared<LayerCreator<ngraph::op::v1::ReduceLogicalOr>>("ReduceLogicalOr"),
-    };
+    // Creators are dispatched through a caseless hash map, so the per-layer lookup cost
+    // stays constant instead of growing with the number of supported operations
+    static const details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> creators = [] {
+        std::vector<std::shared_ptr<LayerBaseCreator>> creatorList = {
+            std::make_shared<LayerCreator<ngraph::op::Abs>>("Abs"),
+            std::make_shared<LayerCreator<ngraph::op::Acos>>("Acos"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Add>>("Add"),
+            std::make_shared<LayerCreator<ngraph::op::Asin>>("Asin"),
+            std::make_shared<LayerCreator<ngraph::op::Atan>>("Atan"),
+            std::make_shared<LayerCreator<ngraph::op::v1::AvgPool>>("AvgPool"),
+            std::make_shared<LayerCreator<ngraph::op::BatchNormInference>>("BatchNormInference"),
+            std::make_shared<LayerCreator<ngraph::op::Ceiling>>("Ceiling"),
+            std::make_shared<LayerCreator<ngraph::op::Clamp>>("Clamp"),
+            std::make_shared<LayerCreator<ngraph::op::Concat>>("Concat"),
+            std::make_shared<LayerCreator<ngraph::op::Constant>>("Const"),
+            std::make_shared<LayerCreator<ngraph::op::Convert>>("Convert"),
+            std::make_shared<LayerCreator<ngraph::op::CTCGreedyDecoder>>("CTCGreedyDecoder"),
+            std::make_shared<LayerCreator<ngraph::op::ReverseSequence>>("ReverseSequence"),
+            std::make_shared<LayerCreator<ngraph::op::Cos>>("Cos"),
+            std::make_shared<LayerCreator<ngraph::op::Cosh>>("Cosh"),
+            std::make_shared<LayerCreator<ngraph::op::DetectionOutput>>("DetectionOutput"),
+            std::make_shared<LayerCreator<ngraph::op::v1::DeformableConvolution>>("DeformableConvolution"),
+            std::make_shared<LayerCreator<ngraph::op::v1::DeformablePSROIPooling>>("DeformablePSROIPooling"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Divide>>("Divide"),
+            std::make_shared<LayerCreator<ngraph::op::SpaceToDepth>>("SpaceToDepth"),
+            std::make_shared<LayerCreator<ngraph::op::DepthToSpace>>("DepthToSpace"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Subtract>>("Subtract"),
+            std::make_shared<LayerCreator<ngraph::op::MatMul>>("MatMul"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Broadcast>>("Broadcast"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Reshape>>("Reshape"),
+            std::make_shared<LayerCreator<ngraph::op::v1::StridedSlice>>("StridedSlice"),
+            std::make_shared<LayerCreator<ngraph::op::Elu>>("ELU"),
+            std::make_shared<LayerCreator<ngraph::op::Exp>>("Exp"),
+            std::make_shared<LayerCreator<ngraph::op::Erf>>("Erf"),
+            std::make_shared<LayerCreator<ngraph::op::FakeQuantize>>("FakeQuantize"),
+            std::make_shared<LayerCreator<ngraph::op::Floor>>("Floor"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Gather>>("Gather"),
+            std::make_shared<LayerCreator<ngraph::op::v1::GatherTree>>("GatherTree"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Greater>>("Greater"),
+            std::make_shared<LayerCreator<ngraph::op::v1::GreaterEqual>>("GreaterEqual"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Convolution>>("Convolution"),
+            std::make_shared<LayerCreator<ngraph::op::v1::GroupConvolution>>("GroupConvolution"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ConvolutionBackpropData>>("ConvolutionBackpropData"),
+            std::make_shared<LayerCreator<ngraph::op::v1::GroupConvolutionBackpropData>>("GroupConvolutionBackpropData"),
+            std::make_shared<LayerCreator<ngraph::op::v1::BinaryConvolution>>("BinaryConvolution"),
+            std::make_shared<LayerCreator<ngraph::op::GRN>>("GRN"),
+            std::make_shared<LayerCreator<ngraph::op::HardSigmoid>>("HardSigmoid"),
+            std::make_shared<LayerCreator<ngraph::op::Interpolate>>("Interpolate"),
+            std::make_shared<LayerCreator<ngraph::op::Log>>("Log"),
+            std::make_shared<LayerCreator<ngraph::op::SquaredDifference>>("SquaredDifference"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Less>>("Less"),
+            std::make_shared<LayerCreator<ngraph::op::v1::LessEqual>>("LessEqual"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Equal>>("Equal"),
+            std::make_shared<LayerCreator<ngraph::op::v1::NotEqual>>("NotEqual"),
+            std::make_shared<LayerCreator<ngraph::op::v1::FloorMod>>("FloorMod"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Select>>("Select"),
+            std::make_shared<LayerCreator<ngraph::op::LRN>>("LRN"),
+            std::make_shared<LayerCreator<ngraph::op::MVN>>("MVN"),
+            std::make_shared<LayerCreator<ngraph::op::LSTMCell>>("LSTMCell"),
+            std::make_shared<LayerCreator<ngraph::op::v1::MaxPool>>("MaxPool"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Maximum>>("Maximum"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Minimum>>("Minimum"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Multiply>>("Multiply"),
+            std::make_shared<LayerCreator<ngraph::op::Negative>>("Negative"),
+            std::make_shared<LayerCreator<ngraph::op::v1::NonMaxSuppression>>("NonMaxSuppression"),
+            std::make_shared<LayerCreator<ngraph::op::NormalizeL2>>("NormalizeL2"),
+            std::make_shared<LayerCreator<ngraph::op::v1::OneHot>>("OneHot"),
+            std::make_shared<LayerCreator<ngraph::op::PRelu>>("PReLU"),
+            std::make_shared<LayerCreator<ngraph::op::Relu>>("ReLU"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Pad>>("Pad"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Power>>("Power"),
+            std::make_shared<LayerCreator<ngraph::op::Range>>("Range"),
+            std::make_shared<LayerCreator<ngraph::op::PriorBox>>("PriorBox"),
+            std::make_shared<LayerCreator<ngraph::op::PriorBoxClustered>>("PriorBoxClustered"),
+            std::make_shared<LayerCreator<ngraph::op::Proposal>>("Proposal"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ReduceMax>>("ReduceMax"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ReduceMin>>("ReduceMin"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ReduceMean>>("ReduceMean"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ReduceProd>>("ReduceProd"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ReduceSum>>("ReduceSum"),
+            std::make_shared<LayerCreator<ngraph::op::ReorgYolo>>("ReorgYolo"),
+            std::make_shared<LayerCreator<ngraph::op::RegionYolo>>("RegionYolo"),
+            std::make_shared<LayerCreator<ngraph::op::Result>>("Result"),
+            std::make_shared<LayerCreator<ngraph::op::ROIPooling>>("ROIPooling"),
+            std::make_shared<LayerCreator<ngraph::op::PSROIPooling>>("PSROIPooling"),
+            std::make_shared<LayerCreator<ngraph::op::ShapeOf>>("ShapeOf"),
+            std::make_shared<LayerCreator<ngraph::op::v0::Selu>>("Selu"),
+            std::make_shared<LayerCreator<ngraph::op::Sigmoid>>("Sigmoid"),
+            std::make_shared<LayerCreator<ngraph::op::Sin>>("Sin"),
+            std::make_shared<LayerCreator<ngraph::op::Sign>>("Sign"),
+            std::make_shared<LayerCreator<ngraph::op::Sinh>>("Sinh"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Softmax>>("Softmax"),
+            std::make_shared<LayerCreator<ngraph::op::v1::Split>>("Split"),
+            std::make_shared<LayerCreator<ngraph::op::VariadicSplit>>("VariadicSplit"),
+            std::make_shared<LayerCreator<ngraph::op::Sqrt>>("Sqrt"),
+            std::make_shared<LayerCreator<ngraph::op::Squeeze>>("Squeeze"),
+            std::make_shared<LayerCreator<ngraph::op::Tan>>("Tan"),
+            std::make_shared<LayerCreator<ngraph::op::Tanh>>("TanH"),
+            std::make_shared<LayerCreator<ngraph::op::Tile>>("Tile"),
+            std::make_shared<LayerCreator<ngraph::op::v1::TopK>>("TopK"),
+            std::make_shared<LayerCreator<ngraph::op::TensorIterator>>("TensorIterator"),
+            std::make_shared<LayerCreator<ngraph::op::Transpose>>("Transpose"),
+            std::make_shared<LayerCreator<ngraph::op::Unsqueeze>>("Unsqueeze"),
+            std::make_shared<LayerCreator<ngraph::op::v1::LogicalAnd>>("LogicalAnd"),
+            std::make_shared<LayerCreator<ngraph::op::v1::LogicalOr>>("LogicalOr"),
+            std::make_shared<LayerCreator<ngraph::op::v1::LogicalXor>>("LogicalXor"),
+            std::make_shared<LayerCreator<ngraph::op::v1::LogicalNot>>("LogicalNot"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ReduceLogicalAnd>>("ReduceLogicalAnd"),
+            std::make_shared<LayerCreator<ngraph::op::v1::ReduceLogicalOr>>("ReduceLogicalOr"),
+        };
+        details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> creatorMap;
+        for (const auto& creator : creatorList) {
+            creatorMap[creator->getType()] = creator;
+        }
+        return creatorMap;
+    }();
 
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
@@ -423,27 +434,27 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
     }
 
     std::shared_ptr<ngraph::Node> ngraphNode;
+    const auto opsetIt = opsets.find(params.version);
     // Try to create operation from creators
-    for (const auto& creator : creators) {
-        if (creator->shouldCreate(params.type)) {
-            bool useCreator = false;
-            // Check that opset is registered
-            useCreator |= opsets.find(params.version) == opsets.end();
-            if (!useCreator) {
-                // Check that creator can create operation with the version from opset
-                const auto opset = opsets.at(params.version);
-                // Opset should contains the same version of operation or doesn't contain operation with current type
-                useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
-            }
-            if (useCreator)
-                ngraphNode = creator->createLayer(inputs, node, binStream, params);
-            break;
+    const auto creatorIt = creators.find(params.type);
+    if (creatorIt != creators.end()) {
+        const auto& creator = creatorIt->second;
+        bool useCreator = false;
+        // Check that opset is registered
+        useCreator |= opsetIt == opsets.end();
+        if (!useCreator) {
+            // Check that creator can create operation with the version from opset
+            const auto& opset = opsetIt->second;
+            // Opset should contains the same version of operation or doesn't contain operation with current type
+            useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
         }
+        if (useCreator)
+            ngraphNode = creator->createLayer(inputs, node, binStream, params);
     }
 
     // Try to create operation from loaded opsets
-    if (!ngraphNode && opsets.count(params.version)) {
-        auto opset = opsets.at(params.version);
+    if (!ngraphNode && opsetIt != opsets.end()) {
+        const auto& opset = opsetIt->second;
 
         if (!opset.contains_type(params.type)) {
             THROW_IE_EXCEPTION << "Opset " << params.version << " doesn't contain the operation with type: " << params.type;
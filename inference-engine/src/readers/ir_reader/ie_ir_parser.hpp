@@ -98,9 +98,6 @@ private:
 
     protected:
         explicit LayerBaseCreator(const std::string& type): type(type) {}
-        std::string getType() {
-            return type;
-        }
         template <class T>
         std::vector<T> getParameters(const pugi::xml_node& node, const std::string& name) {
             std::vector<T> result;
@@ -141,11 +138,13 @@ private:
 
     public:
         virtual ~LayerBaseCreator() {}
+        std::string getType() const {
+            return type;
+        }
         virtual std::shared_ptr<ngraph::Node> createLayer(const ngraph::OutputVector& inputs,
                                                           const pugi::xml_node& node, std::istream& binStream,
                                                           const GenericLayerParams& layerParsePrms) = 0;
 
-        bool shouldCreate(const std::string& nodeType) const;
         virtual ngraph::NodeTypeInfo getNodeType() const = 0;
     };
 
@@ -39,7 +39,22 @@ CNNNetwork IRReader::read(std::istream& model, std::istream& weights, const std:
     model.seekg(0, model.beg);
     weights.seekg(0, weights.beg);
     pugi::xml_document xmlDoc;
-    pugi::xml_parse_result res = xmlDoc.load(model);
+    pugi::xml_parse_result res;
+
+    // Read the model into a single buffer which pugixml tokenizes in place:
+    // this avoids the second full copy of the XML text inside the parser
+    model.seekg(0, model.end);
+    const std::streampos length = model.tellg();
+    model.seekg(0, model.beg);
+    if (length > 0) {
+        void* buffer = pugi::get_memory_allocation_function()(static_cast<size_t>(length));
+        if (buffer == nullptr) THROW_IE_EXCEPTION << "Cannot allocate buffer for the model XML";
+        model.read(reinterpret_cast<char*>(buffer), length);
+        res = xmlDoc.load_buffer_inplace_own(buffer, static_cast<size_t>(length));
+    } else {
+        // non-seekable stream, let pugixml buffer it
+        res = xmlDoc.load(model);
+    }
     if (res.status != pugi::status_ok) {
         THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
     }
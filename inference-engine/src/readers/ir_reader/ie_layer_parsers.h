@@ -40,21 +40,23 @@ public:
 
         if (res->type == "Quantize") res->type = "FakeQuantize";
 
+        // kept local so that concurrent CreateLayer calls share no creator state
+        std::vector<std::string> dataNodeNames;
         if (std::is_same<LT, FullyConnectedLayer>::value) {
-            layerChild[res->name] = {"fc", "fc_data", "data"};
+            dataNodeNames = {"fc", "fc_data", "data"};
         } else if (std::is_same<LT, NormLayer>::value) {
-            layerChild[res->name] = {"lrn", "norm", "norm_data", "data"};
+            dataNodeNames = {"lrn", "norm", "norm_data", "data"};
         } else if (std::is_same<LT, CropLayer>::value) {
-            layerChild[res->name] = {"crop", "crop-data", "data"};
+            dataNodeNames = {"crop", "crop-data", "data"};
         } else if (std::is_same<LT, BatchNormalizationLayer>::value) {
-            layerChild[res->name] = {"batch_norm", "batch_norm_data", "data"};
+            dataNodeNames = {"batch_norm", "batch_norm_data", "data"};
         } else if ((std::is_same<LT, EltwiseLayer>::value)) {
-            layerChild[res->name] = {"elementwise", "elementwise_data", "data"};
+            dataNodeNames = {"elementwise", "elementwise_data", "data"};
         } else {
-            layerChild[res->name] = {"data", tolower(res->type) + "_data", tolower(res->type)};
+            dataNodeNames = {"data", tolower(res->type) + "_data", tolower(res->type)};
         }
 
-        pugi::xml_node dn = GetChild(node, layerChild[res->name], false);
+        pugi::xml_node dn = GetChild(node, dataNodeNames, false);
 
         if (!dn.empty()) {
             if (dn.child("crop").empty()) {
@@ -86,8 +88,6 @@ public:
         }
         return res;
     }
-
-    std::map<std::string, std::vector<std::string>> layerChild;
 };
 
 class ActivationLayerCreator : public BaseCreator {
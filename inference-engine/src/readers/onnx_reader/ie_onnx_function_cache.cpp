@@ -0,0 +1,528 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_onnx_function_cache.hpp"
+
+#include <ie_profiling.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/except.hpp>
+#include <ngraph/node.hpp>
+#include <ngraph/op/constant.hpp>
+#include <ngraph/op/parameter.hpp>
+#include <ngraph/op/result.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/type/element_type.hpp>
+
+namespace InferenceEngine {
+namespace onnx_cache {
+namespace {
+
+const uint32_t kCacheMagic = 0x43464e47;  // "NGFC"
+const uint32_t kCacheVersion = 1;
+
+// kind of a serialized node record; everything which is not a parameter,
+// constant or result goes through the generic attribute-visitor path
+enum class NodeKind : uint8_t { Parameter = 0, Constant = 1, Result = 2, Op = 3 };
+
+// type tag written in front of every attribute value, so a mismatch between the
+// serialized entry and the attribute visiting order of the current ops is detected
+// instead of being read as garbage
+enum class AttrTag : uint8_t {
+    Bool = 1,
+    String,
+    I8,
+    I16,
+    I32,
+    I64,
+    U8,
+    U16,
+    U32,
+    U64,
+    F32,
+    F64,
+    VecI8,
+    VecI16,
+    VecI32,
+    VecI64,
+    VecU8,
+    VecU16,
+    VecU32,
+    VecU64,
+    VecF32,
+    VecF64,
+    VecString,
+};
+
+void writeRaw(std::ostream& out, const void* data, size_t size) {
+    if (size)
+        out.write(reinterpret_cast<const char*>(data), size);
+}
+
+void readRaw(std::istream& in, void* data, size_t size) {
+    if (!size)
+        return;
+    in.read(reinterpret_cast<char*>(data), size);
+    if (!in)
+        throw ngraph::ngraph_error("Unexpected end of the cached function entry");
+}
+
+template <typename T>
+void writeScalar(std::ostream& out, const T& value) {
+    T tmp = value;
+    writeRaw(out, &tmp, sizeof(tmp));
+}
+
+template <typename T>
+T readScalar(std::istream& in) {
+    T value;
+    readRaw(in, &value, sizeof(value));
+    return value;
+}
+
+void writeString(std::ostream& out, const std::string& value) {
+    writeScalar<uint64_t>(out, value.size());
+    writeRaw(out, value.data(), value.size());
+}
+
+std::string readString(std::istream& in) {
+    std::string value(readScalar<uint64_t>(in), '\0');
+    readRaw(in, &value[0], value.size());
+    return value;
+}
+
+template <typename T>
+void writeVector(std::ostream& out, const std::vector<T>& value) {
+    writeScalar<uint64_t>(out, value.size());
+    writeRaw(out, value.data(), value.size() * sizeof(T));
+}
+
+template <typename T>
+std::vector<T> readVector(std::istream& in) {
+    std::vector<T> value(readScalar<uint64_t>(in));
+    readRaw(in, value.data(), value.size() * sizeof(T));
+    return value;
+}
+
+// element types representable by the cache format; the index in this table is what
+// gets serialized, so entries must not be reordered without a version bump
+const std::vector<ngraph::element::Type>& elementTypeTable() {
+    static const std::vector<ngraph::element::Type> table = {
+        ngraph::element::boolean, ngraph::element::bf16, ngraph::element::f16, ngraph::element::f32,
+        ngraph::element::f64,     ngraph::element::i8,   ngraph::element::i16, ngraph::element::i32,
+        ngraph::element::i64,     ngraph::element::u8,   ngraph::element::u16, ngraph::element::u32,
+        ngraph::element::u64,
+    };
+    return table;
+}
+
+bool writeElementType(std::ostream& out, const ngraph::element::Type& type) {
+    const auto& table = elementTypeTable();
+    for (size_t i = 0; i < table.size(); i++) {
+        if (table[i] == type) {
+            writeScalar<uint32_t>(out, static_cast<uint32_t>(i));
+            return true;
+        }
+    }
+    return false;
+}
+
+ngraph::element::Type readElementType(std::istream& in) {
+    const auto& table = elementTypeTable();
+    auto index = readScalar<uint32_t>(in);
+    if (index >= table.size())
+        throw ngraph::ngraph_error("Unknown element type in the cached function entry");
+    return table[index];
+}
+
+void writePartialShape(std::ostream& out, const ngraph::PartialShape& shape) {
+    writeScalar<uint8_t>(out, shape.rank().is_dynamic() ? 1 : 0);
+    if (shape.rank().is_dynamic())
+        return;
+    auto rank = static_cast<size_t>(shape.rank().get_length());
+    writeScalar<uint64_t>(out, rank);
+    for (size_t i = 0; i < rank; i++)
+        writeScalar<int64_t>(out, shape[i].is_dynamic() ? -1 : shape[i].get_length());
+}
+
+ngraph::PartialShape readPartialShape(std::istream& in) {
+    if (readScalar<uint8_t>(in))
+        return ngraph::PartialShape::dynamic();
+    std::vector<ngraph::Dimension> dims(readScalar<uint64_t>(in));
+    for (auto& dim : dims) {
+        auto value = readScalar<int64_t>(in);
+        dim = value < 0 ? ngraph::Dimension::dynamic() : ngraph::Dimension(value);
+    }
+    return ngraph::PartialShape(dims);
+}
+
+const ngraph::OpSet* opsetForVersion(uint64_t version) {
+    switch (version) {
+    case 0: return &ngraph::get_opset0();
+    case 1: return &ngraph::get_opset1();
+    case 2: return &ngraph::get_opset2();
+    case 3: return &ngraph::get_opset3();
+    default: return nullptr;
+    }
+}
+
+#define ON_SCALAR_ADAPTER_WRITE(TYPE, TAG)                                                        \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<TYPE>& adapter) override {     \
+        writeScalar<uint8_t>(m_out, static_cast<uint8_t>(AttrTag::TAG));                          \
+        writeScalar<TYPE>(m_out, adapter.get());                                                  \
+    }
+
+#define ON_VECTOR_ADAPTER_WRITE(TYPE, TAG)                                                        \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<TYPE>>& adapter)   \
+        override {                                                                                \
+        writeScalar<uint8_t>(m_out, static_cast<uint8_t>(AttrTag::TAG));                          \
+        writeVector<TYPE>(m_out, adapter.get());                                                  \
+    }
+
+// Serializes the attributes of a node in visiting order as (tag, value) records.
+// Attribute types without a binary representation (nested functions, raw pointers)
+// mark the visitor as failed, which excludes the whole function from the cache.
+class BinaryAttributeWriter : public ngraph::AttributeVisitor {
+public:
+    explicit BinaryAttributeWriter(std::ostream& out) : m_out(out) {}
+
+    bool failed() const { return m_failed; }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_failed = true;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        writeScalar<uint8_t>(m_out, static_cast<uint8_t>(AttrTag::String));
+        writeString(m_out, adapter.get());
+    }
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        writeScalar<uint8_t>(m_out, static_cast<uint8_t>(AttrTag::VecString));
+        const auto& value = adapter.get();
+        writeScalar<uint64_t>(m_out, value.size());
+        for (const auto& item : value)
+            writeString(m_out, item);
+    }
+
+    ON_SCALAR_ADAPTER_WRITE(bool, Bool)
+    ON_SCALAR_ADAPTER_WRITE(int8_t, I8)
+    ON_SCALAR_ADAPTER_WRITE(int16_t, I16)
+    ON_SCALAR_ADAPTER_WRITE(int32_t, I32)
+    ON_SCALAR_ADAPTER_WRITE(int64_t, I64)
+    ON_SCALAR_ADAPTER_WRITE(uint8_t, U8)
+    ON_SCALAR_ADAPTER_WRITE(uint16_t, U16)
+    ON_SCALAR_ADAPTER_WRITE(uint32_t, U32)
+    ON_SCALAR_ADAPTER_WRITE(uint64_t, U64)
+    ON_SCALAR_ADAPTER_WRITE(float, F32)
+    ON_SCALAR_ADAPTER_WRITE(double, F64)
+    ON_VECTOR_ADAPTER_WRITE(int8_t, VecI8)
+    ON_VECTOR_ADAPTER_WRITE(int16_t, VecI16)
+    ON_VECTOR_ADAPTER_WRITE(int32_t, VecI32)
+    ON_VECTOR_ADAPTER_WRITE(int64_t, VecI64)
+    ON_VECTOR_ADAPTER_WRITE(uint8_t, VecU8)
+    ON_VECTOR_ADAPTER_WRITE(uint16_t, VecU16)
+    ON_VECTOR_ADAPTER_WRITE(uint32_t, VecU32)
+    ON_VECTOR_ADAPTER_WRITE(uint64_t, VecU64)
+    ON_VECTOR_ADAPTER_WRITE(float, VecF32)
+    ON_VECTOR_ADAPTER_WRITE(double, VecF64)
+
+private:
+    std::ostream& m_out;
+    bool m_failed = false;
+};
+
+#define ON_SCALAR_ADAPTER_READ(TYPE, TAG)                                                         \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<TYPE>& adapter) override {     \
+        expectTag(AttrTag::TAG);                                                                  \
+        adapter.set(readScalar<TYPE>(m_in));                                                      \
+    }
+
+#define ON_VECTOR_ADAPTER_READ(TYPE, TAG)                                                         \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<TYPE>>& adapter)   \
+        override {                                                                                \
+        expectTag(AttrTag::TAG);                                                                  \
+        adapter.set(readVector<TYPE>(m_in));                                                      \
+    }
+
+// Restores the attributes of a node in visiting order; the visiting order is defined by
+// the op implementation and therefore matches the order the entry was written in
+class BinaryAttributeReader : public ngraph::AttributeVisitor {
+public:
+    explicit BinaryAttributeReader(std::istream& in) : m_in(in) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        throw ngraph::ngraph_error("Unsupported attribute type in the cached function entry");
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        expectTag(AttrTag::String);
+        adapter.set(readString(m_in));
+    }
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        expectTag(AttrTag::VecString);
+        std::vector<std::string> value(readScalar<uint64_t>(m_in));
+        for (auto& item : value)
+            item = readString(m_in);
+        adapter.set(value);
+    }
+
+    ON_SCALAR_ADAPTER_READ(bool, Bool)
+    ON_SCALAR_ADAPTER_READ(int8_t, I8)
+    ON_SCALAR_ADAPTER_READ(int16_t, I16)
+    ON_SCALAR_ADAPTER_READ(int32_t, I32)
+    ON_SCALAR_ADAPTER_READ(int64_t, I64)
+    ON_SCALAR_ADAPTER_READ(uint8_t, U8)
+    ON_SCALAR_ADAPTER_READ(uint16_t, U16)
+    ON_SCALAR_ADAPTER_READ(uint32_t, U32)
+    ON_SCALAR_ADAPTER_READ(uint64_t, U64)
+    ON_SCALAR_ADAPTER_READ(float, F32)
+    ON_SCALAR_ADAPTER_READ(double, F64)
+    ON_VECTOR_ADAPTER_READ(int8_t, VecI8)
+    ON_VECTOR_ADAPTER_READ(int16_t, VecI16)
+    ON_VECTOR_ADAPTER_READ(int32_t, VecI32)
+    ON_VECTOR_ADAPTER_READ(int64_t, VecI64)
+    ON_VECTOR_ADAPTER_READ(uint8_t, VecU8)
+    ON_VECTOR_ADAPTER_READ(uint16_t, VecU16)
+    ON_VECTOR_ADAPTER_READ(uint32_t, VecU32)
+    ON_VECTOR_ADAPTER_READ(uint64_t, VecU64)
+    ON_VECTOR_ADAPTER_READ(float, VecF32)
+    ON_VECTOR_ADAPTER_READ(double, VecF64)
+
+private:
+    void expectTag(AttrTag expected) {
+        if (readScalar<uint8_t>(m_in) != static_cast<uint8_t>(expected))
+            throw ngraph::ngraph_error("Attribute type mismatch in the cached function entry");
+    }
+
+    std::istream& m_in;
+};
+
+bool serializeFunction(const ngraph::Function& function, std::ostream& out) {
+    auto ops = function.get_ordered_ops();
+    std::map<ngraph::Node*, uint64_t> ids;
+
+    writeScalar<uint32_t>(out, kCacheMagic);
+    writeScalar<uint32_t>(out, kCacheVersion);
+    writeString(out, function.get_friendly_name());
+    writeScalar<uint64_t>(out, ops.size());
+
+    for (const auto& node : ops) {
+        writeString(out, node->get_friendly_name());
+        writeScalar<uint64_t>(out, node->get_input_size());
+        for (size_t i = 0; i < node->get_input_size(); i++) {
+            auto source = node->input_value(i);
+            auto id = ids.find(source.get_node());
+            if (id == ids.end())
+                return false;
+            writeScalar<uint64_t>(out, id->second);
+            writeScalar<uint64_t>(out, source.get_index());
+        }
+
+        if (auto parameter = ngraph::as_type<ngraph::op::Parameter>(node.get())) {
+            writeScalar<uint8_t>(out, static_cast<uint8_t>(NodeKind::Parameter));
+            if (!writeElementType(out, parameter->get_element_type()))
+                return false;
+            writePartialShape(out, parameter->get_partial_shape());
+        } else if (auto constant = ngraph::as_type<ngraph::op::Constant>(node.get())) {
+            writeScalar<uint8_t>(out, static_cast<uint8_t>(NodeKind::Constant));
+            if (!writeElementType(out, constant->get_element_type()))
+                return false;
+            const auto& shape = constant->get_shape();
+            writeScalar<uint64_t>(out, shape.size());
+            for (auto dim : shape)
+                writeScalar<uint64_t>(out, dim);
+            uint64_t byteSize = ngraph::shape_size(shape) * constant->get_element_type().size();
+            writeScalar<uint64_t>(out, byteSize);
+            writeRaw(out, constant->get_data_ptr(), byteSize);
+        } else if (ngraph::is_type<ngraph::op::Result>(node.get())) {
+            writeScalar<uint8_t>(out, static_cast<uint8_t>(NodeKind::Result));
+        } else {
+            const auto& info = node->get_type_info();
+            const auto* opset = opsetForVersion(info.version);
+            // ops outside the released opsets (importer-internal nodes) cannot be
+            // re-created by name on load, so such functions are not cached
+            if (!opset || !opset->contains_type(std::string(info.name)))
+                return false;
+            writeScalar<uint8_t>(out, static_cast<uint8_t>(NodeKind::Op));
+            writeString(out, info.name);
+            writeScalar<uint64_t>(out, info.version);
+            BinaryAttributeWriter writer(out);
+            if (!node->visit_attributes(writer) || writer.failed())
+                return false;
+        }
+
+        uint64_t id = ids.size();
+        ids[node.get()] = id;
+    }
+
+    auto writeNodeList = [&](const std::vector<std::shared_ptr<ngraph::Node>>& nodes) {
+        writeScalar<uint64_t>(out, nodes.size());
+        for (const auto& node : nodes)
+            writeScalar<uint64_t>(out, ids.at(node.get()));
+    };
+    writeNodeList({function.get_parameters().begin(), function.get_parameters().end()});
+    writeNodeList({function.get_results().begin(), function.get_results().end()});
+
+    return out.good();
+}
+
+std::shared_ptr<ngraph::Function> deserializeFunction(std::istream& in) {
+    if (readScalar<uint32_t>(in) != kCacheMagic || readScalar<uint32_t>(in) != kCacheVersion)
+        throw ngraph::ngraph_error("Not a cached function entry of the expected version");
+
+    auto name = readString(in);
+    std::vector<std::shared_ptr<ngraph::Node>> nodes(readScalar<uint64_t>(in));
+
+    for (auto& node : nodes) {
+        auto friendlyName = readString(in);
+        ngraph::OutputVector args(readScalar<uint64_t>(in));
+        for (auto& arg : args) {
+            auto id = readScalar<uint64_t>(in);
+            auto port = readScalar<uint64_t>(in);
+            if (id >= nodes.size() || !nodes[id])
+                throw ngraph::ngraph_error("Invalid node reference in the cached function entry");
+            arg = ngraph::Output<ngraph::Node>(nodes[id], port);
+        }
+
+        switch (static_cast<NodeKind>(readScalar<uint8_t>(in))) {
+        case NodeKind::Parameter: {
+            auto type = readElementType(in);
+            node = std::make_shared<ngraph::op::Parameter>(type, readPartialShape(in));
+            break;
+        }
+        case NodeKind::Constant: {
+            auto type = readElementType(in);
+            ngraph::Shape shape(readScalar<uint64_t>(in));
+            for (auto& dim : shape)
+                dim = readScalar<uint64_t>(in);
+            std::vector<char> data(readScalar<uint64_t>(in));
+            readRaw(in, data.data(), data.size());
+            if (data.size() != ngraph::shape_size(shape) * type.size())
+                throw ngraph::ngraph_error("Invalid constant size in the cached function entry");
+            node = std::make_shared<ngraph::op::Constant>(type, shape, data.data());
+            break;
+        }
+        case NodeKind::Result:
+            if (args.size() != 1)
+                throw ngraph::ngraph_error("Invalid result node in the cached function entry");
+            node = std::make_shared<ngraph::op::Result>(args[0]);
+            break;
+        case NodeKind::Op: {
+            auto typeName = readString(in);
+            const auto* opset = opsetForVersion(readScalar<uint64_t>(in));
+            node = std::shared_ptr<ngraph::Node>(opset ? opset->create(typeName) : nullptr);
+            if (!node)
+                throw ngraph::ngraph_error("Unknown op " + typeName + " in the cached function entry");
+            node->set_arguments(args);
+            BinaryAttributeReader reader(in);
+            if (!node->visit_attributes(reader))
+                throw ngraph::ngraph_error("Op " + typeName + " does not support attribute visiting");
+            node->constructor_validate_and_infer_types();
+            break;
+        }
+        default:
+            throw ngraph::ngraph_error("Invalid node kind in the cached function entry");
+        }
+        node->set_friendly_name(friendlyName);
+    }
+
+    auto readNodeList = [&](std::vector<std::shared_ptr<ngraph::Node>>& list) {
+        list.resize(readScalar<uint64_t>(in));
+        for (auto& node : list) {
+            auto id = readScalar<uint64_t>(in);
+            if (id >= nodes.size())
+                throw ngraph::ngraph_error("Invalid node reference in the cached function entry");
+            node = nodes[id];
+        }
+    };
+
+    std::vector<std::shared_ptr<ngraph::Node>> parameterNodes, resultNodes;
+    readNodeList(parameterNodes);
+    readNodeList(resultNodes);
+
+    ngraph::ParameterVector parameters;
+    for (const auto& node : parameterNodes) {
+        auto parameter = ngraph::as_type_ptr<ngraph::op::Parameter>(node);
+        if (!parameter)
+            throw ngraph::ngraph_error("Invalid parameter node in the cached function entry");
+        parameters.push_back(parameter);
+    }
+    ngraph::ResultVector results;
+    for (const auto& node : resultNodes) {
+        auto result = ngraph::as_type_ptr<ngraph::op::Result>(node);
+        if (!result)
+            throw ngraph::ngraph_error("Invalid result node in the cached function entry");
+        results.push_back(result);
+    }
+
+    return std::make_shared<ngraph::Function>(results, parameters, name);
+}
+
+}  // namespace
+
+std::string modelHash(const std::string& modelBytes) {
+    // 64-bit FNV-1a over the model bytes, with the model size appended to the entry
+    // name so a hash collision additionally requires an exact size match
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : modelBytes) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    std::ostringstream result;
+    result << std::hex << std::setfill('0') << std::setw(16) << hash << "-" << modelBytes.size();
+    return result.str();
+}
+
+std::shared_ptr<ngraph::Function> tryLoad(const std::string& path) {
+    IE_PROFILING_AUTO_SCOPE(onnx_cache::tryLoad)
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return nullptr;
+    try {
+        return deserializeFunction(file);
+    } catch (...) {
+        // a stale or truncated entry is not an error, the model is simply re-imported
+        return nullptr;
+    }
+}
+
+bool tryStore(const ngraph::Function& function, const std::string& path) {
+    IE_PROFILING_AUTO_SCOPE(onnx_cache::tryStore)
+    std::ostringstream buffer(std::ios::binary);
+    if (!serializeFunction(function, buffer))
+        return false;
+
+    // write to a temporary name first, so concurrent readers never observe a partial entry
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+        const std::string& bytes = buffer.str();
+        file.write(bytes.data(), bytes.size());
+        if (!file)
+            return false;
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace onnx_cache
+}  // namespace InferenceEngine
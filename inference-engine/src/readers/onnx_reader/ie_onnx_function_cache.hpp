@@ -0,0 +1,47 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <ngraph/function.hpp>
+
+namespace InferenceEngine {
+namespace onnx_cache {
+
+/**
+ * On-disk cache of imported ngraph functions, keyed by a hash of the ONNX model bytes.
+ *
+ * The cache stores a compact binary serialization of the function (topology, generic op
+ * attributes captured through ngraph::AttributeVisitor, and raw constant data), so a repeated
+ * import of an unchanged model is a plain deserialization instead of the full ONNX frontend
+ * pass. The format is host-local: entries are not meant to be moved between machines or
+ * library versions, and any entry which fails to deserialize is simply re-imported.
+ *
+ * The cache is enabled by pointing the IE_ONNX_CACHE_DIR environment variable to an existing
+ * directory; when the variable is not set the reader imports every model from scratch.
+ */
+
+/** @brief Returns the cache entry name (a stable hex hash) for the given model bytes */
+std::string modelHash(const std::string& modelBytes);
+
+/**
+ * @brief Tries to deserialize a cached function from the given path.
+ * @return the function, or nullptr when the entry is absent, stale or unreadable
+ */
+std::shared_ptr<ngraph::Function> tryLoad(const std::string& path);
+
+/**
+ * @brief Tries to serialize the function to the given path.
+ *
+ * Functions containing ops which do not support attribute visiting (or attribute types the
+ * binary format cannot represent) are not cached.
+ * @return true when the entry was written
+ */
+bool tryStore(const ngraph::Function& function, const std::string& path);
+
+}  // namespace onnx_cache
+}  // namespace InferenceEngine
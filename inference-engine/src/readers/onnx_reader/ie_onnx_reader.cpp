@@ -3,9 +3,15 @@
 //
 
 #include "ie_onnx_reader.hpp"
+#include "ie_onnx_function_cache.hpp"
 #include <ie_api.h>
+#include <ie_profiling.hpp>
 #include <ngraph/frontend/onnx_import/onnx.hpp>
 
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
 using namespace InferenceEngine;
 
 bool ONNXReader::supportModel(std::istream& model) const {
@@ -21,8 +27,28 @@ bool ONNXReader::supportModel(std::istream& model) const {
 }
 
 CNNNetwork ONNXReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    IE_PROFILING_AUTO_SCOPE(ONNXReader::read)
     model.seekg(0, model.beg);
-    return CNNNetwork(ngraph::onnx_import::import_onnx_model(model));
+
+    const char* cacheDir = std::getenv("IE_ONNX_CACHE_DIR");
+    if (cacheDir == nullptr || cacheDir[0] == '\0') {
+        return CNNNetwork(ngraph::onnx_import::import_onnx_model(model));
+    }
+
+    std::stringstream modelBuffer;
+    modelBuffer << model.rdbuf();
+    const std::string& modelBytes = modelBuffer.str();
+    const std::string cachePath =
+        std::string(cacheDir) + "/" + onnx_cache::modelHash(modelBytes) + ".ngf";
+
+    if (auto cachedFunction = onnx_cache::tryLoad(cachePath)) {
+        return CNNNetwork(cachedFunction);
+    }
+
+    std::istringstream modelStream(modelBytes);
+    auto function = ngraph::onnx_import::import_onnx_model(modelStream);
+    onnx_cache::tryStore(*function, cachePath);
+    return CNNNetwork(function);
 }
 
 INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
@@ -0,0 +1,39 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API FoldShapeOfSubgraphs;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/*
+ * Description:
+ *     FoldShapeOfSubgraphs replaces ShapeOf operations whose input shape is
+ *     already static with Constant operations. Dynamic-flavored models carry
+ *     ShapeOf->Gather->Concat->Reshape chains that would otherwise execute on
+ *     every inference; once the ShapeOf is frozen the following ConstantFolding
+ *     pass collapses the whole shape-computation subgraph.
+ */
+
+class ngraph::pass::FoldShapeOfSubgraphs: public ngraph::pass::GraphRewrite {
+public:
+    FoldShapeOfSubgraphs() : GraphRewrite() {
+        fold_shape_of();
+    }
+
+private:
+    void fold_shape_of();
+};
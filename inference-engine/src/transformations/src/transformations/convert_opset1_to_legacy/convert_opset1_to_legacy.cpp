@@ -54,6 +54,8 @@
 
 bool ngraph::pass::ConvertOpSet1ToLegacy::run_on_function(std::shared_ptr<ngraph::Function> f) {
     ngraph::pass::Manager OpSet1ToLegacy;
+    // runs of consecutive GraphRewrite conversions share one traversal each
+    OpSet1ToLegacy.set_fuse_graph_rewrites(true);
     std::vector<std::shared_ptr<ngraph::pass::PassBase> > transforms;
 
 #define NGRAPH_PASS(NAME, NAMESPACE) transforms.push_back(OpSet1ToLegacy.register_pass<NAMESPACE::NAME>());
@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/fold_shape_of_subgraphs.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/rt_info.hpp>
+
+void ngraph::pass::FoldShapeOfSubgraphs::fold_shape_of() {
+    auto data = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 1, 1, 1});
+
+    ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+        auto shape_of = m.get_match_root();
+        const auto & input_shape = shape_of->get_input_partial_shape(0);
+        if (input_shape.is_dynamic()) {
+            return false;
+        }
+
+        auto shape = input_shape.to_shape();
+        std::vector<int64_t> dims(shape.begin(), shape.end());
+        auto constant = opset1::Constant::create(shape_of->get_output_element_type(0), Shape{dims.size()}, dims);
+
+        constant->set_friendly_name(shape_of->get_friendly_name());
+        ngraph::copy_runtime_info(shape_of, constant);
+        ngraph::replace_node(shape_of, constant);
+        return true;
+    };
+
+    auto shape_of_v0 = std::make_shared<ngraph::opset1::ShapeOf>(data);
+    this->add_matcher(std::make_shared<ngraph::pattern::Matcher>(shape_of_v0, "FoldShapeOfSubgraphs.ShapeOfV0"),
+                      callback, PassProperty::CHANGE_DYNAMIC_STATE);
+
+    auto shape_of_v3 = std::make_shared<ngraph::opset3::ShapeOf>(data);
+    this->add_matcher(std::make_shared<ngraph::pattern::Matcher>(shape_of_v3, "FoldShapeOfSubgraphs.ShapeOfV3"),
+                      callback, PassProperty::CHANGE_DYNAMIC_STATE);
+}
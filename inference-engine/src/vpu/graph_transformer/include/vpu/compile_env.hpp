@@ -54,6 +54,21 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    /// Makes the given compilation environment visible on the current thread.
+    /// The environment is thread local, so parallel loops inside the compiler
+    /// have to propagate it to the worker threads running their bodies.
+    class ScopedThreadEnv final {
+    public:
+        explicit ScopedThreadEnv(const CompileEnv& env);
+        ~ScopedThreadEnv();
+
+        ScopedThreadEnv(const ScopedThreadEnv&) = delete;
+        ScopedThreadEnv& operator=(const ScopedThreadEnv&) = delete;
+
+    private:
+        bool _attached = false;
+    };
+
 private:
     explicit CompileEnv(Platform platform);
 };
@@ -97,6 +97,8 @@ DECLARE_VPU_MYRIAD_CONFIG_VALUE(POWER_STAGE_NCES);
 
 DECLARE_VPU_MYRIAD_CONFIG_KEY(THROUGHPUT_STREAMS);
 
+DECLARE_VPU_MYRIAD_CONFIG_KEY(TUNE_REQUEST_DEPTH);
+
 DECLARE_VPU_MYRIAD_CONFIG_KEY(WATCHDOG);
 
 DECLARE_VPU_MYRIAD_CONFIG_KEY(PLUGIN_LOG_FILE_PATH);
@@ -132,6 +132,23 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+CompileEnv::ScopedThreadEnv::ScopedThreadEnv(const CompileEnv& env) {
+    if (g_compileEnv == nullptr) {
+        // a worker thread - borrow the environment of the thread which spawned the loop
+        g_compileEnv = const_cast<CompileEnv*>(&env);
+        _attached = true;
+    } else {
+        // the loop body may also run on the spawning thread itself
+        IE_ASSERT(g_compileEnv == &env);
+    }
+}
+
+CompileEnv::ScopedThreadEnv::~ScopedThreadEnv() {
+    if (_attached) {
+        g_compileEnv = nullptr;
+    }
+}
+
 //
 // compileNetwork
 //
@@ -4,7 +4,12 @@
 
 #include <vpu/middleend/pass_manager.hpp>
 
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ie_parallel.hpp>
 
 #include <vpu/middleend/allocator/allocator.hpp>
 #include <vpu/compile_env.hpp>
@@ -18,170 +23,307 @@ public:
     void run(const Model& model) override;
 };
 
-void PassImpl::run(const Model& model) {
-    const auto& env = CompileEnv::get();
+void checkData(const Data& data) {
+    auto topParent = data->getTopParentData();
 
     //
-    // Check Data requirements.
+    // Memory type.
     //
 
-    for (const auto& data : model->datas()) {
-        auto topParent = data->getTopParentData();
+    auto memoryType = topParent->memReqs();
+
+    loopOverData(topParent, [memoryType](const Data& subData) {
+        auto subMemType = subData->memReqs();
+        IE_ASSERT(subMemType == memoryType);
+        return DataLoopStatus::NextChild;
+    });
+
+    if (memoryType == MemoryType::CMX) {
+        IE_ASSERT(topParent->dataLocation().location == Location::CMX);
+    }
+
+    //
+    // Data <-> Data Edges.
+    //
+
+    if (auto dataEdge = data->parentDataToDataEdge()) {
+        auto parent = dataEdge->parent();
+        auto child = dataEdge->child();
+
+        Data producer, consumer;
+        if (dataEdge->order() == SharedDataOrder::ChildWritesToParent) {
+            producer = child;
+            consumer = parent;
+        } else if (dataEdge->order() == SharedDataOrder::ParentWritesToChild) {
+            producer = parent;
+            consumer = child;
+        } else {
+            VPU_THROW_EXCEPTION << "Invalid data order " << dataEdge->order();
+        }
 
         //
-        // Memory type.
+        // Child must be Intermediate.
         //
 
-        auto memoryType = topParent->memReqs();
+        IE_ASSERT(child->usage() == DataUsage::Intermediate);
 
-        loopOverData(topParent, [memoryType](const Data& subData) {
-            auto subMemType = subData->memReqs();
-            IE_ASSERT(subMemType == memoryType);
-            return DataLoopStatus::NextChild;
-        });
+        //
+        // Parent can't be Temp or Fake.
+        //
 
-        if (memoryType == MemoryType::CMX) {
-            IE_ASSERT(topParent->dataLocation().location == Location::CMX);
-        }
+        IE_ASSERT(parent->usage() != DataUsage::Temp && parent->usage() != DataUsage::Fake);
 
         //
-        // Data <-> Data Edges.
+        // Consumer must be accesible from the producer.
         //
 
-        if (auto dataEdge = data->parentDataToDataEdge()) {
-            auto parent = dataEdge->parent();
-            auto child = dataEdge->child();
-
-            Data producer, consumer;
-            if (dataEdge->order() == SharedDataOrder::ChildWritesToParent) {
-                producer = child;
-                consumer = parent;
-            } else if (dataEdge->order() == SharedDataOrder::ParentWritesToChild) {
-                producer = parent;
-                consumer = child;
-            } else {
-                VPU_THROW_EXCEPTION << "Invalid data order " << dataEdge->order();
+        Stage connectionStage;
+
+        for (const auto& consumerEdge : producer->consumerEdges()) {
+            for (const auto& outEdge : consumerEdge->consumer()->outputEdges()) {
+                if (outEdge->output() == consumer) {
+                    connectionStage = consumerEdge->consumer();
+                    break;
+                }
+            }
+
+            if (connectionStage != nullptr) {
+                break;
             }
+        }
+
+        IE_ASSERT(dataEdge->connectionMode() == SharedConnectionMode::SUBGRAPH || connectionStage != nullptr);
+
+        //
+        // Connection stage must be special.
+        //
+
+        IE_ASSERT(dataEdge->connectionMode() == SharedConnectionMode::SUBGRAPH || connectionStage->category() == StageCategory::Special);
 
+        //
+        // Special checks for each mode.
+        //
+
+        if (dataEdge->mode() == SharedDataMode::ROI) {
             //
-            // Child must be Intermediate.
+            // Check connection stage type and that parent has the largest buffer.
             //
 
-            IE_ASSERT(child->usage() == DataUsage::Intermediate);
+            if (dataEdge->connectionMode() == SharedConnectionMode::SINGLE_STAGE) {
+                if (connectionStage->type() == StageType::StubConcat ||
+                    connectionStage->type() == StageType::Expand) {
+                    IE_ASSERT(producer == child);
+                    IE_ASSERT(consumer == parent);
+                } else if (connectionStage->type() == StageType::Split ||
+                           connectionStage->type() == StageType::Crop) {
+                    IE_ASSERT(producer == parent);
+                    IE_ASSERT(consumer == child);
+                } else {
+                    VPU_THROW_EXCEPTION
+                            << "Stage type " << connectionStage->type()
+                            << " can't be used for ROI data connection";
+                }
+            }
 
             //
-            // Parent can't be Temp or Fake.
+            // Parent and child must have the same order.
             //
 
-            IE_ASSERT(parent->usage() != DataUsage::Temp && parent->usage() != DataUsage::Fake);
+            IE_ASSERT(parent->desc().dimsOrder() == child->desc().dimsOrder());
 
             //
-            // Consumer must be accesible from the producer.
+            // Offset must be valid.
             //
 
-            Stage connectionStage;
-
-            for (const auto& consumerEdge : producer->consumerEdges()) {
-                for (const auto& outEdge : consumerEdge->consumer()->outputEdges()) {
-                    if (outEdge->output() == consumer) {
-                        connectionStage = consumerEdge->consumer();
-                        break;
-                    }
-                }
+            for (const auto& p : dataEdge->attrs().getOrDefault<DimValues>("offset", DimValues())) {
+                IE_ASSERT(parent->desc().dimsOrder().hasDim(p.first));
 
-                if (connectionStage != nullptr) {
-                    break;
-                }
+                IE_ASSERT(child->desc().dim(p.first) + p.second <= parent->desc().dim(p.first));
             }
 
-            IE_ASSERT(dataEdge->connectionMode() == SharedConnectionMode::SUBGRAPH || connectionStage != nullptr);
+            //
+            // Check strides requirements
+            //
 
+            IE_ASSERT(checkStrides(child->desc(), parent->strides(), child->requiredStrides()));
+        } else if (dataEdge->mode() == SharedDataMode::Reshape) {
             //
-            // Connection stage must be special.
+            // Check connection stage type.
             //
 
-            IE_ASSERT(dataEdge->connectionMode() == SharedConnectionMode::SUBGRAPH || connectionStage->category() == StageCategory::Special);
+            IE_ASSERT(dataEdge->connectionMode() == SharedConnectionMode::SUBGRAPH || connectionStage->type() == StageType::Reshape);
 
             //
-            // Special checks for each mode.
+            // Parent and child must have the same data type.
             //
 
-            if (dataEdge->mode() == SharedDataMode::ROI) {
-                //
-                // Check connection stage type and that parent has the largest buffer.
-                //
-
-                if (dataEdge->connectionMode() == SharedConnectionMode::SINGLE_STAGE) {
-                    if (connectionStage->type() == StageType::StubConcat ||
-                        connectionStage->type() == StageType::Expand) {
-                        IE_ASSERT(producer == child);
-                        IE_ASSERT(consumer == parent);
-                    } else if (connectionStage->type() == StageType::Split ||
-                               connectionStage->type() == StageType::Crop) {
-                        IE_ASSERT(producer == parent);
-                        IE_ASSERT(consumer == child);
-                    } else {
-                        VPU_THROW_EXCEPTION
-                                << "Stage type " << connectionStage->type()
-                                << " can't be used for ROI data connection";
-                    }
-                }
+            IE_ASSERT(parent->desc().type() == child->desc().type());
 
-                //
-                // Parent and child must have the same order.
-                //
+            //
+            // Parent and child must have the same number of elements.
+            //
 
-                IE_ASSERT(parent->desc().dimsOrder() == child->desc().dimsOrder());
+            IE_ASSERT(parent->desc().totalDimSize() == child->desc().totalDimSize());
 
-                //
-                // Offset must be valid.
-                //
+            //
+            // Parent and child must be compact.
+            //
 
-                for (const auto& p : dataEdge->attrs().getOrDefault<DimValues>("offset", DimValues())) {
-                    IE_ASSERT(parent->desc().dimsOrder().hasDim(p.first));
+            // TODO: can we weaken this restriction?
+            IE_ASSERT(parent->checkStrides(StridesRequirement::compact()));
+            IE_ASSERT(child->checkStrides(StridesRequirement::compact()));
+        } else {
+            VPU_THROW_EXCEPTION << "Invalid shared data mode " << dataEdge->mode();
+        }
+    }
+}
 
-                    IE_ASSERT(child->desc().dim(p.first) + p.second <= parent->desc().dim(p.first));
-                }
+void checkStage(const Stage& stage, const CompileEnv& env) {
+    //
+    // Check Data DimsOrder requirements
+    //
+
+    const auto& orderInfo = stage->propagateDataOrder();
 
-                //
-                // Check strides requirements
-                //
+    for (const auto& inEdge : stage->inputEdges()) {
+        if (orderInfo.hasInput(inEdge)) {
+            auto requiredOrder = orderInfo.getInput(inEdge);
+            IE_ASSERT(inEdge->input()->desc().dimsOrder() == requiredOrder);
+        }
+    }
+    for (const auto& outEdge : stage->outputEdges()) {
+        if (orderInfo.hasOutput(outEdge)) {
+            auto requiredOrder = orderInfo.getOutput(outEdge);
+            IE_ASSERT(outEdge->output()->desc().dimsOrder() == requiredOrder);
+        }
+    }
 
-                IE_ASSERT(checkStrides(child->desc(), parent->strides(), child->requiredStrides()));
-            } else if (dataEdge->mode() == SharedDataMode::Reshape) {
-                //
-                // Check connection stage type.
-                //
+    //
+    // Check Data Strides requirements
+    //
 
-                IE_ASSERT(dataEdge->connectionMode() == SharedConnectionMode::SUBGRAPH || connectionStage->type() == StageType::Reshape);
+    const auto& stridesInfo = stage->getDataStridesRequirements();
 
-                //
-                // Parent and child must have the same data type.
-                //
+    for (const auto& inEdge : stage->inputEdges()) {
+        if (stridesInfo.hasInput(inEdge)) {
+            auto requiredStrides = stridesInfo.getInput(inEdge);
+            IE_ASSERT(inEdge->input()->checkStrides(requiredStrides));
+        }
+    }
+    for (const auto& outEdge : stage->outputEdges()) {
+        if (stridesInfo.hasOutput(outEdge)) {
+            auto requiredStrides = stridesInfo.getOutput(outEdge);
+            IE_ASSERT(outEdge->output()->checkStrides(requiredStrides));
+        }
+    }
 
-                IE_ASSERT(parent->desc().type() == child->desc().type());
+    //
+    // Check Data Batch support
+    //
 
-                //
-                // Parent and child must have the same number of elements.
-                //
+    const auto& batchInfo = stage->getBatchSupportInfo();
 
-                IE_ASSERT(parent->desc().totalDimSize() == child->desc().totalDimSize());
+    for (const auto& inEdge : stage->inputEdges()) {
+        if (batchInfo.hasInput(inEdge)) {
+            auto requiredBatch = batchInfo.getInput(inEdge);
 
-                //
-                // Parent and child must be compact.
-                //
+            if (requiredBatch == BatchSupport::Split) {
+                IE_ASSERT(inEdge->input()->desc().dim(Dim::N, 1) == 1);
+            }
+        }
+    }
+    for (const auto& outEdge : stage->outputEdges()) {
+        if (batchInfo.hasOutput(outEdge)) {
+            auto requiredBatch = batchInfo.getOutput(outEdge);
 
-                // TODO: can we weaken this restriction?
-                IE_ASSERT(parent->checkStrides(StridesRequirement::compact()));
-                IE_ASSERT(child->checkStrides(StridesRequirement::compact()));
-            } else {
-                VPU_THROW_EXCEPTION << "Invalid shared data mode " << dataEdge->mode();
+            if (requiredBatch == BatchSupport::Split) {
+                IE_ASSERT(outEdge->output()->desc().dim(Dim::N, 1) == 1);
             }
         }
     }
 
     //
-    // Check Stages requirements.
+    // Check SHAVEs requirements
+    //
+
+    auto stageSHAVEsRequirements = stage->getSHAVEsRequirements();
+
+    if (stageSHAVEsRequirements == StageSHAVEsRequirements::NeedMax) {
+        IE_ASSERT(stage->numSHAVEs() == env.resources.numSHAVEs);
+    } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::CanBeLimited) {
+        IE_ASSERT(stage->numSHAVEs() > 0);
+    } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::TwoOrOne) {
+        IE_ASSERT(stage->numSHAVEs() == 1 || stage->numSHAVEs() == 2);
+    } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::OnlyOne) {
+        IE_ASSERT(stage->numSHAVEs() == 1);
+    } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::NotNeeded) {
+        IE_ASSERT(stage->numSHAVEs() == 0);
+    }
+
+    if (const auto injectedStage = stage->injectedStage()) {
+        IE_ASSERT(injectedStage->numSHAVEs() == stage->numSHAVEs());
+
+        auto injectedReqs = injectedStage->getSHAVEsRequirements();
+
+        if (injectedReqs == StageSHAVEsRequirements::NeedMax) {
+            IE_ASSERT(injectedStage->numSHAVEs() == env.resources.numSHAVEs);
+        } else if (injectedReqs == StageSHAVEsRequirements::CanBeLimited) {
+            IE_ASSERT(injectedStage->numSHAVEs() > 0);
+        } else if (injectedReqs == StageSHAVEsRequirements::TwoOrOne) {
+            IE_ASSERT(injectedStage->numSHAVEs() == 1 || stage->numSHAVEs() == 2);
+        } else if (injectedReqs == StageSHAVEsRequirements::OnlyOne) {
+            IE_ASSERT(injectedStage->numSHAVEs() == 1);
+        } else if (injectedReqs == StageSHAVEsRequirements::NotNeeded) {
+            IE_ASSERT(injectedStage->numSHAVEs() == 0);
+        }
+    }
+
+    //
+    // Stage specific checks
+    //
+
+    stage->finalCheck();
+}
+
+void PassImpl::run(const Model& model) {
+    const auto& env = CompileEnv::get();
+
+    // Everything verified by checkData()/checkStage() analyzes a single data object
+    // or a single stage without modifying the model, so the checks are spread over
+    // worker threads; the first failure is rethrown on the calling thread.
+    std::exception_ptr firstError;
+    std::mutex firstErrorMutex;
+
+    const auto recordError = [&firstError, &firstErrorMutex]() {
+        std::lock_guard<std::mutex> lock(firstErrorMutex);
+        if (firstError == nullptr) {
+            firstError = std::current_exception();
+        }
+    };
+
+    //
+    // Check Data requirements.
+    //
+
+    const auto datas = toVector(model->datas());
+
+    ie::parallel_for(datas.size(), [&](size_t dataInd) {
+        CompileEnv::ScopedThreadEnv envGuard(env);
+
+        try {
+            checkData(datas[dataInd]);
+        } catch (...) {
+            recordError();
+        }
+    });
+
+    if (firstError != nullptr) {
+        std::rethrow_exception(firstError);
+    }
+
+    //
+    // Check Stages execution order. This part walks the stage list with a running
+    // execution index and stays sequential.
     //
 
     StageMap<int> stageExecIndMap;
@@ -214,111 +356,26 @@ void PassImpl::run(const Model& model) {
         if (stage->category() != StageCategory::Special) {
             ++stageExecInd;
         }
+    }
 
-        //
-        // Check Data DimsOrder requirements
-        //
-
-        const auto& orderInfo = stage->propagateDataOrder();
-
-        for (const auto& inEdge : stage->inputEdges()) {
-            if (orderInfo.hasInput(inEdge)) {
-                auto requiredOrder = orderInfo.getInput(inEdge);
-                IE_ASSERT(inEdge->input()->desc().dimsOrder() == requiredOrder);
-            }
-        }
-        for (const auto& outEdge : stage->outputEdges()) {
-            if (orderInfo.hasOutput(outEdge)) {
-                auto requiredOrder = orderInfo.getOutput(outEdge);
-                IE_ASSERT(outEdge->output()->desc().dimsOrder() == requiredOrder);
-            }
-        }
-
-        //
-        // Check Data Strides requirements
-        //
-
-        const auto& stridesInfo = stage->getDataStridesRequirements();
-
-        for (const auto& inEdge : stage->inputEdges()) {
-            if (stridesInfo.hasInput(inEdge)) {
-                auto requiredStrides = stridesInfo.getInput(inEdge);
-                IE_ASSERT(inEdge->input()->checkStrides(requiredStrides));
-            }
-        }
-        for (const auto& outEdge : stage->outputEdges()) {
-            if (stridesInfo.hasOutput(outEdge)) {
-                auto requiredStrides = stridesInfo.getOutput(outEdge);
-                IE_ASSERT(outEdge->output()->checkStrides(requiredStrides));
-            }
-        }
-
-        //
-        // Check Data Batch support
-        //
-
-        const auto& batchInfo = stage->getBatchSupportInfo();
-
-        for (const auto& inEdge : stage->inputEdges()) {
-            if (batchInfo.hasInput(inEdge)) {
-                auto requiredBatch = batchInfo.getInput(inEdge);
-
-                if (requiredBatch == BatchSupport::Split) {
-                    IE_ASSERT(inEdge->input()->desc().dim(Dim::N, 1) == 1);
-                }
-            }
-        }
-        for (const auto& outEdge : stage->outputEdges()) {
-            if (batchInfo.hasOutput(outEdge)) {
-                auto requiredBatch = batchInfo.getOutput(outEdge);
-
-                if (requiredBatch == BatchSupport::Split) {
-                    IE_ASSERT(outEdge->output()->desc().dim(Dim::N, 1) == 1);
-                }
-            }
-        }
+    //
+    // Check Stages requirements.
+    //
 
-        //
-        // Check SHAVEs requirements
-        //
+    const auto stages = toVector(model->getStages());
 
-        auto stageSHAVEsRequirements = stage->getSHAVEsRequirements();
-
-        if (stageSHAVEsRequirements == StageSHAVEsRequirements::NeedMax) {
-            IE_ASSERT(stage->numSHAVEs() == env.resources.numSHAVEs);
-        } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::CanBeLimited) {
-            IE_ASSERT(stage->numSHAVEs() > 0);
-        } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::TwoOrOne) {
-            IE_ASSERT(stage->numSHAVEs() == 1 || stage->numSHAVEs() == 2);
-        } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::OnlyOne) {
-            IE_ASSERT(stage->numSHAVEs() == 1);
-        } else if (stageSHAVEsRequirements == StageSHAVEsRequirements::NotNeeded) {
-            IE_ASSERT(stage->numSHAVEs() == 0);
-        }
+    ie::parallel_for(stages.size(), [&](size_t stageInd) {
+        CompileEnv::ScopedThreadEnv envGuard(env);
 
-        if (const auto injectedStage = stage->injectedStage()) {
-            IE_ASSERT(injectedStage->numSHAVEs() == stage->numSHAVEs());
-
-            auto injectedReqs = injectedStage->getSHAVEsRequirements();
-
-            if (injectedReqs == StageSHAVEsRequirements::NeedMax) {
-                IE_ASSERT(injectedStage->numSHAVEs() == env.resources.numSHAVEs);
-            } else if (injectedReqs == StageSHAVEsRequirements::CanBeLimited) {
-                IE_ASSERT(injectedStage->numSHAVEs() > 0);
-            } else if (injectedReqs == StageSHAVEsRequirements::TwoOrOne) {
-                IE_ASSERT(injectedStage->numSHAVEs() == 1 || stage->numSHAVEs() == 2);
-            } else if (injectedReqs == StageSHAVEsRequirements::OnlyOne) {
-                IE_ASSERT(injectedStage->numSHAVEs() == 1);
-            } else if (injectedReqs == StageSHAVEsRequirements::NotNeeded) {
-                IE_ASSERT(injectedStage->numSHAVEs() == 0);
-            }
+        try {
+            checkStage(stages[stageInd], env);
+        } catch (...) {
+            recordError();
         }
+    });
 
-        //
-        // Stage specific checks
-        //
-
-        stage->finalCheck();
+    if (firstError != nullptr) {
+        std::rethrow_exception(firstError);
     }
 }
 
@@ -37,6 +37,7 @@ IE_SUPPRESS_DEPRECATED_START
         VPU_MYRIAD_CONFIG_KEY(PROTOCOL),
         VPU_MYRIAD_CONFIG_KEY(WATCHDOG),
         VPU_MYRIAD_CONFIG_KEY(THROUGHPUT_STREAMS),
+        VPU_MYRIAD_CONFIG_KEY(TUNE_REQUEST_DEPTH),
         VPU_MYRIAD_CONFIG_KEY(POWER_MANAGEMENT),
 
         VPU_CONFIG_KEY(FORCE_RESET),
@@ -110,6 +111,7 @@ IE_SUPPRESS_DEPRECATED_END
     setOption(_pluginLogFilePath, config, VPU_MYRIAD_CONFIG_KEY(PLUGIN_LOG_FILE_PATH));
     setOption(_deviceName, config, CONFIG_KEY(DEVICE_ID));
     setOption(_forceReset, switches, config, VPU_MYRIAD_CONFIG_KEY(FORCE_RESET));
+    setOption(_tuneRequestDepth, switches, config, VPU_MYRIAD_CONFIG_KEY(TUNE_REQUEST_DEPTH));
     setOption(_platform, platforms, config, VPU_MYRIAD_CONFIG_KEY(PLATFORM));
     setOption(_protocol, protocols, config, VPU_MYRIAD_CONFIG_KEY(PROTOCOL));
     setOption(_watchdogInterval, watchdogIntervals, config, VPU_MYRIAD_CONFIG_KEY(WATCHDOG));
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <utility>
 
 #include <ie_metric_helpers.hpp>
@@ -93,6 +94,14 @@ ExecutableNetwork::ExecutableNetwork(
         idStream << networkName << "_TaskExecutorGetResult" << i;
         _taskExecutorGetResultIds.emplace(idStream.str());
     }
+
+    if (_config.tuneRequestDepth()) {
+        InputsDataMap networkInputs;
+        OutputsDataMap networkOutputs;
+        network.getInputsInfo(networkInputs);
+        network.getOutputsInfo(networkOutputs);
+        tuneOptimalRequestDepth(networkInputs, networkOutputs);
+    }
 }
 
 void ExecutableNetwork::Import(std::istream& strm,
@@ -141,6 +150,10 @@ void ExecutableNetwork::Import(std::istream& strm,
         idStream << networkName << "_TaskExecutorGetResult" << i;
         _taskExecutorGetResultIds.emplace(idStream.str());
     }
+
+    if (_config.tuneRequestDepth()) {
+        tuneOptimalRequestDepth(_networkInputs, _networkOutputs);
+    }
 }
 
 ExecutableNetwork::ExecutableNetwork(std::istream& strm,
@@ -163,6 +176,65 @@ ExecutableNetwork::ExecutableNetwork(
     Import(blobFile, devicePool, config);
 }
 
+void ExecutableNetwork::tuneOptimalRequestDepth(const InputsDataMap& networkInputs,
+                                                const OutputsDataMap& networkOutputs) {
+    VPU_PROFILE(tuneOptimalRequestDepth);
+
+    // the device-side FIFO bounds the useful in-flight depth; mirrors the
+    // fifo_elements calculation in MyriadExecutor::allocateGraph()
+    const auto maxDepth = static_cast<unsigned int>(
+        (_device->_platform == NC_MYRIAD_2 && _actualNumExecutors == 1) ? 4 : 2 * _actualNumExecutors);
+    if (maxDepth <= 1) {
+        return;
+    }
+
+    try {
+        // the input FIFO keeps its own copy of every queued inference, so a single
+        // request is enough to model an arbitrary number of requests in flight
+        auto request = std::make_shared<MyriadInferRequest>(_graphDesc, networkInputs, networkOutputs,
+                                                            _inputInfo, _outputInfo,
+                                                            _graphMetaData.stagesMeta, _config, _log,
+                                                            _executor);
+
+        const size_t measuredIterations = 8;
+        double bestThroughput = 0.0;
+
+        for (unsigned int depth = 1; depth <= maxDepth; depth++) {
+            for (unsigned int i = 0; i < depth; i++) {
+                request->InferAsync();
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < measuredIterations; i++) {
+                request->GetResult();
+                request->InferAsync();
+            }
+            const auto stop = std::chrono::steady_clock::now();
+
+            for (unsigned int i = 0; i < depth; i++) {
+                request->GetResult();
+            }
+
+            const auto seconds = std::chrono::duration<double>(stop - start).count();
+            const auto throughput = measuredIterations / seconds;
+
+            // a deeper pipeline has to buy its extra latency and memory with a
+            // measurable gain, otherwise the smaller depth is kept
+            if (throughput > bestThroughput * 1.02) {
+                bestThroughput = throughput;
+                _optimalNumRequests = depth;
+            }
+
+            _log->info("Request depth %u: %f infers/s", depth, throughput);
+        }
+
+        _log->info("Locked in-flight request depth: %u", _optimalNumRequests);
+    } catch (const std::exception& error) {
+        _log->warning("Request depth tuning failed: %s", error.what());
+        _optimalNumRequests = 0;
+    }
+}
+
 void ExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (name == METRIC_KEY(NETWORK_NAME)) {
         result = IE_SET_METRIC(NETWORK_NAME, _graphDesc._name);
@@ -171,7 +243,10 @@ void ExecutableNetwork::GetMetric(const std::string &name, Parameter &result, Re
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, std::vector<std::string>());
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors));
+        const auto optimalNum = _optimalNumRequests != 0
+            ? _optimalNumRequests
+            : static_cast<unsigned int>(2u * _actualNumExecutors);
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, optimalNum);
     } else if (name == METRIC_KEY(DEVICE_THERMAL)) {
         result = IE_SET_METRIC(DEVICE_THERMAL, _executor->GetThermal(_device));
     } else {
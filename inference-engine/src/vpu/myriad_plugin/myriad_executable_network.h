@@ -121,6 +121,7 @@ private:
     GraphMetaInfo _graphMetaData;
     MyriadConfig _config;
     int _actualNumExecutors = 0;
+    unsigned int _optimalNumRequests = 0;
     std::vector<std::string> _supportedMetrics;
 
     DataInfo _inputInfo;
@@ -133,6 +134,9 @@ private:
         std::vector<DevicePtr> &devicePool,
         const MyriadConfig& config);
 
+    void tuneOptimalRequestDepth(const InferenceEngine::InputsDataMap& networkInputs,
+                                 const InferenceEngine::OutputsDataMap& networkOutputs);
+
     InferenceEngine::ITaskExecutor::Ptr getNextTaskExecutor() {
         std::string id = _taskExecutorGetResultIds.front();
 
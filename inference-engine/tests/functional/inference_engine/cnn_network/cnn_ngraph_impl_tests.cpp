@@ -272,6 +272,45 @@ TEST(CNNNGraphImplTests, TestAddOutputFromConvertedNetwork) {
     ASSERT_TRUE(outputs.find(testLayerName) != outputs.end());
 }
 
+TEST(CNNNGraphImplTests, TestPruneOutputs) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        ngraph::PartialShape shape({1, 3, 22, 22});
+        ngraph::element::Type type(ngraph::element::Type_t::f32);
+        auto param = std::make_shared<ngraph::op::Parameter>(type, shape);
+        auto relu = std::make_shared<ngraph::op::Relu>(param);
+        relu->set_friendly_name("relu");
+        auto branch1 = std::make_shared<ngraph::op::Relu>(relu);
+        branch1->set_friendly_name("branch1");
+        auto branch2 = std::make_shared<ngraph::op::Relu>(relu);
+        branch2->set_friendly_name("branch2");
+        auto result1 = std::make_shared<ngraph::op::Result>(branch1);
+        auto result2 = std::make_shared<ngraph::op::Result>(branch2);
+
+        ngraph = std::make_shared<ngraph::Function>(ngraph::ResultVector{result1, result2},
+                                                    ngraph::ParameterVector{param});
+    }
+
+    InferenceEngine::details::CNNNetworkNGraphImpl cnnNet(ngraph);
+    ASSERT_EQ(6, cnnNet.layerCount());
+
+    ResponseDesc resp;
+    ASSERT_EQ(OK, cnnNet.pruneOutputs({"branch1"}, &resp));
+    ASSERT_EQ(4, cnnNet.layerCount());
+
+    OutputsDataMap outputs;
+    cnnNet.getOutputsInfo(outputs);
+    ASSERT_EQ(1, outputs.size());
+    ASSERT_TRUE(outputs.find("branch1") != outputs.end());
+
+    InputsDataMap inputs;
+    cnnNet.getInputsInfo(inputs);
+    ASSERT_EQ(1, inputs.size());
+
+    // the pruned head is gone and cannot be requested any more
+    ASSERT_EQ(NOT_FOUND, cnnNet.pruneOutputs({"branch2"}, &resp));
+}
+
 TEST(CNNNGraphImplTests, ConstantAsInternalAndExternalLayer) {
     std::shared_ptr<ngraph::Function> ngraph;
     {
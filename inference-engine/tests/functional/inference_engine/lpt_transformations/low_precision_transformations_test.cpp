@@ -33,11 +33,11 @@ TEST_F(LowPrecisionTransformationsTests, removeBranchSpecificTransformations) {
 
 TEST_F(LowPrecisionTransformationsTests, removeTransformations) {
     LowPrecisionTransformations transformations = LowPrecisionTransformer::getAllTransformations(LayerTransformation::Params());
-    LayerTransformationPtr transformation = transformations.find("FullyConnected");
+    LayerTransformationPtr transformation = transformations.find("Permute");
     ASSERT_NE(nullptr, transformation);
 
-    transformations.removeTransformations("FullyConnected");
-    transformation = transformations.find("FullyConnected");
+    transformations.removeTransformations("Permute");
+    transformation = transformations.find("Permute");
     ASSERT_EQ(nullptr, transformation);
 }
 
@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+#include <transformations/fold_shape_of_subgraphs.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, FoldShapeOfSubgraphsStatic) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        auto shape_of = std::make_shared<ngraph::opset3::ShapeOf>(data);
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(data, shape_of, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{reshape}, ngraph::ParameterVector{data});
+
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+        ngraph::pass::FoldShapeOfSubgraphs().run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 22, 22});
+        auto shape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {1, 3, 22, 22});
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(data, shape_const, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{reshape}, ngraph::ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FoldShapeOfSubgraphsDynamicNegative) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32,
+                ngraph::PartialShape{1, ngraph::Dimension::dynamic(), 22, 22});
+        auto shape_of = std::make_shared<ngraph::opset3::ShapeOf>(data);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{shape_of}, ngraph::ParameterVector{data});
+
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+        ngraph::pass::FoldShapeOfSubgraphs().run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32,
+                ngraph::PartialShape{1, ngraph::Dimension::dynamic(), 22, 22});
+        auto shape_of = std::make_shared<ngraph::opset3::ShapeOf>(data);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{shape_of}, ngraph::ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
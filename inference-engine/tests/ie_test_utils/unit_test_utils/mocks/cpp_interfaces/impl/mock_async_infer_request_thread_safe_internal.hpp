@@ -57,8 +57,12 @@ public:
             const Blob::Ptr&,
             const PreProcessInfo&));
 
+    MOCK_METHOD1(SetBlobs_ThreadUnsafe, void(const BlobMap&));
+
     MOCK_METHOD1(SetCompletionCallback_ThreadUnsafe, void(IInferRequest::CompletionCallback));
 
     MOCK_METHOD1(SetBatch, void(int));
     MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+    MOCK_METHOD1(SetPriority, void(InferenceEngine::IInferRequest::Priority));
+    MOCK_METHOD1(SetPriority_ThreadUnsafe, void(InferenceEngine::IInferRequest::Priority));
 };
@@ -23,7 +23,9 @@ public:
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
     MOCK_METHOD3(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &, const InferenceEngine::PreProcessInfo&));
+    MOCK_METHOD1(SetBlobs, void(const InferenceEngine::BlobMap&));
     MOCK_CONST_METHOD2(GetPreProcess, void(const char* name, const InferenceEngine::PreProcessInfo**));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
     MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD1(SetPriority, void(InferenceEngine::IInferRequest::Priority));
 };
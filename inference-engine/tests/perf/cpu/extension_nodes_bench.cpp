@@ -0,0 +1,400 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Standalone microbenchmark for the CPU extension nodes (mkldnn_plugin/nodes).
+//
+// Every covered node type is timed over a canonical shape matrix (a small and a
+// large case) and over every configuration the implementation reports, which
+// enumerates the planar/blocked layouts and the precisions the node supports.
+// Results are written as line-oriented JSON so two runs can be diffed, and a
+// previous run can be passed back as a baseline to fail the process on
+// regressions:
+//
+//   cpuPerfTests --output baseline.json
+//   cpuPerfTests --baseline baseline.json --tolerance 1.15
+//
+// Registered types without an entry in the case table are listed in the
+// "uncovered" section of the report; extending coverage is a matter of adding
+// a table entry with the parameters and shapes the node expects.
+
+#include <ie_iextension.h>
+#include <ie_layers.h>
+#include <ie_blob.h>
+#include <blob_factory.hpp>
+#include <nodes/list.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
+
+namespace {
+
+struct ShapeSet {
+    const char* label;
+    std::vector<SizeVector> inDims;
+    std::vector<SizeVector> outDims;
+};
+
+struct BenchCase {
+    std::string type;
+    std::map<std::string, std::string> params;
+    std::vector<ShapeSet> shapes;
+    // per-port precisions of the layer data; missing entries default to FP32
+    std::vector<Precision> inPrecisions;
+    std::vector<Precision> outPrecisions;
+};
+
+struct Result {
+    std::string key;        // node|case|impl|config|layout|precision
+    std::string node;
+    std::string shapeLabel;
+    size_t impl = 0;
+    size_t config = 0;
+    std::string layout;
+    std::string precision;
+    double usPerIter = 0.0;
+    std::string error;
+};
+
+std::string layoutName(const TensorDesc& desc) {
+    switch (desc.getLayout()) {
+        case Layout::C:       return "C";
+        case Layout::NC:      return "NC";
+        case Layout::CHW:     return "CHW";
+        case Layout::NCHW:    return "NCHW";
+        case Layout::NHWC:    return "NHWC";
+        case Layout::NCDHW:   return "NCDHW";
+        case Layout::NDHWC:   return "NDHWC";
+        case Layout::BLOCKED: return "BLOCKED" + std::to_string(desc.getBlockingDesc().getBlockDims().back());
+        default:              return "L" + std::to_string(desc.getLayout());
+    }
+}
+
+Blob::Ptr makeBlob(const TensorDesc& desc) {
+    auto blob = make_blob_with_precision(desc);
+    blob->allocate();
+    // a safe positive fill: keeps transcendental nodes away from NaN/denormal
+    // slow paths while staying a valid zero index/condition for integer inputs
+    if (desc.getPrecision() == Precision::FP32) {
+        auto* data = blob->buffer().as<float*>();
+        std::fill(data, data + blob->size(), 0.5f);
+    } else {
+        std::memset(blob->buffer(), 0, blob->byteSize());
+    }
+    return blob;
+}
+
+std::vector<BenchCase> buildCaseTable() {
+    std::vector<BenchCase> cases;
+
+    // elementwise math family: all types share MathImpl, benchmark a spread of
+    // cheap and transcendental ones
+    for (auto type : {"Abs", "Erf", "Sin", "Tan", "Softplus", "Softsign"}) {
+        cases.push_back({type, {}, {
+            {"small", {{1, 32, 56, 56}},    {{1, 32, 56, 56}}},
+            {"large", {{1, 128, 224, 224}}, {{1, 128, 224, 224}}},
+        }});
+    }
+
+    cases.push_back({"DepthToSpace", {{"block_size", "2"}}, {
+        {"small", {{1, 64, 28, 28}},  {{1, 16, 56, 56}}},
+        {"large", {{1, 256, 56, 56}}, {{1, 64, 112, 112}}},
+    }});
+    cases.push_back({"SpaceToDepth", {{"block_size", "2"}}, {
+        {"small", {{1, 16, 56, 56}},   {{1, 64, 28, 28}}},
+        {"large", {{1, 64, 112, 112}}, {{1, 256, 56, 56}}},
+    }});
+    cases.push_back({"LogSoftmax", {{"axis", "1"}}, {
+        {"small", {{1, 1000}},  {{1, 1000}}},
+        {"large", {{32, 4096}}, {{32, 4096}}},
+    }});
+    cases.push_back({"GRN", {{"bias", "1.0"}}, {
+        {"small", {{1, 32, 56, 56}},    {{1, 32, 56, 56}}},
+        {"large", {{1, 128, 224, 224}}, {{1, 128, 224, 224}}},
+    }});
+    cases.push_back({"Convert", {{"precision", "I32"}}, {
+        {"small", {{1, 32, 56, 56}},    {{1, 32, 56, 56}}},
+        {"large", {{1, 128, 224, 224}}, {{1, 128, 224, 224}}},
+    }, {}, {Precision::I32}});
+    cases.push_back({"Gather", {{"axis", "0"}}, {
+        {"small", {{512, 256}, {64}},    {{64, 256}}},
+        {"large", {{4096, 1024}, {512}}, {{512, 1024}}},
+    }, {Precision::FP32, Precision::I32}});
+    cases.push_back({"ShuffleChannels", {{"axis", "1"}, {"group", "4"}}, {
+        {"small", {{1, 64, 28, 28}},  {{1, 64, 28, 28}}},
+        {"large", {{1, 256, 56, 56}}, {{1, 256, 56, 56}}},
+    }});
+    cases.push_back({"Select", {{"auto_broadcast", "none"}}, {
+        {"small", {{1, 32, 56, 56}, {1, 32, 56, 56}, {1, 32, 56, 56}},
+                  {{1, 32, 56, 56}}},
+        {"large", {{1, 64, 224, 224}, {1, 64, 224, 224}, {1, 64, 224, 224}},
+                  {{1, 64, 224, 224}}},
+    }, {Precision::U8, Precision::FP32, Precision::FP32}});
+
+    return cases;
+}
+
+double timeExecute(ILayerExecImpl& impl, std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                   double minTimeMs, std::string& error) {
+    ResponseDesc resp;
+    for (int i = 0; i < 3; i++) {
+        if (OK != impl.execute(inputs, outputs, &resp)) {
+            error = resp.msg;
+            return 0.0;
+        }
+    }
+    size_t iters = 0;
+    const auto start = std::chrono::steady_clock::now();
+    double elapsedUs = 0.0;
+    do {
+        if (OK != impl.execute(inputs, outputs, &resp)) {
+            error = resp.msg;
+            return 0.0;
+        }
+        iters++;
+        elapsedUs = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+            std::chrono::steady_clock::now() - start).count();
+    } while (elapsedUs < minTimeMs * 1000.0);
+    return elapsedUs / iters;
+}
+
+void runCase(MKLDNNExtensions& extensions, const BenchCase& benchCase, double minTimeMs,
+             std::vector<Result>& results) {
+    for (const auto& shapes : benchCase.shapes) {
+        Result base;
+        base.node = benchCase.type;
+        base.shapeLabel = shapes.label;
+
+        LayerParams layerParams{benchCase.type + "_bench", benchCase.type, Precision::FP32};
+        CNNLayer layer(layerParams);
+        layer.params = benchCase.params;
+        std::vector<DataPtr> inData;  // keeps the weak insData pointers alive
+        for (size_t i = 0; i < shapes.inDims.size(); i++) {
+            const auto prc = i < benchCase.inPrecisions.size() ? benchCase.inPrecisions[i] : Precision(Precision::FP32);
+            const auto& dims = shapes.inDims[i];
+            inData.push_back(std::make_shared<Data>(
+                "in" + std::to_string(i), TensorDesc(prc, dims, TensorDesc::getLayoutByDims(dims))));
+            layer.insData.push_back(inData.back());
+        }
+        for (size_t i = 0; i < shapes.outDims.size(); i++) {
+            const auto prc = i < benchCase.outPrecisions.size() ? benchCase.outPrecisions[i]
+                                                                : Precision(Precision::FP32);
+            const auto& dims = shapes.outDims[i];
+            layer.outData.push_back(std::make_shared<Data>(
+                "out" + std::to_string(i), TensorDesc(prc, dims, TensorDesc::getLayoutByDims(dims))));
+        }
+
+        ResponseDesc resp;
+        ILayerImplFactory* factoryPtr = nullptr;
+        if (OK != extensions.getFactoryFor(factoryPtr, &layer, &resp)) {
+            base.error = resp.msg;
+            results.push_back(base);
+            continue;
+        }
+        std::unique_ptr<ILayerImplFactory> factory(factoryPtr);
+        std::vector<ILayerImpl::Ptr> impls;
+        if (OK != factory->getImplementations(impls, &resp)) {
+            base.error = resp.msg;
+            results.push_back(base);
+            continue;
+        }
+
+        for (size_t implIdx = 0; implIdx < impls.size(); implIdx++) {
+            auto execImpl = std::dynamic_pointer_cast<ILayerExecImpl>(impls[implIdx]);
+            if (!execImpl)
+                continue;
+            std::vector<LayerConfig> configs;
+            if (OK != execImpl->getSupportedConfigurations(configs, &resp)) {
+                Result result = base;
+                result.impl = implIdx;
+                result.error = resp.msg;
+                results.push_back(result);
+                continue;
+            }
+            for (size_t cfgIdx = 0; cfgIdx < configs.size(); cfgIdx++) {
+                Result result = base;
+                result.impl = implIdx;
+                result.config = cfgIdx;
+                auto config = configs[cfgIdx];
+                result.layout = layoutName(config.inConfs[0].desc);
+                result.precision = config.inConfs[0].desc.getPrecision().name();
+                result.key = result.node + "|" + result.shapeLabel + "|" + std::to_string(implIdx) + "|" +
+                             std::to_string(cfgIdx) + "|" + result.layout + "|" + result.precision;
+                if (OK != execImpl->init(config, &resp)) {
+                    result.error = resp.msg;
+                    results.push_back(result);
+                    continue;
+                }
+                std::vector<Blob::Ptr> inputs, outputs;
+                for (const auto& conf : config.inConfs)
+                    inputs.push_back(makeBlob(conf.desc));
+                for (const auto& conf : config.outConfs)
+                    outputs.push_back(makeBlob(conf.desc));
+                result.usPerIter = timeExecute(*execImpl, inputs, outputs, minTimeMs, result.error);
+                results.push_back(result);
+            }
+        }
+    }
+}
+
+void writeReport(std::ostream& stream, const std::vector<Result>& results,
+                 const std::vector<std::string>& uncovered) {
+    stream << "{\n  \"schema\": \"cpu_extension_nodes_bench/1\",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        stream << "    {\"node\": \"" << r.node << "\", \"case\": \"" << r.shapeLabel
+               << "\", \"impl\": " << r.impl << ", \"config\": " << r.config
+               << ", \"layout\": \"" << r.layout << "\", \"precision\": \"" << r.precision << "\", ";
+        if (r.error.empty())
+            stream << "\"us_per_iter\": " << r.usPerIter;
+        else
+            stream << "\"error\": \"" << r.error << "\"";
+        stream << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    stream << "  ],\n  \"uncovered\": [\n";
+    for (size_t i = 0; i < uncovered.size(); i++)
+        stream << "    \"" << uncovered[i] << "\"" << (i + 1 < uncovered.size() ? "," : "") << "\n";
+    stream << "  ]\n}\n";
+}
+
+// minimal field extraction from the line-oriented report written above; enough
+// to read our own output back as a baseline without a JSON dependency
+bool extractString(const std::string& line, const std::string& key, std::string& value) {
+    const auto pattern = "\"" + key + "\": \"";
+    auto pos = line.find(pattern);
+    if (pos == std::string::npos)
+        return false;
+    pos += pattern.size();
+    const auto end = line.find('"', pos);
+    value = line.substr(pos, end - pos);
+    return true;
+}
+
+bool extractNumber(const std::string& line, const std::string& key, double& value) {
+    const auto pattern = "\"" + key + "\": ";
+    const auto pos = line.find(pattern);
+    if (pos == std::string::npos)
+        return false;
+    value = std::stod(line.substr(pos + pattern.size()));
+    return true;
+}
+
+std::map<std::string, double> readBaseline(const std::string& path) {
+    std::map<std::string, double> baseline;
+    std::ifstream file(path);
+    if (!file)
+        throw std::runtime_error("cannot open baseline file: " + path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::string node, shapeLabel, layout, precision;
+        double impl = 0, config = 0, us = 0;
+        if (!extractString(line, "node", node) || !extractNumber(line, "us_per_iter", us))
+            continue;
+        extractString(line, "case", shapeLabel);
+        extractString(line, "layout", layout);
+        extractString(line, "precision", precision);
+        extractNumber(line, "impl", impl);
+        extractNumber(line, "config", config);
+        baseline[node + "|" + shapeLabel + "|" + std::to_string(static_cast<size_t>(impl)) + "|" +
+                 std::to_string(static_cast<size_t>(config)) + "|" + layout + "|" + precision] = us;
+    }
+    return baseline;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string outputPath = "cpu_extension_nodes_bench.json";
+    std::string baselinePath;
+    std::string filter;
+    double tolerance = 1.15;
+    double minTimeMs = 200.0;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (arg == "--baseline" && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--tolerance" && i + 1 < argc) {
+            tolerance = std::stod(argv[++i]);
+        } else if (arg == "--min-time-ms" && i + 1 < argc) {
+            minTimeMs = std::stod(argv[++i]);
+        } else {
+            std::cout << "Usage: " << argv[0] << " [--output report.json] [--baseline report.json]"
+                      << " [--tolerance 1.15] [--min-time-ms 200] [--filter substring]" << std::endl;
+            return arg == "-h" || arg == "--help" ? 0 : 1;
+        }
+    }
+
+    MKLDNNExtensions extensions;
+    const auto cases = buildCaseTable();
+
+    std::set<std::string> covered;
+    for (const auto& benchCase : cases)
+        covered.insert(benchCase.type);
+    std::vector<std::string> uncovered;
+    char** types = nullptr;
+    unsigned int typesCount = 0;
+    ResponseDesc resp;
+    if (OK == extensions.getPrimitiveTypes(types, typesCount, &resp)) {
+        for (unsigned int i = 0; i < typesCount; i++) {
+            if (!covered.count(types[i]))
+                uncovered.push_back(types[i]);
+            delete[] types[i];
+        }
+        delete[] types;
+        std::sort(uncovered.begin(), uncovered.end());
+    }
+
+    std::vector<Result> results;
+    for (const auto& benchCase : cases) {
+        if (!filter.empty() && benchCase.type.find(filter) == std::string::npos)
+            continue;
+        runCase(extensions, benchCase, minTimeMs, results);
+    }
+
+    std::ofstream output(outputPath);
+    writeReport(output, results, uncovered);
+    std::cout << "wrote " << results.size() << " results to " << outputPath
+              << " (" << uncovered.size() << " node types uncovered)" << std::endl;
+
+    int failures = 0;
+    for (const auto& result : results) {
+        if (!result.error.empty()) {
+            std::cerr << "ERROR " << (result.key.empty() ? result.node : result.key)
+                      << ": " << result.error << std::endl;
+            failures++;
+        }
+    }
+    if (!baselinePath.empty()) {
+        const auto baseline = readBaseline(baselinePath);
+        for (const auto& result : results) {
+            if (!result.error.empty())
+                continue;
+            const auto it = baseline.find(result.key);
+            if (it == baseline.end())
+                continue;
+            if (result.usPerIter > it->second * tolerance) {
+                std::cerr << "REGRESSION " << result.key << ": " << result.usPerIter
+                          << " us vs baseline " << it->second << " us" << std::endl;
+                failures++;
+            }
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
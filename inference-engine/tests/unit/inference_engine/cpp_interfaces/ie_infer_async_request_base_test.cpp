@@ -190,6 +190,20 @@ TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetBlob) {
     ASSERT_EQ(UNEXPECTED, request->SetBlob(nullptr, data, nullptr));
 }
 
+// SetBlobs
+TEST_F(InferRequestBaseTests, canForwardSetBlobs) {
+    BlobMap blobs;
+    EXPECT_CALL(*mock_impl.get(), SetBlobs(Ref(blobs))).Times(1);
+    ASSERT_EQ(OK, request->SetBlobs(blobs, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canReportErrorInSetBlobs) {
+    EXPECT_CALL(*mock_impl.get(), SetBlobs(_)).WillOnce(Throw(std::runtime_error("compare")));
+    BlobMap blobs;
+    ASSERT_NE(request->SetBlobs(blobs, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
 // SetCompletionCallback
 TEST_F(InferRequestBaseTests, canForwardSetCompletionCallback) {
     InferenceEngine::IInferRequest::CompletionCallback callback = nullptr;
@@ -247,6 +247,48 @@ TEST_F(InferRequestThreadSafeDefaultTests, callbackIsCalledIfAsyncRequestFailed)
     ASSERT_TRUE(wasCalled);
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, completionTokenDispatchedWithoutBlockingAThread) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+
+    bool tokenCalled = false;
+    testRequest->StartAsync();
+    testRequest->Await([&](StatusCode status, std::exception_ptr exception) {
+        tokenCalled = true;
+        ASSERT_EQ(StatusCode::OK, status);
+        ASSERT_EQ(nullptr, exception);
+    });
+    // the pipeline has not run yet, so the token must not have fired
+    ASSERT_FALSE(tokenCalled);
+    taskExecutor->executeAll();
+    ASSERT_TRUE(tokenCalled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, completionTokenDispatchedImmediatelyIfNotStarted) {
+    bool tokenCalled = false;
+    testRequest->Await([&](StatusCode status, std::exception_ptr exception) {
+        tokenCalled = true;
+        ASSERT_EQ(StatusCode::INFER_NOT_STARTED, status);
+    });
+    ASSERT_TRUE(tokenCalled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, completionTokenTakesExceptionIfAsyncRequestFailed) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::exception()));
+
+    std::promise<StatusCode> tokenStatus;
+    testRequest->StartAsync();
+    testRequest->Await([&](StatusCode status, std::exception_ptr exception) {
+        ASSERT_NE(nullptr, exception);
+        tokenStatus.set_value(status);
+    });
+    ASSERT_EQ(StatusCode::GENERAL_ERROR, tokenStatus.get_future().get());
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+}
+
 TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailedAndNoCallback) {
     auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
     testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
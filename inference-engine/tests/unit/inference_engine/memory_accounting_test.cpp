@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "system_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MemoryAccountingTests : public CommonTestUtils::TestsCommon {
+protected:
+    uint64_t counter(const std::string& name) {
+        const auto report = MemoryAccounting::get().report();
+        const auto it = report.find(name);
+        return it != report.end() ? it->second : 0;
+    }
+};
+
+TEST_F(MemoryAccountingTests, trackAllocationsOfCurrentPhase) {
+    SystemMemoryAllocator allocator;
+
+    const uint64_t readCurrentBefore = counter("READ_CURRENT");
+    {
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Read);
+        void* handle = allocator.alloc(1024);
+        ASSERT_NE(handle, nullptr);
+        EXPECT_EQ(counter("READ_CURRENT"), readCurrentBefore + 1024);
+        EXPECT_GE(counter("READ_PEAK"), readCurrentBefore + 1024);
+        allocator.free(handle);
+    }
+    EXPECT_EQ(counter("READ_CURRENT"), readCurrentBefore);
+}
+
+TEST_F(MemoryAccountingTests, freeIsAttributedToAllocationPhase) {
+    SystemMemoryAllocator allocator;
+
+    const uint64_t compileCurrentBefore = counter("COMPILE_CURRENT");
+    void* handle = nullptr;
+    {
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Compile);
+        handle = allocator.alloc(512);
+        ASSERT_NE(handle, nullptr);
+    }
+    {
+        MemoryAccounting::ScopedPhase phase(MemoryAccounting::Phase::Infer);
+        allocator.free(handle);
+    }
+    EXPECT_EQ(counter("COMPILE_CURRENT"), compileCurrentBefore);
+}
+
+TEST_F(MemoryAccountingTests, ignoresUnknownHandle) {
+    SystemMemoryAllocator allocator;
+
+    const uint64_t totalCurrentBefore = counter("TOTAL_CURRENT");
+    std::unique_ptr<char[]> foreign(new char[128]);
+    MemoryAccounting::get().freed(foreign.get());
+    EXPECT_EQ(counter("TOTAL_CURRENT"), totalCurrentBefore);
+}
+
+TEST_F(MemoryAccountingTests, scopedPhaseRestoresPreviousPhase) {
+    SystemMemoryAllocator allocator;
+
+    const uint64_t transformCurrentBefore = counter("TRANSFORM_CURRENT");
+    {
+        MemoryAccounting::ScopedPhase outer(MemoryAccounting::Phase::Transform);
+        {
+            MemoryAccounting::ScopedPhase inner(MemoryAccounting::Phase::Infer);
+        }
+        void* handle = allocator.alloc(256);
+        ASSERT_NE(handle, nullptr);
+        EXPECT_EQ(counter("TRANSFORM_CURRENT"), transformCurrentBefore + 256);
+        allocator.free(handle);
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include <ie_precision_conversions.hpp>
+#include <precision_utils.h>
+
+using namespace InferenceEngine;
+
+using PrecisionConversionsTests = CommonTestUtils::TestsCommon;
+
+TEST_F(PrecisionConversionsTests, convertArrayU8ToF32) {
+    std::vector<uint8_t> src(77);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<uint8_t>(i * 3);
+
+    std::vector<float> dst(src.size(), -1.0f);
+    PrecisionConversions::convertArrayU8ToF32(src.data(), dst.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++)
+        EXPECT_EQ(dst[i], static_cast<float>(src[i]));
+}
+
+TEST_F(PrecisionConversionsTests, convertArrayF32ToU8Saturates) {
+    const std::vector<float> src = {-100.0f, -0.5f, 0.0f, 0.49f, 1.0f, 1.99f, 127.3f, 254.6f, 255.0f, 1000.0f,
+                                    42.0f, 17.5f, 200.2f, 3.0f, 99.9f, 255.4f, 256.0f, -1.0f, 128.0f, 0.1f};
+
+    std::vector<uint8_t> dst(src.size(), 7);
+    PrecisionConversions::convertArrayF32ToU8(src.data(), dst.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        float clamped = (std::min)((std::max)(src[i], 0.0f), 255.0f);
+        EXPECT_EQ(dst[i], static_cast<uint8_t>(clamped)) << "at index " << i;
+    }
+}
+
+TEST_F(PrecisionConversionsTests, convertArrayBF16RoundTrip) {
+    std::vector<float> src(41);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = 0.125f * static_cast<float>(i) - 2.0f;
+
+    std::vector<int16_t> bf16(src.size(), 0);
+    std::vector<float> restored(src.size(), 0.0f);
+    PrecisionConversions::convertArrayF32ToBF16(src.data(), bf16.data(), src.size());
+    PrecisionConversions::convertArrayBF16ToF32(bf16.data(), restored.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++)
+        EXPECT_NEAR(restored[i], src[i], std::abs(src[i]) / 128.0f + 1e-6f) << "at index " << i;
+}
+
+TEST_F(PrecisionConversionsTests, convertArrayF16MatchesElementwise) {
+    std::vector<float> src(53);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = 0.37f * static_cast<float>(i) - 9.5f;
+
+    std::vector<short> f16(src.size(), 0);
+    std::vector<float> restored(src.size(), 0.0f);
+    PrecisionConversions::convertArrayF32ToF16(src.data(), f16.data(), src.size());
+    PrecisionConversions::convertArrayF16ToF32(f16.data(), restored.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        EXPECT_EQ(f16[i], PrecisionUtils::f32tof16(src[i])) << "at index " << i;
+        EXPECT_EQ(restored[i], PrecisionUtils::f16tof32(PrecisionUtils::f32tof16(src[i]))) << "at index " << i;
+    }
+}
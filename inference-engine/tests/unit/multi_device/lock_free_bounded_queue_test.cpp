@@ -0,0 +1,106 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "multi_device.hpp"
+
+using MultiDevicePlugin::LockFreeBoundedQueue;
+
+TEST(LockFreeBoundedQueueTest, FifoSingleThread) {
+    LockFreeBoundedQueue<int> queue;
+    queue.init(8);
+
+    int value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+
+    for (int i = 0; i < 8; i++) {
+        queue.push(i);
+    }
+    for (int i = 0; i < 8; i++) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(LockFreeBoundedQueueTest, WrapsAroundCapacity) {
+    // capacity rounds up to a power of two; cycle well past it to cover the
+    // sequence-number wrap handling in every cell
+    LockFreeBoundedQueue<int> queue;
+    queue.init(5);
+
+    for (int round = 0; round < 1000; round++) {
+        for (int i = 0; i < 5; i++) {
+            queue.push(round * 5 + i);
+        }
+        for (int i = 0; i < 5; i++) {
+            int value = -1;
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(round * 5 + i, value);
+        }
+    }
+}
+
+TEST(LockFreeBoundedQueueTest, FourThreadStress) {
+    // 2 producers and 2 consumers moving 12.8M items: no item may be lost,
+    // duplicated, or observed out of its producer's order
+    constexpr std::size_t itemsPerProducer = 6400000;
+    constexpr int producers = 2;
+    constexpr int consumers = 2;
+
+    LockFreeBoundedQueue<std::int64_t> queue;
+    queue.init(1024);
+
+    std::atomic<std::size_t> popped{0};
+    std::vector<std::vector<std::int64_t>> consumed(consumers);
+    std::vector<std::thread> threads;
+
+    for (int c = 0; c < consumers; c++) {
+        consumed[c].reserve(itemsPerProducer);
+        threads.emplace_back([&, c] {
+            std::int64_t value = 0;
+            while (popped.load(std::memory_order_relaxed) < producers * itemsPerProducer) {
+                if (queue.try_pop(value)) {
+                    consumed[c].push_back(value);
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            for (std::size_t i = 0; i < itemsPerProducer; i++) {
+                queue.push((static_cast<std::int64_t>(p) << 32) | static_cast<std::int64_t>(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // every consumer pops in queue order, so the items of one producer must be
+    // increasing within each consumer's sequence
+    std::size_t total = 0;
+    std::vector<std::size_t> perProducerCounts(producers, 0);
+    for (int c = 0; c < consumers; c++) {
+        std::vector<std::int64_t> lastSeen(producers, -1);
+        for (std::int64_t value : consumed[c]) {
+            const int producer = static_cast<int>(value >> 32);
+            const std::int64_t sequence = value & 0xFFFFFFFF;
+            ASSERT_LT(lastSeen[producer], sequence);
+            lastSeen[producer] = sequence;
+            perProducerCounts[producer]++;
+        }
+        total += consumed[c].size();
+    }
+    ASSERT_EQ(producers * itemsPerProducer, total);
+    for (int p = 0; p < producers; p++) {
+        ASSERT_EQ(itemsPerProducer, perProducerCounts[p]);
+    }
+}
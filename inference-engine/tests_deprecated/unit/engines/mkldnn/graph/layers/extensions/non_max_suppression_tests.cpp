@@ -7,6 +7,7 @@
 #include "single_layer_common.hpp"
 #include "tests_common.hpp"
 #include <ie_core.hpp>
+#include <random>
 
 
 using namespace ::testing;
@@ -566,3 +567,56 @@ INSTANTIATE_TEST_CASE_P(
 
             nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} } /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
 ));
+
+//  Randomized cases: leave `ref` empty so the plugin output is compared against
+//  ref_nms above. Random scores make ties (which both sorts may break differently)
+//  practically impossible, so the comparison is exact.
+static std::vector<nmsTF_test_params> randomNMSParams() {
+    std::vector<nmsTF_test_params> params;
+    std::mt19937 gen(41);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+    for (int case_idx = 0; case_idx < 60; case_idx++) {
+        size_t num_batches = 1 + gen() % 3;
+        size_t num_classes = 1 + gen() % 4;
+        size_t num_boxes = 1 + gen() % 64;
+
+        nmsTF_test_params p;
+        p.center_point_box = static_cast<int>(gen() % 2);
+        p.sort_result_descending = static_cast<int>(gen() % 2);
+        p.scoresDim = { num_batches, num_classes, num_boxes };
+
+        p.boxes.resize(num_batches * num_boxes * 4);
+        for (size_t i = 0; i < p.boxes.size(); i += 4) {
+            if (p.center_point_box) {
+                //  x_center, y_center, width, height
+                p.boxes[i + 0] = dist(gen);
+                p.boxes[i + 1] = dist(gen);
+                p.boxes[i + 2] = dist(gen) * 0.5f;
+                p.boxes[i + 3] = dist(gen) * 0.5f;
+            } else {
+                //  y1, x1, y2, x2 (flipped coordinates are allowed)
+                p.boxes[i + 0] = dist(gen);
+                p.boxes[i + 1] = dist(gen);
+                p.boxes[i + 2] = dist(gen);
+                p.boxes[i + 3] = dist(gen);
+            }
+        }
+
+        p.scores.resize(num_batches * num_classes * num_boxes);
+        for (size_t i = 0; i < p.scores.size(); i++)
+            p.scores[i] = dist(gen);
+
+        p.max_output_boxes_per_class = { static_cast<int>(1 + gen() % num_boxes) };
+        p.iou_threshold = { dist(gen) };
+        p.score_threshold = { dist(gen) * 0.5f };
+        p.num_selected_indices = static_cast<int>(num_batches * num_classes) * p.max_output_boxes_per_class[0];
+
+        params.push_back(p);
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNonMaxSuppressionRandom, MKLDNNCPUExtNonMaxSuppressionTFTests,
+        ::testing::ValuesIn(randomNMSParams()));
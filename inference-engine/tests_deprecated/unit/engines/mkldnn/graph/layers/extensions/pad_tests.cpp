@@ -0,0 +1,226 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include <ie_core.hpp>
+#include <random>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct pad_test_params {
+    InferenceEngine::SizeVector inDims;
+    std::vector<unsigned int> padsBegin;
+    std::vector<unsigned int> padsEnd;
+    std::string padMode;
+    float padValue;
+
+    std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+//  Straightforward per-element reference: for every output coordinate compute the source
+//  coordinate (or the pad value) one dimension at a time
+static void ref_pad(
+        InferenceEngine::TBlob<float> &src,
+        InferenceEngine::TBlob<float> &dst,
+        pad_test_params p
+) {
+    const float *src_data = src.data();
+    float *dst_data = dst.data();
+
+    InferenceEngine::SizeVector src_dims = src.getTensorDesc().getDims();
+    InferenceEngine::SizeVector dst_dims = dst.getTensorDesc().getDims();
+    InferenceEngine::SizeVector srcStrides = src.getTensorDesc().getBlockingDesc().getStrides();
+    InferenceEngine::SizeVector dstStrides = dst.getTensorDesc().getBlockingDesc().getStrides();
+    size_t dims_size = dst_dims.size();
+
+    for (size_t dst_idx = 0; dst_idx < dst.size(); dst_idx++) {
+        size_t src_idx = 0;
+        bool is_pad = false;
+        for (size_t i = 0; i < dims_size; i++) {
+            int64_t n = static_cast<int64_t>(src_dims[i]);
+            int64_t s = static_cast<int64_t>((dst_idx / dstStrides[i]) % dst_dims[i]) -
+                        static_cast<int64_t>(p.padsBegin[i]);
+            if (p.padMode == "constant") {
+                if (s < 0 || s >= n) {
+                    is_pad = true;
+                    break;
+                }
+            } else if (p.padMode == "edge") {
+                s = (std::max)(int64_t(0), (std::min)(s, n - 1));
+            } else if (p.padMode == "reflect") {
+                if (s < 0) s = -s;
+                if (s >= n) s = 2 * n - 2 - s;
+            } else {  //  symmetric
+                if (s < 0) s = -s - 1;
+                if (s >= n) s = 2 * n - 1 - s;
+            }
+            src_idx += static_cast<size_t>(s) * srcStrides[i];
+        }
+        dst_data[dst_idx] = is_pad ? p.padValue : src_data[src_idx];
+    }
+}
+
+class MKLDNNCPUExtPadTests : public TestsCommon, public WithParamInterface<pad_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="Pad_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="InputData" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    _IDATA_
+                </port>
+            </output>
+        </layer>
+        <layer name="pad" type="Pad" precision="FP32" id="2">
+            <data pads_begin="_PB_" pads_end="_PE_" pad_mode="_PM_" pad_value="_PV_"/>
+            <input>
+                <port id="1">
+                    _IDATA_
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    _ODATA_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(pad_test_params p) {
+        std::string model = model_t;
+        std::string inData;
+        std::string outData;
+        std::string padsBegin;
+        std::string padsEnd;
+
+        for (size_t i = 0; i < p.inDims.size(); i++) {
+            inData += "<dim>" + std::to_string(p.inDims[i]) + "</dim>\n";
+            outData += "<dim>" + std::to_string(p.inDims[i] + p.padsBegin[i] + p.padsEnd[i]) + "</dim>\n";
+            padsBegin += (i ? "," : "") + std::to_string(p.padsBegin[i]);
+            padsEnd += (i ? "," : "") + std::to_string(p.padsEnd[i]);
+        }
+
+        REPLACE_WITH_STR(model, "_IDATA_", inData);
+        REPLACE_WITH_STR(model, "_ODATA_", outData);
+        REPLACE_WITH_STR(model, "_PB_", padsBegin);
+        REPLACE_WITH_STR(model, "_PE_", padsEnd);
+        REPLACE_WITH_STR(model, "_PM_", p.padMode);
+        REPLACE_WITH_NUM(model, "_PV_", p.padValue);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            pad_test_params p = ::testing::WithParamInterface<pad_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::Core core;
+            InferenceEngine::CNNNetwork network;
+            ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+
+            //  Input Data
+            InferenceEngine::Blob::Ptr srcData = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.inDims, InferenceEngine::TensorDesc::getLayoutByDims(p.inDims) });
+            srcData->allocate();
+            for (size_t i = 0; i < srcData->size(); i++) {
+                static_cast<float*>(srcData->buffer())[i] = static_cast<float>(i % 31) + 1.f;
+            }
+            auto * srcDataPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(srcData.get());
+            if (srcDataPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            //  Output Data
+            InferenceEngine::OutputsDataMap out;
+            out = network.getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            //  Infer
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputData", srcData));
+            graph.Infer(srcs, outputBlobs);
+
+            //  Reference
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_pad(*srcDataPtr, dst_ref, p);
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtPadTests, TestsPad) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsPad, MKLDNNCPUExtPadTests,
+        ::testing::Values(
+// Params: inDims, padsBegin, padsEnd, padMode, padValue
+        pad_test_params{ { 3,4 },{ 2,2 },{ 1,3 }, "constant", 0.f },
+        pad_test_params{ { 3,4 },{ 2,2 },{ 1,3 }, "constant", -1.f },
+        pad_test_params{ { 3,4 },{ 2,2 },{ 1,3 }, "edge", 0.f },
+        pad_test_params{ { 3,4 },{ 2,2 },{ 1,3 }, "reflect", 0.f },
+        pad_test_params{ { 3,4 },{ 2,2 },{ 1,3 }, "symmetric", 0.f },
+        pad_test_params{ { 2,3,4,5 },{ 1,0,2,3 },{ 2,1,0,4 }, "constant", 7.f },
+        pad_test_params{ { 2,3,4,5 },{ 1,0,2,3 },{ 2,1,0,4 }, "edge", 0.f },
+        pad_test_params{ { 2,3,4,5 },{ 1,0,2,3 },{ 1,2,0,4 }, "reflect", 0.f },
+        pad_test_params{ { 2,3,4,5 },{ 1,0,2,3 },{ 2,1,0,4 }, "symmetric", 0.f },
+        pad_test_params{ { 1,1,1,10 },{ 0,0,0,9 },{ 0,0,0,9 }, "symmetric", 0.f },
+        pad_test_params{ { 6 },{ 5 },{ 5 }, "reflect", 0.f }));
+
+//  Randomized cases over all modes: the row-wise copy path must produce exactly what the
+//  per-element reference does, for any mix of zero and non-zero pads
+static std::vector<pad_test_params> randomPadParams() {
+    std::vector<pad_test_params> params;
+    std::mt19937 gen(43);
+
+    const std::string modes[] = { "constant", "edge", "reflect", "symmetric" };
+    for (int case_idx = 0; case_idx < 40; case_idx++) {
+        pad_test_params p;
+        size_t num_dims = 1 + gen() % 5;
+        p.inDims.resize(num_dims);
+        p.padsBegin.resize(num_dims);
+        p.padsEnd.resize(num_dims);
+        p.padMode = modes[gen() % 4];
+        for (size_t i = 0; i < num_dims; i++) {
+            p.inDims[i] = 1 + gen() % 8;
+            //  'reflect' requires pads < dim, 'symmetric' requires pads <= dim
+            unsigned int max_pad = (p.padMode == "reflect") ? static_cast<unsigned int>(p.inDims[i] - 1) :
+                (p.padMode == "symmetric") ? static_cast<unsigned int>(p.inDims[i]) : 4u;
+            p.padsBegin[i] = (max_pad == 0) ? 0 : gen() % (max_pad + 1);
+            p.padsEnd[i] = (max_pad == 0) ? 0 : gen() % (max_pad + 1);
+        }
+        p.padValue = static_cast<float>(static_cast<int>(gen() % 19)) - 9.f;
+        params.push_back(p);
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsPadRandom, MKLDNNCPUExtPadTests,
+        ::testing::ValuesIn(randomPadParams()));
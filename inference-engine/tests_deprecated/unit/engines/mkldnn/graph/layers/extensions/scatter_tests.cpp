@@ -7,6 +7,7 @@
 #include "single_layer_common.hpp"
 #include "tests_common.hpp"
 #include <ie_core.hpp>
+#include <random>
 
 
 using namespace ::testing;
@@ -201,3 +202,236 @@ INSTANTIATE_TEST_CASE_P(
         scatterTF_test_params{"FP32", { 3,3 },{ 0,0,0,0,0,0,0,0,0 },{ 2,3 },{ 1,0,2,0,2,1 },{ 1.,1.1,1.2,2,2.1,2.2 }, 0,{ 2,1.1,0,1,0,2.2,0,2.1,1.2 }},
         scatterTF_test_params{"FP32", { 3,3 },{ 0,0,0,0,0,0,0,0,0 },{ 2,3 },{ 1,0,2,0,2,1 },{ 1.,1.1,1.2,2,2.1,2.2 }, 1,{ 1.1,1,1.2,2,2.2,2.1,0,0,0 }},
         scatterTF_test_params{"FP32", { 1,5 },{ 1,2,3,4,5 },{ 1,2 },{ 1,3 },{ 1.1,2.1 }, 1,{ 1,1.1,3,2.1,5 }}));
+
+struct scatter_random_test_params {
+    std::string inIdxPrecision;
+    InferenceEngine::SizeVector inDataDim;
+    InferenceEngine::SizeVector inIdxDim;
+    int axis;
+    uint32_t seed;
+};
+
+//  Randomized cases with heavy index duplication: the bucketed parallel scatter must keep
+//  the last-write-wins order of a sequential walk over the indices, and must be
+//  deterministic from run to run
+class MKLDNNCPUExtScatterRandomTests : public TestsCommon, public WithParamInterface<scatter_random_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="Scatter_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="InputData" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    _IDATA_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputIndexes" type="Input" precision="_IIDXP_" id="2">
+            <output>
+                <port id="2">
+                    _IIDX_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputUpdates" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="3">
+                    _IIDX_
+                </port>
+            </output>
+        </layer>
+        <layer name="scatter" type="ScatterUpdate" precision="FP32" id="4">
+            <data axis="_AX_"/>
+            <input>
+                <port id="1">
+                    _IDATA_
+                </port>
+                <port id="2" precision="_IIDXP_">
+                    _IIDX_
+                </port>
+                <port id="3">
+                    _IIDX_
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    _IDATA_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="4" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="4" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(scatter_random_test_params p) {
+        std::string model = model_t;
+        std::string inIdx;
+        std::string inData;
+
+        for (auto& idx : p.inIdxDim) {
+            inIdx += "<dim>";
+            inIdx += std::to_string(idx) + "</dim>\n";
+        }
+
+        for (auto& dct : p.inDataDim) {
+            inData += "<dim>";
+            inData += std::to_string(dct) + "</dim>\n";
+        }
+
+        REPLACE_WITH_STR(model, "_IIDX_", inIdx);
+        REPLACE_WITH_STR(model, "_IIDXP_", p.inIdxPrecision);
+        REPLACE_WITH_STR(model, "_IDATA_", inData);
+        REPLACE_WITH_NUM(model, "_AX_", p.axis);
+
+        return model;
+    }
+
+    //  Sequential reference: every update is applied in index order, so with duplicated
+    //  indices the last one wins
+    void ref_scatter(const std::vector<float>& data, const std::vector<int32_t>& indexes,
+                     const std::vector<float>& updates, std::vector<float>& reference,
+                     scatter_random_test_params p) {
+        reference = data;
+
+        InferenceEngine::SizeVector dataStrides(p.inDataDim.size());
+        size_t stride = 1;
+        for (int j = p.inDataDim.size() - 1; j >= 0; j--) {
+            dataStrides[j] = stride;
+            stride *= p.inDataDim[j];
+        }
+
+        for (size_t iwork = 0; iwork < indexes.size(); iwork++) {
+            size_t dst_idx = 0, i = iwork;
+            for (int j = p.inIdxDim.size() - 1; j >= 0; j--) {
+                size_t counter = i % p.inIdxDim[j];
+                i /= p.inIdxDim[j];
+                if (j != p.axis)
+                    dst_idx += counter * dataStrides[j];
+            }
+            unsigned int idx = static_cast<unsigned int>(indexes[iwork]);
+            if (idx < p.inDataDim[p.axis])
+                reference[dst_idx + idx * dataStrides[p.axis]] = updates[iwork];
+        }
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            scatter_random_test_params p = ::testing::WithParamInterface<scatter_random_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            std::mt19937 gen(p.seed);
+            size_t dataSize = 1, idxSize = 1;
+            for (auto& d : p.inDataDim) dataSize *= d;
+            for (auto& d : p.inIdxDim) idxSize *= d;
+
+            std::vector<float> inData(dataSize);
+            for (auto& v : inData) v = static_cast<float>(static_cast<int>(gen() % 1000)) * 0.1f;
+
+            //  index range deliberately narrowed so duplicates along the axis are frequent
+            size_t idxRange = (std::max)(size_t(1), p.inDataDim[p.axis] / 2 + 1);
+            std::vector<int32_t> inIdx(idxSize);
+            for (auto& v : inIdx) v = static_cast<int32_t>(gen() % idxRange);
+
+            std::vector<float> inUpd(idxSize);
+            for (auto& v : inUpd) v = static_cast<float>(static_cast<int>(gen() % 1000)) * 0.1f;
+
+            std::vector<float> reference;
+            ref_scatter(inData, inIdx, inUpd, reference, p);
+
+            InferenceEngine::Core core;
+            InferenceEngine::CNNNetwork network;
+            ASSERT_NO_THROW(network = core.ReadNetwork(model));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+
+            //  Input Data
+            InferenceEngine::Blob::Ptr srcData = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.inDataDim, InferenceEngine::TensorDesc::getLayoutByDims(p.inDataDim) });
+            srcData->allocate();
+            memcpy(srcData->buffer(), &inData[0], sizeof(float)*inData.size());
+
+            // Input Indexes
+            InferenceEngine::Blob::Ptr srcIdx;
+            if (p.inIdxPrecision == "I32") {
+                srcIdx = InferenceEngine::make_shared_blob<int32_t>({ InferenceEngine::Precision::I32, p.inIdxDim, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdxDim) });
+                srcIdx->allocate();
+                memcpy(static_cast<int32_t*>(srcIdx->buffer()), &inIdx[0], sizeof(int32_t)*inIdx.size());
+            } else {
+                srcIdx = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.inIdxDim, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdxDim) });
+                srcIdx->allocate();
+                for (size_t i = 0; i < inIdx.size(); i++) {
+                    static_cast<float*>(srcIdx->buffer())[i] = static_cast<float>(inIdx[i]);
+                }
+            }
+
+            // Input Updates
+            InferenceEngine::Blob::Ptr srcUpd;
+            srcUpd = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.inIdxDim, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdxDim) });
+            srcUpd->allocate();
+            memcpy(static_cast<float*>(srcUpd->buffer()), &inUpd[0], sizeof(float)*inUpd.size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputData", srcData));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputIndexes", srcIdx));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputUpdates", srcUpd));
+
+            //  Infer several times: with duplicated indices every run must produce the
+            //  same bytes as the sequential reference, whatever the thread partitioning
+            InferenceEngine::OutputsDataMap out;
+            out = network.getOutputsInfo();
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            for (int run = 0; run < 3; run++) {
+                InferenceEngine::TBlob<float>::Ptr output;
+                output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+                output->allocate();
+                InferenceEngine::BlobMap outputBlobs;
+                outputBlobs[item.first] = output;
+
+                graph.Infer(srcs, outputBlobs);
+
+                if (memcmp((*output).data(), &reference[0], output->byteSize()) != 0)
+                    FAIL() << "Wrong result with compare to sequential reference, run " << run;
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtScatterRandomTests, TestsScatterRandom) {}
+
+static std::vector<scatter_random_test_params> randomScatterParams() {
+    std::vector<scatter_random_test_params> params;
+    std::mt19937 gen(45);
+
+    for (int case_idx = 0; case_idx < 30; case_idx++) {
+        scatter_random_test_params p;
+        p.inIdxPrecision = (case_idx % 5 == 4) ? "FP32" : "I32";
+        size_t num_dims = 2 + gen() % 3;
+        p.inDataDim.resize(num_dims);
+        p.inIdxDim.resize(num_dims);
+        p.axis = static_cast<int>(gen() % num_dims);
+        for (size_t i = 0; i < num_dims; i++) {
+            p.inDataDim[i] = 2 + gen() % 15;
+            //  idx dims must not exceed data dims except along the axis
+            p.inIdxDim[i] = (i == static_cast<size_t>(p.axis)) ? (1 + gen() % 20)
+                                                               : (1 + gen() % p.inDataDim[i]);
+        }
+        p.seed = 100 + case_idx;
+        params.push_back(p);
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsScatterRandom, MKLDNNCPUExtScatterRandomTests,
+        ::testing::ValuesIn(randomScatterParams()));
@@ -10,6 +10,7 @@
 
 #include <ie_core.hpp>
 #include <ie_plugin_config.hpp>
+#include <random>
 
 using namespace ::testing;
 using namespace std;
@@ -535,6 +536,33 @@ INSTANTIATE_TEST_CASE_P(TestsPermuteBlocked, permute_s8, ::testing::ValuesIn(tes
 INSTANTIATE_TEST_CASE_P(TestsPermutePlanarToBlocked, permute_s8, ::testing::ValuesIn(test_cases_planar_to_blocked_s8));
 INSTANTIATE_TEST_CASE_P(TestsPermuteBlockedToPlanar, permute_s8, ::testing::ValuesIn(test_cases_blocked_to_planar_s8));
 
+// Randomized planar cases: random shapes with random orders cover every way adjacent
+// dimensions can (or cannot) be merged, and are checked against ref_permute above
+static std::vector<test_params_t> random_planar_cases() {
+    std::vector<test_params_t> cases;
+    std::mt19937 gen(44);
+
+    const Layout layouts[] = { Layout::CHW, Layout::NCHW, Layout::NCDHW };
+    for (int case_idx = 0; case_idx < 60; case_idx++) {
+        size_t num_dims = 3 + gen() % 3;
+        Layout layout = layouts[num_dims - 3];
+
+        SizeVector dims(num_dims);
+        SizeVector order(num_dims);
+        for (size_t i = 0; i < num_dims; i++) {
+            dims[i] = 1 + gen() % 7;
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), gen);
+
+        cases.push_back(test_params_t(layout, layout, Precision::FP32, 1, dims, order,
+                                      SizeVector({}), SizeVector({}), SizeVector({}), SizeVector({})));
+    }
+    return cases;
+}
+
+INSTANTIATE_TEST_CASE_P(TestsPermuteRandom, permute_f32, ::testing::ValuesIn(random_planar_cases()));
+
 class MKLDNNGraphDynBatchPermuteTests: public permute_f32 {
 protected:
     virtual void SetUp() {
@@ -73,6 +73,8 @@ struct engine_configuration {
                                           ///< (switched off for older drivers then NEO).
     uint16_t n_streams;                   ///< Number of queues executed in parallel
     const std::string tuning_cache_path;  ///< Path to tuning kernel cache
+    const std::string kernels_cache_path;  ///< Path to a directory with persistent compiled program binaries keyed by
+                                           ///< device, driver and program sources. Empty by default (means no cache).
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -93,7 +95,8 @@ struct engine_configuration {
         throttle_mode_types throttle_mode = throttle_mode_types::disabled,
         bool memory_pool = true,
         uint16_t n_streams = 1,
-        const std::string& tuning_cache_path = "cache.json")
+        const std::string& tuning_cache_path = "cache.json",
+        const std::string& kernels_cache_path = std::string())
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -106,7 +109,8 @@ struct engine_configuration {
         , throttle_mode(throttle_mode)
         , enable_memory_pool(memory_pool)
         , n_streams(n_streams)
-        , tuning_cache_path(tuning_cache_path) {
+        , tuning_cache_path(tuning_cache_path)
+        , kernels_cache_path(kernels_cache_path) {
         if (n_streams == 0) {
             throw std::invalid_argument("Invalid streams count set in engine config");
         }
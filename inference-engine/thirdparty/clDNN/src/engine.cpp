@@ -94,6 +94,7 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf) {
     result.throttle_mode = conf.throttle_mode;
     result.queues_num = conf.n_streams;
     result.tuning_cache_path = conf.tuning_cache_path;
+    result.kernels_cache_path = conf.kernels_cache_path;
     return result;
 }
 
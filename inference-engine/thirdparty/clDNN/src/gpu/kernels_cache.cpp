@@ -99,6 +99,15 @@ std::string reorder_options(const std::string& org_options) {
 inline bool does_options_support_batch_compilation(const std::string& options) {
     return options.find("-D") == std::string::npos && options.find("-I") == std::string::npos;
 }
+
+// FNV-1a; used to key persistent program binaries, so it has to be stable across runs and processes
+// (std::hash gives no such guarantee).
+inline void hash_combine(uint64_t& seed, const std::string& str) {
+    for (const auto& c : str) {
+        seed ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
+        seed *= 0x100000001b3ULL;
+    }
+}
 }  // namespace
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const {
@@ -206,6 +215,10 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
         dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
     }
 
+    std::string binary_cache_dir = _context.get_configuration().kernels_cache_path;
+    if (!binary_cache_dir.empty() && binary_cache_dir.back() != '/')
+        binary_cache_dir += '/';
+
     try {
         kernels_map kmap;
         std::string err_log;  // accumulated build log from all program's parts (only contains messages from parts which
@@ -224,12 +237,75 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
                 }
             }
 
+            std::string binary_cache_name;
+            if (!binary_cache_dir.empty()) {
+                // The binary is only valid for the exact device, driver, build options and sources
+                // it was produced from, so all of them participate in the key.
+                uint64_t key = 0xcbf29ce484222325ULL;
+                hash_combine(key, _context.get_device_info().dev_name);
+                hash_combine(key, _context.get_device_info().driver_version);
+                hash_combine(key, program_source.options);
+                for (const auto& s : sources) hash_combine(key, s);
+
+                std::stringstream key_ss;
+                key_ss << std::hex << key;
+                binary_cache_name = binary_cache_dir + "clDNN_program_" + key_ss.str() + ".bin";
+            }
+
+            bool loaded_from_cache = false;
+            if (!binary_cache_name.empty()) {
+                std::ifstream binary_file(binary_cache_name, std::ios::binary | std::ios::ate);
+                if (binary_file.good()) {
+                    cl::Program::Binaries binaries(1);
+                    binaries.front().resize(static_cast<size_t>(binary_file.tellg()));
+                    binary_file.seekg(0, std::ios::beg);
+                    binary_file.read(reinterpret_cast<char*>(binaries.front().data()), binaries.front().size());
+
+                    if (binary_file.good() && !binaries.front().empty()) {
+                        try {
+                            cl::Program program(_context.context(), {_context.device()}, binaries);
+                            program.build({_context.device()}, program_source.options.c_str());
+                            // Store kernels for serialization process.
+                            _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>(), _prog_id);
+
+                            cl::vector<cl::Kernel> kernels;
+                            program.createKernels(&kernels);
+
+                            for (auto& k : kernels) {
+                                auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+                                kmap.emplace(kernel_name,
+                                             kernels_cache::kernel_type(k, _context.get_device_info().supports_usm));
+                            }
+
+                            loaded_from_cache = true;
+                        } catch (const cl::Error&) {
+                            // A stale or foreign binary - fall back to building from sources; the
+                            // cache entry is rewritten with a fresh binary below.
+                        }
+                    }
+                }
+            }
+
+            if (loaded_from_cache)
+                continue;
+
             try {
                 cl::Program program(_context.context(), sources);
                 program.build({_context.device()}, program_source.options.c_str());
                 // Store kernels for serialization process.
                 _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>(), _prog_id);
 
+                if (!binary_cache_name.empty()) {
+                    auto binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+                    if (!binaries.empty() && !binaries.front().empty()) {
+                        std::ofstream binary_file(binary_cache_name, std::ios::binary);
+                        if (binary_file.good())
+                            binary_file.write(reinterpret_cast<const char*>(binaries.front().data()),
+                                              binaries.front().size());
+                        // A failed write only leaves the cache cold; the program itself is already built.
+                    }
+                }
+
                 if (dump_sources && dump_file.good()) {
                     dump_file << "\n/* Build Log:\n";
                     for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>()) dump_file << p.second << "\n";
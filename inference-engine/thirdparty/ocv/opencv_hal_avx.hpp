@@ -3187,6 +3187,30 @@ namespace {
     }
 }  // namespace
 
+// for each j=index[k], load pair of floats (src[j], src[j+1]);
+// the pairs are laid out so that v_deinterleave() below gives the
+// src[j]'s in `even` and the src[j+1]'s in `odd`, both in index order
+static inline void v_gather_pairs(const float src[], const v_int32x8& index,
+                                  v_float32x8& low, v_float32x8& high)
+{
+    int CV_DECL_ALIGNED(32) i[8];
+    v_store_aligned(i, index);
+
+    __m128 z = _mm_setzero_ps();
+    __m128 l01, l45, h23, h67;
+    l01 = _mm_loadl_pi(z,   (const __m64*)&src[i[0]]);  // pair of floats
+    l01 = _mm_loadh_pi(l01, (const __m64*)&src[i[1]]);
+    l45 = _mm_loadl_pi(z,   (const __m64*)&src[i[4]]);
+    l45 = _mm_loadh_pi(l45, (const __m64*)&src[i[5]]);
+    low.val = _v256_combine(l01, l45);
+
+    h23 = _mm_loadl_pi(z,   (const __m64*)&src[i[2]]);
+    h23 = _mm_loadh_pi(h23, (const __m64*)&src[i[3]]);
+    h67 = _mm_loadl_pi(z,   (const __m64*)&src[i[6]]);
+    h67 = _mm_loadh_pi(h67, (const __m64*)&src[i[7]]);
+    high.val = _v256_combine(h23, h67);
+}
+
 CV_CPU_OPTIMIZATION_HAL_NAMESPACE_END
 
 //! @endcond
@@ -3288,6 +3288,48 @@ namespace {
     }
 }  // namespace
 
+// for each j=index[k], load pair of floats (src[j], src[j+1]);
+// the pairs are laid out per 128-bit lane so that v_deinterleave()
+// below gives the src[j]'s in `even` and the src[j+1]'s in `odd`,
+// both in index order
+static inline void v_gather_pairs(const float src[], const v_int32x16& index,
+                                  v_float32x16& low, v_float32x16& high)
+{
+    int CV_DECL_ALIGNED(64) i[16];
+    v_store_aligned(i, index);
+
+    __m128 z = _mm_setzero_ps();
+    __m128 p;
+
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[0]]);  // pair of floats
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[1]]);
+    __m512 l = _mm512_castps128_ps512(p);
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[4]]);
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[5]]);
+    l = _mm512_insertf32x4(l, p, 1);
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[8]]);
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[9]]);
+    l = _mm512_insertf32x4(l, p, 2);
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[12]]);
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[13]]);
+    l = _mm512_insertf32x4(l, p, 3);
+    low.val = l;
+
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[2]]);
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[3]]);
+    __m512 h = _mm512_castps128_ps512(p);
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[6]]);
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[7]]);
+    h = _mm512_insertf32x4(h, p, 1);
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[10]]);
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[11]]);
+    h = _mm512_insertf32x4(h, p, 2);
+    p = _mm_loadl_pi(z, (const __m64*)&src[i[14]]);
+    p = _mm_loadh_pi(p, (const __m64*)&src[i[15]]);
+    h = _mm512_insertf32x4(h, p, 3);
+    high.val = h;
+}
+
 CV_CPU_OPTIMIZATION_HAL_NAMESPACE_END
 
 //! @endcond
@@ -52,6 +52,10 @@ static constexpr char iop_message[] = "Optional. Specifies precision for input a
 
 static constexpr char dla_arch_name[] = "Optional. Specify architecture name used to compile executable network for FPGA device.";
 
+static constexpr char cpu_prepared_weights_message[] = "Optional. Store the weights reordered into the layouts chosen"
+                                                       " by the CPU plugin inside the output file,\n"
+"                                             so importing it skips all weight reorders.";
+
 DEFINE_bool(h, false, help_message);
 DEFINE_string(m, "", model_message);
 DEFINE_string(d, "", targetDeviceMessage);
@@ -64,6 +68,7 @@ DEFINE_string(VPU_MYRIAD_PLATFORM, "", platform_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(DLA_ARCH_NAME, "", dla_arch_name);
+DEFINE_bool(CPU_PREPARED_WEIGHTS, false, cpu_prepared_weights_message);
 
 static void showUsage() {
     std::cout << std::endl;
@@ -84,6 +89,8 @@ static void showUsage() {
     std::cout << "      -VPU_NUMBER_OF_CMX_SLICES  <value>     "   << number_of_cmx_slices_message << std::endl;
     std::cout << "    DLA options:                             "                                   << std::endl;
     std::cout << "      -DLA_ARCH_NAME             <value>     "   << dla_arch_name                << std::endl;
+    std::cout << "    CPU options:                             "                                   << std::endl;
+    std::cout << "      -CPU_PREPARED_WEIGHTS                  "   << cpu_prepared_weights_message << std::endl;
     std::cout << std::endl;
 }
 
@@ -159,6 +166,10 @@ static std::map<std::string, std::string> configure(const std::string &configFil
         config["DLIA_ARCH_NAME"] = FLAGS_DLA_ARCH_NAME;
     }
 
+    if (FLAGS_CPU_PREPARED_WEIGHTS) {
+        config[CONFIG_KEY(CPU_EXPORT_PREPARED_WEIGHTS)] = CONFIG_VALUE(YES);
+    }
+
     return config;
 }
 
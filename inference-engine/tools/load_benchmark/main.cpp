@@ -0,0 +1,339 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char model_message[] = "Required. Path to an .xml file with a trained model.";
+static constexpr char device_message[] = "Optional. Device to load the network to. "
+                                         "Default value: \"CPU\".";
+static constexpr char mode_message[] = "Optional. Load generation mode: \"closed\" keeps a fixed number of requests "
+                                       "in flight, \"open\" issues requests on an arrival schedule independent of "
+                                       "completions. Default value: \"closed\".";
+static constexpr char nireq_message[] = "Optional. Number of infer requests: the concurrency of the closed loop or "
+                                        "the pool the open loop draws from. Default value: 0 (the optimal number "
+                                        "reported by the device).";
+static constexpr char duration_message[] = "Optional. Measurement duration in seconds. Default value: 10.";
+static constexpr char rate_message[] = "Optional. Open loop only. Target arrival rate in requests per second. "
+                                       "Default value: 1000.";
+static constexpr char distribution_message[] = "Optional. Open loop only. Request arrival distribution: \"uniform\" "
+                                               "(constant inter-arrival gap) or \"poisson\" (exponential gaps). "
+                                               "Default value: \"uniform\".";
+static constexpr char seed_message[] = "Optional. Seed of the arrival schedule generator. "
+                                       "Default value: 0 (non-deterministic).";
+static constexpr char latency_file_message[] = "Optional. Path to a CSV file the per-request latencies are written "
+                                               "to, one row per request.";
+static constexpr char report_file_message[] = "Optional. Path to the JSON summary file. "
+                                              "By default the summary is printed to stdout.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(d, "CPU", device_message);
+DEFINE_string(mode, "closed", mode_message);
+DEFINE_uint32(nireq, 0, nireq_message);
+DEFINE_uint32(t, 10, duration_message);
+DEFINE_double(rate, 1000.0, rate_message);
+DEFINE_string(distribution, "uniform", distribution_message);
+DEFINE_uint64(seed, 0, seed_message);
+DEFINE_string(latency_file, "", latency_file_message);
+DEFINE_string(report_file, "", report_file_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "load_benchmark [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                         " << help_message         << std::endl;
+    std::cout << "    -m            <value>      " << model_message        << std::endl;
+    std::cout << "    -d            <value>      " << device_message       << std::endl;
+    std::cout << "    -mode         <value>      " << mode_message         << std::endl;
+    std::cout << "    -nireq        <value>      " << nireq_message        << std::endl;
+    std::cout << "    -t            <value>      " << duration_message     << std::endl;
+    std::cout << "    -rate         <value>      " << rate_message         << std::endl;
+    std::cout << "    -distribution <value>      " << distribution_message << std::endl;
+    std::cout << "    -seed         <value>      " << seed_message         << std::endl;
+    std::cout << "    -latency_file <value>      " << latency_file_message << std::endl;
+    std::cout << "    -report_file  <value>      " << report_file_message  << std::endl;
+    std::cout << std::endl;
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct RequestRecord {
+    double issueUs;    // issue (or scheduled arrival) time, relative to the run start
+    double latencyUs;  // issue-to-completion time
+};
+
+struct RunResult {
+    size_t completed = 0;
+    size_t lateIssues = 0;  // open loop only: arrivals which found no free request
+    double durationS = 0.0;
+    std::vector<RequestRecord> records;
+};
+
+double percentile(std::vector<double>& sortedLatencies, double ratio) {
+    if (sortedLatencies.empty())
+        return 0.0;
+    const auto index = static_cast<size_t>(ratio * (sortedLatencies.size() - 1));
+    return sortedLatencies[index];
+}
+
+void fillRequestInputs(InferRequest& request, const ConstInputsDataMap& inputsInfo) {
+    // the content doesn't matter for load generation, but the pages must be
+    // touched so the first measured request doesn't pay the fault-in cost
+    for (const auto& input : inputsInfo) {
+        Blob::Ptr blob = request.GetBlob(input.first);
+        auto buffer = blob->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < blob->byteSize(); ++i) {
+            buffer[i] = static_cast<uint8_t>(i % 0xFF);
+        }
+    }
+}
+
+// Closed loop: every worker thread drives its own request back to back, so the
+// offered concurrency is constant and the measured rate is the sustained
+// throughput at that concurrency.
+RunResult runClosedLoop(std::vector<InferRequest>& requests) {
+    RunResult result;
+    std::vector<std::vector<RequestRecord>> perWorkerRecords(requests.size());
+    std::vector<std::thread> workers;
+
+    const auto start = Clock::now();
+    const auto deadline = start + std::chrono::seconds(FLAGS_t);
+
+    for (size_t i = 0; i < requests.size(); ++i) {
+        workers.emplace_back([&requests, &perWorkerRecords, i, start, deadline] {
+            auto& request = requests[i];
+            auto& records = perWorkerRecords[i];
+            while (Clock::now() < deadline) {
+                const auto issued = Clock::now();
+                request.Infer();
+                const auto completed = Clock::now();
+                records.push_back(RequestRecord{
+                    std::chrono::duration<double, std::micro>(issued - start).count(),
+                    std::chrono::duration<double, std::micro>(completed - issued).count()});
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    result.durationS = std::chrono::duration<double>(Clock::now() - start).count();
+    for (auto& records : perWorkerRecords) {
+        result.records.insert(result.records.end(), records.begin(), records.end());
+    }
+    result.completed = result.records.size();
+    return result;
+}
+
+// Open loop: requests are issued on a precomputed arrival schedule regardless of
+// completions, the way an external client population would offer load. Latency
+// is counted from the scheduled arrival, so time spent waiting for a free
+// request (the server falling behind) stays visible instead of being absorbed
+// into a slower issue rate.
+RunResult runOpenLoop(std::vector<InferRequest>& requests) {
+    RunResult result;
+
+    std::mutex poolMutex;
+    std::condition_variable poolCv;
+    std::vector<size_t> freeRequests(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i)
+        freeRequests[i] = i;
+    std::vector<Clock::time_point> issueStamps(requests.size());
+
+    std::mutex recordsMutex;
+
+    const uint64_t seed = FLAGS_seed != 0 ? FLAGS_seed : std::random_device{}();
+    std::mt19937_64 generator(seed);
+    std::exponential_distribution<double> poissonGap(FLAGS_rate);
+    const double uniformGapS = 1.0 / FLAGS_rate;
+    const bool poisson = FLAGS_distribution == "poisson";
+
+    const auto start = Clock::now();
+    const auto deadline = start + std::chrono::seconds(FLAGS_t);
+
+    for (size_t i = 0; i < requests.size(); ++i) {
+        auto& request = requests[i];
+        request.SetCompletionCallback([&, i] {
+            const auto completed = Clock::now();
+            {
+                std::lock_guard<std::mutex> lock{recordsMutex};
+                result.records.push_back(RequestRecord{
+                    std::chrono::duration<double, std::micro>(issueStamps[i] - start).count(),
+                    std::chrono::duration<double, std::micro>(completed - issueStamps[i]).count()});
+            }
+            std::lock_guard<std::mutex> lock{poolMutex};
+            freeRequests.push_back(i);
+            poolCv.notify_one();
+        });
+    }
+
+    double nextArrivalS = 0.0;
+    while (true) {
+        const auto arrival = start + std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(nextArrivalS));
+        if (arrival >= deadline)
+            break;
+        std::this_thread::sleep_until(arrival);
+
+        size_t requestId;
+        {
+            std::unique_lock<std::mutex> lock{poolMutex};
+            if (freeRequests.empty()) {
+                result.lateIssues++;
+                poolCv.wait(lock, [&freeRequests] { return !freeRequests.empty(); });
+            }
+            requestId = freeRequests.back();
+            freeRequests.pop_back();
+        }
+
+        // latency is measured from the scheduled arrival, not from StartAsync
+        issueStamps[requestId] = arrival;
+        requests[requestId].StartAsync();
+
+        nextArrivalS += poisson ? poissonGap(generator) : uniformGapS;
+    }
+
+    // drain: every request back in the pool means every callback has run
+    {
+        std::unique_lock<std::mutex> lock{poolMutex};
+        poolCv.wait(lock, [&freeRequests, &requests] { return freeRequests.size() == requests.size(); });
+    }
+
+    result.durationS = std::chrono::duration<double>(Clock::now() - start).count();
+    result.completed = result.records.size();
+    return result;
+}
+
+void writeLatencyCsv(const RunResult& result, const std::string& path) {
+    std::ofstream csv(path);
+    if (!csv.is_open()) {
+        throw std::runtime_error("Can't open latency file " + path);
+    }
+    csv << "id,issue_us,latency_us" << std::endl;
+    for (size_t i = 0; i < result.records.size(); ++i) {
+        csv << i << "," << std::fixed << result.records[i].issueUs
+            << "," << std::fixed << result.records[i].latencyUs << std::endl;
+    }
+}
+
+void writeReport(const RunResult& result, std::ostream& out) {
+    std::vector<double> latencies;
+    latencies.reserve(result.records.size());
+    for (const auto& record : result.records)
+        latencies.push_back(record.latencyUs);
+    std::sort(latencies.begin(), latencies.end());
+
+    double totalUs = 0.0;
+    for (const auto latency : latencies)
+        totalUs += latency;
+
+    out << "{" << std::endl;
+    out << "    \"mode\": \"" << FLAGS_mode << "\"," << std::endl;
+    if (FLAGS_mode == "open") {
+        out << "    \"distribution\": \"" << FLAGS_distribution << "\"," << std::endl;
+        out << "    \"target_rate_rps\": " << std::fixed << FLAGS_rate << "," << std::endl;
+        out << "    \"late_issues\": " << result.lateIssues << "," << std::endl;
+    }
+    out << "    \"requests\": " << result.completed << "," << std::endl;
+    out << "    \"duration_s\": " << std::fixed << result.durationS << "," << std::endl;
+    out << "    \"throughput_rps\": " << std::fixed
+        << (result.durationS > 0.0 ? result.completed / result.durationS : 0.0) << "," << std::endl;
+    out << "    \"latency_us\": {" << std::endl;
+    out << "        \"min\": " << std::fixed << (latencies.empty() ? 0.0 : latencies.front()) << "," << std::endl;
+    out << "        \"avg\": " << std::fixed << (latencies.empty() ? 0.0 : totalUs / latencies.size()) << ","
+        << std::endl;
+    out << "        \"p50\": " << std::fixed << percentile(latencies, 0.50) << "," << std::endl;
+    out << "        \"p90\": " << std::fixed << percentile(latencies, 0.90) << "," << std::endl;
+    out << "        \"p99\": " << std::fixed << percentile(latencies, 0.99) << "," << std::endl;
+    out << "        \"max\": " << std::fixed << (latencies.empty() ? 0.0 : latencies.back()) << std::endl;
+    out << "    }" << std::endl;
+    out << "}" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+        if (FLAGS_h) {
+            showUsage();
+            return EXIT_SUCCESS;
+        }
+        if (FLAGS_m.empty()) {
+            showUsage();
+            throw std::logic_error("Parameter -m is not set");
+        }
+        if (FLAGS_mode != "closed" && FLAGS_mode != "open") {
+            throw std::logic_error("Parameter -mode expects \"closed\" or \"open\", got \"" + FLAGS_mode + "\"");
+        }
+        if (FLAGS_distribution != "uniform" && FLAGS_distribution != "poisson") {
+            throw std::logic_error("Parameter -distribution expects \"uniform\" or \"poisson\", got \""
+                                   + FLAGS_distribution + "\"");
+        }
+        if (FLAGS_rate <= 0.0) {
+            throw std::logic_error("Parameter -rate expects a positive value");
+        }
+
+        Core core;
+        CNNNetwork network = core.ReadNetwork(FLAGS_m);
+        ExecutableNetwork executableNetwork = core.LoadNetwork(network, FLAGS_d);
+
+        size_t requestsCount = FLAGS_nireq;
+        if (requestsCount == 0) {
+            requestsCount = executableNetwork.GetMetric(
+                    METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        }
+
+        std::vector<InferRequest> requests;
+        for (size_t i = 0; i < requestsCount; ++i) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            fillRequestInputs(requests.back(), executableNetwork.GetInputsInfo());
+        }
+
+        // warm up every request once, so jit generation, weight reorders and
+        // lazy allocations don't land in the measured interval
+        for (auto& request : requests) {
+            request.Infer();
+        }
+
+        const RunResult result = FLAGS_mode == "closed" ? runClosedLoop(requests) : runOpenLoop(requests);
+
+        if (!FLAGS_latency_file.empty()) {
+            writeLatencyCsv(result, FLAGS_latency_file);
+        }
+        if (FLAGS_report_file.empty()) {
+            writeReport(result, std::cout);
+        } else {
+            std::ofstream reportFile(FLAGS_report_file);
+            if (!reportFile.is_open()) {
+                throw std::runtime_error("Can't open report file " + FLAGS_report_file);
+            }
+            writeReport(result, reportFile);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,322 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include <precision_utils.h>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char filter_message[] = "Optional. Run only benchmarks whose name contains the given substring.";
+static constexpr char device_message[] = "Optional. Device used by the layer execution benchmarks. "
+                                         "Default value: \"CPU\".";
+static constexpr char min_time_message[] = "Optional. Minimum measured time per benchmark in milliseconds. "
+                                           "Default value: 300.";
+static constexpr char min_iterations_message[] = "Optional. Minimum number of measured iterations per benchmark. "
+                                                 "Default value: 16.";
+static constexpr char report_file_message[] = "Optional. Path to the JSON report file. "
+                                              "By default the report is printed to stdout.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(f, "", filter_message);
+DEFINE_string(d, "CPU", device_message);
+DEFINE_uint32(t, 300, min_time_message);
+DEFINE_uint32(niter, 16, min_iterations_message);
+DEFINE_string(report_file, "", report_file_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "micro_benchmark [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                        " << help_message           << std::endl;
+    std::cout << "    -f            <value>     " << filter_message         << std::endl;
+    std::cout << "    -d            <value>     " << device_message         << std::endl;
+    std::cout << "    -t            <value>     " << min_time_message       << std::endl;
+    std::cout << "    -niter        <value>     " << min_iterations_message << std::endl;
+    std::cout << "    -report_file  <value>     " << report_file_message    << std::endl;
+    std::cout << std::endl;
+}
+
+namespace {
+
+struct BenchmarkResult {
+    std::string name;
+    std::string status;
+    size_t iterations = 0;
+    double avgUs = 0.0;
+    double totalMs = 0.0;
+};
+
+template <typename Body>
+BenchmarkResult runBenchmark(const std::string& name, Body&& body) {
+    BenchmarkResult result;
+    result.name = name;
+    result.status = "ok";
+
+    if (!FLAGS_f.empty() && name.find(FLAGS_f) == std::string::npos) {
+        result.status = "skipped";
+        return result;
+    }
+
+    try {
+        constexpr size_t warmupIterations = 3;
+        for (size_t i = 0; i < warmupIterations; ++i) {
+            body();
+        }
+
+        double totalUs = 0.0;
+        size_t iterations = 0;
+        while ((totalUs < FLAGS_t * 1000.0) || (iterations < FLAGS_niter)) {
+            const auto start = std::chrono::steady_clock::now();
+            body();
+            const auto stop = std::chrono::steady_clock::now();
+
+            totalUs += std::chrono::duration<double, std::micro>(stop - start).count();
+            ++iterations;
+        }
+
+        result.iterations = iterations;
+        result.avgUs = totalUs / iterations;
+        result.totalMs = totalUs / 1000.0;
+    } catch (const std::exception& error) {
+        result.status = error.what();
+    } catch (...) {
+        result.status = "unknown failure";
+    }
+
+    return result;
+}
+
+std::string jsonEscape(const std::string& value) {
+    std::string escaped;
+    for (const char symbol : value) {
+        if (symbol == '"' || symbol == '\\') {
+            escaped += '\\';
+            escaped += symbol;
+        } else if (symbol == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += symbol;
+        }
+    }
+    return escaped;
+}
+
+void writeReport(const std::vector<BenchmarkResult>& results, std::ostream& out) {
+    out << "[" << std::endl;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        out << "    { \"name\": \"" << jsonEscape(result.name) << "\""
+            << ", \"status\": \"" << jsonEscape(result.status) << "\""
+            << ", \"iterations\": " << result.iterations
+            << ", \"avg_us\": " << std::fixed << result.avgUs
+            << ", \"total_ms\": " << std::fixed << result.totalMs
+            << " }" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    out << "]" << std::endl;
+}
+
+Blob::Ptr makeBlob(const Precision& precision, const SizeVector& dims, const Layout& layout) {
+    Blob::Ptr blob = make_blob_with_precision(TensorDesc(precision, dims, layout));
+    blob->allocate();
+
+    auto buffer = blob->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < blob->byteSize(); ++i) {
+        buffer[i] = static_cast<uint8_t>(i % 0xFF);
+    }
+
+    return blob;
+}
+
+std::string makePortsSection(const std::string& tag, size_t portId) {
+    std::ostringstream section;
+    section << "        <" << tag << ">" << std::endl
+            << "            <port id=\"" << portId << "\">" << std::endl
+            << "                <dim>1</dim><dim>3</dim><dim>128</dim><dim>128</dim>" << std::endl
+            << "            </port>" << std::endl
+            << "        </" << tag << ">" << std::endl;
+    return section.str();
+}
+
+struct LayerSpec {
+    std::string type;
+    std::string data;
+};
+
+// Builds IR with an Input layer followed by a chain of the given layers, each
+// consuming the output of the previous one.
+std::string makeChainModel(const std::string& name, const std::vector<LayerSpec>& layers) {
+    std::ostringstream model;
+    model << "<net name=\"" << name << "\" version=\"6\" batch=\"1\">" << std::endl;
+    model << "<layers>" << std::endl;
+
+    model << "    <layer name=\"input\" type=\"Input\" precision=\"FP32\" id=\"0\">" << std::endl
+          << makePortsSection("output", 0)
+          << "    </layer>" << std::endl;
+
+    for (size_t i = 0; i < layers.size(); ++i) {
+        model << "    <layer name=\"layer_" << i << "\" type=\"" << layers[i].type
+              << "\" precision=\"FP32\" id=\"" << (i + 1) << "\">" << std::endl;
+        if (!layers[i].data.empty()) {
+            model << "        <data " << layers[i].data << "/>" << std::endl;
+        }
+        model << makePortsSection("input", 0)
+              << makePortsSection("output", 1)
+              << "    </layer>" << std::endl;
+    }
+
+    model << "</layers>" << std::endl;
+    model << "<edges>" << std::endl;
+    for (size_t i = 0; i < layers.size(); ++i) {
+        model << "    <edge from-layer=\"" << i << "\" from-port=\"" << (i == 0 ? 0 : 1)
+              << "\" to-layer=\"" << (i + 1) << "\" to-port=\"0\"/>" << std::endl;
+    }
+    model << "</edges>" << std::endl;
+    model << "</net>" << std::endl;
+
+    return model.str();
+}
+
+void runBlobTransformBenchmarks(std::vector<BenchmarkResult>& results) {
+    const SizeVector dims = {1, 3, 224, 224};
+
+    struct Case {
+        std::string name;
+        Precision precision;
+        Layout srcLayout;
+        Layout dstLayout;
+    };
+    const std::vector<Case> cases = {
+        { "blob_copy/fp32/nchw_to_nhwc", Precision::FP32, Layout::NCHW, Layout::NHWC },
+        { "blob_copy/fp32/nhwc_to_nchw", Precision::FP32, Layout::NHWC, Layout::NCHW },
+        { "blob_copy/u8/nchw_to_nhwc",   Precision::U8,   Layout::NCHW, Layout::NHWC },
+        { "blob_copy/u8/nhwc_to_nchw",   Precision::U8,   Layout::NHWC, Layout::NCHW },
+    };
+
+    for (const auto& testCase : cases) {
+        Blob::Ptr src = makeBlob(testCase.precision, dims, testCase.srcLayout);
+        Blob::Ptr dst = makeBlob(testCase.precision, dims, testCase.dstLayout);
+        results.push_back(runBenchmark(testCase.name, [src, dst] {
+            blob_copy(src, dst);
+        }));
+    }
+}
+
+void runPrecisionConvertBenchmarks(std::vector<BenchmarkResult>& results) {
+    constexpr size_t elementsCount = 1024 * 1024;
+
+    std::vector<float> fp32Data(elementsCount, 1.5f);
+    std::vector<ie_fp16> fp16Data(elementsCount);
+
+    results.push_back(runBenchmark("precision_convert/f32_to_f16", [&fp32Data, &fp16Data] {
+        PrecisionUtils::f32tof16Arrays(fp16Data.data(), fp32Data.data(), fp16Data.size());
+    }));
+    results.push_back(runBenchmark("precision_convert/f16_to_f32", [&fp32Data, &fp16Data] {
+        PrecisionUtils::f16tof32Arrays(fp32Data.data(), fp16Data.data(), fp32Data.size());
+    }));
+}
+
+void runReaderBenchmarks(std::vector<BenchmarkResult>& results, Core& core) {
+    const std::string model = makeChainModel("micro_benchmark_chain", std::vector<LayerSpec>(256, LayerSpec{"ReLU", ""}));
+
+    results.push_back(runBenchmark("reader/parse_chain_256_layers", [&core, &model] {
+        core.ReadNetwork(model, Blob::CPtr());
+    }));
+}
+
+void runExecutorBenchmarks(std::vector<BenchmarkResult>& results) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"MicroBenchStreams"});
+
+    results.push_back(runBenchmark("executor/dispatch_round_trip", [executor] {
+        std::promise<void> done;
+        auto ready = done.get_future();
+        executor->run([&done] {
+            done.set_value();
+        });
+        ready.wait();
+    }));
+}
+
+void runLayerBenchmarks(std::vector<BenchmarkResult>& results, Core& core) {
+    struct Case {
+        std::string name;
+        LayerSpec layer;
+    };
+    const std::vector<Case> cases = {
+        { "layer/grn",    { "GRN",    "bias=\"1.0\"" } },
+        { "layer/interp", { "Interp", "height=\"128\" width=\"128\" pad_beg=\"0\" pad_end=\"0\"" } },
+    };
+
+    for (const auto& testCase : cases) {
+        if (!FLAGS_f.empty() && testCase.name.find(FLAGS_f) == std::string::npos) {
+            continue;
+        }
+
+        try {
+            const std::string model = makeChainModel("micro_benchmark_layer", { testCase.layer });
+            CNNNetwork network = core.ReadNetwork(model, Blob::CPtr());
+            ExecutableNetwork executableNetwork = core.LoadNetwork(network, FLAGS_d);
+            InferRequest request = executableNetwork.CreateInferRequest();
+
+            results.push_back(runBenchmark(testCase.name, [&request] {
+                request.Infer();
+            }));
+        } catch (const std::exception& error) {
+            BenchmarkResult result;
+            result.name = testCase.name;
+            result.status = error.what();
+            results.push_back(result);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+        if (FLAGS_h) {
+            showUsage();
+            return EXIT_SUCCESS;
+        }
+
+        Core core;
+
+        std::vector<BenchmarkResult> results;
+        runBlobTransformBenchmarks(results);
+        runPrecisionConvertBenchmarks(results);
+        runReaderBenchmarks(results, core);
+        runExecutorBenchmarks(results);
+        runLayerBenchmarks(results, core);
+
+        if (FLAGS_report_file.empty()) {
+            writeReport(results, std::cout);
+        } else {
+            std::ofstream reportFile(FLAGS_report_file);
+            if (!reportFile.is_open()) {
+                throw std::runtime_error("Can't open report file " + FLAGS_report_file);
+            }
+            writeReport(results, reportFile);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdio>
 #include <iostream>
 #include <sstream>
@@ -168,6 +169,45 @@ CoordinateTransform::CoordinateTransform(const Shape& source_shape,
                                               source_start_corner[source_axis_order[axis]],
                                           source_strides[source_axis_order[axis]]));
     }
+
+    // When there is no dilation, the buffer index of a target coordinate is an affine
+    // function of the coordinate: each axis contributes the coordinate value times a
+    // fixed stride, plus a fixed offset for the start corner and padding. Precompute
+    // those multipliers here so that `index` is a single dot product rather than a full
+    // coordinate conversion. This is the common case for the reference kernels, which
+    // mostly iterate over whole shapes, slices and permutations.
+    m_index_is_affine = std::all_of(m_target_dilation_strides.begin(),
+                                    m_target_dilation_strides.end(),
+                                    [](size_t stride) { return stride == 1; });
+    m_index_offset = 0;
+
+    if (m_index_is_affine)
+    {
+        std::vector<size_t> row_major_strides(m_n_axes);
+        size_t stride = 1;
+
+        for (size_t axis = m_n_axes; axis-- > 0;)
+        {
+            row_major_strides[axis] = stride;
+            stride *= m_source_shape[axis];
+        }
+
+        m_index_strides.resize(m_n_axes);
+
+        for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+        {
+            size_t source_axis = m_source_axis_order[target_axis];
+
+            m_index_strides[target_axis] =
+                m_source_strides[source_axis] * row_major_strides[source_axis];
+
+            // The offset terms may individually wrap around zero, but the sum computed
+            // in `index` is exact for any coordinate that has a source coordinate.
+            m_index_offset += m_source_start_corner[source_axis] * row_major_strides[source_axis];
+            m_index_offset -= static_cast<size_t>(m_target_padding_below[target_axis]) *
+                              row_major_strides[source_axis];
+        }
+    }
 }
 
 Strides CoordinateTransform::default_strides(size_t n_axes)
@@ -292,6 +332,18 @@ size_t CoordinateTransform::index_source(const Coordinate& c) const
 // Compute the index of a target-space coordinate in thebuffer.
 size_t CoordinateTransform::index(const Coordinate& c) const
 {
+    if (m_index_is_affine)
+    {
+        size_t index = m_index_offset;
+
+        for (size_t axis = 0; axis < m_n_axes; axis++)
+        {
+            index += c[axis] * m_index_strides[axis];
+        }
+
+        return index;
+    }
+
     return index_source(to_source_coordinate(c));
 }
 
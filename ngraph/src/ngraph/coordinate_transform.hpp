@@ -113,5 +113,13 @@ namespace ngraph
         Shape m_target_shape;
         size_t m_n_axes;
         Iterator m_end_iterator;
+
+        // Fast path for `index`: when the transform has no dilation, the buffer index of
+        // a target coordinate is an affine function of the coordinate, so it can be
+        // evaluated as a single dot product with multipliers precomputed in the
+        // constructor.
+        bool m_index_is_affine;
+        size_t m_index_offset;
+        std::vector<size_t> m_index_strides;
     };
 }
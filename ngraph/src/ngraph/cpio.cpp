@@ -14,6 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "ngraph/cpio.hpp"
 #include "ngraph/log.hpp"
 
@@ -290,6 +301,195 @@ vector<char> cpio::Reader::read(const FileInfo& info)
     return buffer;
 }
 
+static uint16_t read_u16_mem(const char* data, bool big_endian = false)
+{
+    const uint8_t* ch = reinterpret_cast<const uint8_t*>(data);
+    uint16_t rc;
+    if (big_endian)
+    {
+        rc = static_cast<uint16_t>((ch[0] << 8) + ch[1]);
+    }
+    else
+    {
+        rc = static_cast<uint16_t>((ch[1] << 8) + ch[0]);
+    }
+    return rc;
+}
+
+static uint32_t read_u32_mem(const char* data, bool big_endian = false)
+{
+    // binary CPIO stores 32 bit fields as two 16 bit words, high word first
+    uint16_t sh[2];
+    sh[0] = read_u16_mem(data, big_endian);
+    sh[1] = read_u16_mem(data + 2, big_endian);
+    return (sh[0] << 16) + sh[1];
+}
+
+cpio::MappedReader::MappedReader(const string& filename)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_mapped(false)
+{
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+        {
+            void* map = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED)
+            {
+                m_data = static_cast<char*>(map);
+                m_size = file_stat.st_size;
+                m_mapped = true;
+            }
+        }
+        ::close(fd);
+    }
+#endif
+    if (!m_mapped)
+    {
+        // fall back to loading the archive into a buffer where mapping is unavailable
+        ifstream in(filename, ios_base::binary | ios_base::in);
+        if (!in)
+        {
+            throw runtime_error("error opening CPIO archive '" + filename + "'");
+        }
+        in.seekg(0, ios_base::end);
+        m_size = in.tellg();
+        in.seekg(0, ios_base::beg);
+        m_data = new char[m_size];
+        in.read(m_data, m_size);
+    }
+
+    // a binary CPIO header is 26 bytes: magic, 7 u16 attributes, mtime, namesize, filesize
+    size_t offset = 0;
+    while (offset + 26 <= m_size)
+    {
+        const char* header = m_data + offset;
+        bool big_endian;
+        uint8_t ch0 = static_cast<uint8_t>(header[0]);
+        uint8_t ch1 = static_cast<uint8_t>(header[1]);
+        if (ch0 == 0x71 && ch1 == 0xC7)
+        {
+            big_endian = true;
+        }
+        else if (ch0 == 0xC7 && ch1 == 0x71)
+        {
+            big_endian = false;
+        }
+        else if (ch0 == '0')
+        {
+            throw runtime_error("CPIO ASCII unsupported");
+        }
+        else
+        {
+            throw runtime_error("CPIO invalid file");
+        }
+
+        uint16_t namesize = read_u16_mem(header + 20, big_endian);
+        uint32_t filesize = read_u32_mem(header + 22, big_endian);
+        offset += 26;
+        if (offset + namesize > m_size)
+        {
+            throw runtime_error("CPIO invalid file");
+        }
+        // namesize includes the null string terminator so -1
+        string file_name = string(m_data + offset, namesize - 1);
+        offset += namesize + (namesize % 2);
+
+        if (file_name == "TRAILER!!!")
+        {
+            break;
+        }
+        if (offset + filesize > m_size)
+        {
+            throw runtime_error("CPIO invalid file");
+        }
+
+        m_file_info.emplace_back(file_name, filesize, offset);
+        offset += filesize + (filesize % 2);
+    }
+}
+
+cpio::MappedReader::~MappedReader()
+{
+    if (m_mapped)
+    {
+#ifndef _WIN32
+        munmap(m_data, m_size);
+#endif
+    }
+    else
+    {
+        delete[] m_data;
+    }
+}
+
+const vector<cpio::FileInfo>& cpio::MappedReader::get_file_info() const
+{
+    return m_file_info;
+}
+
+const char* cpio::MappedReader::get_data(const FileInfo& info) const
+{
+    return m_data + info.get_offset();
+}
+
+bool cpio::MappedReader::read(const string& file_name, void* data, size_t size_in_bytes) const
+{
+    bool rc = false;
+    for (const FileInfo& info : m_file_info)
+    {
+        if (info.get_name() == file_name)
+        {
+            if (size_in_bytes != info.get_size())
+            {
+                throw runtime_error("Buffer size does not match file size");
+            }
+            memcpy(data, get_data(info), size_in_bytes);
+            rc = true;
+            break;
+        }
+    }
+    return rc;
+}
+
+void cpio::MappedReader::read_all(
+    const function<void(const FileInfo&, const char*)>& handler) const
+{
+    size_t hw = thread::hardware_concurrency();
+    size_t n_threads = min(hw > 1 ? hw : 1, m_file_info.size());
+    if (n_threads <= 1)
+    {
+        for (const FileInfo& info : m_file_info)
+        {
+            handler(info, get_data(info));
+        }
+        return;
+    }
+
+    // members are handed out through a shared counter so large and small members
+    // balance across the team instead of being split into fixed ranges
+    atomic<size_t> next_member{0};
+    vector<thread> workers;
+    workers.reserve(n_threads);
+    for (size_t t = 0; t < n_threads; t++)
+    {
+        workers.emplace_back([&]() {
+            for (size_t i = next_member++; i < m_file_info.size(); i = next_member++)
+            {
+                handler(m_file_info[i], get_data(m_file_info[i]));
+            }
+        });
+    }
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
 bool cpio::is_cpio(const string& path)
 {
     ifstream in(path, ios_base::binary | ios_base::in);
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -34,6 +35,7 @@ namespace ngraph
         class FileInfo;
         class Writer;
         class Reader;
+        class MappedReader;
 
         bool is_cpio(const std::string&);
         bool is_cpio(std::istream&);
@@ -117,3 +119,33 @@ private:
     std::ifstream m_my_stream;
     std::vector<cpio::FileInfo> m_file_info;
 };
+
+/// \brief Reader over a memory-mapped CPIO archive.
+///
+/// The whole archive is mapped into memory once (or, on platforms without mapping
+/// support, loaded into a buffer) and the member index is built up front, so
+/// get_data() hands out pointers straight into the mapping and members can be
+/// extracted in any order and from several threads at once without seeking a
+/// shared stream. read_all() extracts every member on a temporary team of threads.
+class NGRAPH_API ngraph::cpio::MappedReader
+{
+public:
+    MappedReader(const std::string& filename);
+    ~MappedReader();
+
+    const std::vector<FileInfo>& get_file_info() const;
+    /// \brief Returns a pointer into the mapped archive at the start of the member's data.
+    ///        The pointer stays valid for the lifetime of the reader.
+    const char* get_data(const FileInfo& info) const;
+    bool read(const std::string& file_name, void* data, size_t size_in_bytes) const;
+    /// \brief Calls `handler` once for every member with its info and data pointer.
+    ///        The calls run on a temporary team of threads, so the handler may be
+    ///        invoked concurrently for different members and must not throw.
+    void read_all(const std::function<void(const FileInfo&, const char*)>& handler) const;
+
+private:
+    char* m_data;
+    size_t m_size;
+    bool m_mapped;
+    std::vector<cpio::FileInfo> m_file_info;
+};
@@ -57,6 +57,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->set_needs_validation(true);
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -16,6 +16,7 @@
 
 #include "ngraph/distributed.hpp"
 #include "ngraph/distributed/null.hpp"
+#include "ngraph/distributed/socket.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/type.hpp"
 
@@ -54,8 +55,16 @@ DistributedInterface* ngraph::get_distributed_interface()
 {
     if (nullptr == s_distributed_interface)
     {
-        set_distributed_interface(
-            std::unique_ptr<DistributedInterface>(new ngraph::distributed::Null()));
+        if (distributed::Socket::available())
+        {
+            set_distributed_interface(
+                std::unique_ptr<DistributedInterface>(new ngraph::distributed::Socket()));
+        }
+        else
+        {
+            set_distributed_interface(
+                std::unique_ptr<DistributedInterface>(new ngraph::distributed::Null()));
+        }
     }
     return s_distributed_interface.get();
 }
@@ -0,0 +1,398 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ngraph/distributed/socket.hpp"
+#include "ngraph/except.hpp"
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <chrono>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+using namespace ngraph;
+
+bool distributed::Socket::available()
+{
+#ifdef _WIN32
+    return false;
+#else
+    return nullptr != std::getenv("NGRAPH_SOCKET_PEERS");
+#endif
+}
+
+const std::string& distributed::Socket::get_name() const
+{
+    return m_name;
+}
+
+int distributed::Socket::get_size()
+{
+    return m_size;
+}
+
+int distributed::Socket::get_rank()
+{
+    return m_rank;
+}
+
+#ifdef _WIN32
+
+distributed::Socket::Socket()
+{
+    throw ngraph_error("Socket distributed interface is not supported on this platform");
+}
+
+distributed::Socket::~Socket() = default;
+
+void distributed::Socket::all_reduce(void*, void*, element::Type_t, reduction::Type, size_t)
+{
+    throw ngraph_error("Socket distributed interface is not supported on this platform");
+}
+
+void distributed::Socket::broadcast(void*, element::Type_t, size_t, int)
+{
+    throw ngraph_error("Socket distributed interface is not supported on this platform");
+}
+
+void distributed::Socket::recv(void*, element::Type_t, size_t, int)
+{
+    throw ngraph_error("Socket distributed interface is not supported on this platform");
+}
+
+void distributed::Socket::send(const void*, element::Type_t, size_t, int)
+{
+    throw ngraph_error("Socket distributed interface is not supported on this platform");
+}
+
+int distributed::Socket::connection(int)
+{
+    return -1;
+}
+
+void distributed::Socket::write_bytes(int, const void*, size_t)
+{
+}
+
+void distributed::Socket::read_bytes(int, void*, size_t)
+{
+}
+
+#else
+
+distributed::Socket::Socket()
+{
+    const char* peers_env = std::getenv("NGRAPH_SOCKET_PEERS");
+    if (peers_env == nullptr)
+    {
+        throw ngraph_error("NGRAPH_SOCKET_PEERS is not set");
+    }
+    std::string peers{peers_env};
+    size_t pos = 0;
+    while (pos <= peers.size())
+    {
+        size_t comma = peers.find(',', pos);
+        if (comma == std::string::npos)
+        {
+            comma = peers.size();
+        }
+        std::string peer = peers.substr(pos, comma - pos);
+        size_t colon = peer.rfind(':');
+        if (colon == std::string::npos)
+        {
+            throw ngraph_error("NGRAPH_SOCKET_PEERS entry '" + peer + "' is not host:port");
+        }
+        m_peers.emplace_back(peer.substr(0, colon), std::stoi(peer.substr(colon + 1)));
+        pos = comma + 1;
+    }
+    m_size = static_cast<int>(m_peers.size());
+
+    const char* rank_env = std::getenv("NGRAPH_SOCKET_RANK");
+    m_rank = rank_env ? std::stoi(rank_env) : 0;
+    if (m_rank < 0 || m_rank >= m_size)
+    {
+        throw ngraph_error("NGRAPH_SOCKET_RANK is outside of the peer list");
+    }
+
+    m_listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listen_fd < 0)
+    {
+        throw ngraph_error("Cannot create the listen socket");
+    }
+    int reuse = 1;
+    setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(static_cast<uint16_t>(m_peers[m_rank].second));
+    if (::bind(m_listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        ::listen(m_listen_fd, m_size) < 0)
+    {
+        ::close(m_listen_fd);
+        throw ngraph_error("Cannot listen on port " +
+                           std::to_string(m_peers[m_rank].second));
+    }
+}
+
+distributed::Socket::~Socket()
+{
+    for (auto& connection : m_connections)
+    {
+        ::close(connection.second);
+    }
+    if (m_listen_fd >= 0)
+    {
+        ::close(m_listen_fd);
+    }
+}
+
+int distributed::Socket::connection(int peer)
+{
+    if (peer == m_rank || peer < 0 || peer >= m_size)
+    {
+        throw ngraph_error("Invalid peer rank " + std::to_string(peer));
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_connections.find(peer);
+    if (found != m_connections.end())
+    {
+        return found->second;
+    }
+
+    if (peer < m_rank)
+    {
+        // the higher rank dials; the peer may not have started yet, so retry
+        addrinfo hints;
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* result = nullptr;
+        if (getaddrinfo(m_peers[peer].first.c_str(),
+                        std::to_string(m_peers[peer].second).c_str(),
+                        &hints,
+                        &result) != 0 ||
+            result == nullptr)
+        {
+            throw ngraph_error("Cannot resolve peer host " + m_peers[peer].first);
+        }
+        int fd = -1;
+        for (int attempt = 0; attempt < 600; attempt++)
+        {
+            fd = ::socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+            if (fd >= 0 && ::connect(fd, result->ai_addr, result->ai_addrlen) == 0)
+            {
+                break;
+            }
+            if (fd >= 0)
+            {
+                ::close(fd);
+                fd = -1;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        freeaddrinfo(result);
+        if (fd < 0)
+        {
+            throw ngraph_error("Cannot connect to peer rank " + std::to_string(peer));
+        }
+        int nodelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+        uint32_t handshake = htonl(static_cast<uint32_t>(m_rank));
+        if (::write(fd, &handshake, sizeof(handshake)) != sizeof(handshake))
+        {
+            ::close(fd);
+            throw ngraph_error("Handshake with peer rank " + std::to_string(peer) + " failed");
+        }
+        m_connections[peer] = fd;
+        return fd;
+    }
+
+    // the lower rank accepts until the wanted peer has dialed in; connections
+    // from other ranks arriving meanwhile are kept for their later use
+    while (m_connections.find(peer) == m_connections.end())
+    {
+        int fd = ::accept(m_listen_fd, nullptr, nullptr);
+        if (fd < 0)
+        {
+            throw ngraph_error("accept() failed while waiting for peer rank " +
+                               std::to_string(peer));
+        }
+        int nodelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+        uint32_t handshake = 0;
+        if (::read(fd, &handshake, sizeof(handshake)) != sizeof(handshake))
+        {
+            ::close(fd);
+            throw ngraph_error("Handshake read failed");
+        }
+        m_connections[static_cast<int>(ntohl(handshake))] = fd;
+    }
+    return m_connections[peer];
+}
+
+void distributed::Socket::write_bytes(int peer, const void* data, size_t size)
+{
+    int fd = connection(peer);
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0)
+    {
+        ssize_t written = ::write(fd, bytes, size);
+        if (written <= 0)
+        {
+            throw ngraph_error("Connection to peer rank " + std::to_string(peer) + " is broken");
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void distributed::Socket::read_bytes(int peer, void* data, size_t size)
+{
+    int fd = connection(peer);
+    char* bytes = static_cast<char*>(data);
+    while (size > 0)
+    {
+        ssize_t got = ::read(fd, bytes, size);
+        if (got <= 0)
+        {
+            throw ngraph_error("Connection to peer rank " + std::to_string(peer) + " is broken");
+        }
+        bytes += got;
+        size -= static_cast<size_t>(got);
+    }
+}
+
+namespace
+{
+    template <typename T>
+    void reduce_typed(const void* in, void* inout, reduction::Type reduce_type, size_t count)
+    {
+        const T* src = static_cast<const T*>(in);
+        T* dst = static_cast<T*>(inout);
+        for (size_t i = 0; i < count; i++)
+        {
+            switch (reduce_type)
+            {
+            case reduction::Type::SUM: dst[i] = dst[i] + src[i]; break;
+            case reduction::Type::PROD: dst[i] = dst[i] * src[i]; break;
+            case reduction::Type::MIN: dst[i] = src[i] < dst[i] ? src[i] : dst[i]; break;
+            case reduction::Type::MAX: dst[i] = src[i] > dst[i] ? src[i] : dst[i]; break;
+            }
+        }
+    }
+
+    void reduce_buffers(const void* in,
+                        void* inout,
+                        element::Type_t element_type,
+                        reduction::Type reduce_type,
+                        size_t count)
+    {
+        switch (element_type)
+        {
+        case element::Type_t::f32: reduce_typed<float>(in, inout, reduce_type, count); break;
+        case element::Type_t::f64: reduce_typed<double>(in, inout, reduce_type, count); break;
+        case element::Type_t::i32: reduce_typed<int32_t>(in, inout, reduce_type, count); break;
+        case element::Type_t::i64: reduce_typed<int64_t>(in, inout, reduce_type, count); break;
+        default:
+            throw ngraph_error("Socket all_reduce does not support element type " +
+                               element::Type(element_type).get_type_name());
+        }
+    }
+}
+
+void distributed::Socket::all_reduce(
+    void* in, void* out, element::Type_t element_type, reduction::Type reduce_type, size_t count)
+{
+    size_t size = count * element::Type(element_type).size();
+    if (m_size < 2)
+    {
+        if (in != out)
+        {
+            std::memcpy(out, in, size);
+        }
+        return;
+    }
+
+    if (m_rank != 0)
+    {
+        write_bytes(0, in, size);
+        read_bytes(0, out, size);
+        return;
+    }
+
+    if (in != out)
+    {
+        std::memcpy(out, in, size);
+    }
+    std::vector<char> partial(size);
+    for (int peer = 1; peer < m_size; peer++)
+    {
+        read_bytes(peer, partial.data(), size);
+        reduce_buffers(partial.data(), out, element_type, reduce_type, count);
+    }
+    for (int peer = 1; peer < m_size; peer++)
+    {
+        write_bytes(peer, out, size);
+    }
+}
+
+void distributed::Socket::broadcast(void* in,
+                                    element::Type_t element_type,
+                                    size_t count,
+                                    int root_id)
+{
+    size_t size = count * element::Type(element_type).size();
+    if (m_rank == root_id)
+    {
+        for (int peer = 0; peer < m_size; peer++)
+        {
+            if (peer != m_rank)
+            {
+                write_bytes(peer, in, size);
+            }
+        }
+    }
+    else
+    {
+        read_bytes(root_id, in, size);
+    }
+}
+
+void distributed::Socket::recv(void* in, element::Type_t element_type, size_t count, int src_id)
+{
+    read_bytes(src_id, in, count * element::Type(element_type).size());
+}
+
+void distributed::Socket::send(const void* in,
+                               element::Type_t element_type,
+                               size_t count,
+                               int dest_id)
+{
+    write_bytes(dest_id, in, count * element::Type(element_type).size());
+}
+
+#endif
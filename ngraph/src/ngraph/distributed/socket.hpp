@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief Plain TCP implementation of the distributed interface.
+        ///
+        /// Needs no external communication library: the process group is described by
+        /// environment variables and the ranks talk over lazily established socket
+        /// connections (the higher rank connects, the lower rank accepts, a handshake
+        /// carries the connecting rank):
+        ///
+        ///     NGRAPH_SOCKET_PEERS  comma separated "host:port" listen endpoints,
+        ///                          one per rank, in rank order
+        ///     NGRAPH_SOCKET_RANK   the rank of this process in the peer list
+        ///
+        /// all_reduce gathers the partial buffers on rank 0 and broadcasts the reduced
+        /// result, which suits small process groups scaled out for memory rather than
+        /// for communication throughput. POSIX only.
+        class Socket : public DistributedInterface
+        {
+        public:
+            /// \brief Whether the environment describes a socket process group
+            static bool available();
+
+            Socket();
+            ~Socket() override;
+
+            const std::string& get_name() const override;
+            int get_size() override;
+            int get_rank() override;
+
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count) override;
+
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id) override;
+
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override;
+
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_id) override;
+
+        protected:
+            std::string m_name{"SOCKET"};
+
+        private:
+            int connection(int peer);
+            void write_bytes(int peer, const void* data, size_t size);
+            void read_bytes(int peer, void* data, size_t size);
+
+            int m_rank = 0;
+            int m_size = 1;
+            int m_listen_fd = -1;
+            std::vector<std::pair<std::string, int>> m_peers;
+            std::map<int, int> m_connections;
+            std::mutex m_mutex;
+        };
+    }
+}
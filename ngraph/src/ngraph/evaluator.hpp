@@ -16,9 +16,16 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <exception>
 #include <map>
+#include <mutex>
 #include <stack>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "ngraph/node.hpp"
 #include "ngraph/shape.hpp"
@@ -204,6 +211,164 @@ namespace ngraph
             return m_value_map.at(value);
         }
 
+        /// \brief Determine information about value, dispatching ready ops to worker threads
+        ///
+        /// Ops whose arguments are all available are executed concurrently on num_threads
+        /// threads (the calling thread included), respecting data dependencies, so wide
+        /// graphs use all cores. Handlers may run concurrently and must be thread-safe;
+        /// with num_threads of 0 or 1 the single threaded depth-first schedule is used.
+        V evaluate_parallel(const Output<Node>& value,
+                            size_t num_threads = std::thread::hardware_concurrency())
+        {
+            if (num_threads <= 1)
+            {
+                return evaluate(value);
+            }
+
+            // Discover the not-yet-computed subgraph feeding the value. Ops without a
+            // handler are resolved right away, exactly as in the depth-first schedule.
+            std::vector<Node*> pending_order;
+            std::unordered_set<Node*> seen;
+            std::stack<Node*> discover;
+            discover.push(value.get_node());
+            while (!discover.empty())
+            {
+                Node* node = discover.top();
+                discover.pop();
+                if (!seen.insert(node).second)
+                {
+                    continue;
+                }
+                if (m_value_map.find(node->output(0)) != m_value_map.end())
+                {
+                    // Already computed
+                    continue;
+                }
+                if (!get_handler(node))
+                {
+                    // We don't know how to handle this op, so mark the outputs as unknown
+                    for (auto output : node->outputs())
+                    {
+                        m_value_map[output] = V();
+                    }
+                    continue;
+                }
+                pending_order.push_back(node);
+                for (auto v : node->input_values())
+                {
+                    discover.push(v.get_node());
+                }
+            }
+
+            if (pending_order.size() <= 1)
+            {
+                return evaluate(value);
+            }
+
+            // Count the pending arguments of every pending op; ops with none are ready.
+            // Duplicated arguments are counted per edge and notified per edge below.
+            const std::unordered_set<Node*> pending(pending_order.begin(), pending_order.end());
+            std::unordered_map<Node*, size_t> remaining_args;
+            std::unordered_map<Node*, std::vector<Node*>> dependents;
+            std::vector<Node*> ready;
+            for (Node* node : pending_order)
+            {
+                size_t args = 0;
+                for (auto v : node->input_values())
+                {
+                    Node* arg = v.get_node();
+                    if (pending.count(arg) > 0)
+                    {
+                        ++args;
+                        dependents[arg].push_back(node);
+                    }
+                }
+                remaining_args[node] = args;
+                if (args == 0)
+                {
+                    ready.push_back(node);
+                }
+            }
+
+            std::mutex mutex;
+            std::condition_variable ready_cond;
+            size_t remaining_ops = pending_order.size();
+            std::exception_ptr error;
+
+            auto worker = [&]() {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (true)
+                {
+                    ready_cond.wait(lock, [&] {
+                        return error || remaining_ops == 0 || !ready.empty();
+                    });
+                    if (error || remaining_ops == 0)
+                    {
+                        return;
+                    }
+                    Node* node = ready.back();
+                    ready.pop_back();
+                    op_handler handler = get_handler(node);
+                    std::vector<V> inputs;
+                    for (auto v : node->input_values())
+                    {
+                        inputs.push_back(m_value_map.at(v));
+                    }
+                    // The handler runs without the lock so independent ops overlap
+                    lock.unlock();
+                    std::vector<V> outputs;
+                    try
+                    {
+                        outputs = handler(node, inputs);
+                    }
+                    catch (...)
+                    {
+                        lock.lock();
+                        if (!error)
+                        {
+                            error = std::current_exception();
+                        }
+                        ready_cond.notify_all();
+                        return;
+                    }
+                    lock.lock();
+                    for (size_t i = 0; i < outputs.size(); ++i)
+                    {
+                        m_value_map[node->output(i)] = outputs[i];
+                    }
+                    auto it = dependents.find(node);
+                    if (it != dependents.end())
+                    {
+                        for (Node* dependent : it->second)
+                        {
+                            if (--remaining_args.at(dependent) == 0)
+                            {
+                                ready.push_back(dependent);
+                            }
+                        }
+                    }
+                    --remaining_ops;
+                    ready_cond.notify_all();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (size_t i = 1; i < num_threads; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            return m_value_map.at(value);
+        }
+
     protected:
         op_handler m_universal_handler;
         op_handler_map m_handlers;
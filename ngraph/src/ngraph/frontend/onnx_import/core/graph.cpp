@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <exception>
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <thread>
+#include <unordered_set>
 
 #include "graph.hpp"
 #include "node.hpp"
@@ -94,24 +97,110 @@ namespace ngraph
             }
         } // namespace detail
 
-        Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto, Model& model)
+        Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto,
+                     Model& model,
+                     const std::string& model_dir)
             : m_graph_proto{&graph_proto}
             , m_model{&model}
+            , m_model_dir{model_dir}
         {
+            // Names referenced by graph nodes, outputs or inputs: only those
+            // initializers are decoded eagerly. The remaining ones are
+            // materialized lazily in get_ng_node_from_cache, so initializers
+            // nothing ever asks for are never decoded at all.
+            std::unordered_set<std::string> referenced_names;
+            for (const auto& node_proto : m_graph_proto->node())
+            {
+                for (const auto& input_name : node_proto.input())
+                {
+                    referenced_names.insert(input_name);
+                }
+            }
+            for (const auto& output : m_graph_proto->output())
+            {
+                referenced_names.insert(output.name());
+            }
+            for (const auto& input : m_graph_proto->input())
+            {
+                referenced_names.insert(input.name());
+            }
+
             // Process all initializers in the graph
+            std::vector<const Tensor*> tensors_to_decode;
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    m_initializers.emplace(initializer_tensor.name(), tensor);
+                    const auto it = m_initializers
+                                        .emplace(initializer_tensor.name(),
+                                                 Tensor{initializer_tensor, m_model_dir})
+                                        .first;
+                    // External-data tensors keep only a (file, offset, length)
+                    // reference at this point and are excluded from the eager
+                    // decode below: the side file is read in
+                    // get_ng_node_from_cache, when a consumer actually wires
+                    // the initializer into the graph.
+                    if (referenced_names.count(initializer_tensor.name()) > 0 &&
+                        !it->second.has_external_data())
+                    {
+                        tensors_to_decode.push_back(&it->second);
+                    }
+                }
+            }
 
-                    // For each initializer, create a Constant node and store in cache
-                    auto ng_constant = tensor.get_ng_constant();
-                    add_provenance_tag_to_initializer(tensor, ng_constant);
-                    m_ng_node_cache.emplace(initializer_tensor.name(), std::move(ng_constant));
+            // Create the Constant nodes and store them in cache. Raw data
+            // conversion dominates import time of large models and every
+            // initializer is independent, so the decoding is spread across
+            // threads.
+            std::vector<std::shared_ptr<default_opset::Constant>> constants(
+                tensors_to_decode.size());
+            const std::size_t num_threads =
+                std::min<std::size_t>(std::max<unsigned int>(std::thread::hardware_concurrency(), 1),
+                                      tensors_to_decode.size());
+            if (num_threads > 1)
+            {
+                std::vector<std::thread> workers;
+                std::vector<std::exception_ptr> errors(num_threads);
+                for (std::size_t t = 0; t < num_threads; ++t)
+                {
+                    workers.emplace_back([&, t] {
+                        try
+                        {
+                            for (std::size_t i = t; i < tensors_to_decode.size(); i += num_threads)
+                            {
+                                constants[i] = tensors_to_decode[i]->get_ng_constant();
+                            }
+                        }
+                        catch (...)
+                        {
+                            errors[t] = std::current_exception();
+                        }
+                    });
+                }
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+                for (const auto& error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < tensors_to_decode.size(); ++i)
+                {
+                    constants[i] = tensors_to_decode[i]->get_ng_constant();
                 }
             }
+            for (std::size_t i = 0; i < tensors_to_decode.size(); ++i)
+            {
+                add_provenance_tag_to_initializer(*tensors_to_decode[i], constants[i]);
+                m_ng_node_cache.emplace(tensors_to_decode[i]->get_name(), std::move(constants[i]));
+            }
 
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
             for (const auto& input : m_graph_proto->input())
@@ -124,6 +213,14 @@ namespace ngraph
                     continue;
                 }
 
+                // An input shadowed by a not-yet-decoded initializer (external
+                // data) becomes a Constant through the lazy path instead of a
+                // Parameter here
+                if (m_initializers.count(input.name()) > 0)
+                {
+                    continue;
+                }
+
                 const auto value_info = m_inputs.back();
                 auto ng_node = value_info.get_ng_node(m_parameters, m_initializers);
                 add_provenance_tag_to_input(value_info, ng_node);
@@ -186,6 +283,28 @@ namespace ngraph
             }
         }
 
+        std::shared_ptr<ngraph::Node>
+            Graph::get_ng_node_from_cache(const std::string& name) const
+        {
+            const auto it = m_ng_node_cache.find(name);
+            if (it != m_ng_node_cache.end())
+            {
+                return it->second;
+            }
+            const auto initializer = m_initializers.find(name);
+            if (initializer == m_initializers.end())
+            {
+                // keep the behaviour of the former `m_ng_node_cache.at(name)`
+                return m_ng_node_cache.at(name);
+            }
+            // an initializer which was not referenced when the graph was built;
+            // materialize it on first use
+            auto ng_constant = initializer->second.get_ng_constant();
+            add_provenance_tag_to_initializer(initializer->second, ng_constant);
+            m_ng_node_cache.emplace(name, ng_constant);
+            return std::move(ng_constant);
+        }
+
         NodeVector Graph::get_ng_outputs() const
         {
             NodeVector results;
@@ -33,16 +33,15 @@ namespace ngraph
         class Graph
         {
         public:
-            Graph(const ONNX_NAMESPACE::GraphProto& proto, Model& model);
+            Graph(const ONNX_NAMESPACE::GraphProto& proto,
+                  Model& model,
+                  const std::string& model_dir = "");
             const std::vector<Node>& get_nodes() const { return m_nodes; }
             const std::vector<ValueInfo>& get_inputs() const { return m_inputs; }
             const std::vector<ValueInfo>& get_outputs() const { return m_outputs; }
             NodeVector get_ng_outputs() const;
             const ParameterVector& get_ng_parameters() const { return m_parameters; }
-            std::shared_ptr<ngraph::Node> get_ng_node_from_cache(const std::string& name) const
-            {
-                return m_ng_node_cache.at(name);
-            }
+            std::shared_ptr<ngraph::Node> get_ng_node_from_cache(const std::string& name) const;
             const std::string& get_name() const { return m_graph_proto->name(); }
             NodeVector make_ng_nodes(const Node& onnx_node) const;
 
@@ -63,9 +62,14 @@ namespace ngraph
             std::vector<ValueInfo> m_inputs;
             std::vector<ValueInfo> m_outputs;
             ParameterVector m_parameters;
-            std::map<std::string, std::shared_ptr<ngraph::Node>> m_ng_node_cache;
+            // mutable: initializers which nothing referenced at import time are
+            // materialized lazily by get_ng_node_from_cache
+            mutable std::map<std::string, std::shared_ptr<ngraph::Node>> m_ng_node_cache;
             std::map<std::string, Tensor> m_initializers;
             Model* m_model;
+            // directory the model file was loaded from; external data locations
+            // of the initializers are resolved against it
+            std::string m_model_dir;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Graph& graph)
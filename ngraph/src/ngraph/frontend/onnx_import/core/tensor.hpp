@@ -23,6 +23,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -384,9 +385,11 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::string model_dir = "")
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_model_dir{std::move(model_dir)}
             {
                 if (m_shape == Shape{0})
                 {
@@ -404,6 +407,19 @@ namespace ngraph
             Tensor& operator=(Tensor&&) = delete;
 
             const Shape& get_shape() const { return m_shape; }
+            /// \brief      Checks whether the tensor bytes live in a side file.
+            ///
+            ///             Such a tensor carries only a (file, offset, length)
+            ///             reference; nothing is read from disk until get_data
+            ///             (or get_ng_constant) is called on it.
+            bool has_external_data() const
+            {
+                return m_tensor_proto->has_data_location() &&
+                       m_tensor_proto->data_location() ==
+                           ONNX_NAMESPACE::TensorProto_DataLocation::
+                               TensorProto_DataLocation_EXTERNAL;
+            }
+
             template <typename T>
             std::vector<T> get_data() const
             {
@@ -411,6 +427,16 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (has_external_data())
+                {
+                    // this is the only place the side file is touched: the
+                    // referenced byte range is pulled in on demand and decoded
+                    // exactly like the raw_data field of an internal tensor
+                    const auto raw_data =
+                        TensorExternalData{*m_tensor_proto}.load_external_data(m_model_dir);
+                    return detail::tensor::detail::__get_raw_data<T>(raw_data,
+                                                                     m_tensor_proto->data_type());
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -518,6 +544,9 @@ namespace ngraph
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            // directory external data locations are resolved against; empty for
+            // tensors coming from streams or attributes
+            std::string m_model_dir;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
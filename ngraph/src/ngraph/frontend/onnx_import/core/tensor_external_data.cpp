@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+
+#include "tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+        {
+            for (const auto& entry : tensor.external_data())
+            {
+                if (entry.key() == "location")
+                {
+                    m_data_location = entry.value();
+                }
+                else if (entry.key() == "offset")
+                {
+                    m_offset = std::stoull(entry.value());
+                }
+                else if (entry.key() == "length")
+                {
+                    m_data_length = std::stoull(entry.value());
+                }
+                else if (entry.key() == "checksum")
+                {
+                    m_sha1_digest = entry.value();
+                }
+            }
+            if (m_data_location.empty())
+            {
+                throw error::external_data::unspecified_location{};
+            }
+        }
+
+        std::string TensorExternalData::load_external_data(const std::string& model_dir) const
+        {
+            const auto full_path =
+                model_dir.empty() ? m_data_location : model_dir + "/" + m_data_location;
+            std::ifstream external_data_stream{full_path,
+                                               std::ios::binary | std::ios::in | std::ios::ate};
+            if (!external_data_stream.is_open())
+            {
+                throw error::external_data::file_open{full_path};
+            }
+
+            std::uint64_t read_data_length = m_data_length;
+            if (read_data_length == 0)
+            {
+                const auto file_size =
+                    static_cast<std::uint64_t>(external_data_stream.tellg());
+                read_data_length = file_size - m_offset;
+            }
+
+            std::string read_data;
+            read_data.resize(read_data_length);
+            external_data_stream.seekg(m_offset, std::ios::beg);
+            external_data_stream.read(&read_data[0], read_data_length);
+            if (external_data_stream.fail() ||
+                static_cast<std::uint64_t>(external_data_stream.gcount()) != read_data_length)
+            {
+                throw error::external_data::data_read{full_path};
+            }
+            return read_data;
+        }
+    }
+}
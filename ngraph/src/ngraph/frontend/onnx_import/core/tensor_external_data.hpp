@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <onnx/onnx_pb.h>
+#include <cstdint>
+#include <string>
+
+#include "ngraph/except.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace external_data
+            {
+                struct file_open : ngraph_error
+                {
+                    explicit file_open(const std::string& path)
+                        : ngraph_error{"Failure opening external data file: " + path}
+                    {
+                    }
+                };
+
+                struct data_read : ngraph_error
+                {
+                    explicit data_read(const std::string& path)
+                        : ngraph_error{"Failure reading external data from file: " + path}
+                    {
+                    }
+                };
+
+                struct unspecified_location : ngraph_error
+                {
+                    unspecified_location()
+                        : ngraph_error{"externally stored tensor specifies no data location"}
+                    {
+                    }
+                };
+            }
+        }
+
+        /// \brief      A reference to tensor bytes stored outside of the model file.
+        ///
+        ///             Only the (location, offset, length) triple recorded in the
+        ///             initializer is kept; the referenced file is opened and read
+        ///             exclusively by load_external_data, i.e. when a consumer
+        ///             actually asks for the tensor contents.
+        class TensorExternalData
+        {
+        public:
+            TensorExternalData() = delete;
+            explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+            /// \brief      Reads the referenced byte range from the side file.
+            ///
+            /// \param[in]  model_dir  The directory the model file was loaded from;
+            ///                        relative data locations are resolved against it.
+            ///
+            /// \return     A buffer with the raw tensor bytes, laid out exactly as
+            ///             the raw_data field of an internally stored tensor.
+            std::string load_external_data(const std::string& model_dir) const;
+
+            const std::string& get_data_location() const { return m_data_location; }
+            std::uint64_t get_offset() const { return m_offset; }
+            std::uint64_t get_data_length() const { return m_data_length; }
+
+        private:
+            std::string m_data_location;
+            // offset 0 and length 0 follow the ONNX convention: read the whole
+            // file starting from its beginning
+            std::uint64_t m_offset = 0;
+            std::uint64_t m_data_length = 0;
+            std::string m_sha1_digest;
+        };
+    }
+}
@@ -50,34 +50,48 @@ namespace ngraph
                 };
 
             } // namespace error
-        }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
-        {
-            ONNX_NAMESPACE::ModelProto model_proto;
-            // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            static ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& stream)
             {
-                // Rewind to the beginning and clear stream state.
-                stream.clear();
-                stream.seekg(0);
-                google::protobuf::io::IstreamInputStream iistream(&stream);
-                // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                ONNX_NAMESPACE::ModelProto model_proto;
+                // Try parsing input as a binary protobuf message
+                if (!model_proto.ParseFromIstream(&stream))
                 {
-                    throw detail::error::stream_parse{stream};
+                    // Rewind to the beginning and clear stream state.
+                    stream.clear();
+                    stream.seekg(0);
+                    google::protobuf::io::IstreamInputStream iistream(&stream);
+                    // Try parsing input as a prototxt message
+                    if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                    {
+                        throw detail::error::stream_parse{stream};
+                    }
                 }
+                return model_proto;
             }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
+            static std::shared_ptr<Function>
+                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto,
+                                       const std::string& model_dir)
             {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                Model model{model_proto};
+                Graph graph{model_proto.graph(), model, model_dir};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
+                {
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
+                }
+                return function;
             }
-            return function;
+        } // namespace detail
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            // a stream carries no location: external data files can be referenced
+            // only by paths valid as-is (absolute or relative to the working dir)
+            return detail::convert_to_ng_function(detail::parse_from_istream(stream), "");
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -87,7 +101,12 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            // external data locations are resolved relative to the model file
+            const auto last_separator = file_path.find_last_of("/\\");
+            const auto model_dir = last_separator == std::string::npos
+                                       ? std::string{}
+                                       : file_path.substr(0, last_separator);
+            return detail::convert_to_ng_function(detail::parse_from_istream(ifs), model_dir);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
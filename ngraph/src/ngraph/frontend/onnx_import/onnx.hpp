@@ -62,6 +62,10 @@ namespace ngraph
         /// \note       If stream parsing fails or the ONNX model contains unsupported ops,
         ///             the function throws an ngraph_error exception.
         ///
+        /// \note       A stream carries no location, so initializers stored as external
+        ///             data can only reference files by paths valid as-is from the
+        ///             working directory. Prefer the file path overload for such models.
+        ///
         /// \param[in]  stream    The input stream (e.g. file stream, memory stream, etc).
         ///
         /// \return     An nGraph function that represents a single output from the created graph.
@@ -74,6 +78,10 @@ namespace ngraph
         /// \note      If file parsing fails or the ONNX model contains unsupported ops,
         ///            the function throws an ngraph_error exception.
         ///
+        /// \note      Initializers stored as external data are resolved relative to the
+        ///            model file and read lazily, when a consumer first asks for their
+        ///            contents.
+        ///
         /// \param[in] file_path  The path to a file containing the ONNX model
         ///                       (relative or absolute).
         ///
@@ -15,12 +15,17 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
 #include <list>
 #include <memory>
+#include <sstream>
+#include <unordered_map>
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -76,11 +81,183 @@ Function::Function(const std::shared_ptr<Node>& result,
 {
 }
 
+namespace
+{
+    // Flattens the attributes of a node into a stream for use as part of a validation cache key.
+    // Attributes which the flat form cannot capture (sub-graphs, node references, raw data) mark
+    // the node as not cacheable via ok().
+    class ValidationKeySerializer : public AttributeVisitor
+    {
+    public:
+        ValidationKeySerializer(std::ostream& out)
+            : m_out(out)
+        {
+        }
+        void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override
+        {
+            m_ok = false;
+        }
+        void on_adapter(const std::string& name, ValueAccessor<bool>& adapter) override
+        {
+            m_out << name << '=' << adapter.get() << ';';
+        }
+        void on_adapter(const std::string& name, ValueAccessor<std::string>& adapter) override
+        {
+            m_out << name << '=' << adapter.get() << ';';
+        }
+        void on_adapter(const std::string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            m_out << name << '=' << adapter.get() << ';';
+        }
+        void on_adapter(const std::string& name, ValueAccessor<double>& adapter) override
+        {
+            m_out << name << '=' << adapter.get() << ';';
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<int64_t>>& adapter) override
+        {
+            append_vector(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<uint64_t>>& adapter) override
+        {
+            append_vector(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<float>>& adapter) override
+        {
+            append_vector(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<double>>& adapter) override
+        {
+            append_vector(name, adapter.get());
+        }
+        void on_adapter(const std::string& name,
+                        ValueAccessor<std::vector<std::string>>& adapter) override
+        {
+            append_vector(name, adapter.get());
+        }
+        bool ok() const { return m_ok; }
+    private:
+        template <typename T>
+        void append_vector(const std::string& name, const std::vector<T>& values)
+        {
+            m_out << name << '=';
+            for (auto& value : values)
+            {
+                m_out << value << ',';
+            }
+            m_out << ';';
+        }
+
+        std::ostream& m_out;
+        bool m_ok = true;
+    };
+
+    // Builds a cache key covering everything the shape inference of a well-behaved node may read
+    // except the values of shape-relevant constant inputs, which are compared against the cached
+    // representative at replay time (relevance is only known after the representative validated)
+    bool make_validation_key(Node& node, std::string& key)
+    {
+        std::ostringstream buf;
+        const auto& type = node.get_type_info();
+        buf << type.name << ':' << type.version << '|';
+        ValidationKeySerializer serializer(buf);
+        if (!node.visit_attributes(serializer) || !serializer.ok())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < node.get_input_size(); i++)
+        {
+            buf << '|' << node.get_input_element_type(i) << ' '
+                << node.get_input_partial_shape(i);
+        }
+        key = buf.str();
+        return true;
+    }
+
+    bool constant_values_match(Node& node, Node& rep, size_t input_index)
+    {
+        auto* node_const = dynamic_cast<op::Constant*>(node.input_value(input_index).get_node());
+        auto* rep_const = dynamic_cast<op::Constant*>(rep.input_value(input_index).get_node());
+        if (node_const == nullptr || rep_const == nullptr)
+        {
+            // not a literal: safe only when both nodes read the very same tensor
+            return node.input_value(input_index) == rep.input_value(input_index);
+        }
+        // the key already matched element types and shapes
+        size_t byte_size = shape_size(rep_const->get_shape()) *
+                           rep_const->get_output_element_type(0).size();
+        return std::memcmp(node_const->get_data_ptr(), rep_const->get_data_ptr(), byte_size) == 0;
+    }
+
+    // Copies the validation outcome of an identical, already validated node: output types and
+    // shapes plus the shape/value relevance marks of the inputs. Bails out when a shape-relevant
+    // input value differs from (or cannot be compared with) the representative's.
+    bool replay_validation(Node& node, Node& rep)
+    {
+        const auto& rep_inputs = static_cast<const Node&>(rep).get_inputs();
+        for (size_t i = 0; i < rep_inputs.size(); i++)
+        {
+            if (rep_inputs[i].get_is_relevant_to_shape() && !constant_values_match(node, rep, i))
+            {
+                return false;
+            }
+        }
+        node.set_output_size(rep.get_output_size());
+        for (size_t i = 0; i < rep.get_output_size(); i++)
+        {
+            node.set_output_type(
+                i, rep.get_output_element_type(i), rep.get_output_partial_shape(i));
+        }
+        for (size_t i = 0; i < rep_inputs.size(); i++)
+        {
+            node.set_input_is_relevant_to_shape(i, rep_inputs[i].get_is_relevant_to_shape());
+            node.set_input_is_relevant_to_value(i, rep_inputs[i].get_is_relevant_to_value());
+        }
+        node.set_needs_validation(false);
+        return true;
+    }
+}
+
 void Function::validate_nodes_and_infer_types()
 {
+    // Validation results are memoized within this pass: graphs made of repeated identical blocks
+    // re-run the same shape arithmetic once per unique (op type, attributes, input shapes/types)
+    // combination instead of once per node. A node whose validation mutates its attributes
+    // (e.g. auto-computed paddings) disqualifies its key from replay, since replay would skip
+    // that mutation.
+    struct CacheEntry
+    {
+        Node* rep;
+        bool replayable;
+    };
+    std::unordered_map<std::string, CacheEntry> cache;
+
     for (auto& node : get_ordered_ops())
     {
-        node->revalidate_and_infer_types();
+        std::string key;
+        const bool has_key = make_validation_key(*node, key);
+        bool replayed = false;
+        if (has_key)
+        {
+            auto it = cache.find(key);
+            if (it != cache.end() && it->second.replayable)
+            {
+                replayed = replay_validation(*node, *it->second.rep);
+            }
+        }
+        if (!replayed)
+        {
+            node->revalidate_and_infer_types();
+            if (has_key && cache.find(key) == cache.end())
+            {
+                std::string post_key;
+                const bool attrs_stable = make_validation_key(*node, post_key) && post_key == key;
+                cache.insert({key, CacheEntry{node.get(), attrs_stable}});
+            }
+        }
 
         // If we find a parameter make sure it is in the list of parameters of the function
         if (node->is_parameter())
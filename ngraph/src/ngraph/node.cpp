@@ -30,6 +30,7 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/pool_allocator.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -218,8 +219,10 @@ descriptor::Output& Node::get_output_descriptor(size_t position)
     while (m_outputs.size() <= position)
     {
         size_t i = m_outputs.size();
-        auto tensor_descriptor =
-            make_shared<descriptor::Tensor>(element::dynamic, PartialShape::dynamic(), this, i);
+        // descriptors are created once per node output; allocate_shared puts both the
+        // descriptor and its control block into the pool to avoid malloc churn on load
+        auto tensor_descriptor = allocate_shared<descriptor::Tensor>(
+            PoolAllocator<descriptor::Tensor>(), element::dynamic, PartialShape::dynamic(), this, i);
         m_outputs.emplace_back(this, i, tensor_descriptor);
     }
     return m_outputs.at(position);
@@ -241,6 +244,7 @@ void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
     validate_and_infer_types();
+    m_needs_validation = false;
 #endif
 }
 
@@ -286,7 +290,18 @@ void Node::set_input_is_relevant_to_value(size_t i, bool relevant)
 
 void Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape)
 {
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    auto& output = get_output_descriptor(i);
+    auto tensor = output.get_tensor_ptr();
+    // a changed output type invalidates whatever the consumers inferred from it
+    if (tensor->get_element_type() != element_type ||
+        !tensor->get_partial_shape().same_scheme(pshape))
+    {
+        for (descriptor::Input* input : output.get_inputs())
+        {
+            input->get_raw_pointer_node()->set_needs_validation(true);
+        }
+    }
+    tensor->set_tensor_type(element_type, pshape);
 }
 
 std::deque<descriptor::Output>& Node::get_outputs()
@@ -237,7 +237,16 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            validate_and_infer_types();
+            m_needs_validation = false;
+        }
+        /// \brief True when the node's inputs or their types changed since the last
+        ///        validation. Checked by pass::Validate to skip untouched nodes.
+        bool needs_validation() const { return m_needs_validation; }
+        /// \brief Requests (or cancels) revalidation on the next pass::Validate run
+        void set_needs_validation(bool needs_validation) { m_needs_validation = needs_validation; }
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -590,6 +599,7 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
+        bool m_needs_validation = true;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
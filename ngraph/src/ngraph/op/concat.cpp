@@ -20,7 +20,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
-#include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/opt_kernel/concat.hpp"
 using namespace std;
 using namespace ngraph;
 
@@ -162,7 +162,7 @@ namespace
             out_shape[concatenation_axis] += arg_shapes.back()[concatenation_axis];
         }
         out->set_shape(out_shape);
-        runtime::reference::concat<T>(
+        runtime::opt_kernel::concat<T>(
             arg_bufs, out->get_data_ptr<ET>(), arg_shapes, out_shape, concatenation_axis);
         return true;
     }
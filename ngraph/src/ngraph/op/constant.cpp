@@ -317,8 +317,24 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
 }
 
 op::Constant::Constant(const Constant& other)
-    : Constant(other.m_element_type, other.m_shape)
+    : m_element_type(other.m_element_type)
+    , m_shape(other.m_shape)
 {
+    // share the buffer of the source constant instead of delegating to the allocating
+    // constructor; the freshly allocated buffer was dropped on the next line anyway,
+    // which made every clone of a large constant spike the peak memory
+    m_data = other.m_data;
+    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    constructor_validate_and_infer_types();
+}
+
+op::Constant::Constant(const Constant& other, const Shape& new_shape)
+    : m_element_type(other.m_element_type)
+    , m_shape(new_shape)
+{
+    NGRAPH_CHECK(shape_size(other.m_shape) == shape_size(new_shape),
+                 "Shape size " + std::to_string(shape_size(new_shape)) + " is not equal to " +
+                     std::to_string(shape_size(other.m_shape)));
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
     constructor_validate_and_infer_types();
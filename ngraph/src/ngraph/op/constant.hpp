@@ -234,6 +234,15 @@ namespace ngraph
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
                 Constant(const Constant& other);
+
+                /// \brief Constructs a constant sharing the data buffer of another constant
+                ///        under a different shape with the same number of elements, so
+                ///        folding reshape-like operations copies no data.
+                ///
+                /// \param other The constant whose data buffer is shared.
+                /// \param new_shape The shape of the view.
+                Constant(const Constant& other, const Shape& new_shape);
+
                 Constant& operator=(const Constant&) = delete;
 
                 virtual ~Constant() override;
@@ -22,6 +22,7 @@
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/not.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/runtime/reference/select.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -115,6 +116,91 @@ void op::v1::Select::generate_adjoints(autodiff::Adjoints& adjoints, const Outpu
     adjoints.add_delta(y, delta * not_p_as_y_type);
 }
 
+namespace
+{
+    template <element::Type_t ET>
+    bool evaluate(const HostTensorPtr& arg0,
+                  const HostTensorPtr& arg1,
+                  const HostTensorPtr& arg2,
+                  const HostTensorPtr& out,
+                  const op::AutoBroadcastSpec& broadcast_spec)
+    {
+        runtime::reference::select<typename element_type_traits<ET>::value_type>(
+            arg0->get_data_ptr<char>(),
+            arg1->get_data_ptr<ET>(),
+            arg2->get_data_ptr<ET>(),
+            out->get_data_ptr<ET>(),
+            arg0->get_shape(),
+            arg1->get_shape(),
+            arg2->get_shape(),
+            broadcast_spec);
+        return true;
+    }
+
+    bool evaluate_select(const HostTensorPtr& arg0,
+                         const HostTensorPtr& arg1,
+                         const HostTensorPtr& arg2,
+                         const HostTensorPtr& out,
+                         const op::AutoBroadcastSpec& broadcast_spec)
+    {
+        // the output shape is the merge of all three input shapes, broadcast
+        // the same way validate_and_infer_types merges them
+        PartialShape result_shape = arg2->get_shape();
+        for (auto& input : {arg1, arg0})
+        {
+            if (broadcast_spec.m_type == op::AutoBroadcastType::NONE)
+            {
+                NGRAPH_CHECK(PartialShape::merge_into(result_shape, input->get_shape()),
+                             "Argument shapes are inconsistent.");
+            }
+            else
+            {
+                NGRAPH_CHECK(PartialShape::broadcast_merge_into(
+                                 result_shape, input->get_shape(), broadcast_spec),
+                             "Argument shapes are inconsistent.");
+            }
+        }
+        out->set_element_type(arg1->get_element_type());
+        out->set_shape(result_shape.to_shape());
+
+        bool rc = true;
+        switch (arg1->get_element_type())
+        {
+            TYPE_CASE(i8)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(i16)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(i32)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(i64)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(u8)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(u16)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(u32)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(u64)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(bf16)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(f16)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(f32)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+            TYPE_CASE(f64)(arg0, arg1, arg2, out, broadcast_spec);
+            break;
+        default: rc = false; break;
+        }
+        return rc;
+    }
+}
+
+bool op::v1::Select::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs)
+{
+    return evaluate_select(inputs[0], inputs[1], inputs[2], outputs[0], get_auto_broadcast());
+}
+
 constexpr NodeTypeInfo op::v0::Select::type_info;
 
 op::v0::Select::Select(const Output<Node>& arg0, const Output<Node>& arg1, const Output<Node>& arg2)
@@ -157,6 +243,12 @@ shared_ptr<Node> op::v0::Select::clone_with_new_inputs(const OutputVector& new_a
     return make_shared<v0::Select>(new_args.at(0), new_args.at(1), new_args.at(2));
 }
 
+bool op::v0::Select::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs)
+{
+    return evaluate_select(
+        inputs[0], inputs[1], inputs[2], outputs[0], op::AutoBroadcastSpec(AutoBroadcastType::NONE));
+}
+
 void op::Select::generate_adjoints(autodiff::Adjoints& adjoints, const OutputVector& deltas)
 {
     auto delta = deltas.at(0);
@@ -19,6 +19,7 @@
 #include "ngraph/builder/split.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/split.hpp"
+#include "ngraph/runtime/opt_kernel/slice.hpp"
 #include "ngraph/validation_util.hpp"
 
 using namespace std;
@@ -184,3 +185,94 @@ shared_ptr<Node> op::v1::Split::clone_with_new_inputs(const OutputVector& new_ar
     check_new_args_count(this, new_args);
     return make_shared<v1::Split>(new_args.at(0), new_args.at(1), m_num_splits);
 }
+
+namespace
+{
+    template <element::Type_t ET>
+    bool evaluate(const HostTensorPtr& arg0,
+                  const HostTensorPtr& out,
+                  const Coordinate& lower_bounds,
+                  const Coordinate& upper_bounds)
+    {
+        runtime::opt_kernel::slice<typename element_type_traits<ET>::value_type>(
+            arg0->get_data_ptr<ET>(),
+            out->get_data_ptr<ET>(),
+            arg0->get_shape(),
+            lower_bounds,
+            upper_bounds,
+            Strides(lower_bounds.size(), 1),
+            out->get_shape());
+        return true;
+    }
+
+    bool evaluate_split(const HostTensorPtr& arg0,
+                        const HostTensorPtr& axis_tensor,
+                        const HostTensorVector& outputs,
+                        size_t num_splits)
+    {
+        const auto data_shape = arg0->get_shape();
+        int64_t data_rank = static_cast<int64_t>(data_shape.size());
+
+        int64_t axis = read_index_vector(axis_tensor)[0];
+        axis = axis < 0 ? data_rank + axis : axis;
+        NGRAPH_CHECK(axis >= 0 && axis < data_rank, "Split axis is out of bounds: ", axis);
+        NGRAPH_CHECK(data_shape[axis] % num_splits == 0,
+                     "The dimension of the split axis must be a multiple of the number of splits.");
+        const size_t split_length = data_shape[axis] / num_splits;
+
+        auto out_shape = data_shape;
+        out_shape[axis] = split_length;
+
+        bool rc = true;
+        for (size_t i = 0; i < num_splits; i++)
+        {
+            const auto& out = outputs[i];
+            out->set_element_type(arg0->get_element_type());
+            out->set_shape(out_shape);
+
+            Coordinate lower_bounds(data_shape.size(), 0);
+            Coordinate upper_bounds = data_shape;
+            lower_bounds[axis] = i * split_length;
+            upper_bounds[axis] = (i + 1) * split_length;
+
+            switch (arg0->get_element_type())
+            {
+                TYPE_CASE(i8)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(i16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(i32)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(i64)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u8)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u32)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u64)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(bf16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(f16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(f32)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(f64)(arg0, out, lower_bounds, upper_bounds);
+                break;
+            default: rc = false; break;
+            }
+            if (!rc)
+            {
+                break;
+            }
+        }
+        return rc;
+    }
+}
+
+bool op::v1::Split::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs)
+{
+    return evaluate_split(inputs[0], inputs[1], outputs, m_num_splits);
+}
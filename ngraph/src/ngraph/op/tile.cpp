@@ -14,9 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "ngraph/op/tile.hpp"
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/reference/tile.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -100,3 +104,70 @@ void op::Tile::generate_adjoints(autodiff::Adjoints& /* adjoints */,
 {
     throw ngraph_error("generate_adjoints not implemented for Tile");
 }
+
+namespace
+{
+    template <element::Type_t ET>
+    bool evaluate(const HostTensorPtr& arg0, const HostTensorPtr& out)
+    {
+        runtime::reference::tile<typename element_type_traits<ET>::value_type>(
+            arg0->get_data_ptr<ET>(), out->get_data_ptr<ET>(), arg0->get_shape(), out->get_shape());
+        return true;
+    }
+
+    bool evaluate_tile(const HostTensorPtr& arg0, const HostTensorPtr& repeats,
+                       const HostTensorPtr& out)
+    {
+        auto data_shape = arg0->get_shape();
+        auto repeats_val = read_index_vector(repeats);
+
+        // expand data shape and repeats to output rank
+        auto output_rank = std::max(data_shape.size(), repeats_val.size());
+        data_shape.insert(data_shape.begin(), output_rank - data_shape.size(), 1);
+        repeats_val.insert(repeats_val.begin(), output_rank - repeats_val.size(), 1);
+
+        Shape output_shape(output_rank);
+        for (size_t i = 0; i < output_rank; i++)
+        {
+            output_shape[i] = data_shape[i] * repeats_val[i];
+        }
+        out->set_element_type(arg0->get_element_type());
+        out->set_shape(output_shape);
+
+        bool rc = true;
+        switch (arg0->get_element_type())
+        {
+            TYPE_CASE(i8)(arg0, out);
+            break;
+            TYPE_CASE(i16)(arg0, out);
+            break;
+            TYPE_CASE(i32)(arg0, out);
+            break;
+            TYPE_CASE(i64)(arg0, out);
+            break;
+            TYPE_CASE(u8)(arg0, out);
+            break;
+            TYPE_CASE(u16)(arg0, out);
+            break;
+            TYPE_CASE(u32)(arg0, out);
+            break;
+            TYPE_CASE(u64)(arg0, out);
+            break;
+            TYPE_CASE(bf16)(arg0, out);
+            break;
+            TYPE_CASE(f16)(arg0, out);
+            break;
+            TYPE_CASE(f32)(arg0, out);
+            break;
+            TYPE_CASE(f64)(arg0, out);
+            break;
+        default: rc = false; break;
+        }
+        return rc;
+    }
+}
+
+bool op::v0::Tile::evaluate(const HostTensorVector& outputs, const HostTensorVector& inputs)
+{
+    return evaluate_tile(inputs[0], inputs[1], outputs[0]);
+}
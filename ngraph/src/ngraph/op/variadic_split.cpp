@@ -18,6 +18,7 @@
 
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/variadic_split.hpp"
+#include "ngraph/runtime/opt_kernel/slice.hpp"
 #include "ngraph/validation_util.hpp"
 
 using namespace std;
@@ -141,3 +142,119 @@ shared_ptr<Node> op::v1::VariadicSplit::clone_with_new_inputs(const OutputVector
     check_new_args_count(this, new_args);
     return make_shared<v1::VariadicSplit>(new_args.at(0), new_args.at(1), new_args.at(2));
 }
+
+namespace
+{
+    template <element::Type_t ET>
+    bool evaluate(const HostTensorPtr& arg0,
+                  const HostTensorPtr& out,
+                  const Coordinate& lower_bounds,
+                  const Coordinate& upper_bounds)
+    {
+        runtime::opt_kernel::slice<typename element_type_traits<ET>::value_type>(
+            arg0->get_data_ptr<ET>(),
+            out->get_data_ptr<ET>(),
+            arg0->get_shape(),
+            lower_bounds,
+            upper_bounds,
+            Strides(lower_bounds.size(), 1),
+            out->get_shape());
+        return true;
+    }
+
+    bool evaluate_variadic_split(const HostTensorPtr& arg0,
+                                 const HostTensorPtr& axis_tensor,
+                                 const HostTensorPtr& split_lengths_tensor,
+                                 const HostTensorVector& outputs)
+    {
+        const auto data_shape = arg0->get_shape();
+        int64_t data_rank = static_cast<int64_t>(data_shape.size());
+
+        int64_t axis = read_index_vector(axis_tensor)[0];
+        axis = axis < 0 ? data_rank + axis : axis;
+        NGRAPH_CHECK(axis >= 0 && axis < data_rank, "Split axis is out of bounds: ", axis);
+
+        auto split_lengths = read_index_vector(split_lengths_tensor);
+        NGRAPH_CHECK(split_lengths.size() == outputs.size(),
+                     "The number of split lengths must match the number of outputs.");
+
+        // resolve a single -1 length to the remainder of the split axis
+        int64_t sum_of_splits = 0;
+        int64_t negative_one = -1;
+        for (size_t i = 0; i < split_lengths.size(); i++)
+        {
+            if (split_lengths[i] == -1)
+            {
+                negative_one = i;
+            }
+            else
+            {
+                sum_of_splits += split_lengths[i];
+            }
+        }
+        if (negative_one >= 0)
+        {
+            split_lengths[negative_one] =
+                static_cast<int64_t>(data_shape[axis]) - sum_of_splits;
+        }
+
+        bool rc = true;
+        size_t offset = 0;
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            const auto& out = outputs[i];
+            const size_t split_length = split_lengths[i];
+
+            auto out_shape = data_shape;
+            out_shape[axis] = split_length;
+            out->set_element_type(arg0->get_element_type());
+            out->set_shape(out_shape);
+
+            Coordinate lower_bounds(data_shape.size(), 0);
+            Coordinate upper_bounds = data_shape;
+            lower_bounds[axis] = offset;
+            upper_bounds[axis] = offset + split_length;
+            offset += split_length;
+
+            switch (arg0->get_element_type())
+            {
+                TYPE_CASE(i8)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(i16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(i32)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(i64)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u8)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u32)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(u64)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(bf16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(f16)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(f32)(arg0, out, lower_bounds, upper_bounds);
+                break;
+                TYPE_CASE(f64)(arg0, out, lower_bounds, upper_bounds);
+                break;
+            default: rc = false; break;
+            }
+            if (!rc)
+            {
+                break;
+            }
+        }
+        return rc;
+    }
+}
+
+bool op::v1::VariadicSplit::evaluate(const HostTensorVector& outputs,
+                                     const HostTensorVector& inputs)
+{
+    return evaluate_variadic_split(inputs[0], inputs[1], inputs[2], outputs);
+}
@@ -86,6 +86,8 @@ public:
         construct_constant_slice();
         construct_constant_dyn_slice();
         construct_constant_dyn_reshape();
+        construct_constant_squeeze();
+        construct_constant_unsqueeze();
         construct_constant_transpose();
         construct_constant_select();
         construct_constant_one_hot();
@@ -107,6 +109,8 @@ private:
     void construct_constant_slice();
     void construct_constant_dyn_slice();
     void construct_constant_dyn_reshape();
+    void construct_constant_squeeze();
+    void construct_constant_unsqueeze();
     void construct_constant_transpose();
     void construct_constant_select();
     void construct_constant_split();
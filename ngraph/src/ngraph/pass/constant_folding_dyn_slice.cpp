@@ -18,7 +18,7 @@
 #include "ngraph/op/experimental/dyn_slice.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
-#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/opt_kernel/slice.hpp"
 #include "ngraph/slice_plan.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -44,7 +44,7 @@ shared_ptr<op::Constant> fold_constant_dyn_slice(shared_ptr<op::Constant> data,
 
     runtime::AlignedBuffer slice_out_buffer(shape_size(plan.reshape_in_shape) * sizeof(T));
     T* slice_out_data = slice_out_buffer.get_ptr<T>();
-    runtime::reference::slice<T>(data->get_data_ptr<T>(),
+    runtime::opt_kernel::slice<T>(data->get_data_ptr<T>(),
                                  slice_out_data,
                                  data->get_shape(),
                                  Coordinate(plan.begins.begin(), plan.begins.end()),
@@ -16,7 +16,7 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/slice.hpp"
-#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/opt_kernel/slice.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -29,7 +29,7 @@ shared_ptr<op::Constant> fold_constant_slice(shared_ptr<op::Constant> constant,
     runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
     T* data_ptr = buffer.get_ptr<T>();
 
-    runtime::reference::slice<T>(constant->get_data_ptr<T>(),
+    runtime::opt_kernel::slice<T>(constant->get_data_ptr<T>(),
                                  data_ptr,
                                  constant->get_shape(),
                                  slice->get_lower_bounds(),
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "constant_folding.hpp"
+#include "ngraph/op/fused/squeeze.hpp"
+#include "ngraph/op/fused/unsqueeze.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void pass::ConstantFolding::construct_constant_squeeze()
+{
+    auto constant_data_label = make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 1, 4}, pattern::has_class<op::Constant>());
+    auto constant_axes_label =
+        make_shared<pattern::op::Label>(element::i64, Shape{1}, pattern::has_class<op::Constant>());
+    auto squeeze = make_shared<op::Squeeze>(constant_data_label, constant_axes_label);
+
+    auto constant_squeeze_callback = [constant_data_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_squeeze_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+
+        auto constant_data_match =
+            static_pointer_cast<op::Constant>(pattern_map[constant_data_label]);
+        auto match_root = m.get_match_root();
+        NGRAPH_CHECK(revalidate_and_ensure_static(match_root));
+        // Squeeze only drops unit dimensions: the folded constant is a view over the
+        // source constant's buffer, no data is copied
+        auto replacement = make_shared<op::Constant>(*constant_data_match, match_root->get_shape());
+        replace_node(match_root, replacement);
+        return true;
+    };
+
+    auto squeeze_matcher =
+        make_shared<pattern::Matcher>(squeeze, "ConstantFolding.ConstantSqueeze");
+    this->add_matcher(
+        squeeze_matcher, constant_squeeze_callback, PassProperty::CHANGE_DYNAMIC_STATE);
+}
+
+void pass::ConstantFolding::construct_constant_unsqueeze()
+{
+    auto constant_data_label = make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 4}, pattern::has_class<op::Constant>());
+    auto constant_axes_label =
+        make_shared<pattern::op::Label>(element::i64, Shape{1}, pattern::has_class<op::Constant>());
+    auto unsqueeze = make_shared<op::Unsqueeze>(constant_data_label, constant_axes_label);
+
+    auto constant_unsqueeze_callback = [constant_data_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_unsqueeze_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+
+        auto constant_data_match =
+            static_pointer_cast<op::Constant>(pattern_map[constant_data_label]);
+        auto match_root = m.get_match_root();
+        NGRAPH_CHECK(revalidate_and_ensure_static(match_root));
+        // Unsqueeze only inserts unit dimensions: the folded constant is a view over
+        // the source constant's buffer, no data is copied
+        auto replacement = make_shared<op::Constant>(*constant_data_match, match_root->get_shape());
+        replace_node(match_root, replacement);
+        return true;
+    };
+
+    auto unsqueeze_matcher =
+        make_shared<pattern::Matcher>(unsqueeze, "ConstantFolding.ConstantUnsqueeze");
+    this->add_matcher(
+        unsqueeze_matcher, constant_unsqueeze_callback, PassProperty::CHANGE_DYNAMIC_STATE);
+}
@@ -163,6 +163,19 @@ void pass::GraphRewriteBase::add_handler(const std::string& name,
     }
 }
 
+void pass::GraphRewriteBase::merge_rewrite(const std::shared_ptr<GraphRewriteBase>& other)
+{
+    for (auto& closure : other->m_matchers)
+    {
+        m_matchers.push_back(closure);
+        if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+        {
+            set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+        }
+    }
+    m_merged_rewrites.push_back(other);
+}
+
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
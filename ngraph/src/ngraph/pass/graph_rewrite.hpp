@@ -48,6 +48,11 @@ public:
                      std::function<bool(const std::shared_ptr<Node>& node)> handler,
                      const PassPropertyMask& property);
 
+    /// \brief Appends the matchers of `other` after the already registered ones, so a
+    /// single traversal of this pass serves both. The merged pass object is retained
+    /// because its closures may reference its state.
+    void merge_rewrite(const std::shared_ptr<GraphRewriteBase>& other);
+
 protected:
     GraphRewriteBase()
         : FunctionPass()
@@ -67,6 +72,7 @@ protected:
         PassPropertyMask property;
     };
     std::vector<MatchClosure> m_matchers;
+    std::vector<std::shared_ptr<GraphRewriteBase>> m_merged_rewrites;
 };
 
 /// \brief GraphRewrite (in tandem with \sa Matcher) performs transformations on specified patterns
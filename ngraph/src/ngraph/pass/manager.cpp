@@ -22,7 +22,9 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 
+#include "ngraph/check.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -47,11 +49,118 @@ pass::Manager::~Manager()
 {
 }
 
+void pass::Manager::add_checkpoint(const std::string& name)
+{
+    m_checkpoint_markers.push_back({name, m_pass_list.size()});
+}
+
+// A structural fingerprint of a function: node types with their output element types and
+// shapes, in topological order. It is intentionally value-blind (constant payloads are not
+// hashed), which is cheap and sufficient to tell apart structurally different inputs; a
+// caller re-running the pipeline on a freshly imported copy of the same network matches.
+static size_t function_fingerprint(const shared_ptr<Function>& func)
+{
+    std::hash<std::string> str_hash;
+    vector<size_t> values;
+    for (auto& node : func->get_ordered_ops())
+    {
+        values.push_back(str_hash(node->get_type_info().name));
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            std::ostringstream buf;
+            buf << node->get_output_element_type(i) << node->get_output_partial_shape(i);
+            values.push_back(str_hash(buf.str()));
+        }
+    }
+    return hash_combine(values);
+}
+
+// Rebuilds the checkpointed state on top of the target function: the snapshot is cloned with
+// its parameters pre-mapped onto the target's parameters and the target's results are rewired
+// to the cloned producers, so the restored graph hangs off the caller's Function object.
+static void restore_checkpoint(const shared_ptr<Function>& target,
+                               const shared_ptr<Function>& state)
+{
+    const auto& state_params = state->get_parameters();
+    const auto& target_params = target->get_parameters();
+    NGRAPH_CHECK(state_params.size() == target_params.size(),
+                 "Checkpoint parameter count does not match the function being transformed");
+
+    NodeMap node_map;
+    for (size_t i = 0; i < state_params.size(); i++)
+    {
+        node_map[state_params[i].get()] = target_params[i];
+    }
+    auto replay = clone_function(*state, node_map);
+
+    const auto& replay_results = replay->get_results();
+    const auto& target_results = target->get_results();
+    NGRAPH_CHECK(replay_results.size() == target_results.size(),
+                 "Checkpoint result count does not match the function being transformed");
+    for (size_t i = 0; i < target_results.size(); i++)
+    {
+        target_results[i]->set_argument(0, replay_results[i]->input_value(0));
+    }
+}
+
+std::string pass::Manager::prefix_signature(size_t end_index) const
+{
+    std::string signature;
+    for (size_t i = 0; i < end_index && i < m_pass_names.size(); i++)
+    {
+        signature += m_pass_names[i];
+        signature += '/';
+    }
+    return signature;
+}
+
+void pass::Manager::save_checkpoints_at(size_t pass_index,
+                                        size_t start_index,
+                                        size_t input_fingerprint,
+                                        const shared_ptr<Function>& func)
+{
+    for (auto& marker : m_checkpoint_markers)
+    {
+        // only snapshot states which were actually computed in this run; a marker the run
+        // was restored from already holds a matching state
+        if (marker.pass_index != pass_index || pass_index < start_index ||
+            (pass_index == start_index && start_index != 0))
+        {
+            continue;
+        }
+        m_checkpoints[marker.name] =
+            CheckpointState{input_fingerprint, prefix_signature(pass_index), clone_function(*func)};
+    }
+}
+
 void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
 {
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
 
     get_state().set_function(func);
+
+    // When checkpoints are registered, look for a snapshot taken on a structurally identical
+    // input by an earlier run of the same pass prefix; the latest match is restored and the
+    // pipeline resumes right after its marker.
+    size_t start_index = 0;
+    size_t input_fingerprint = 0;
+    if (!m_checkpoint_markers.empty())
+    {
+        input_fingerprint = function_fingerprint(func);
+        for (auto it = m_checkpoint_markers.rbegin(); it != m_checkpoint_markers.rend(); ++it)
+        {
+            auto found = m_checkpoints.find(it->name);
+            if (found != m_checkpoints.end() &&
+                found->second.input_fingerprint == input_fingerprint &&
+                found->second.prefix_signature == prefix_signature(it->pass_index))
+            {
+                restore_checkpoint(func, found->second.state);
+                start_index = it->pass_index;
+                break;
+            }
+        }
+    }
+
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
     vector<shared_ptr<Function>> f_array{func};
 
@@ -61,6 +170,15 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        if (index < start_index)
+        {
+            index++;
+            continue;
+        }
+        if (!m_checkpoint_markers.empty())
+        {
+            save_checkpoints_at(index, start_index, input_fingerprint, func);
+        }
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -165,6 +283,11 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
         }
     }
+    if (!m_checkpoint_markers.empty())
+    {
+        // markers registered after the last pass snapshot the fully transformed function
+        save_checkpoints_at(m_pass_list.size(), start_index, input_fingerprint, func);
+    }
     if (profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
@@ -17,10 +17,13 @@
 #pragma once
 
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
@@ -44,12 +47,26 @@ public:
     template <typename T, class... Args>
     std::shared_ptr<T> register_pass(Args&&... args)
     {
-        auto rc = push_pass<T>(std::forward<Args>(args)...);
+        static_assert(std::is_base_of<pass::PassBase, T>::value, "pass not derived from pass base");
+        auto pass = std::make_shared<T>(std::forward<Args>(args)...);
+        if (m_fuse_graph_rewrites)
+        {
+            auto rewrite = std::dynamic_pointer_cast<GraphRewrite>(pass);
+            if (rewrite && m_open_rewrite_group)
+            {
+                // Fold the matchers into the preceding GraphRewrite so that one
+                // traversal per fixpoint iteration serves the whole run of rewrites.
+                m_open_rewrite_group->merge_rewrite(rewrite);
+                return pass;
+            }
+            m_open_rewrite_group = rewrite;
+        }
+        push_pass(std::static_pointer_cast<PassBase>(pass), typeid(T));
         if (m_per_pass_validation)
         {
-            push_pass<Validate>();
+            push_pass(std::make_shared<Validate>(), typeid(Validate));
         }
-        return rc;
+        return pass;
     }
 
     void run_passes(std::shared_ptr<Function>, bool transitive = true);
@@ -63,28 +80,48 @@ public:
     /// each registered pass
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Marks a named checkpoint after the most recently registered pass. When
+    /// run_passes later executes the pipeline up to the marker, the function state is
+    /// snapshotted (as an in-memory clone) together with a fingerprint of the input
+    /// function and of the pass prefix. A subsequent run_passes call on a structurally
+    /// identical input restores the snapshot and resumes after the marker, so tuning
+    /// loops which only vary the passes behind a checkpoint skip the common prefix.
+    /// \param name Checkpoint name, unique per manager
+    void add_checkpoint(const std::string& name);
+    /// \brief Drops all checkpoint states captured by previous run_passes calls
+    void clear_checkpoints() { m_checkpoints.clear(); }
+    /// \brief Set flag to merge consecutive GraphRewrite passes into a single traversal.
+    /// Matchers keep their registration order: a node is only offered to the matchers of
+    /// a later rewrite after the earlier ones failed on it, which is the same cascading
+    /// contract GraphRewrite applies to its own matchers.
+    /// \param new_state Value "true" enables merging; "false", otherwise
+    void set_fuse_graph_rewrites(bool new_state)
+    {
+        m_fuse_graph_rewrites = new_state;
+        if (!new_state)
+        {
+            m_open_rewrite_group = nullptr;
+        }
+    }
+
 private:
-    template <typename T, class... Args>
-    std::shared_ptr<T> push_pass(Args&&... args)
+    void push_pass(const std::shared_ptr<PassBase>& pass, const std::type_info& type_info)
     {
-        static_assert(std::is_base_of<pass::PassBase, T>::value, "pass not derived from pass base");
-        auto pass = std::make_shared<T>(std::forward<Args>(args)...);
-        auto pass_base = std::static_pointer_cast<PassBase>(pass);
-        m_pass_list.push_back(pass_base);
-        if (m_visualize || m_serialize)
+        m_pass_list.push_back(pass);
+        // the names also identify the pass prefix of a checkpoint, so they are
+        // recorded unconditionally
         {
 #ifdef _WIN32
             // MSVC produce a human-readable type name like class ngraph::pass::LikeReplacement
             // by typeid(T).name(). Later ofstream doesn't accept it as a valid file name.
             //
-            std::string str = typeid(T).name();
+            std::string str = type_info.name();
             auto pos = str.find_last_of(":");
             m_pass_names.push_back(str.substr(pos + 1));
 #elif defined(__linux) || defined(__APPLE__)
-            m_pass_names.push_back(typeid(T).name());
+            m_pass_names.push_back(type_info.name());
 #endif
         }
-        return pass;
     }
 
     std::vector<std::string> m_pass_names;
@@ -94,4 +131,25 @@ private:
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    bool m_fuse_graph_rewrites = false;
+    std::shared_ptr<GraphRewrite> m_open_rewrite_group;
+
+    struct CheckpointMarker
+    {
+        std::string name;
+        size_t pass_index;
+    };
+    struct CheckpointState
+    {
+        size_t input_fingerprint;
+        std::string prefix_signature;
+        std::shared_ptr<Function> state;
+    };
+    std::string prefix_signature(size_t end_index) const;
+    void save_checkpoints_at(size_t pass_index,
+                             size_t start_index,
+                             size_t input_fingerprint,
+                             const std::shared_ptr<Function>& func);
+    std::vector<CheckpointMarker> m_checkpoint_markers;
+    std::map<std::string, CheckpointState> m_checkpoints;
 };
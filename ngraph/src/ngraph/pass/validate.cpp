@@ -21,6 +21,17 @@ using namespace ngraph;
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    // Only nodes touched since the last validation need revisiting: replacing an
+    // input or changing an upstream output type sets the flag, and a changed output
+    // type inferred here dirties the consumers which follow in topological order.
+    // This keeps the per-pass validation of pass::Manager linear in the number of
+    // modified nodes instead of the graph size.
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (node->needs_validation())
+        {
+            node->revalidate_and_infer_types();
+        }
+    }
     return false;
 }
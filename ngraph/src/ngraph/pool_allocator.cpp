@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pool_allocator.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace ngraph;
+
+namespace
+{
+    // Sizes are rounded up to the granularity; multiples of it also keep every
+    // pooled object aligned for any fundamental type.
+    constexpr size_t s_granularity = alignof(std::max_align_t);
+    constexpr size_t s_max_pooled_size = 512;
+    constexpr size_t s_block_size = 64 * 1024;
+
+    struct Pool
+    {
+        std::mutex m_mutex;
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        char* m_bump = nullptr;
+        size_t m_bump_left = 0;
+        void* m_free_lists[s_max_pooled_size / s_granularity] = {};
+    };
+
+    Pool& get_pool()
+    {
+        // Deliberately leaked so objects released during static teardown, after this
+        // translation unit's destructors have run, can still reach a live pool.
+        static Pool* s_pool = new Pool;
+        return *s_pool;
+    }
+}
+
+void* ObjectPool::allocate(size_t size)
+{
+    if (size == 0 || size > s_max_pooled_size)
+    {
+        return ::operator new(size);
+    }
+    const size_t slot = (size + s_granularity - 1) / s_granularity;
+    const size_t slot_size = slot * s_granularity;
+    Pool& pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.m_mutex);
+    void*& free_list = pool.m_free_lists[slot - 1];
+    if (free_list != nullptr)
+    {
+        void* ptr = free_list;
+        free_list = *static_cast<void**>(ptr);
+        return ptr;
+    }
+    if (pool.m_bump_left < slot_size)
+    {
+        pool.m_blocks.emplace_back(new char[s_block_size]);
+        pool.m_bump = pool.m_blocks.back().get();
+        pool.m_bump_left = s_block_size;
+    }
+    void* ptr = pool.m_bump;
+    pool.m_bump += slot_size;
+    pool.m_bump_left -= slot_size;
+    return ptr;
+}
+
+void ObjectPool::deallocate(void* ptr, size_t size) noexcept
+{
+    if (size == 0 || size > s_max_pooled_size)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    const size_t slot = (size + s_granularity - 1) / s_granularity;
+    Pool& pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.m_mutex);
+    void*& free_list = pool.m_free_lists[slot - 1];
+    *static_cast<void**>(ptr) = free_list;
+    free_list = ptr;
+}
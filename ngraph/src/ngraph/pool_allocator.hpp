@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Size-segregated pool for the small objects created in bulk during graph
+    ///        construction, such as output tensor descriptors.
+    ///
+    /// Allocations are carved bump-pointer style from large blocks and recycled through
+    /// per-size free lists; the blocks themselves are retained for the lifetime of the
+    /// process. Access is serialized with a mutex: graph construction is effectively
+    /// single threaded and the pool is not touched on any execution hot path.
+    class NGRAPH_API ObjectPool
+    {
+    public:
+        /// \brief Returns storage of at least `size` bytes, pooled for small sizes
+        static void* allocate(size_t size);
+        /// \brief Returns storage obtained from allocate() back to the pool
+        static void deallocate(void* ptr, size_t size) noexcept;
+    };
+
+    /// \brief Minimal STL-style allocator over ObjectPool. With std::allocate_shared
+    ///        both the object and its control block come from the pool.
+    template <typename T>
+    class PoolAllocator
+    {
+    public:
+        using value_type = T;
+
+        PoolAllocator() = default;
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>&)
+        {
+        }
+
+        T* allocate(size_t n) { return static_cast<T*>(ObjectPool::allocate(n * sizeof(T))); }
+        void deallocate(T* p, size_t n) noexcept { ObjectPool::deallocate(p, n * sizeof(T)); }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&)
+    {
+        return false;
+    }
+}
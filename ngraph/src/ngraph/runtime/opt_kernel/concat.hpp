@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            // Concatenation of dense row-major tensors never needs per-element
+            // coordinate arithmetic: every input contributes one contiguous run per
+            // combination of the axes before the concatenation axis, and the runs of
+            // all inputs are interleaved back to back in the output. Copy run by run.
+            template <typename T>
+            void concat(const std::vector<const T*>& args,
+                        T* out,
+                        const std::vector<Shape>& in_shapes,
+                        const Shape& out_shape,
+                        int64_t concatenation_axis)
+            {
+                size_t outer_count = 1;
+                for (int64_t axis = 0; axis < concatenation_axis; axis++)
+                {
+                    outer_count *= out_shape[axis];
+                }
+
+                // contiguous run each input contributes per outer coordinate
+                std::vector<size_t> run_sizes(args.size(), 1);
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    for (size_t axis = concatenation_axis; axis < in_shapes[i].size(); axis++)
+                    {
+                        run_sizes[i] *= in_shapes[i][axis];
+                    }
+                }
+
+                for (size_t outer = 0; outer < outer_count; outer++)
+                {
+                    for (size_t i = 0; i < args.size(); i++)
+                    {
+                        out = std::copy(args[i] + outer * run_sizes[i],
+                                        args[i] + (outer + 1) * run_sizes[i],
+                                        out);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/shape.hpp"
@@ -240,16 +244,81 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
-                switch (in_shape.size())
+                // Squeeze out size-1 axes (they don't affect the element order) and fuse
+                // runs of axes which stay adjacent after the permutation: a fused
+                // transpose moves whole contiguous blocks, so the innermost loop of
+                // reshape_inN copies the longest possible runs and the effective rank -
+                // and with it the indexing arithmetic - shrinks.
+                Shape squeezed_shape;
+                AxisVector squeezed_order;
+                std::vector<size_t> axis_remap(in_shape.size());
+                for (size_t axis = 0; axis < in_shape.size(); axis++)
+                {
+                    if (in_shape[axis] != 1)
+                    {
+                        axis_remap[axis] = squeezed_shape.size();
+                        squeezed_shape.push_back(in_shape[axis]);
+                    }
+                }
+                for (auto axis : in_axis_order)
+                {
+                    if (in_shape[axis] != 1)
+                    {
+                        squeezed_order.push_back(axis_remap[axis]);
+                    }
+                }
+
+                // group axes consecutive both in the input and in the order
+                std::vector<std::pair<size_t, size_t>> groups; // input start axis, fused size
+                for (size_t i = 0; i < squeezed_order.size(); i++)
+                {
+                    if (i > 0 && squeezed_order[i] == squeezed_order[i - 1] + 1)
+                    {
+                        groups.back().second *= squeezed_shape[squeezed_order[i]];
+                    }
+                    else
+                    {
+                        groups.emplace_back(squeezed_order[i], squeezed_shape[squeezed_order[i]]);
+                    }
+                }
+
+                std::vector<std::pair<size_t, size_t>> groups_by_axis(groups);
+                std::sort(groups_by_axis.begin(), groups_by_axis.end());
+
+                Shape fused_shape;
+                for (const auto& group : groups_by_axis)
+                {
+                    fused_shape.push_back(group.second);
+                }
+
+                AxisVector fused_order;
+                Shape fused_out_shape;
+                for (const auto& group : groups)
+                {
+                    fused_order.push_back(std::lower_bound(groups_by_axis.begin(),
+                                                           groups_by_axis.end(),
+                                                           group) -
+                                          groups_by_axis.begin());
+                    fused_out_shape.push_back(group.second);
+                }
+
+                // a sorted fused order keeps the element order: plain copy
+                if (std::is_sorted(fused_order.begin(), fused_order.end()))
+                {
+                    std::copy(in, in + shape_size(in_shape), out);
+                    return;
+                }
+
+                switch (fused_shape.size())
                 {
-                case 0: reshape_in0<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 1: reshape_in1<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 2: reshape_in2<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 3: reshape_in3<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 4: reshape_in4<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 5: reshape_in5<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 6: reshape_in6<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                default: reference::reshape(in, out, in_shape, in_axis_order, out_shape); break;
+                case 2: reshape_in2<T>(in, out, fused_shape, fused_order, fused_out_shape); break;
+                case 3: reshape_in3<T>(in, out, fused_shape, fused_order, fused_out_shape); break;
+                case 4: reshape_in4<T>(in, out, fused_shape, fused_order, fused_out_shape); break;
+                case 5: reshape_in5<T>(in, out, fused_shape, fused_order, fused_out_shape); break;
+                case 6: reshape_in6<T>(in, out, fused_shape, fused_order, fused_out_shape); break;
+                default:
+                    reference::reshape(in, out, fused_shape, fused_order, fused_out_shape);
+                    break;
                 }
             }
         }
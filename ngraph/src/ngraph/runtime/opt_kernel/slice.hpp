@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ngraph/coordinate.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            // Slice specialized for unit strides, the overwhelmingly common case:
+            // instead of visiting every output element through CoordinateTransform,
+            // the longest contiguous run of input elements is detected - the sliced
+            // range of the innermost partially-taken axis together with every fully
+            // taken axis behind it - and the runs are copied as blocks. Non-unit
+            // strides on the run axes fall back to the reference kernel.
+            template <typename T>
+            void slice(const T* arg,
+                       T* out,
+                       const Shape& arg_shape,
+                       const Coordinate& lower_bounds,
+                       const Coordinate& upper_bounds,
+                       const Strides& strides,
+                       const Shape& out_shape)
+            {
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+                const size_t rank = arg_shape.size();
+                if (rank == 0)
+                {
+                    *out = *arg;
+                    return;
+                }
+
+                // the run covers the longest suffix of fully taken unit-stride axes
+                size_t run_axis = rank;
+                while (run_axis > 0 && lower_bounds[run_axis - 1] == 0 &&
+                       upper_bounds[run_axis - 1] == arg_shape[run_axis - 1] &&
+                       strides[run_axis - 1] == 1)
+                {
+                    run_axis--;
+                }
+
+                size_t run_size = 1;
+                for (size_t axis = run_axis; axis < rank; axis++)
+                {
+                    run_size *= arg_shape[axis];
+                }
+
+                if (run_axis == 0)
+                {
+                    // the whole tensor is taken
+                    std::copy(arg, arg + run_size, out);
+                    return;
+                }
+
+                // the innermost partially taken axis extends the run when its stride
+                // is 1; a strided run axis would make the runs non-contiguous
+                run_axis--;
+                if (strides[run_axis] != 1)
+                {
+                    reference::slice(
+                        arg, out, arg_shape, lower_bounds, upper_bounds, strides, out_shape);
+                    return;
+                }
+                run_size *= upper_bounds[run_axis] - lower_bounds[run_axis];
+
+                std::vector<size_t> arg_strides(rank, 1);
+                for (size_t axis = rank - 1; axis > 0; axis--)
+                {
+                    arg_strides[axis - 1] = arg_strides[axis] * arg_shape[axis];
+                }
+
+                // walk the coordinate space of the axes outside the run
+                Coordinate coord(lower_bounds.begin(), lower_bounds.begin() + run_axis);
+                for (;;)
+                {
+                    size_t arg_offset = lower_bounds[run_axis] * arg_strides[run_axis];
+                    for (size_t axis = 0; axis < run_axis; axis++)
+                    {
+                        arg_offset += coord[axis] * arg_strides[axis];
+                    }
+                    std::copy(arg + arg_offset, arg + arg_offset + run_size, out);
+                    out += run_size;
+
+                    size_t axis = run_axis;
+                    while (axis-- > 0)
+                    {
+                        coord[axis] += strides[axis];
+                        if (coord[axis] < upper_bounds[axis])
+                        {
+                            break;
+                        }
+                        coord[axis] = lower_bounds[axis];
+                        if (axis == 0)
+                        {
+                            return;
+                        }
+                    }
+                    if (run_axis == 0)
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -22,6 +22,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/util.hpp"
 
@@ -87,8 +88,6 @@ namespace ngraph
                     is_quantized = true;
                 }
 
-                auto old_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
                 // Comments throughout assume without loss of generality that:
                 //
                 // * batch axes for both in and out are 0
@@ -96,172 +95,177 @@ namespace ngraph
                 // * out channel axes for filter is 0
                 // * out channel axis for out is 1
 
-                // At the outermost level we will walk over every out coordinate O.
-                CoordinateTransform out_transform(out_shape);
-
-                for (const Coordinate& out_coord : out_transform)
-                {
-                    // Our out coordinate O will have the form:
-                    //
-                    //   (N,chan_out,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[out_batch_axis];
-                    size_t out_channel = out_coord[out_channel_axis];
-
-                    // For the in we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,0,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,
-                    //      chans_in_count,
-                    //      s_1*i_1+ l_1*filter_dims_1,
-                    ///       ...,
-                    ///     s_n*i_n +l_n*filter_dims_n)
-                    //
-                    // with strides:
-                    //
-                    //   (1,l_1,...,l_n).
-                    //
-                    // Note that we are iterating within the *padded* and *dilated* in batch, so
-                    // further down we must check the current coordinate is in the pad or dilation
-                    // gap.
-
-                    size_t n_spatial_dimensions = in_shape.size() - 2;
-                    size_t n_in_channels = in_shape[in_channel_axis];
-
-                    Coordinate in_transform_start(2 + n_spatial_dimensions);
-                    Coordinate in_transform_end(2 + n_spatial_dimensions);
-                    Strides in_transform_movement_strides(2 + n_spatial_dimensions, 1);
-                    CoordinateDiff in_transform_pad_below(2 + n_spatial_dimensions, 0);
-                    CoordinateDiff in_transform_pad_above(2 + n_spatial_dimensions, 0);
-                    Strides in_transform_dilation_strides(2 + n_spatial_dimensions, 1);
-
-                    in_transform_start[in_batch_axis] = batch_index;
-                    in_transform_end[in_batch_axis] = batch_index + 1;
-                    in_transform_start[in_channel_axis] = 0;
-                    in_transform_end[in_channel_axis] = 1;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                // At the outermost level we will walk over every out coordinate O. The out
+                // coordinates are computed independently of each other, so slices of the
+                // out space are processed in parallel where it is worthwhile.
+                parallel_for_shape(out_shape, [&](CoordinateTransform& out_transform) {
+                    // The rounding mode is thread-local, so it is set on the worker itself
+                    auto old_mode = std::fegetround();
+                    std::fesetround(FE_TONEAREST);
+                    for (const Coordinate& out_coord : out_transform)
                     {
-                        size_t filter_dilation_stride = filter_dilation[i - 2];
-                        size_t filter_movement_stride = stride[i - 2];
-                        std::ptrdiff_t below_pad = in_pad_below[i - 2];
-                        std::ptrdiff_t above_pad = in_pad_above[i - 2];
-                        size_t in_dilation_stride = in_dilation[i - 2];
-
-                        in_transform_start[i] = filter_movement_stride * out_coord[i];
-                        in_transform_end[i] = in_transform_start[i] +
-                                              (filter_shape[i] - 1) * filter_dilation_stride + 1;
-                        in_transform_movement_strides[i] = filter_dilation_stride;
-                        in_transform_pad_below[i] = below_pad;
-                        in_transform_pad_above[i] = above_pad;
-                        in_transform_dilation_strides[i] = in_dilation_stride;
-                    }
+                        // Our out coordinate O will have the form:
+                        //
+                        //   (N,chan_out,i_1,...,i_n)
+
+                        size_t batch_index = out_coord[out_batch_axis];
+                        size_t out_channel = out_coord[out_channel_axis];
+
+                        // For the in we need to iterate the coordinate:
+                        //
+                        //   I:
+                        //
+                        // over the range (noninclusive on the right):
+                        //
+                        //   (N,0,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
+                        //
+                        //     (N+1,
+                        //      chans_in_count,
+                        //      s_1*i_1+ l_1*filter_dims_1,
+                        ///       ...,
+                        ///     s_n*i_n +l_n*filter_dims_n)
+                        //
+                        // with strides:
+                        //
+                        //   (1,l_1,...,l_n).
+                        //
+                        // Note that we are iterating within the *padded* and *dilated* in batch, so
+                        // further down we must check the current coordinate is in the pad or dilation
+                        // gap.
+
+                        size_t n_spatial_dimensions = in_shape.size() - 2;
+                        size_t n_in_channels = in_shape[in_channel_axis];
+
+                        Coordinate in_transform_start(2 + n_spatial_dimensions);
+                        Coordinate in_transform_end(2 + n_spatial_dimensions);
+                        Strides in_transform_movement_strides(2 + n_spatial_dimensions, 1);
+                        CoordinateDiff in_transform_pad_below(2 + n_spatial_dimensions, 0);
+                        CoordinateDiff in_transform_pad_above(2 + n_spatial_dimensions, 0);
+                        Strides in_transform_dilation_strides(2 + n_spatial_dimensions, 1);
+
+                        in_transform_start[in_batch_axis] = batch_index;
+                        in_transform_end[in_batch_axis] = batch_index + 1;
+                        in_transform_start[in_channel_axis] = 0;
+                        in_transform_end[in_channel_axis] = 1;
+
+                        for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                        {
+                            size_t filter_dilation_stride = filter_dilation[i - 2];
+                            size_t filter_movement_stride = stride[i - 2];
+                            std::ptrdiff_t below_pad = in_pad_below[i - 2];
+                            std::ptrdiff_t above_pad = in_pad_above[i - 2];
+                            size_t in_dilation_stride = in_dilation[i - 2];
+
+                            in_transform_start[i] = filter_movement_stride * out_coord[i];
+                            in_transform_end[i] = in_transform_start[i] +
+                                                  (filter_shape[i] - 1) * filter_dilation_stride + 1;
+                            in_transform_movement_strides[i] = filter_dilation_stride;
+                            in_transform_pad_below[i] = below_pad;
+                            in_transform_pad_above[i] = above_pad;
+                            in_transform_dilation_strides[i] = in_dilation_stride;
+                        }
 
-                    AxisVector in_transform_axis_order(2 + n_spatial_dimensions);
-                    for (size_t i = 0; i < in_transform_axis_order.size(); i++)
-                    {
-                        in_transform_axis_order[i] = i;
-                    }
-                    CoordinateTransform in_transform(in_shape,
-                                                     in_transform_start,
-                                                     in_transform_end,
-                                                     in_transform_movement_strides,
-                                                     in_transform_axis_order,
-                                                     in_transform_pad_below,
-                                                     in_transform_pad_above,
-                                                     in_transform_dilation_strides);
-
-                    // Simultaneously with iterating I, for the filter we need to iterate the
-                    // coordinate:
-                    //
-                    //   F
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (chan_out,0,0,...,0) ->
-                    //     (chan_out+1,
-                    //      chans_in_count,
-                    //      filter_dims_1,
-                    //        ...,
-                    //      filter_dims_n)
-                    //
-                    // with unit stride.
-
-                    Shape filter_transform_start(2 + n_spatial_dimensions);
-                    Shape filter_transform_end(2 + n_spatial_dimensions);
-
-                    filter_transform_start[filter_out_channel_axis] = out_channel;
-                    filter_transform_end[filter_out_channel_axis] = out_channel + 1;
-                    filter_transform_start[filter_in_channel_axis] = 0;
-                    filter_transform_end[filter_in_channel_axis] = 1;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        filter_transform_start[i] = 0;
-                        filter_transform_end[i] = filter_shape[i];
-                    }
+                        AxisVector in_transform_axis_order(2 + n_spatial_dimensions);
+                        for (size_t i = 0; i < in_transform_axis_order.size(); i++)
+                        {
+                            in_transform_axis_order[i] = i;
+                        }
+                        CoordinateTransform in_transform(in_shape,
+                                                         in_transform_start,
+                                                         in_transform_end,
+                                                         in_transform_movement_strides,
+                                                         in_transform_axis_order,
+                                                         in_transform_pad_below,
+                                                         in_transform_pad_above,
+                                                         in_transform_dilation_strides);
+
+                        // Simultaneously with iterating I, for the filter we need to iterate the
+                        // coordinate:
+                        //
+                        //   F
+                        //
+                        // over the range (noninclusive on the right):
+                        //
+                        //   (chan_out,0,0,...,0) ->
+                        //     (chan_out+1,
+                        //      chans_in_count,
+                        //      filter_dims_1,
+                        //        ...,
+                        //      filter_dims_n)
+                        //
+                        // with unit stride.
+
+                        Shape filter_transform_start(2 + n_spatial_dimensions);
+                        Shape filter_transform_end(2 + n_spatial_dimensions);
+
+                        filter_transform_start[filter_out_channel_axis] = out_channel;
+                        filter_transform_end[filter_out_channel_axis] = out_channel + 1;
+                        filter_transform_start[filter_in_channel_axis] = 0;
+                        filter_transform_end[filter_in_channel_axis] = 1;
+
+                        for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                        {
+                            filter_transform_start[i] = 0;
+                            filter_transform_end[i] = filter_shape[i];
+                        }
 
-                    CoordinateTransform filter_transform(
-                        filter_shape, filter_transform_start, filter_transform_end);
+                        CoordinateTransform filter_transform(
+                            filter_shape, filter_transform_start, filter_transform_end);
 
-                    // As we go, we sum up:
-                    //
-                    //   out[O] += in[I] * filter[F].
+                        // As we go, we sum up:
+                        //
+                        //   out[O] += in[I] * filter[F].
 
-                    ACCUMULATION result = 0;
+                        ACCUMULATION result = 0;
 
-                    CoordinateTransform::Iterator in_it = in_transform.begin();
-                    CoordinateTransform::Iterator filter_it = filter_transform.begin();
-                    CoordinateTransform::Iterator in_it_end = in_transform.end();
-                    CoordinateTransform::Iterator filter_it_end = filter_transform.end();
+                        CoordinateTransform::Iterator in_it = in_transform.begin();
+                        CoordinateTransform::Iterator filter_it = filter_transform.begin();
+                        CoordinateTransform::Iterator in_it_end = in_transform.end();
+                        CoordinateTransform::Iterator filter_it_end = filter_transform.end();
 
-                    size_t in_channel_stride = row_major_strides(in_shape).at(in_channel_axis);
-                    size_t filter_in_channel_stride =
-                        row_major_strides(filter_shape).at(filter_in_channel_axis);
+                        size_t in_channel_stride = row_major_strides(in_shape).at(in_channel_axis);
+                        size_t filter_in_channel_stride =
+                            row_major_strides(filter_shape).at(filter_in_channel_axis);
 
-                    while (in_it != in_it_end && filter_it != filter_it_end)
-                    {
-                        const Coordinate& in_coord = *in_it;
-                        if (in_transform.has_source_coordinate(in_coord))
+                        while (in_it != in_it_end && filter_it != filter_it_end)
                         {
-                            size_t in_idx = in_transform.index(in_coord);
-                            const Coordinate& filter_coord = *filter_it;
-                            size_t filter_idx = filter_transform.index(filter_coord);
-                            for (size_t in_channel = 0; in_channel < n_in_channels; ++in_channel)
+                            const Coordinate& in_coord = *in_it;
+                            if (in_transform.has_source_coordinate(in_coord))
                             {
-                                ACCUMULATION in_v = static_cast<ACCUMULATION>(in[in_idx]);
-                                ACCUMULATION f_v = static_cast<ACCUMULATION>(filter[filter_idx]);
-                                if (is_quantized)
+                                size_t in_idx = in_transform.index(in_coord);
+                                const Coordinate& filter_coord = *filter_it;
+                                size_t filter_idx = filter_transform.index(filter_coord);
+                                for (size_t in_channel = 0; in_channel < n_in_channels; ++in_channel)
                                 {
-                                    in_v = in_v - static_cast<ACCUMULATION>(*input_zero_point);
-                                    f_v = f_v - static_cast<ACCUMULATION>(*filter_zero_point);
+                                    ACCUMULATION in_v = static_cast<ACCUMULATION>(in[in_idx]);
+                                    ACCUMULATION f_v = static_cast<ACCUMULATION>(filter[filter_idx]);
+                                    if (is_quantized)
+                                    {
+                                        in_v = in_v - static_cast<ACCUMULATION>(*input_zero_point);
+                                        f_v = f_v - static_cast<ACCUMULATION>(*filter_zero_point);
+                                    }
+                                    result += in_v * f_v;
+                                    in_idx += in_channel_stride;
+                                    filter_idx += filter_in_channel_stride;
                                 }
-                                result += in_v * f_v;
-                                in_idx += in_channel_stride;
-                                filter_idx += filter_in_channel_stride;
                             }
+                            ++in_it;
+                            ++filter_it;
+                        }
+                        if (is_quantized)
+                        {
+                            float scale = *input_scale * *filter_scale / *output_scale;
+                            out[out_transform.index(out_coord)] =
+                                static_cast<OUTPUT>(std::round(static_cast<float>(result) * scale)) +
+                                *output_zero_point;
+                        }
+                        else
+                        {
+                            out[out_transform.index(out_coord)] = result;
                         }
-                        ++in_it;
-                        ++filter_it;
-                    }
-                    if (is_quantized)
-                    {
-                        float scale = *input_scale * *filter_scale / *output_scale;
-                        out[out_transform.index(out_coord)] =
-                            static_cast<OUTPUT>(std::round(static_cast<float>(result) * scale)) +
-                            *output_zero_point;
-                    }
-                    else
-                    {
-                        out[out_transform.index(out_coord)] = result;
                     }
-                }
-                std::fesetround(old_mode);
+                    std::fesetround(old_mode);
+                });
             }
 
             template <typename INPUT,
@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/env_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Number of threads used by the parallel reference kernel helpers.
+            ///        Defaults to the hardware concurrency; NGRAPH_REF_PARALLEL_THREADS
+            ///        overrides it and a value of 0 or 1 disables threading.
+            inline size_t parallel_thread_count()
+            {
+                static const size_t count = []() -> size_t {
+                    int32_t env = getenv_int("NGRAPH_REF_PARALLEL_THREADS", -1);
+                    if (env >= 0)
+                    {
+                        return env > 1 ? static_cast<size_t>(env) : 1;
+                    }
+                    size_t hw = std::thread::hardware_concurrency();
+                    return hw > 1 ? hw : 1;
+                }();
+                return count;
+            }
+
+            /// \brief Runs `body` over slices of `shape` on a temporary team of threads.
+            ///
+            /// The shape is split along its outermost splittable axis. Each slice is
+            /// presented as a CoordinateTransform whose index() addresses the unsliced
+            /// tensor, so a kernel body written against a whole-shape transform works
+            /// unchanged; the body runs once per slice and its iterations must be
+            /// independent. Falls back to a single inline call over the whole shape
+            /// when threading is disabled or no axis can be split.
+            inline void parallel_for_shape(const Shape& shape,
+                                           const std::function<void(CoordinateTransform&)>& body)
+            {
+                const size_t n_threads = parallel_thread_count();
+                size_t split_axis = shape.size();
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    if (shape[i] > 1)
+                    {
+                        split_axis = i;
+                        break;
+                    }
+                }
+                if (n_threads <= 1 || split_axis == shape.size())
+                {
+                    CoordinateTransform whole_shape(shape);
+                    body(whole_shape);
+                    return;
+                }
+                const size_t extent = shape[split_axis];
+                const size_t n_chunks = std::min(n_threads, extent);
+                std::vector<std::thread> workers;
+                workers.reserve(n_chunks);
+                // kernel bodies throw on valid input (e.g. AvgPool windows landing
+                // entirely in padding), and an exception escaping a std::thread
+                // terminates the process; capture the first one and rethrow after
+                // the joins so errors surface the same way as in the serial path
+                std::exception_ptr first_error;
+                std::mutex error_mutex;
+                for (size_t chunk = 0; chunk < n_chunks; chunk++)
+                {
+                    Coordinate start_corner(shape.size(), 0);
+                    Coordinate end_corner(shape);
+                    start_corner[split_axis] = chunk * extent / n_chunks;
+                    end_corner[split_axis] = (chunk + 1) * extent / n_chunks;
+                    CoordinateTransform slice(shape, start_corner, end_corner);
+                    workers.emplace_back([slice, &body, &first_error, &error_mutex]() mutable {
+                        try
+                        {
+                            body(slice);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(error_mutex);
+                            if (!first_error)
+                            {
+                                first_error = std::current_exception();
+                            }
+                        }
+                    });
+                }
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+                if (first_error)
+                {
+                    std::rethrow_exception(first_error);
+                }
+            }
+        }
+    }
+}
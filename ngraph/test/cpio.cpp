@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include <gtest/gtest.h>
 
@@ -66,6 +68,40 @@ TEST(cpio, read)
     }
 }
 
+TEST(cpio, mapped_read)
+{
+    const string test_file = file_util::path_join(TEST_FILES, "test.cpio");
+
+    cpio::MappedReader reader(test_file);
+    const auto& file_info = reader.get_file_info();
+    ASSERT_EQ(3, file_info.size());
+    EXPECT_STREQ(file_info[0].get_name().c_str(), "test1.txt");
+    EXPECT_STREQ(file_info[1].get_name().c_str(), "test2.txt");
+    EXPECT_STREQ(file_info[2].get_name().c_str(), "test3.txt");
+
+    // get_data is a zero-copy view into the mapped archive
+    string content(reader.get_data(file_info[1]), file_info[1].get_size());
+    EXPECT_STREQ(content.c_str(), "this is a test");
+
+    runtime::AlignedBuffer data(file_info[0].get_size());
+    ASSERT_TRUE(reader.read(file_info[0].get_name(), data.get_ptr(), file_info[0].get_size()));
+    content = string(data.get_ptr<char>(), file_info[0].get_size());
+    EXPECT_STREQ(content.c_str(), "12345");
+
+    // parallel extraction visits every member exactly once
+    map<string, string> extracted;
+    mutex guard;
+    reader.read_all([&](const cpio::FileInfo& info, const char* member_data) {
+        lock_guard<mutex> lock(guard);
+        extracted[info.get_name()] = string(member_data, info.get_size());
+    });
+    ASSERT_EQ(3, extracted.size());
+    EXPECT_STREQ(extracted["test1.txt"].c_str(), "12345");
+    EXPECT_STREQ(extracted["test2.txt"].c_str(), "this is a test");
+    EXPECT_STREQ(extracted["test3.txt"].c_str(),
+                 "the quick brown fox jumped over the lazy dog");
+}
+
 TEST(cpio, write)
 {
     const string test_file = "test1.cpio";
@@ -67,3 +67,29 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+// Per-pass validation only revisits nodes whose inputs changed: untouched nodes
+// stay clean after a pass, while replacing an input dirties the consumer again.
+TEST(pass_manager, revalidate_only_dirty_nodes)
+{
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(true);
+    pass_manager.register_pass<DummyPass>();
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+
+    for (auto& node : graph->get_ordered_ops())
+    {
+        EXPECT_FALSE(node->needs_validation());
+    }
+
+    auto result = graph->get_results().at(0);
+    auto parameter = graph->get_parameters().at(0);
+    result->input(0).replace_source_output(parameter->output(0));
+    EXPECT_TRUE(result->needs_validation());
+    EXPECT_FALSE(parameter->needs_validation());
+
+    pass_manager.run_passes(graph);
+    EXPECT_FALSE(result->needs_validation());
+}
@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/pool_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(pool_allocator, alignment)
+{
+    void* p = ObjectPool::allocate(24);
+    size_t addr = reinterpret_cast<size_t>(p) % alignof(max_align_t);
+    EXPECT_EQ(addr, 0);
+    ObjectPool::deallocate(p, 24);
+}
+
+TEST(pool_allocator, recycling)
+{
+    void* p1 = ObjectPool::allocate(40);
+    ObjectPool::deallocate(p1, 40);
+    void* p2 = ObjectPool::allocate(40);
+    EXPECT_EQ(p1, p2);
+    ObjectPool::deallocate(p2, 40);
+}
+
+TEST(pool_allocator, large_sizes_fall_through)
+{
+    void* p = ObjectPool::allocate(1 << 20);
+    EXPECT_NE(p, nullptr);
+    ObjectPool::deallocate(p, 1 << 20);
+}
+
+TEST(pool_allocator, allocate_shared)
+{
+    auto p = allocate_shared<int>(PoolAllocator<int>(), 42);
+    EXPECT_EQ(*p, 42);
+}